@@ -0,0 +1,340 @@
+/*************************************************************************
+【文件名】BenchmarkMain.cpp
+【功能模块和目的】基准测试程序的主函数，注册几何核心和文件读写的基准测试
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】2026/10/19 谭雯心 测试模型改由MeshGenerator生成
+*************************************************************************/
+// BenchmarkRunner所属头文件
+#include "BenchmarkRunner.hpp"
+// BenchmarkState所属头文件
+#include "BenchmarkState.hpp"
+// Face3D所属头文件
+#include "Face3D.hpp"
+// Model3D所属头文件
+#include "Model3D.hpp"
+// MeshGenerator所属头文件
+#include "MeshGenerator.hpp"
+// Model3D_OBJ_Exporter所属头文件
+#include "Model3D_OBJ_Exporter.hpp"
+// Model3D_OBJ_Importer所属头文件
+#include "Model3D_OBJ_Importer.hpp"
+// Point3D所属头文件
+#include "Point3D.hpp"
+// Set所属头文件
+#include "Set.hpp"
+// ofstream所属头文件
+#include <fstream>
+// cout所属头文件
+#include <iostream>
+// string所属头文件
+#include <string>
+// remove所属头文件
+#include <cstdio>
+// strtod, strtoull所属头文件
+#include <cstdlib>
+// size_t所属头文件
+#include <cstddef>
+
+using namespace std;
+
+namespace {
+    // 读写基准测试使用的临时文件
+    const string TEMP_FILE_NAME = "benchmark_mesh.obj";
+    // 防止被测结果被编译器优化掉
+    volatile double g_Sink = 0;
+
+    /*************************************************************************
+    【函数名称】MakeGrid
+    【函数功能】用MeshGenerator生成含FaceCount个面的起伏网格
+    【参数】size_t FaceCount, 表示面数
+    【返回值】Model3D，生成的模型
+    【开发者及日期】谭雯心 2026/10/19
+    【更改记录】2026/10/19 谭雯心 改用MeshGenerator生成，不再附加边界线
+    *************************************************************************/
+    Model3D MakeGrid(size_t FaceCount) {
+        return MeshGenerator(MeshGenerator::Shape::GRID, FaceCount)
+            .GenerateModel();
+    }
+    /*************************************************************************
+    【函数名称】MakePointSet
+    【函数功能】生成含Count个不同点的集合。点互不相同由构造保证，
+           因此直接调用Group::Add跳过查重，使准备时间为线性
+    【参数】size_t Count, 表示点数
+    【返回值】Set<Point3D>，生成的集合
+    【开发者及日期】谭雯心 2026/10/19
+    【更改记录】
+    *************************************************************************/
+    Set<Point3D> MakePointSet(size_t Count) {
+        Set<Point3D> Points;
+        for (size_t i = 0; i < Count; i++) {
+            Points.Group<Point3D>::Add(Point3D(static_cast<double>(i),
+                static_cast<double>(i % 7), static_cast<double>(i % 13)));
+        }
+        return Points;
+    }
+    /*************************************************************************
+    【函数名称】SetAdd
+    【函数功能】基准测试：向含N个点的集合添加一个新点（含查重）
+    【参数】BenchmarkState& State, 表示计时状态
+    【返回值】无
+    【开发者及日期】谭雯心 2026/10/19
+    【更改记录】
+    *************************************************************************/
+    void SetAdd(BenchmarkState& State) {
+        Set<Point3D> Points = MakePointSet(State.GetRange());
+        Point3D NewPoint(-1, -1, -1);
+        while (State.KeepRunning()) {
+            Points.Add(NewPoint);
+            State.PauseTiming();
+            Points.Remove(Points.CountElement() - 1);
+            State.ResumeTiming();
+        }
+        State.SetItemsProcessed(State.GetIterations());
+    }
+    /*************************************************************************
+    【函数名称】SetContains
+    【函数功能】基准测试：在含N个点的集合中查找不存在的点（最坏情况）
+    【参数】BenchmarkState& State, 表示计时状态
+    【返回值】无
+    【开发者及日期】谭雯心 2026/10/19
+    【更改记录】
+    *************************************************************************/
+    void SetContains(BenchmarkState& State) {
+        Set<Point3D> Points = MakePointSet(State.GetRange());
+        Point3D Missing(-1, -1, -1);
+        while (State.KeepRunning()) {
+            g_Sink = Points.Contains(Missing);
+        }
+        State.SetItemsProcessed(State.GetIterations());
+    }
+    /*************************************************************************
+    【函数名称】ModelAddFace
+    【函数功能】基准测试：逐个调用Model3D::AddFace构建含N个面的模型
+    【参数】BenchmarkState& State, 表示计时状态
+    【返回值】无
+    【开发者及日期】谭雯心 2026/10/19
+    【更改记录】
+    *************************************************************************/
+    void ModelAddFace(BenchmarkState& State) {
+        Model3D Source = MakeGrid(State.GetRange());
+        vector<Face3D> Faces;
+        for (const auto& Face : Source.Faces()) {
+            Faces.push_back(*Face);
+        }
+        while (State.KeepRunning()) {
+            Model3D Model;
+            for (const Face3D& Face : Faces) {
+                Model.AddFace(Face);
+            }
+            g_Sink = static_cast<double>(Model.GetFaceCount());
+        }
+        State.SetItemsProcessed(State.GetIterations() * Faces.size());
+    }
+    /*************************************************************************
+    【函数名称】ModelArea
+    【函数功能】基准测试：计算含N个面的模型的总面积
+    【参数】BenchmarkState& State, 表示计时状态
+    【返回值】无
+    【开发者及日期】谭雯心 2026/10/19
+    【更改记录】
+    *************************************************************************/
+    void ModelArea(BenchmarkState& State) {
+        Model3D Model = MakeGrid(State.GetRange());
+        while (State.KeepRunning()) {
+            g_Sink = Model.Area();
+        }
+        State.SetItemsProcessed(State.GetIterations() * Model.GetFaceCount());
+    }
+    /*************************************************************************
+    【函数名称】ModelLength
+    【函数功能】基准测试：计算含N条线的线框模型的总长度
+    【参数】BenchmarkState& State, 表示计时状态
+    【返回值】无
+    【开发者及日期】谭雯心 2026/10/19
+    【更改记录】
+    *************************************************************************/
+    void ModelLength(BenchmarkState& State) {
+        Model3D Model = MeshGenerator(MeshGenerator::Shape::WIREFRAME,
+            State.GetRange()).GenerateModel();
+        while (State.KeepRunning()) {
+            g_Sink = Model.Length();
+        }
+        State.SetItemsProcessed(State.GetIterations() * Model.GetLineCount());
+    }
+    /*************************************************************************
+    【函数名称】ModelBoundingBox
+    【函数功能】基准测试：计算含N个面的模型的包围盒体积
+    【参数】BenchmarkState& State, 表示计时状态
+    【返回值】无
+    【开发者及日期】谭雯心 2026/10/19
+    【更改记录】
+    *************************************************************************/
+    void ModelBoundingBox(BenchmarkState& State) {
+        Model3D Model = MakeGrid(State.GetRange());
+        while (State.KeepRunning()) {
+            g_Sink = Model.BoundingBoxVolume();
+        }
+        State.SetItemsProcessed(
+            State.GetIterations() * Model.GetElementCount());
+    }
+    /*************************************************************************
+    【函数名称】ObjImport
+    【函数功能】基准测试：从OBJ文件导入含N个面的模型
+    【参数】BenchmarkState& State, 表示计时状态
+    【返回值】无
+    【开发者及日期】谭雯心 2026/10/19
+    【更改记录】
+    *************************************************************************/
+    void ObjImport(BenchmarkState& State) {
+        Model3D_OBJ_Exporter().SaveToFile(TEMP_FILE_NAME,
+            MakeGrid(State.GetRange()));
+        Model3D_OBJ_Importer Importer;
+        size_t FaceCount = 0;
+        while (State.KeepRunning()) {
+            Model3D Model = Importer.LoadFromFile(TEMP_FILE_NAME);
+            FaceCount = Model.GetFaceCount();
+        }
+        remove(TEMP_FILE_NAME.c_str());
+        State.SetItemsProcessed(State.GetIterations() * FaceCount);
+    }
+    /*************************************************************************
+    【函数名称】ObjExport
+    【函数功能】基准测试：把含N个面的模型导出到OBJ文件
+    【参数】BenchmarkState& State, 表示计时状态
+    【返回值】无
+    【开发者及日期】谭雯心 2026/10/19
+    【更改记录】
+    *************************************************************************/
+    void ObjExport(BenchmarkState& State) {
+        Model3D Model = MakeGrid(State.GetRange());
+        Model3D_OBJ_Exporter Exporter;
+        while (State.KeepRunning()) {
+            Exporter.SaveToFile(TEMP_FILE_NAME, Model);
+        }
+        remove(TEMP_FILE_NAME.c_str());
+        State.SetItemsProcessed(State.GetIterations() * Model.GetFaceCount());
+    }
+    /*************************************************************************
+    【函数名称】ModelCopy
+    【函数功能】基准测试：拷贝含N个面的模型
+    【参数】BenchmarkState& State, 表示计时状态
+    【返回值】无
+    【开发者及日期】谭雯心 2026/10/19
+    【更改记录】
+    *************************************************************************/
+    void ModelCopy(BenchmarkState& State) {
+        Model3D Model = MakeGrid(State.GetRange());
+        while (State.KeepRunning()) {
+            Model3D Copy(Model);
+            g_Sink = static_cast<double>(Copy.GetFaceCount());
+        }
+        State.SetItemsProcessed(State.GetIterations() * Model.GetFaceCount());
+    }
+    /*************************************************************************
+    【函数名称】ModelMerge
+    【函数功能】基准测试：合并两个各含N个面、有一半面相同的模型
+    【参数】BenchmarkState& State, 表示计时状态
+    【返回值】无
+    【开发者及日期】谭雯心 2026/10/19
+    【更改记录】
+    *************************************************************************/
+    void ModelMerge(BenchmarkState& State) {
+        size_t Range = State.GetRange();
+        Model3D Full = MakeGrid(Range + Range / 2);
+        vector<Face3D> Faces;
+        for (const auto& Face : Full.Faces()) {
+            Faces.push_back(*Face);
+        }
+        Model3D First(vector<Line3D>(), vector<Face3D>(
+            Faces.begin(), Faces.begin() + Range));
+        Model3D Second(vector<Line3D>(), vector<Face3D>(
+            Faces.end() - Range, Faces.end()));
+        while (State.KeepRunning()) {
+            Model3D Merged = First + Second;
+            g_Sink = static_cast<double>(Merged.GetFaceCount());
+        }
+        State.SetItemsProcessed(State.GetIterations() * Range * 2);
+    }
+    /*************************************************************************
+    【函数名称】PrintUsage
+    【函数功能】输出命令行用法
+    【参数】const char* Program, 表示程序名
+    【返回值】无
+    【开发者及日期】谭雯心 2026/10/19
+    【更改记录】
+    *************************************************************************/
+    void PrintUsage(const char* Program) {
+        cout << "Usage: " << Program << " [options]\n"
+             << "  --benchmark_filter=<substring>  run matching benchmarks\n"
+             << "  --benchmark_out=<file.json>     write results as JSON\n"
+             << "  --benchmark_min_time=<seconds>  minimum time per benchmark\n"
+             << "  --benchmark_max_range=<n>       skip larger problem sizes\n"
+             << "  --benchmark_list_tests          list benchmark names\n";
+    }
+}
+
+/*************************************************************************
+【函数名称】main
+【函数功能】注册全部基准测试，解析命令行参数，运行并输出结果
+【参数】int argc, char** argv, 表示命令行参数
+【返回值】int，0表示成功，1表示参数错误或无法写入JSON文件
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+int main(int argc, char** argv) {
+    BenchmarkRunner Runner;
+    Runner.Register("Set<Point3D>/Add", SetAdd, {1000, 10000, 100000, 1000000});
+    Runner.Register("Set<Point3D>/Contains", SetContains,
+        {1000, 10000, 100000, 1000000});
+    Runner.Register("Model3D/AddFace", ModelAddFace, {100, 1000, 10000});
+    Runner.Register("Model3D/Area", ModelArea, {1000, 10000, 100000, 1000000});
+    Runner.Register("Model3D/Length", ModelLength,
+        {1000, 10000, 100000, 1000000});
+    Runner.Register("Model3D/BoundingBoxVolume", ModelBoundingBox,
+        {1000, 10000, 100000, 1000000});
+    Runner.Register("OBJ/Import", ObjImport, {1000, 10000});
+    Runner.Register("OBJ/Export", ObjExport, {1000, 10000});
+    Runner.Register("Model3D/Copy", ModelCopy, {1000, 10000, 100000});
+    Runner.Register("Model3D/Merge", ModelMerge, {100, 1000, 10000});
+    string OutFile;
+    bool ListOnly = false;
+    for (int i = 1; i < argc; i++) {
+        string Argument = argv[i];
+        size_t Equal = Argument.find('=');
+        string Key = Argument.substr(0, Equal);
+        string Value = Equal == string::npos ? "" : Argument.substr(Equal + 1);
+        if (Key == "--benchmark_filter") {
+            Runner.SetFilter(Value);
+        }
+        else if (Key == "--benchmark_out") {
+            OutFile = Value;
+        }
+        else if (Key == "--benchmark_min_time") {
+            Runner.SetMinTime(strtod(Value.c_str(), nullptr));
+        }
+        else if (Key == "--benchmark_max_range") {
+            Runner.SetMaxRange(strtoull(Value.c_str(), nullptr, 10));
+        }
+        else if (Key == "--benchmark_list_tests") {
+            ListOnly = true;
+        }
+        else {
+            PrintUsage(argv[0]);
+            return 1;
+        }
+    }
+    if (ListOnly) {
+        Runner.List(cout);
+        return 0;
+    }
+    Runner.Run(cout);
+    if (!OutFile.empty()) {
+        ofstream File(OutFile, ios::trunc);
+        Runner.WriteJson(File, argv[0]);
+        if (!File) {
+            cerr << "Cannot write " << OutFile << '\n';
+            return 1;
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,278 @@
+/*************************************************************************
+【文件名】BenchmarkRunner.cpp
+【功能模块和目的】定义BenchmarkRunner类的成员函数
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+// BenchmarkRunner所属头文件
+#include "BenchmarkRunner.hpp"
+// BenchmarkState所属头文件
+#include "BenchmarkState.hpp"
+// max, min所属头文件
+#include <algorithm>
+// setw所属头文件
+#include <iomanip>
+// ostream所属头文件
+#include <iostream>
+// string所属头文件
+#include <string>
+// hardware_concurrency所属头文件
+#include <thread>
+// vector所属头文件
+#include <vector>
+// time, strftime所属头文件
+#include <ctime>
+// size_t所属头文件
+#include <cstddef>
+
+using namespace std;
+
+namespace {
+    /*************************************************************************
+    【函数名称】JsonString
+    【函数功能】把字符串转换为带引号的JSON字符串
+    【参数】const string& Text, 表示字符串
+    【返回值】string，JSON字符串
+    【开发者及日期】谭雯心 2026/10/19
+    【更改记录】
+    *************************************************************************/
+    string JsonString(const string& Text) {
+        string Result = "\"";
+        for (char c : Text) {
+            if (c == '"' || c == '\\') {
+                Result += '\\';
+                Result += c;
+            }
+            else if (static_cast<unsigned char>(c) < 0x20) {
+                const char* HEX = "0123456789abcdef";
+                Result += "\\u00";
+                Result += HEX[(c >> 4) & 0xf];
+                Result += HEX[c & 0xf];
+            }
+            else {
+                Result += c;
+            }
+        }
+        return Result + "\"";
+    }
+}
+
+//-------------------------------------------------------------------------
+// 静态常量
+//-------------------------------------------------------------------------
+
+// 默认最短时间
+constexpr double BenchmarkRunner::DEFAULT_MIN_TIME;
+// 最大迭代次数
+constexpr size_t BenchmarkRunner::MAX_ITERATIONS;
+
+//-------------------------------------------------------------------------
+// 非静态Setter成员函数
+//-------------------------------------------------------------------------
+
+/*************************************************************************
+【函数名称】Register
+【函数功能】注册基准测试，每个问题规模展开为名为“名称/规模”的一项
+【参数】const string& Name, 表示名称
+       const Function& Body, 表示被测函数
+       const vector<size_t>& Ranges, 表示问题规模列表
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+void BenchmarkRunner::Register(const string& Name, const Function& Body,
+                               const vector<size_t>& Ranges) {
+    for (size_t Range : Ranges) {
+        m_Entries.push_back(Entry{Name + "/" + to_string(Range), Range, Body});
+    }
+}
+/*************************************************************************
+【函数名称】SetFilter
+【函数功能】设置名称过滤子串
+【参数】const string& Filter, 表示过滤子串，空串表示全部
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+void BenchmarkRunner::SetFilter(const string& Filter) {
+    m_Filter = Filter;
+}
+/*************************************************************************
+【函数名称】SetMinTime
+【函数功能】设置最短时间
+【参数】double MinTime, 表示最短时间（秒）
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+void BenchmarkRunner::SetMinTime(double MinTime) {
+    m_MinTime = max(MinTime, 0.0);
+}
+/*************************************************************************
+【函数名称】SetMaxRange
+【函数功能】设置最大问题规模
+【参数】size_t MaxRange, 表示最大问题规模
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+void BenchmarkRunner::SetMaxRange(size_t MaxRange) {
+    m_MaxRange = MaxRange;
+}
+/*************************************************************************
+【函数名称】Run
+【函数功能】运行全部匹配的基准测试，每完成一项输出一行表格
+【参数】ostream& Console, 表示表格输出流
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+void BenchmarkRunner::Run(ostream& Console) {
+    m_Results.clear();
+    Console << left << setw(40) << "Benchmark" << right
+            << setw(16) << "Time(ns)" << setw(16) << "CPU(ns)"
+            << setw(14) << "Iterations" << setw(16) << "Items/s" << '\n';
+    Console << string(102, '-') << '\n';
+    for (const Entry& AEntry : m_Entries) {
+        if (!Matches(AEntry)) {
+            continue;
+        }
+        Result AResult = RunEntry(AEntry);
+        m_Results.push_back(AResult);
+        Console << left << setw(40) << AResult.Name << right << fixed
+                << setprecision(1) << setw(16) << AResult.RealTime
+                << setw(16) << AResult.CpuTime
+                << setw(14) << AResult.Iterations
+                << setprecision(0) << setw(16) << AResult.ItemsPerSecond
+                << defaultfloat << '\n';
+        Console.flush();
+    }
+}
+
+//-------------------------------------------------------------------------
+// 非静态Getter成员函数
+//-------------------------------------------------------------------------
+
+/*************************************************************************
+【函数名称】List
+【函数功能】列出全部匹配的基准测试名称，每行一个
+【参数】ostream& Console, 表示输出流
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+void BenchmarkRunner::List(ostream& Console) const {
+    for (const Entry& AEntry : m_Entries) {
+        if (Matches(AEntry)) {
+            Console << AEntry.Name << '\n';
+        }
+    }
+}
+/*************************************************************************
+【函数名称】GetResults
+【函数功能】获取运行结果
+【参数】无
+【返回值】const vector<Result>&，运行结果
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+const vector<BenchmarkRunner::Result>& BenchmarkRunner::GetResults() const {
+    return m_Results;
+}
+/*************************************************************************
+【函数名称】WriteJson
+【函数功能】按Google Benchmark的JSON结构输出运行环境和结果
+【参数】ostream& Stream, 表示输出流
+       const string& Executable, 表示可执行文件名
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+void BenchmarkRunner::WriteJson(ostream& Stream,
+                                const string& Executable) const {
+    char Date[64];
+    time_t Now = time(nullptr);
+    strftime(Date, sizeof(Date), "%Y-%m-%dT%H:%M:%S%z", localtime(&Now));
+#ifdef NDEBUG
+    const string BUILD_TYPE = "release";
+#else
+    const string BUILD_TYPE = "debug";
+#endif
+    Stream << "{\n";
+    Stream << "  \"context\": {\n";
+    Stream << "    \"date\": " << JsonString(Date) << ",\n";
+    Stream << "    \"executable\": " << JsonString(Executable) << ",\n";
+    Stream << "    \"num_cpus\": " << thread::hardware_concurrency() << ",\n";
+    Stream << "    \"min_time\": " << m_MinTime << ",\n";
+    Stream << "    \"library_build_type\": " << JsonString(BUILD_TYPE) << "\n";
+    Stream << "  },\n";
+    Stream << "  \"benchmarks\": [";
+    Stream << setprecision(17);
+    for (size_t i = 0; i < m_Results.size(); i++) {
+        const Result& AResult = m_Results[i];
+        Stream << (i == 0 ? "\n" : ",\n");
+        Stream << "    {\n";
+        Stream << "      \"name\": " << JsonString(AResult.Name) << ",\n";
+        Stream << "      \"run_type\": \"iteration\",\n";
+        Stream << "      \"range\": " << AResult.Range << ",\n";
+        Stream << "      \"iterations\": " << AResult.Iterations << ",\n";
+        Stream << "      \"real_time\": " << AResult.RealTime << ",\n";
+        Stream << "      \"cpu_time\": " << AResult.CpuTime << ",\n";
+        Stream << "      \"time_unit\": \"ns\",\n";
+        Stream << "      \"items_per_second\": " << AResult.ItemsPerSecond
+               << "\n";
+        Stream << "    }";
+    }
+    Stream << "\n  ]\n}\n";
+}
+
+//-------------------------------------------------------------------------
+// 私有非静态成员函数
+//-------------------------------------------------------------------------
+
+/*************************************************************************
+【函数名称】Matches
+【函数功能】基准测试项是否匹配名称过滤子串和最大问题规模
+【参数】const Entry& AEntry, 表示基准测试项
+【返回值】bool，是否匹配
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+bool BenchmarkRunner::Matches(const Entry& AEntry) const {
+    return AEntry.Name.find(m_Filter) != string::npos
+        && AEntry.Range <= m_MaxRange;
+}
+/*************************************************************************
+【函数名称】RunEntry
+【函数功能】运行一项基准测试：迭代次数从1开始，按上一次运行的耗时估计
+       达到最短时间所需的次数（每次最多增加到10倍），直到耗时足够为止
+【参数】const Entry& AEntry, 表示基准测试项
+【返回值】Result，该项的结果
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+BenchmarkRunner::Result BenchmarkRunner::RunEntry(const Entry& AEntry) const {
+    size_t Iterations = 1;
+    while (true) {
+        BenchmarkState State(AEntry.Range, Iterations);
+        AEntry.Body(State);
+        double Seconds = State.GetRealSeconds();
+        if (Seconds >= m_MinTime || Iterations >= MAX_ITERATIONS) {
+            Result AResult;
+            AResult.Name = AEntry.Name;
+            AResult.Range = AEntry.Range;
+            AResult.Iterations = Iterations;
+            AResult.RealTime = Seconds * 1e9 / Iterations;
+            AResult.CpuTime = State.GetCpuSeconds() * 1e9 / Iterations;
+            AResult.ItemsPerSecond = Seconds > 0
+                ? State.GetItemsProcessed() / Seconds : 0;
+            return AResult;
+        }
+        // 预估所需次数并留出40%余量
+        double Multiplier = Seconds > 0
+            ? m_MinTime * 1.4 / Seconds : 10.0;
+        Multiplier = min(max(Multiplier, 1.5), 10.0);
+        Iterations = min(static_cast<size_t>(Iterations * Multiplier) + 1,
+                         MAX_ITERATIONS);
+    }
+}
@@ -0,0 +1,144 @@
+/*************************************************************************
+【文件名】BenchmarkRunner.hpp
+【功能模块和目的】定义BenchmarkRunner类，注册、运行基准测试并输出结果
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+#ifndef BENCHMARKRUNNER_HPP
+#define BENCHMARKRUNNER_HPP
+
+// BenchmarkState所属头文件
+#include "BenchmarkState.hpp"
+// function所属头文件
+#include <functional>
+// ostream所属头文件
+#include <iostream>
+// numeric_limits所属头文件
+#include <limits>
+// string所属头文件
+#include <string>
+// vector所属头文件
+#include <vector>
+// size_t所属头文件
+#include <cstddef>
+
+using namespace std;
+
+/*************************************************************************
+【类名】BenchmarkRunner
+【功能】基准测试的注册和运行器。每个基准测试按问题规模展开为
+       “名称/规模”的若干项，每项从1次迭代开始逐步增加迭代次数，
+       直到计时时间不少于最短时间，以最后一次运行的平均时间为结果。
+       结果输出为控制台表格，也可输出为与Google Benchmark相同结构的JSON，
+       便于在版本之间比较
+【接口说明】
+    默认构造函数
+    禁止拷贝构造函数
+    禁止赋值运算符
+    虚析构函数
+    注册基准测试
+    设置名称过滤子串、最短时间、最大问题规模
+    运行全部匹配的基准测试
+    列出全部匹配的基准测试名称
+    获取运行结果
+    输出JSON
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+class BenchmarkRunner {
+public:
+    //-------------------------------------------------------------------------
+    // 公有类型
+    //-------------------------------------------------------------------------
+    // 被测函数
+    using Function = function<void(BenchmarkState&)>;
+    // 一项基准测试的结果
+    struct Result {
+        // 名称（含问题规模）
+        string Name;
+        // 问题规模
+        size_t Range;
+        // 迭代次数
+        size_t Iterations;
+        // 每次迭代的墙钟时间（纳秒）
+        double RealTime;
+        // 每次迭代的CPU时间（纳秒）
+        double CpuTime;
+        // 每秒处理的元素数，未设置处理的元素数时为0
+        double ItemsPerSecond;
+    };
+    //-------------------------------------------------------------------------
+    // 静态常量
+    //-------------------------------------------------------------------------
+    // 默认最短时间（秒）
+    static constexpr double DEFAULT_MIN_TIME{0.5};
+    // 最大迭代次数
+    static constexpr size_t MAX_ITERATIONS{1000000000};
+    //-------------------------------------------------------------------------
+    // 必要的构造、析构、拷贝、赋值运算符重载函数
+    //-------------------------------------------------------------------------
+    // 默认构造函数
+    BenchmarkRunner() = default;
+    // 禁止拷贝构造函数
+    BenchmarkRunner(const BenchmarkRunner& Source) = delete;
+    // 禁止赋值运算符
+    BenchmarkRunner& operator=(const BenchmarkRunner& Source) = delete;
+    // 虚析构函数
+    virtual ~BenchmarkRunner() = default;
+    //-------------------------------------------------------------------------
+    // 非静态Setter成员函数
+    //-------------------------------------------------------------------------
+    // 注册基准测试，对每个问题规模各运行一次
+    void Register(const string& Name, const Function& Body,
+                  const vector<size_t>& Ranges);
+    // 设置名称过滤子串（只运行名称包含该子串的项，空串表示全部）
+    void SetFilter(const string& Filter);
+    // 设置最短时间（秒）
+    void SetMinTime(double MinTime);
+    // 设置最大问题规模（跳过规模更大的项）
+    void SetMaxRange(size_t MaxRange);
+    // 运行全部匹配的基准测试，并把表格输出到Console
+    void Run(ostream& Console);
+    //-------------------------------------------------------------------------
+    // 非静态Getter成员函数
+    //-------------------------------------------------------------------------
+    // 列出全部匹配的基准测试名称
+    void List(ostream& Console) const;
+    // 获取运行结果
+    const vector<Result>& GetResults() const;
+    // 输出JSON
+    void WriteJson(ostream& Stream, const string& Executable) const;
+
+private:
+    //-------------------------------------------------------------------------
+    // 私有类型
+    //-------------------------------------------------------------------------
+    // 已注册的一项基准测试
+    struct Entry {
+        string Name;
+        size_t Range;
+        Function Body;
+    };
+    //-------------------------------------------------------------------------
+    // 私有非静态成员函数
+    //-------------------------------------------------------------------------
+    // 基准测试项是否匹配名称过滤子串和最大问题规模
+    bool Matches(const Entry& AEntry) const;
+    // 运行一项基准测试
+    Result RunEntry(const Entry& AEntry) const;
+    //-------------------------------------------------------------------------
+    // 私有非静态成员
+    //-------------------------------------------------------------------------
+    // 已注册的基准测试
+    vector<Entry> m_Entries{};
+    // 运行结果
+    vector<Result> m_Results{};
+    // 名称过滤子串
+    string m_Filter{};
+    // 最短时间（秒）
+    double m_MinTime{DEFAULT_MIN_TIME};
+    // 最大问题规模
+    size_t m_MaxRange{numeric_limits<size_t>::max()};
+};
+
+#endif /* BenchmarkRunner.hpp */
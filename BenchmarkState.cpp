@@ -0,0 +1,161 @@
+/*************************************************************************
+【文件名】BenchmarkState.cpp
+【功能模块和目的】定义BenchmarkState类的成员函数
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+// BenchmarkState所属头文件
+#include "BenchmarkState.hpp"
+// steady_clock所属头文件
+#include <chrono>
+// clock所属头文件
+#include <ctime>
+// size_t所属头文件
+#include <cstddef>
+
+using namespace std;
+
+//-------------------------------------------------------------------------
+// 必要的构造、析构、拷贝、赋值运算符重载函数
+//-------------------------------------------------------------------------
+
+/*************************************************************************
+【函数名称】BenchmarkState
+【函数功能】带参构造函数
+【参数】size_t Range, 表示问题规模
+       size_t Iterations, 表示迭代次数
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+BenchmarkState::BenchmarkState(size_t Range, size_t Iterations)
+    : m_Range(Range), m_Iterations(Iterations), m_Remaining(Iterations) {
+}
+
+//-------------------------------------------------------------------------
+// 非静态Setter成员函数
+//-------------------------------------------------------------------------
+
+/*************************************************************************
+【函数名称】KeepRunning
+【函数功能】是否继续迭代，第一次调用时开始计时，迭代结束时停止计时
+【参数】无
+【返回值】bool，是否继续迭代
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+bool BenchmarkState::KeepRunning() {
+    if (!m_Started) {
+        m_Started = true;
+        ResumeTiming();
+    }
+    if (m_Remaining == 0) {
+        PauseTiming();
+        return false;
+    }
+    m_Remaining--;
+    return true;
+}
+/*************************************************************************
+【函数名称】PauseTiming
+【函数功能】暂停计时，把本段时间累加到总时间
+【参数】无
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+void BenchmarkState::PauseTiming() {
+    if (m_Timing) {
+        m_RealSeconds += chrono::duration<double>(
+            chrono::steady_clock::now() - m_RealStart).count();
+        m_CpuSeconds += static_cast<double>(clock() - m_CpuStart)
+            / CLOCKS_PER_SEC;
+        m_Timing = false;
+    }
+}
+/*************************************************************************
+【函数名称】ResumeTiming
+【函数功能】恢复计时
+【参数】无
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+void BenchmarkState::ResumeTiming() {
+    if (!m_Timing) {
+        m_Timing = true;
+        m_CpuStart = clock();
+        m_RealStart = chrono::steady_clock::now();
+    }
+}
+/*************************************************************************
+【函数名称】SetItemsProcessed
+【函数功能】设置处理的元素数
+【参数】size_t Items, 表示全部迭代处理的元素总数
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+void BenchmarkState::SetItemsProcessed(size_t Items) {
+    m_ItemsProcessed = Items;
+}
+
+//-------------------------------------------------------------------------
+// 非静态Getter成员函数
+//-------------------------------------------------------------------------
+
+/*************************************************************************
+【函数名称】GetRange
+【函数功能】获取问题规模
+【参数】无
+【返回值】size_t，问题规模
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+size_t BenchmarkState::GetRange() const {
+    return m_Range;
+}
+/*************************************************************************
+【函数名称】GetIterations
+【函数功能】获取迭代次数
+【参数】无
+【返回值】size_t，迭代次数
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+size_t BenchmarkState::GetIterations() const {
+    return m_Iterations;
+}
+/*************************************************************************
+【函数名称】GetRealSeconds
+【函数功能】获取计时的墙钟时间
+【参数】无
+【返回值】double，墙钟时间（秒）
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+double BenchmarkState::GetRealSeconds() const {
+    return m_RealSeconds;
+}
+/*************************************************************************
+【函数名称】GetCpuSeconds
+【函数功能】获取计时的CPU时间
+【参数】无
+【返回值】double，CPU时间（秒）
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+double BenchmarkState::GetCpuSeconds() const {
+    return m_CpuSeconds;
+}
+/*************************************************************************
+【函数名称】GetItemsProcessed
+【函数功能】获取处理的元素数
+【参数】无
+【返回值】size_t，处理的元素数
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+size_t BenchmarkState::GetItemsProcessed() const {
+    return m_ItemsProcessed;
+}
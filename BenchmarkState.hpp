@@ -0,0 +1,101 @@
+/*************************************************************************
+【文件名】BenchmarkState.hpp
+【功能模块和目的】定义BenchmarkState类，表示一次基准测试运行的计时状态
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+#ifndef BENCHMARKSTATE_HPP
+#define BENCHMARKSTATE_HPP
+
+// steady_clock所属头文件
+#include <chrono>
+// clock_t所属头文件
+#include <ctime>
+// size_t所属头文件
+#include <cstddef>
+
+using namespace std;
+
+/*************************************************************************
+【类名】BenchmarkState
+【功能】一次基准测试运行的计时状态，用法与Google Benchmark的State相同：
+       被测函数在while (State.KeepRunning())循环中执行被测代码，
+       循环体执行指定的迭代次数；准备数据等不计时的代码放在
+       PauseTiming与ResumeTiming之间。同时记录墙钟时间和进程CPU时间
+【接口说明】
+    带参构造函数（问题规模、迭代次数）
+    禁止拷贝构造函数
+    禁止赋值运算符
+    虚析构函数
+    是否继续迭代
+    暂停计时、恢复计时
+    设置处理的元素数
+    获取问题规模、迭代次数、墙钟时间、CPU时间、处理的元素数
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+class BenchmarkState {
+public:
+    //-------------------------------------------------------------------------
+    // 必要的构造、析构、拷贝、赋值运算符重载函数
+    //-------------------------------------------------------------------------
+    // 带参构造函数
+    BenchmarkState(size_t Range, size_t Iterations);
+    // 禁止拷贝构造函数
+    BenchmarkState(const BenchmarkState& Source) = delete;
+    // 禁止赋值运算符
+    BenchmarkState& operator=(const BenchmarkState& Source) = delete;
+    // 虚析构函数
+    virtual ~BenchmarkState() = default;
+    //-------------------------------------------------------------------------
+    // 非静态Setter成员函数
+    //-------------------------------------------------------------------------
+    // 是否继续迭代（第一次调用时开始计时，迭代结束时停止计时）
+    bool KeepRunning();
+    // 暂停计时
+    void PauseTiming();
+    // 恢复计时
+    void ResumeTiming();
+    // 设置处理的元素数（用于计算每秒处理的元素数）
+    void SetItemsProcessed(size_t Items);
+    //-------------------------------------------------------------------------
+    // 非静态Getter成员函数
+    //-------------------------------------------------------------------------
+    // 获取问题规模
+    size_t GetRange() const;
+    // 获取迭代次数
+    size_t GetIterations() const;
+    // 获取计时的墙钟时间（秒）
+    double GetRealSeconds() const;
+    // 获取计时的CPU时间（秒）
+    double GetCpuSeconds() const;
+    // 获取处理的元素数
+    size_t GetItemsProcessed() const;
+
+private:
+    //-------------------------------------------------------------------------
+    // 私有非静态成员
+    //-------------------------------------------------------------------------
+    // 问题规模
+    size_t m_Range;
+    // 迭代次数
+    size_t m_Iterations;
+    // 剩余迭代次数
+    size_t m_Remaining;
+    // 是否已开始迭代
+    bool m_Started{false};
+    // 是否正在计时
+    bool m_Timing{false};
+    // 本段计时开始时的墙钟时间
+    chrono::steady_clock::time_point m_RealStart{};
+    // 本段计时开始时的CPU时间
+    clock_t m_CpuStart{0};
+    // 累计的墙钟时间（秒）
+    double m_RealSeconds{0};
+    // 累计的CPU时间（秒）
+    double m_CpuSeconds{0};
+    // 处理的元素数
+    size_t m_ItemsProcessed{0};
+};
+
+#endif /* BenchmarkState.hpp */
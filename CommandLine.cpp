@@ -0,0 +1,478 @@
+/*************************************************************************
+【文件名】CommandLine.cpp
+【功能模块和目的】定义CommandLine类的成员函数
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】2026/10/19 谭雯心 增加了执行命令脚本的run命令
+           2026/10/19 谭雯心 转换失败时同时报告源文件和目标文件
+           2026/10/19 谭雯心 并发任务改由TaskScheduler执行，增加了-j选项
+*************************************************************************/
+// CommandLine所属头文件
+#include "CommandLine.hpp"
+// Controller所属头文件
+#include "Controller.hpp"
+// Model3D所属头文件
+#include "Model3D.hpp"
+// MeshGenerator所属头文件
+#include "MeshGenerator.hpp"
+// EditScript所属头文件
+#include "EditScript.hpp"
+// ScriptExecutor所属头文件
+#include "ScriptExecutor.hpp"
+// TaskScheduler所属头文件
+#include "TaskScheduler.hpp"
+// ostringstream所属头文件
+#include <sstream>
+// string、stoull所属头文件
+#include <string>
+// vector所属头文件
+#include <vector>
+// function所属头文件
+#include <functional>
+// uint64_t所属头文件
+#include <cstdint>
+// size_t所属头文件
+#include <cstddef>
+
+using namespace std;
+
+namespace {
+    /*********************************************************************
+    【函数名称】ParseShape
+    【函数功能】把形状名称转换为MeshGenerator::Shape
+    【参数】const string& Name, 表示形状名称（grid、sphere、soup、wireframe）
+           MeshGenerator::Shape& AShape, 用于返回形状
+    【返回值】bool，名称是否有效
+    【开发者及日期】谭雯心 2026/10/19
+    【更改记录】
+    *********************************************************************/
+    bool ParseShape(const string& Name, MeshGenerator::Shape& AShape) {
+        if (Name == "grid") {
+            AShape = MeshGenerator::Shape::GRID;
+        }
+        else if (Name == "sphere") {
+            AShape = MeshGenerator::Shape::SPHERE;
+        }
+        else if (Name == "soup") {
+            AShape = MeshGenerator::Shape::SOUP;
+        }
+        else if (Name == "wireframe") {
+            AShape = MeshGenerator::Shape::WIREFRAME;
+        }
+        else {
+            return false;
+        }
+        return true;
+    }
+    /*********************************************************************
+    【函数名称】ParseCount
+    【函数功能】把十进制字符串转换为无符号整数
+    【参数】const string& Text, 表示字符串
+           uint64_t& Value, 用于返回数值
+    【返回值】bool，字符串是否为有效的无符号整数
+    【开发者及日期】谭雯心 2026/10/19
+    【更改记录】
+    *********************************************************************/
+    bool ParseCount(const string& Text, uint64_t& Value) {
+        if (Text.empty()
+            || Text.find_first_not_of("0123456789") != string::npos) {
+            return false;
+        }
+        try {
+            Value = stoull(Text);
+        }
+        catch (...) {
+            return false;
+        }
+        return true;
+    }
+}
+
+//-------------------------------------------------------------------------
+// 静态常量
+//-------------------------------------------------------------------------
+
+// 参数错误时的退出码
+constexpr int CommandLine::USAGE_ERROR;
+
+//-------------------------------------------------------------------------
+// 必要的构造、析构、拷贝、赋值运算符重载函数
+//-------------------------------------------------------------------------
+
+/*************************************************************************
+【函数名称】CommandLine
+【函数功能】带参构造函数
+【参数】ostream& Output, 表示结果输出流
+       ostream& Error, 表示错误信息输出流
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+CommandLine::CommandLine(ostream& Output, ostream& Error)
+    : m_Output(Output), m_Error(Error),
+      m_pController(Controller::GetInstance()) {
+}
+
+//-------------------------------------------------------------------------
+// 非静态成员函数
+//-------------------------------------------------------------------------
+
+/*************************************************************************
+【函数名称】Run
+【函数功能】按第一个参数分派命令，结束时刷新输出流
+【参数】const vector<string>& Arguments, 表示不含程序名的参数列表
+【返回值】int，退出码
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】2026/10/19 谭雯心 增加了命令前的-j <n>选项
+*************************************************************************/
+int CommandLine::Run(const vector<string>& Arguments) {
+    int ExitCode = 0;
+    // 命令前的-j <n>设置TaskScheduler的工作者数
+    size_t First = 0;
+    uint64_t WorkerCount = 0;
+    if (Arguments.size() >= 2 && Arguments[0] == "-j") {
+        First = 2;
+        if (!ParseCount(Arguments[1], WorkerCount) || WorkerCount == 0
+            || !TaskScheduler::SetWorkerCount(
+                static_cast<size_t>(WorkerCount))) {
+            ExitCode = Usage(string("invalid worker count ") + Arguments[1]);
+        }
+    }
+    if (ExitCode == 0 && Arguments.size() <= First) {
+        ExitCode = Usage("missing command");
+    }
+    else if (ExitCode == 0) {
+        const string& Command = Arguments[First];
+        vector<string> Rest(Arguments.begin() + First + 1, Arguments.end());
+        if (Command == "convert") {
+            ExitCode = Convert(Rest);
+        }
+        else if (Command == "stats") {
+            ExitCode = Stats(Rest);
+        }
+        else if (Command == "merge") {
+            ExitCode = Merge(Rest);
+        }
+        else if (Command == "generate") {
+            ExitCode = Generate(Rest);
+        }
+        else if (Command == "run") {
+            ExitCode = RunScript(Rest);
+        }
+        else {
+            ExitCode = Usage(string("unknown command ") + Command);
+        }
+    }
+    m_Output.flush();
+    m_Error.flush();
+    return ExitCode;
+}
+
+//-------------------------------------------------------------------------
+// 受保护的成员函数
+//-------------------------------------------------------------------------
+
+/*************************************************************************
+【函数名称】Convert
+【函数功能】流式转换文件。两个参数时把第一个文件转换为第二个文件，
+       带-e <ext>时把每个文件转换为同名的<ext>文件，多个文件并发转换。
+       失败可能源于源文件也可能源于目标文件，因此按“源 -> 目标”报告
+【参数】const vector<string>& Arguments, 表示命令的参数
+【返回值】int，退出码
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】2026/10/19 谭雯心 失败信息同时给出源文件和目标文件
+*************************************************************************/
+int CommandLine::Convert(const vector<string>& Arguments) {
+    vector<string> Sources;
+    vector<string> Targets;
+    string Extension;
+    for (size_t i = 0; i < Arguments.size(); i++) {
+        if (Arguments[i] == "-e" && i + 1 < Arguments.size()) {
+            Extension = Arguments[++i];
+        }
+        else {
+            Sources.push_back(Arguments[i]);
+        }
+    }
+    if (Extension.empty()) {
+        if (Sources.size() != 2) {
+            return Usage("convert needs <in> <out> or <in>... -e <ext>");
+        }
+        Targets.push_back(Sources[1]);
+        Sources.pop_back();
+    }
+    else {
+        if (Sources.empty()) {
+            return Usage("convert needs at least one input file");
+        }
+        for (const auto& Source : Sources) {
+            Targets.push_back(ReplaceExtension(Source, Extension));
+        }
+    }
+    vector<Controller::Res> Results(Sources.size(), Controller::Res::OK);
+    RunTasks(Sources.size(), [&](size_t i) {
+        // 目标与源相同时打开目标会清空源文件，不转换
+        if (Targets[i] == Sources[i]) {
+            Results[i] = Controller::Res::FILE_NOT_AVAILABLE;
+            return;
+        }
+        Results[i] = m_pController->ConvertModelFile(Sources[i], Targets[i]);
+    });
+    int ExitCode = 0;
+    for (size_t i = 0; i < Sources.size(); i++) {
+        if (Results[i] != Controller::Res::OK) {
+            int Code = Fail(Sources[i] + " -> " + Targets[i], Results[i]);
+            ExitCode = (ExitCode == 0) ? Code : ExitCode;
+        }
+    }
+    return ExitCode;
+}
+/*************************************************************************
+【函数名称】Stats
+【函数功能】并发地流式统计文件，按参数顺序每行输出一个文件的
+       文件名、面数、线数、点数、面积、长度和包围盒体积，以制表符分隔
+【参数】const vector<string>& Arguments, 表示文件名列表
+【返回值】int，退出码
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+int CommandLine::Stats(const vector<string>& Arguments) {
+    if (Arguments.empty()) {
+        return Usage("stats needs at least one file");
+    }
+    vector<Controller::ModelInfo> Infos(Arguments.size());
+    vector<Controller::Res> Results(Arguments.size(), Controller::Res::OK);
+    RunTasks(Arguments.size(), [&](size_t i) {
+        Results[i] = m_pController->StreamModelInfo(Arguments[i], Infos[i]);
+    });
+    ostringstream Buffer;
+    Buffer << "file\tfaces\tlines\tpoints\tarea\tlength\tvolume\n";
+    int ExitCode = 0;
+    for (size_t i = 0; i < Arguments.size(); i++) {
+        if (Results[i] != Controller::Res::OK) {
+            int Code = Fail(Arguments[i], Results[i]);
+            ExitCode = (ExitCode == 0) ? Code : ExitCode;
+            continue;
+        }
+        const Controller::ModelInfo& Info = Infos[i];
+        Buffer << Arguments[i] << '\t' << Info.FaceCount << '\t'
+            << Info.LineCount << '\t' << Info.PointCount << '\t'
+            << Info.Area << '\t' << Info.Length << '\t' << Info.Volume
+            << '\n';
+    }
+    m_Output << Buffer.str();
+    return ExitCode;
+}
+/*************************************************************************
+【函数名称】Merge
+【函数功能】并发导入多个模型，按参数顺序依次合并（与Model3D的+=相同，
+       重复的面和线只保留一个）后导出。任一模型导入失败时不导出
+【参数】const vector<string>& Arguments, 表示命令的参数
+【返回值】int，退出码
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+int CommandLine::Merge(const vector<string>& Arguments) {
+    vector<string> Sources;
+    string Target;
+    for (size_t i = 0; i < Arguments.size(); i++) {
+        if (Arguments[i] == "-o" && i + 1 < Arguments.size()) {
+            Target = Arguments[++i];
+        }
+        else {
+            Sources.push_back(Arguments[i]);
+        }
+    }
+    if (Sources.empty() || Target.empty()) {
+        return Usage("merge needs <in>... -o <out>");
+    }
+    vector<Model3D> Models(Sources.size());
+    vector<Controller::Res> Results(Sources.size(), Controller::Res::OK);
+    RunTasks(Sources.size(), [&](size_t i) {
+        Results[i] = m_pController->LoadModelFromFile(Sources[i], Models[i]);
+    });
+    int ExitCode = 0;
+    for (size_t i = 0; i < Sources.size(); i++) {
+        if (Results[i] != Controller::Res::OK) {
+            int Code = Fail(Sources[i], Results[i]);
+            ExitCode = (ExitCode == 0) ? Code : ExitCode;
+        }
+    }
+    if (ExitCode != 0) {
+        return ExitCode;
+    }
+    Model3D& Merged = Models[0];
+    for (size_t i = 1; i < Models.size(); i++) {
+        Merged += Models[i];
+        Models[i].Clear();
+    }
+    Controller::Res Res = m_pController->SaveModelToFile(Target, Merged);
+    if (Res != Controller::Res::OK) {
+        return Fail(Target, Res);
+    }
+    return 0;
+}
+/*************************************************************************
+【函数名称】Generate
+【函数功能】用MeshGenerator生成模型并流式写入文件
+【参数】const vector<string>& Arguments, 表示命令的参数
+【返回值】int，退出码
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+int CommandLine::Generate(const vector<string>& Arguments) {
+    vector<string> Positional;
+    uint64_t Seed = MeshGenerator::DEFAULT_SEED;
+    for (size_t i = 0; i < Arguments.size(); i++) {
+        if (Arguments[i] == "-s" && i + 1 < Arguments.size()) {
+            if (!ParseCount(Arguments[++i], Seed)) {
+                return Usage(string("invalid seed ") + Arguments[i]);
+            }
+        }
+        else {
+            Positional.push_back(Arguments[i]);
+        }
+    }
+    if (Positional.size() != 3) {
+        return Usage("generate needs <shape> <count> <out> [-s <seed>]");
+    }
+    MeshGenerator::Shape AShape;
+    if (!ParseShape(Positional[0], AShape)) {
+        return Usage(string("unknown shape ") + Positional[0]);
+    }
+    uint64_t Count = 0;
+    if (!ParseCount(Positional[1], Count)) {
+        return Usage(string("invalid count ") + Positional[1]);
+    }
+    try {
+        MeshGenerator(AShape, static_cast<size_t>(Count), Seed)
+            .GenerateToFile(Positional[2]);
+    }
+    catch (const MeshGenerator::FILE_NOT_SUPPORTED&) {
+        return Fail(Positional[2], Controller::Res::FILE_NOT_SUPPORTED);
+    }
+    catch (...) {
+        return Fail(Positional[2], Controller::Res::FILE_NOT_AVAILABLE);
+    }
+    return 0;
+}
+/*************************************************************************
+【函数名称】RunScript
+【函数功能】解析并执行命令脚本，输出每步的执行记录和总耗时。
+       脚本有语法错误时不执行任何命令
+【参数】const vector<string>& Arguments, 表示命令的参数
+【返回值】int，退出码
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+int CommandLine::RunScript(const vector<string>& Arguments) {
+    if (Arguments.size() != 1) {
+        return Usage("run needs <script>");
+    }
+    EditScript Script;
+    try {
+        Script.ParseFile(Arguments[0]);
+    }
+    catch (const EditScript::SYNTAX_ERROR& Error) {
+        return Usage(Arguments[0] + ": " + Error.what());
+    }
+    catch (...) {
+        return Fail(Arguments[0], Controller::Res::FILE_NOT_AVAILABLE);
+    }
+    ScriptExecutor Executor;
+    Controller::Res Res = Executor.Execute(Script);
+    ostringstream Buffer;
+    Executor.WriteReport(Buffer);
+    size_t Executed = 0;
+    for (const auto& AStep : Executor.Steps()) {
+        Executed += AStep.CommandCount;
+    }
+    Buffer << "total\t\t" << Executed << "\t"
+        << m_pController->ControllerResStr(Res) << "\t"
+        << Executor.GetTotalNanoseconds() / 1000.0 << "\t\n";
+    m_Output << Buffer.str();
+    if (Res != Controller::Res::OK) {
+        const ScriptExecutor::Step& Failed = Executor.Steps().back();
+        return Fail(Arguments[0] + ":" + to_string(Failed.LastLine), Res);
+    }
+    return 0;
+}
+/*************************************************************************
+【函数名称】Usage
+【函数功能】输出错误原因和用法
+【参数】const string& Message, 表示错误原因
+【返回值】int，USAGE_ERROR
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+int CommandLine::Usage(const string& Message) {
+    m_Error << "error: " << Message << '\n'
+        << "usage:\n"
+        << "  main                                  interactive menu\n"
+        << "  main convert <in> <out>\n"
+        << "  main convert <in>... -e <ext>\n"
+        << "  main stats <file>...\n"
+        << "  main merge <in>... -o <out>\n"
+        << "  main generate <grid|sphere|soup|wireframe> <count> <out>"
+        << " [-s <seed>]\n"
+        << "  main run <script>\n"
+        << "commands may be preceded by -j <n> to use n worker threads\n";
+    return USAGE_ERROR;
+}
+/*************************************************************************
+【函数名称】Fail
+【函数功能】输出文件的失败信息
+【参数】const string& FileName, 表示文件名
+       Controller::Res Res, 表示失败原因
+【返回值】int，退出码，即Res的值
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+int CommandLine::Fail(const string& FileName, Controller::Res Res) {
+    m_Error << FileName << ": " << m_pController->ControllerResStr(Res)
+        << '\n';
+    return static_cast<int>(Res);
+}
+
+//-------------------------------------------------------------------------
+// 受保护的静态成员函数
+//-------------------------------------------------------------------------
+
+/*************************************************************************
+【函数名称】RunTasks
+【函数功能】在TaskScheduler中并发执行Count个任务，每个任务为一块，
+       全部完成后返回
+【参数】size_t Count, 表示任务数
+       const function<void(size_t)>& Task, 表示以任务编号为参数的任务
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】2026/10/19 谭雯心 改为由TaskScheduler执行，不再自行创建线程
+*************************************************************************/
+void CommandLine::RunTasks(
+    size_t Count, const function<void(size_t)>& Task) {
+    TaskScheduler::GetInstance()->ParallelFor(0, Count, 1,
+        [&](size_t First, size_t Last) {
+            for (size_t i = First; i < Last; i++) {
+                Task(i);
+            }
+        });
+}
+/*************************************************************************
+【函数名称】ReplaceExtension
+【函数功能】把文件名的扩展名替换为Extension，没有扩展名时追加
+【参数】const string& FileName, 表示文件名
+       const string& Extension, 表示新的扩展名（可含开头的'.'）
+【返回值】string，新的文件名
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】2026/10/19 谭雯心 扩展名开头的'.'不再重复
+*************************************************************************/
+string CommandLine::ReplaceExtension(
+    const string& FileName, const string& Extension) {
+    string Suffix = (!Extension.empty() && Extension[0] == '.')
+        ? Extension.substr(1) : Extension;
+    size_t Dot = FileName.find_last_of('.');
+    size_t Slash = FileName.find_last_of("/\\");
+    if (Dot == string::npos || (Slash != string::npos && Dot < Slash)) {
+        return FileName + "." + Suffix;
+    }
+    return FileName.substr(0, Dot + 1) + Suffix;
+}
@@ -0,0 +1,114 @@
+/*************************************************************************
+【文件名】CommandLine.hpp
+【功能模块和目的】定义CommandLine类，表示非交互的命令行批处理界面
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】2026/10/19 谭雯心 增加了执行命令脚本的run命令
+           2026/10/19 谭雯心 并发任务改由TaskScheduler执行
+*************************************************************************/
+#ifndef COMMANDLINE_HPP
+#define COMMANDLINE_HPP
+
+// Controller所属头文件
+#include "Controller.hpp"
+// ostream所属头文件
+#include <iostream>
+// string所属头文件
+#include <string>
+// vector所属头文件
+#include <vector>
+// function所属头文件
+#include <functional>
+// shared_ptr所属头文件
+#include <memory>
+// size_t所属头文件
+#include <cstddef>
+
+using namespace std;
+
+/*************************************************************************
+【类名】CommandLine
+【功能】非交互的命令行批处理界面，直接调用Controller完成一条命令：
+       convert <in> <out>               流式转换一个文件
+       convert <in>... -e <ext>         把每个文件转换为同名的<ext>文件
+       stats <file>...                  流式统计文件，每行输出一个文件
+       merge <in>... -o <out>           合并多个模型并导出
+       generate <shape> <count> <out> [-s <seed>]  生成模型并导出
+       run <script>                     执行命令脚本，输出每步的耗时
+       命令前可加-j <n>，设置TaskScheduler的工作者数。
+       多个文件的命令并发处理，结果按参数顺序输出。输出先写入缓冲区，
+       命令结束时一次写出。退出码为按参数顺序第一个失败的ControllerRes
+       的值，全部成功为0，参数错误为USAGE_ERROR
+【接口说明】
+    静态常量：参数错误时的退出码
+    带参构造函数
+    禁止拷贝构造和赋值
+    虚析构函数
+    执行一条命令并返回退出码
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】2026/10/19 谭雯心 增加了执行命令脚本的run命令
+           2026/10/19 谭雯心 并发任务改由TaskScheduler执行，增加了-j选项
+*************************************************************************/
+class CommandLine {
+public:
+    //-------------------------------------------------------------------------
+    // 静态常量
+    //-------------------------------------------------------------------------
+    // 参数错误时的退出码，不与ControllerRes的值重复
+    static constexpr int USAGE_ERROR{64};
+    //-------------------------------------------------------------------------
+    // 必要的构造、析构、拷贝、赋值运算符重载函数
+    //-------------------------------------------------------------------------
+    // 带参构造函数，指定结果和错误信息的输出流
+    CommandLine(ostream& Output, ostream& Error);
+    // 禁止拷贝构造
+    CommandLine(const CommandLine& Source) = delete;
+    // 禁止赋值
+    CommandLine& operator=(const CommandLine& Source) = delete;
+    // 虚析构函数
+    virtual ~CommandLine() = default;
+    //-------------------------------------------------------------------------
+    // 非静态成员函数
+    //-------------------------------------------------------------------------
+    // 执行一条命令（不含程序名的参数列表）并返回退出码
+    int Run(const vector<string>& Arguments);
+
+protected:
+    //-------------------------------------------------------------------------
+    // 受保护的成员函数
+    //-------------------------------------------------------------------------
+    // 转换命令
+    virtual int Convert(const vector<string>& Arguments);
+    // 统计命令
+    virtual int Stats(const vector<string>& Arguments);
+    // 合并命令
+    virtual int Merge(const vector<string>& Arguments);
+    // 生成命令
+    virtual int Generate(const vector<string>& Arguments);
+    // 执行命令脚本
+    virtual int RunScript(const vector<string>& Arguments);
+    // 输出用法并返回USAGE_ERROR
+    int Usage(const string& Message);
+    // 输出失败信息，返回对应的退出码
+    int Fail(const string& FileName, Controller::Res Res);
+    //-------------------------------------------------------------------------
+    // 受保护的静态成员函数
+    //-------------------------------------------------------------------------
+    // 在TaskScheduler中并发执行Count个任务
+    static void RunTasks(size_t Count, const function<void(size_t)>& Task);
+    // 把文件名的扩展名替换为Extension
+    static string ReplaceExtension(
+        const string& FileName, const string& Extension);
+
+private:
+    //-------------------------------------------------------------------------
+    // 私有非静态成员
+    //-------------------------------------------------------------------------
+    // 结果输出流
+    ostream& m_Output;
+    // 错误信息输出流
+    ostream& m_Error;
+    // 控制器
+    shared_ptr<Controller> m_pController;
+};
+
+#endif /* CommandLine.hpp */
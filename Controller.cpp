@@ -2,7 +2,25 @@
 【文件名】Controller.cpp
 【功能模块和目的】控制器类的实现
 【开发者及日期】谭雯心 2024/8/9
-【更改记录】
+【更改记录】2026/10/19 谭雯心 增加了LOD链的生成、读写、选取和后台导入模型
+           2026/10/19 谭雯心 增加了M3B格式、流式统计和格式转换
+           2026/10/19 谭雯心 增加了自相交和干涉检测
+           2026/10/19 谭雯心 为导入、导出、添加面和线、统计增加了计时探针
+           2026/10/19 谭雯心 增加了模型内存占用统计
+           2026/10/19 谭雯心 流式格式转换增加了OBJ目标格式
+           2026/10/19 谭雯心 增加了批量添加面和线
+           2026/10/19 谭雯心 支持多线程并发访问
+           2026/10/19 谭雯心 增加了异步导入和导出
+           2026/10/19 谭雯心 统计全部模型改由TaskScheduler并行执行
+           2026/10/19 谭雯心 增加了编辑日志、撤销和重做
+           2026/10/19 谭雯心 增加了STL格式
+           2026/10/19 谭雯心 增加了PLY格式
+           2026/10/19 谭雯心 导入器、导出器改由PorterRegistry选择
+           2026/10/19 谭雯心 导入、导出只打开一次文件并使用大缓冲区
+           2026/10/19 谭雯心 导出和格式转换改为经临时文件原子保存
+           2026/10/19 谭雯心 透明地读写gzip压缩的模型文件
+           2026/10/19 谭雯心 增加了把OBJ文件的各组导入为多个模型
+           2026/10/19 谭雯心 导出指定模型到M3B文件时只写出修改的部分
 *************************************************************************/
 // Controller类的头文件
 #include "Controller.hpp"
@@ -14,14 +32,54 @@
 #include "Model3D.hpp"
 // Point3D所属头文件
 #include "Point3D.hpp"
-// Model3D_OBJ_Exporter所属头文件
-#include "Model3D_OBJ_Exporter.hpp"
-// Model3D_OBJ_Importer所属头文件
-#include "Model3D_OBJ_Importer.hpp"
+// PorterRegistry所属头文件
+#include "PorterRegistry.hpp"
+// Porter所属头文件
+#include "Porter.hpp"
+// Model3D_M3B_Exporter所属头文件
+#include "Model3D_M3B_Exporter.hpp"
+// ModelStatisticsStage所属头文件
+#include "ModelStatisticsStage.hpp"
+// IndexedModel3D所属头文件
+#include "IndexedModel3D.hpp"
+// LODChain所属头文件
+#include "LODChain.hpp"
+// MeshIntersector所属头文件
+#include "MeshIntersector.hpp"
+// Instrumentation所属头文件
+#include "Instrumentation.hpp"
+// ScopedTimer所属头文件
+#include "ScopedTimer.hpp"
+// ModelBatcher所属头文件
+#include "ModelBatcher.hpp"
+// ModelBuilderStage所属头文件
+#include "ModelBuilderStage.hpp"
+// ProgressStreamBuf所属头文件
+#include "ProgressStreamBuf.hpp"
+// GzipStreamBuf所属头文件
+#include "GzipStreamBuf.hpp"
+// TaskScheduler所属头文件
+#include "TaskScheduler.hpp"
+// EditJournal所属头文件
+#include "EditJournal.hpp"
+// future, promise所属头文件
+#include <future>
+// shared_mutex, shared_lock所属头文件
+#include <shared_mutex>
+// mutex, lock_guard, unique_lock, call_once所属头文件
+#include <mutex>
+// seconds所属头文件
+#include <chrono>
+// ifstream, ofstream所属头文件
+#include <fstream>
+// remove所属头文件
+#include <cstdio>
 // numeric_limits所属头文件
 #include <limits>
-// shared_ptr所属头文件
+// shared_ptr、unique_ptr所属头文件
 #include <memory>
+// streambuf所属头文件
+#include <streambuf>
 // string所属头文件
 #include <string>
 // vector所属头文件
@@ -36,6 +94,261 @@ using namespace std;
 
 // m_pInstance初始化为nullptr
 shared_ptr<Controller> Controller::m_pInstance = nullptr;
+// m_InstanceFlag保证m_pInstance只创建一次
+once_flag Controller::m_InstanceFlag;
+
+namespace {
+    // 导入模型的探针，处理量为导入的面数与线数之和
+    const size_t PROBE_LOAD
+        = Instrumentation::RegisterProbe("Controller::LoadModelFromFile");
+    // 导出模型的探针，处理量为导出的面数与线数之和
+    const size_t PROBE_SAVE
+        = Instrumentation::RegisterProbe("Controller::SaveModelToFile");
+    // 添加面的探针
+    const size_t PROBE_ADD_FACE
+        = Instrumentation::RegisterProbe("Controller::AddFace");
+    // 添加线的探针
+    const size_t PROBE_ADD_LINE
+        = Instrumentation::RegisterProbe("Controller::AddLine");
+    // 统计模型信息的探针，处理量为统计的面数与线数之和
+    const size_t PROBE_LIST_INFO
+        = Instrumentation::RegisterProbe("Controller::ListModelInfo");
+
+    /*************************************************************************
+    【函数名称】FillModelInfo
+    【函数功能】调用Model3D类的相关函数获取模型统计信息，调用者须持有
+           模型的锁
+    【参数】const Model3D& AModel, 模型
+           Controller::ModelInfo& Info, 模型统计信息
+    【返回值】无
+    【开发者及日期】谭雯心 2026/10/19
+    【更改记录】
+    *************************************************************************/
+    void FillModelInfo(const Model3D& AModel, Controller::ModelInfo& Info) {
+        Info.Name = AModel.Name;
+        Info.FaceCount = AModel.GetFaceCount();
+        Info.LineCount = AModel.GetLineCount();
+        Info.PointCount = AModel.GetPointCount();
+        Info.ElementCount = AModel.GetElementCount();
+        Info.Area = AModel.Area();
+        Info.Length = AModel.Length();
+        Info.Volume = AModel.BoundingBoxVolume();
+    }
+
+    /*************************************************************************
+    【类名】ReportingStage
+    【功能】流式处理阶段：把批次转交给下一个处理阶段，并把批次中的面数与
+           线数记入IOTask
+    【接口说明】
+        带参构造函数（下一个处理阶段、IOTask）
+        处理一个批次
+        全部批次处理完毕
+    【开发者及日期】谭雯心 2026/10/19
+    【更改记录】
+    *************************************************************************/
+    class ReportingStage : public ModelStreamStage {
+    public:
+        // 带参构造函数
+        ReportingStage(ModelStreamStage& Next, IOTask& Task)
+            : m_Next(Next), m_Task(Task) {
+        }
+        // 转交一个批次并记录元素数
+        virtual void ProcessBatch(const Batch& ABatch) override {
+            m_Task.ThrowIfCancelled();
+            m_Next.ProcessBatch(ABatch);
+            m_Task.AddElements(ABatch.FaceIndices.size() / 3
+                + ABatch.LineIndices.size() / 2);
+        }
+        // 通知下一个处理阶段全部批次处理完毕
+        virtual void Finish() override {
+            m_Task.ThrowIfCancelled();
+            m_Next.Finish();
+        }
+
+    private:
+        // 下一个处理阶段
+        ModelStreamStage& m_Next;
+        // 记录进度的任务
+        IOTask& m_Task;
+    };
+
+    /*************************************************************************
+    【函数名称】OpenSource
+    【函数功能】打开源文件并选择导入器，之后的读取都使用同一个流：
+           内容为gzip数据时接入解压的流缓冲区，按解压后的内容选择导入器，
+           选择后流回到开头，并令流在badbit时抛出异常，使解压时发现的
+           截断或损坏不被当作文件结束
+    【参数】const string& FileName, 文件名
+           ifstream& File, 未打开的输入流
+           vector<char>& Buffer, 缓冲区，须在File之前声明
+           unique_ptr<streambuf>& pFilter, 解压的流缓冲区，须在File之后声明
+           shared_ptr<const Model3D_Importer>& pImporter, 选择的导入器
+    【返回值】Controller::Res枚举类型，文件无法打开时按扩展名区分
+           FILE_NOT_SUPPORTED和FILE_NOT_AVAILABLE
+    【开发者及日期】谭雯心 2026/10/19
+    【更改记录】
+    *************************************************************************/
+    Controller::Res OpenSource(const string& FileName, ifstream& File,
+        vector<char>& Buffer, unique_ptr<streambuf>& pFilter,
+        shared_ptr<const Model3D_Importer>& pImporter) {
+        shared_ptr<PorterRegistry> pRegistry = PorterRegistry::GetInstance();
+        try {
+            Porter::OpenInput(FileName, File, Buffer);
+        }
+        catch (...) {
+            return pRegistry->FindImporter(FileName) == nullptr
+                ? Controller::Res::FILE_NOT_SUPPORTED
+                : Controller::Res::FILE_NOT_AVAILABLE;
+        }
+        pFilter = Porter::AttachDecompressor(File);
+        pImporter = pRegistry->FindImporter(FileName, File);
+        if (pImporter == nullptr) {
+            return Controller::Res::FILE_NOT_SUPPORTED;
+        }
+        File.exceptions(ios::badbit);
+        return Controller::Res::OK;
+    }
+
+    /*************************************************************************
+    【函数名称】LoadWithProgress
+    【函数功能】经ProgressStreamBuf流式读取模型文件，读取过程中报告字节数
+           和元素数，并在每个缓冲区和批次之间检查是否已取消。压缩文件的
+           解压在ProgressStreamBuf之上进行，字节数按文件中压缩后的数据计
+    【参数】const string& FileName, 文件名
+           Model3D& AModel, 接收导入结果的模型
+           IOTask& Task, 报告进度和响应取消的任务
+    【返回值】Controller::Res枚举类型，已取消时返回OPERATION_CANCELLED
+    【开发者及日期】谭雯心 2026/10/19
+    【更改记录】2026/10/19 谭雯心 改为由PorterRegistry选择导入器
+               2026/10/19 谭雯心 只打开一次文件并使用大缓冲区
+               2026/10/19 谭雯心 透明地解压gzip压缩的文件
+    *************************************************************************/
+    Controller::Res LoadWithProgress(
+        const string& FileName, Model3D& AModel, IOTask& Task) {
+        shared_ptr<PorterRegistry> pRegistry = PorterRegistry::GetInstance();
+        // 只打开一次文件，选择导入器和导入都使用同一个流
+        vector<char> FileBuffer;
+        ifstream File;
+        try {
+            Porter::OpenInput(FileName, File, FileBuffer);
+        }
+        catch (...) {
+            return pRegistry->FindImporter(FileName) == nullptr
+                ? Controller::Res::FILE_NOT_SUPPORTED
+                : Controller::Res::FILE_NOT_AVAILABLE;
+        }
+        // 按解压后的内容选择导入器，选择后文件回到开头
+        unique_ptr<streambuf> pFilter = Porter::AttachDecompressor(File);
+        bool bCompressed = pFilter != nullptr;
+        shared_ptr<const Model3D_Importer> pImporter
+            = pRegistry->FindImporter(FileName, File);
+        if (pImporter == nullptr) {
+            return Controller::Res::FILE_NOT_SUPPORTED;
+        }
+        streamoff Size = File.rdbuf()->pubseekoff(0, ios::end, ios::in);
+        File.rdbuf()->pubseekpos(0, ios::in);
+        Task.Start(Size > 0 ? static_cast<uint64_t>(Size) : 0);
+        ScopedTimer Timer(PROBE_LOAD);
+        // 读取经过ProgressStreamBuf，取消时抛出的异常穿过流的读函数
+        ProgressStreamBuf Buffer(*File.rdbuf(), Task);
+        File.basic_ios<char>::rdbuf(&Buffer);
+        // 压缩文件在ProgressStreamBuf之上重新接入解压的流缓冲区
+        pFilter.reset();
+        if (bCompressed) {
+            pFilter.reset(
+                new GzipStreamBuf(Buffer, GzipStreamBuf::Mode::DECOMPRESS));
+            File.basic_ios<char>::rdbuf(pFilter.get());
+        }
+        File.exceptions(ios::badbit);
+        try {
+            ModelBuilderStage Builder(AModel);
+            ReportingStage Reporter(Builder, Task);
+            ModelBatcher Batcher(Reporter);
+            pImporter->StreamFromStream(File, Batcher);
+            Batcher.Finish();
+        }
+        catch (const IOTask::CANCELLED&) {
+            return Controller::Res::OPERATION_CANCELLED;
+        }
+        catch (...) {
+            return Controller::Res::FILE_NOT_AVAILABLE;
+        }
+        Timer.AddItems(AModel.GetElementCount());
+        return Controller::Res::OK;
+    }
+    /*************************************************************************
+    【函数名称】SaveWithProgress
+    【函数功能】经ProgressStreamBuf导出模型，导出过程中报告字节数，完成后
+           报告元素数；写入临时文件，完成后原子地替换目标文件，
+           已取消或失败时删除临时文件
+    【参数】const string& FileName, 文件名
+           const Model3D& AModel, 要导出的模型，调用者须持有模型的锁
+           IOTask& Task, 报告进度和响应取消的任务
+    【返回值】Controller::Res枚举类型，已取消时返回OPERATION_CANCELLED
+    【开发者及日期】谭雯心 2026/10/19
+    【更改记录】2026/10/19 谭雯心 改为由PorterRegistry选择导出器
+               2026/10/19 谭雯心 使用大缓冲区
+               2026/10/19 谭雯心 改为经临时文件原子保存，取消时目标文件不变
+               2026/10/19 谭雯心 文件名以".gz"结尾时压缩保存
+    *************************************************************************/
+    Controller::Res SaveWithProgress(
+        const string& FileName, const Model3D& AModel, IOTask& Task) {
+        shared_ptr<const Model3D_Exporter> pExporter
+            = PorterRegistry::GetInstance()->FindExporter(FileName);
+        if (pExporter == nullptr) {
+            return Controller::Res::FILE_NOT_SUPPORTED;
+        }
+        Controller::Res Result = Controller::Res::OK;
+        // 写入同目录的临时文件，完成后原子地替换目标文件
+        string TempName = Porter::TempFileName(FileName);
+        {
+            vector<char> FileBuffer;
+            ofstream File;
+            try {
+                Porter::OpenOutput(TempName, File, FileBuffer);
+            }
+            catch (...) {
+                return Controller::Res::FILE_NOT_AVAILABLE;
+            }
+            Task.Start(0);
+            ScopedTimer Timer(PROBE_SAVE);
+            // 写入经过ProgressStreamBuf，取消时抛出的异常穿过流的写函数
+            ProgressStreamBuf Buffer(*File.rdbuf(), Task);
+            File.basic_ios<char>::rdbuf(&Buffer);
+            // 压缩在ProgressStreamBuf之上进行，字节数按压缩后的数据计
+            unique_ptr<streambuf> pCompressor
+                = Porter::AttachCompressor(FileName, File);
+            File.exceptions(ios::badbit);
+            try {
+                pExporter->SaveToStream(File, AModel);
+                File.flush();
+                Task.AddElements(AModel.GetElementCount());
+                Timer.AddItems(AModel.GetElementCount());
+            }
+            catch (const IOTask::CANCELLED&) {
+                Result = Controller::Res::OPERATION_CANCELLED;
+            }
+            catch (...) {
+                Result = Controller::Res::FILE_NOT_AVAILABLE;
+            }
+            // 恢复文件自己的缓冲区，关闭时不再经过ProgressStreamBuf
+            File.exceptions(ios::goodbit);
+            File.basic_ios<char>::rdbuf(File.rdbuf());
+            if (Result != Controller::Res::OK) {
+                // 已取消或失败时删除临时文件，目标文件保持原有内容
+                Porter::DiscardOutput(File, TempName);
+                return Result;
+            }
+            try {
+                Porter::CommitOutput(File, TempName, FileName);
+            }
+            catch (...) {
+                Result = Controller::Res::FILE_NOT_AVAILABLE;
+            }
+        }
+        return Result;
+    }
+}
 
 //----------------------------------------------------------------------
 // 非静态Setter
@@ -49,30 +362,54 @@ shared_ptr<Controller> Controller::m_pInstance = nullptr;
 【返回值】Controller::Res枚举类型
 【开发者及日期】谭雯心 2024/8/9
 【更改记录】2024/8/12 谭雯心 增加了从文件中导入模型可能抛出的异常
+           2026/10/19 谭雯心 增加了M3B格式
+           2026/10/19 谭雯心 增加了计时探针
+           2026/10/19 谭雯心 改为由PorterRegistry选择导入器
+           2026/10/19 谭雯心 只打开一次文件并使用大缓冲区
+           2026/10/19 谭雯心 透明地解压gzip压缩的文件
+           2026/10/19 谭雯心 为导入的同步基线补上文件名
+           2026/10/19 谭雯心 截断或损坏的压缩文件导入失败
 *************************************************************************/
 Controller::Res Controller::LoadModelFromFile(
     const string& FileName, Model3D& AModel) {
-    // 创建Model3D_OBJ_Importer对象
-    Model3D_OBJ_Importer Importer;
-    string Extension;
-    // 获取文件扩展名，若不支持该文件类型，返回FILE_NOT_SUPPORTED
+    ScopedTimer Timer(PROBE_LOAD);
+    shared_ptr<PorterRegistry> pRegistry = PorterRegistry::GetInstance();
+    // 只打开一次文件，选择导入器和导入都使用同一个流
+    vector<char> Buffer;
+    ifstream File;
     try {
-        Extension = Importer.GetExtension(FileName);
-    } 
+        Porter::OpenInput(FileName, File, Buffer);
+    }
     catch (...) {
-        return Res::FILE_NOT_SUPPORTED;
+        // 文件无法打开时，仍按扩展名区分不支持的格式
+        return pRegistry->FindImporter(FileName) == nullptr
+            ? Res::FILE_NOT_SUPPORTED : Res::FILE_NOT_AVAILABLE;
     }
-    // 若不是.obj文件，返回FILE_NOT_SUPPORTED
-    if (Extension != "obj") {
+    // 内容为gzip数据时接入解压的流缓冲区，之后的读取都经过它
+    unique_ptr<streambuf> pFilter = Porter::AttachDecompressor(File);
+    // 选择导入器，若没有能读取的导入器，返回FILE_NOT_SUPPORTED
+    shared_ptr<const Model3D_Importer> pImporter
+        = pRegistry->FindImporter(FileName, File);
+    if (pImporter == nullptr) {
         return Res::FILE_NOT_SUPPORTED;
     }
     // 尝试从文件中导入模型，若失败，返回FILE_NOT_AVAILABLE
+    // 解压时发现截断或损坏所抛出的异常须穿过流的读函数，不能当作文件结束
+    File.exceptions(ios::badbit);
     try {
-        Importer.LoadFromFile(FileName, AModel);
+        AModel = pImporter->LoadFromStream(File);
     } 
     catch (...) {
         return Res::FILE_NOT_AVAILABLE;
     }
+    // 导入器记录了同步基线且文件未压缩时，之后可增量导出到该文件
+    if (AModel.GetBaseline().Revision != 0 && pFilter == nullptr
+        && !Porter::IsCompressedName(FileName)) {
+        Model3D::SyncBaseline Baseline = AModel.GetBaseline();
+        Baseline.FileName = FileName;
+        AModel.MarkSynced(Baseline);
+    }
+    Timer.AddItems(AModel.GetElementCount());
     return Res::OK;
 }
 /*************************************************************************
@@ -83,14 +420,25 @@ Controller::Res Controller::LoadModelFromFile(
 【返回值】Controller::Res枚举类型
 【开发者及日期】谭雯心 2024/8/9
 【更改记录】2024/8/12 谭雯心 增加了从文件中导入模型可能抛出的异常
+           2026/10/19 谭雯心 支持多线程并发访问
+           2026/10/19 谭雯心 记录编辑日志
 *************************************************************************/
 Controller::Res Controller::LoadModelFromFile(
     const string& FileName, size_t ModelIndex) {
-    // 若Index超出范围找不到指定模型，返回MODEL_NOT_FOUND
-    if (ModelIndex >= m_pModel.size()) {
+    // 若ModelIndex超出范围找不到指定模型，返回MODEL_NOT_FOUND
+    shared_ptr<ModelSlot> pSlot = FindSlot(ModelIndex);
+    if (pSlot == nullptr) {
         return Res::MODEL_NOT_FOUND;
     }
-    return LoadModelFromFile(FileName, *m_pModel[ModelIndex]);
+    // 在锁外导入到新模型，导入期间其他线程仍可查询原模型
+    shared_ptr<Model3D> pModel = make_shared<Model3D>();
+    Res Result = LoadModelFromFile(FileName, *pModel);
+    if (Result == Res::OK) {
+        unique_lock<shared_mutex> Lock(pSlot->Mutex);
+        pSlot->Journal.RecordModel(pSlot->pModel);
+        pSlot->pModel = pModel;
+    }
+    return Result;
 }
 /*************************************************************************
 【函数名称】LoadModelFromFile
@@ -104,37 +452,99 @@ Controller::Res Controller::LoadModelFromFile(const string& FileName) {
     return LoadModelFromFile(FileName, m_ullCurrentModelIndex);
 }
 /*************************************************************************
+【函数名称】LoadModelGroupsFromFile
+【函数功能】把OBJ文件的每个组或对象导入为一个新模型，依次添加到模型列表
+       末尾，并把第一个新模型设为当前模型。文件只解析一遍，各组共用顶点
+       坐标并行组装（见Model3D_OBJ_Importer::LoadGroupsFromStream）；
+       新模型一次发布，而不是逐个复制模型列表
+【参数】const string& FileName, 文件名
+       size_t& LoadedCount, 返回新添加的模型数量，失败时为0
+【返回值】Controller::Res枚举类型，不是OBJ文件时为FILE_NOT_SUPPORTED
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】2026/10/19 谭雯心 截断或损坏的压缩文件导入失败
+*************************************************************************/
+Controller::Res Controller::LoadModelGroupsFromFile(
+    const string& FileName, size_t& LoadedCount) {
+    ScopedTimer Timer(PROBE_LOAD);
+    LoadedCount = 0;
+    shared_ptr<PorterRegistry> pRegistry = PorterRegistry::GetInstance();
+    vector<char> Buffer;
+    ifstream File;
+    try {
+        Porter::OpenInput(FileName, File, Buffer);
+    }
+    catch (...) {
+        return pRegistry->FindImporter(FileName) == nullptr
+            ? Res::FILE_NOT_SUPPORTED : Res::FILE_NOT_AVAILABLE;
+    }
+    unique_ptr<streambuf> pFilter = Porter::AttachDecompressor(File);
+    // 只有OBJ格式有组
+    shared_ptr<const Model3D_OBJ_Importer> pImporter
+        = dynamic_pointer_cast<const Model3D_OBJ_Importer>(
+            pRegistry->FindImporter(FileName, File));
+    if (pImporter == nullptr) {
+        return Res::FILE_NOT_SUPPORTED;
+    }
+    vector<shared_ptr<Model3D>> Models;
+    // 解压时发现截断或损坏所抛出的异常须穿过流的读函数
+    File.exceptions(ios::badbit);
+    try {
+        Models = pImporter->LoadGroupsFromStream(File);
+    }
+    catch (...) {
+        return Res::FILE_NOT_AVAILABLE;
+    }
+    // 在锁外创建槽位，直接使用导入的模型
+    SlotList NewSlots;
+    NewSlots.reserve(Models.size());
+    size_t ElementCount = 0;
+    for (const shared_ptr<Model3D>& pModel : Models) {
+        shared_ptr<ModelSlot> pSlot = make_shared<ModelSlot>();
+        pSlot->pModel = pModel;
+        pSlot->Journal.SetBudget(m_ullJournalBudget);
+        ElementCount += pModel->GetElementCount();
+        NewSlots.push_back(pSlot);
+    }
+    if (!NewSlots.empty()) {
+        lock_guard<mutex> Lock(m_ListMutex);
+        SlotList Slots = *Snapshot();
+        size_t First = Slots.size();
+        Slots.insert(Slots.end(), NewSlots.begin(), NewSlots.end());
+        Publish(Slots);
+        m_ullCurrentModelIndex = First;
+    }
+    LoadedCount = NewSlots.size();
+    Timer.AddItems(ElementCount);
+    return Res::OK;
+}
+/*************************************************************************
 【函数名称】SaveModelToFile
 【函数功能】将模型导出到文件
 【参数】const string& FileName, 文件名
        const Model3D& AModel, 模型
 【返回值】Controller::Res枚举类型
 【开发者及日期】谭雯心 2024/8/9
-【更改记录】
+【更改记录】2026/10/19 谭雯心 增加了M3B格式
+           2026/10/19 谭雯心 增加了计时探针
+           2026/10/19 谭雯心 改为由PorterRegistry选择导出器
 *************************************************************************/
 Controller::Res Controller::SaveModelToFile(
     const string& FileName, const Model3D& AModel) {
-    // 创建Model3D_OBJ_Exporter对象
-    Model3D_OBJ_Exporter Exporter;
-    string Extension;
-    // 获取文件扩展名，若不支持该文件类型，返回FILE_NOT_SUPPORTED
-    try {
-        Extension = Exporter.GetExtension(FileName);
-    } 
-    catch (...) {
-        return Res::FILE_NOT_SUPPORTED;
-    }
-    // 若不是.obj文件，返回FILE_NOT_SUPPORTED
-    if (Extension != "obj") {
+    ScopedTimer Timer(PROBE_SAVE);
+    // 按扩展名选择导出器，若没有对应的导出器，返回FILE_NOT_SUPPORTED
+    shared_ptr<const Model3D_Exporter> pExporter
+        = PorterRegistry::GetInstance()->FindExporter(FileName);
+    if (pExporter == nullptr) {
         return Res::FILE_NOT_SUPPORTED;
     }
     // 尝试将模型导入到文件，若失败，返回FILE_NOT_AVAILABLE
     try {
-        Exporter.SaveToFile(FileName, AModel);
+        pExporter->SaveToFile(FileName, AModel);
     } 
     catch (...) {
         return Res::FILE_NOT_AVAILABLE;
     }
+    Timer.AddItems(AModel.GetElementCount());
     return Res::OK;
 }
 /*************************************************************************
@@ -144,15 +554,34 @@ Controller::Res Controller::SaveModelToFile(
        size_t ModelIndex, 模型位置
 【返回值】Controller::Res枚举类型
 【开发者及日期】谭雯心 2024/8/9
-【更改记录】
+【更改记录】2026/10/19 谭雯心 支持多线程并发访问
+           2026/10/19 谭雯心 M3B文件增量导出，只写出修改的部分
 *************************************************************************/
 Controller::Res Controller::SaveModelToFile(
     const string& FileName, size_t ModelIndex) {
     // 若ModelIndex超出范围找不到指定模型，返回MODEL_NOT_FOUND
-    if (ModelIndex < m_pModel.size()) {
-        return SaveModelToFile(FileName, *m_pModel[ModelIndex]);
+    shared_ptr<ModelSlot> pSlot = FindSlot(ModelIndex);
+    if (pSlot == nullptr) {
+        return Res::MODEL_NOT_FOUND;
     }
-    return Res::MODEL_NOT_FOUND;
+    // M3B格式增量导出，导出后更新模型的同步基线，须独占模型
+    shared_ptr<const Model3D_M3B_Exporter> pM3BExporter
+        = dynamic_pointer_cast<const Model3D_M3B_Exporter>(
+            PorterRegistry::GetInstance()->FindExporter(FileName));
+    if (pM3BExporter != nullptr && !Porter::IsCompressedName(FileName)) {
+        ScopedTimer Timer(PROBE_SAVE);
+        unique_lock<shared_mutex> Lock(pSlot->Mutex);
+        try {
+            pM3BExporter->SaveChangesToFile(FileName, *pSlot->pModel);
+        }
+        catch (...) {
+            return Res::FILE_NOT_AVAILABLE;
+        }
+        Timer.AddItems(pSlot->pModel->GetElementCount());
+        return Res::OK;
+    }
+    shared_lock<shared_mutex> Lock(pSlot->Mutex);
+    return SaveModelToFile(FileName, *pSlot->pModel);
 }
 /*************************************************************************
 【函数名称】SaveModelToFile
@@ -172,12 +601,19 @@ Controller::Res Controller::SaveModelToFile(const string& FileName) {
 【返回值】Controller::Res枚举类型
 【开发者及日期】谭雯心 2024/8/9
 【更改记录】2024/8/10 谭雯心 修改了创建模型的逻辑
+           2026/10/19 谭雯心 同步添加LOD链和后台导入的位置
+           2026/10/19 谭雯心 支持多线程并发访问
+           2026/10/19 谭雯心 设置编辑日志的内存预算
 *************************************************************************/
 Controller::Res Controller::CreateModel() {
-    // 创建模型并添加到模型列表
-    m_pModel.push_back(shared_ptr<Model3D>(new Model3D()));
+    lock_guard<mutex> Lock(m_ListMutex);
+    // 复制模型列表，添加新的槽位后发布
+    SlotList Slots = *Snapshot();
+    Slots.push_back(make_shared<ModelSlot>());
+    Slots.back()->Journal.SetBudget(m_ullJournalBudget);
+    Publish(Slots);
     // 设置当前模型为新创建的模型
-    m_ullCurrentModelIndex = m_pModel.size() - 1;
+    m_ullCurrentModelIndex = Slots.size() - 1;
     return Res::OK;
 }
 /*************************************************************************
@@ -188,18 +624,22 @@ Controller::Res Controller::CreateModel() {
 【返回值】Controller::Res枚举类型
 【开发者及日期】谭雯心 2024/8/9
 【更改记录】2024/8/12 谭雯心 修正了修改m_ullCurrentModelIndex的逻辑
+           2026/10/19 谭雯心 同步添加LOD链和后台导入的位置
+           2026/10/19 谭雯心 支持多线程并发访问
+           2026/10/19 谭雯心 设置编辑日志的内存预算
 *************************************************************************/
 Controller::Res Controller::AddModel(
     const Model3D& AModel, size_t ModelIndex) {
-    // 创建新的Model3D对象
-    shared_ptr<Model3D> pModel = make_shared<Model3D>(AModel);
-    // 若Index超出范围找不到指定模型，返回MODEL_NOT_FOUND
-    if (ModelIndex < m_pModel.size()) {
-        m_pModel.insert(m_pModel.begin() + ModelIndex, pModel);
-    } 
-    else {
-        m_pModel.push_back(pModel);
-    }
+    // 创建新的槽位，复制模型
+    shared_ptr<ModelSlot> pSlot = make_shared<ModelSlot>();
+    pSlot->pModel = make_shared<Model3D>(AModel);
+    pSlot->Journal.SetBudget(m_ullJournalBudget);
+    lock_guard<mutex> Lock(m_ListMutex);
+    // 复制模型列表，插入槽位后发布，若ModelIndex超出范围，添加到末尾
+    SlotList Slots = *Snapshot();
+    ModelIndex = min(ModelIndex, Slots.size());
+    Slots.insert(Slots.begin() + ModelIndex, pSlot);
+    Publish(Slots);
     // 若ModelIndex小于当前模型位置，当前模型位置加1
     if (ModelIndex < m_ullCurrentModelIndex) {
         m_ullCurrentModelIndex++;
@@ -212,10 +652,10 @@ Controller::Res Controller::AddModel(
 【参数】const Model3D& AModel, 要添加的模型
 【返回值】Controller::Res枚举类型
 【开发者及日期】谭雯心 2024/8/9
-【更改记录】
+【更改记录】2026/10/19 谭雯心 支持多线程并发访问
 *************************************************************************/
 Controller::Res Controller::AddModel(const Model3D& AModel) {
-    return AddModel(AModel, m_pModel.size());
+    return AddModel(AModel, numeric_limits<size_t>::max());
 }
 /*************************************************************************
 【函数名称】RemoveModel
@@ -223,20 +663,33 @@ Controller::Res Controller::AddModel(const Model3D& AModel) {
 【参数】size_t ModelIndex, 模型位置
 【返回值】Controller::Res枚举类型
 【开发者及日期】谭雯心 2024/8/9
-【更改记录】
+【更改记录】2026/10/19 谭雯心 同步删除LOD链和后台导入（等待其结束）
+           2026/10/19 谭雯心 支持多线程并发访问
 *************************************************************************/
 Controller::Res Controller::RemoveModel(size_t ModelIndex) {
-    // 若ModelIndex超出范围找不到指定模型，返回MODEL_NOT_FOUND
-    if (ModelIndex < m_pModel.size()) {
-        // 删除指定位置模型
-        m_pModel.erase(m_pModel.begin() + ModelIndex);
+    shared_ptr<ModelSlot> pRemoved;
+    {
+        lock_guard<mutex> Lock(m_ListMutex);
+        // 若ModelIndex超出范围找不到指定模型，返回MODEL_NOT_FOUND
+        SlotList Slots = *Snapshot();
+        if (ModelIndex >= Slots.size()) {
+            return Res::MODEL_NOT_FOUND;
+        }
+        // 复制模型列表，删除指定位置的槽位后发布
+        pRemoved = Slots[ModelIndex];
+        Slots.erase(Slots.begin() + ModelIndex);
+        Publish(Slots);
         // 若ModelIndex小于当前模型位置，当前模型位置减1
         if (ModelIndex < m_ullCurrentModelIndex) {
             m_ullCurrentModelIndex--;
         }
-        return Res::OK;
     }
-    return Res::MODEL_NOT_FOUND;
+    // 在列表锁外等待被删除模型的后台导入结束
+    unique_lock<shared_mutex> Lock(pRemoved->Mutex);
+    if (pRemoved->Pending.valid()) {
+        pRemoved->Pending.wait();
+    }
+    return Res::OK;
 }
 /*************************************************************************
 【函数名称】SetCurrentModel
@@ -244,11 +697,12 @@ Controller::Res Controller::RemoveModel(size_t ModelIndex) {
 【参数】size_t Index, 模型位置
 【返回值】Controller::Res枚举类型
 【开发者及日期】谭雯心 2024/8/9
-【更改记录】
+【更改记录】2026/10/19 谭雯心 支持多线程并发访问
 *************************************************************************/
 Controller::Res Controller::SetCurrentModel(size_t ModelIndex) {
+    lock_guard<mutex> Lock(m_ListMutex);
     // 若Index超出范围找不到指定模型，返回MODEL_NOT_FOUND
-    if (ModelIndex >= m_pModel.size()) {
+    if (ModelIndex >= Snapshot()->size()) {
         return Res::MODEL_NOT_FOUND;
     }
     m_ullCurrentModelIndex = ModelIndex;
@@ -261,25 +715,29 @@ Controller::Res Controller::SetCurrentModel(size_t ModelIndex) {
        const Model3D& AModel, 指定模型
 【返回值】Controller::Res枚举类型
 【开发者及日期】谭雯心 2024/8/9
-【更改记录】
+【更改记录】2026/10/19 谭雯心 增加了计时探针
+           2026/10/19 谭雯心 支持多线程并发访问
+           2026/10/19 谭雯心 记录编辑日志
 *************************************************************************/
 Controller::Res Controller::AddFace(
     const Face3D& AFace, const Model3D& AModel) {
-    // 遍历模型列表, 若找到指定模型，向该模型中添加面
-    for (auto it = m_pModel.begin(); it != m_pModel.end(); ++it) {
-        if (**it == AModel) {
-            // 若面已存在，返回FACE_ALREADY_EXISTS
-            try {
-                (*it)->AddFace(AFace);
-            } 
-            catch (...) {
-                return Res::FACE_ALREADY_EXISTS;
-            }
-            return Res::OK;
-        }
+    ScopedTimer Timer(PROBE_ADD_FACE);
+    // 查找指定模型，若找到，向该模型中添加面
+    shared_ptr<ModelSlot> pSlot = FindSlot(AModel);
+    if (pSlot == nullptr) {
+        // 若未找到指定模型，返回MODEL_NOT_FOUND
+        return Res::FACE_NOT_FOUND;
     }
-    // 若未找到指定模型，返回MODEL_NOT_FOUND
-    return Res::FACE_NOT_FOUND;
+    unique_lock<shared_mutex> Lock(pSlot->Mutex);
+    // 若面已存在，返回FACE_ALREADY_EXISTS
+    try {
+        pSlot->pModel->AddFace(AFace);
+    }
+    catch (...) {
+        return Res::FACE_ALREADY_EXISTS;
+    }
+    pSlot->Journal.RecordInsertFace(pSlot->pModel->GetFaceCount() - 1);
+    return Res::OK;
 }
 /*************************************************************************
 【函数名称】AddFace
@@ -288,22 +746,71 @@ Controller::Res Controller::AddFace(
        size_t Index, 模型位置
 【返回值】Controller::Res枚举类型
 【开发者及日期】谭雯心 2024/8/9
-【更改记录】
+【更改记录】2026/10/19 谭雯心 增加了计时探针
+           2026/10/19 谭雯心 支持多线程并发访问
+           2026/10/19 谭雯心 记录编辑日志
 *************************************************************************/
 Controller::Res Controller::AddFace(
     const Face3D& AFace, size_t ModelIndex) {
+    ScopedTimer Timer(PROBE_ADD_FACE);
     // 若Index超出范围找不到指定模型，返回MODEL_NOT_FOUND
-    if (ModelIndex < m_pModel.size()) {
+    shared_ptr<ModelSlot> pSlot = FindSlot(ModelIndex);
+    if (pSlot == nullptr) {
+        return Res::MODEL_NOT_FOUND;
+    }
+    unique_lock<shared_mutex> Lock(pSlot->Mutex);
+    // 若面已存在，返回FACE_ALREADY_EXISTS
+    try {
+        pSlot->pModel->AddFace(AFace);
+    }
+    catch (...) {
+        return Res::FACE_ALREADY_EXISTS;
+    }
+    pSlot->Journal.RecordInsertFace(pSlot->pModel->GetFaceCount() - 1);
+    return Res::OK;
+}
+/*************************************************************************
+【函数名称】AddFaces
+【函数功能】向指定位置的模型中依次添加多个面，只查找一次模型并一次性
+       预留容量，遇到第一个失败的面时停止
+【参数】const vector<Face3D>& Faces, 要添加的面
+       size_t ModelIndex, 模型位置
+       size_t& AddedCount, 成功添加的面数
+【返回值】Controller::Res枚举类型，第一个失败的面的结果
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】2026/10/19 谭雯心 支持多线程并发访问
+           2026/10/19 谭雯心 记录编辑日志
+*************************************************************************/
+Controller::Res Controller::AddFaces(
+    const vector<Face3D>& Faces, size_t ModelIndex, size_t& AddedCount) {
+    ScopedTimer Timer(PROBE_ADD_FACE);
+    AddedCount = 0;
+    // 若Index超出范围找不到指定模型，返回MODEL_NOT_FOUND
+    shared_ptr<ModelSlot> pSlot = FindSlot(ModelIndex);
+    if (pSlot == nullptr) {
+        return Res::MODEL_NOT_FOUND;
+    }
+    // 整批添加期间持有独占锁
+    unique_lock<shared_mutex> Lock(pSlot->Mutex);
+    pSlot->pModel->ReserveFaces(Faces.size());
+    // 整批添加记为一步编辑
+    pSlot->Journal.BeginGroup();
+    Res Result = Res::OK;
+    for (const auto& AFace : Faces) {
         // 若面已存在，返回FACE_ALREADY_EXISTS
         try {
-            m_pModel[ModelIndex]->AddFace(AFace);
-        } 
+            pSlot->pModel->AddFace(AFace);
+        }
         catch (...) {
-            return Res::FACE_ALREADY_EXISTS;
+            Result = Res::FACE_ALREADY_EXISTS;
+            break;
         }
-        return Res::OK;
+        pSlot->Journal.RecordInsertFace(pSlot->pModel->GetFaceCount() - 1);
+        AddedCount++;
     }
-    return Res::MODEL_NOT_FOUND;
+    pSlot->Journal.EndGroup();
+    Timer.AddItems(AddedCount);
+    return Result;
 }
 /*************************************************************************
 【函数名称】AddFace
@@ -315,7 +822,9 @@ Controller::Res Controller::AddFace(
        size_t Index, 模型位置
 【返回值】Controller::Res枚举类型
 【开发者及日期】谭雯心 2024/8/9
-【更改记录】
+【更改记录】2026/10/19 谭雯心 增加了计时探针
+           2026/10/19 谭雯心 支持多线程并发访问
+           2026/10/19 谭雯心 记录编辑日志
 *************************************************************************/
 Controller::Res Controller::AddFace(
     const double x1, const double y1,
@@ -323,6 +832,7 @@ Controller::Res Controller::AddFace(
     const double y2, const double z2,
     const double x3, const double y3,
     const double z3, size_t ModelIndex) {
+    ScopedTimer Timer(PROBE_ADD_FACE);
     // 创建三个点
     Point3D Point1(x1, y1, z1);
     Point3D Point2(x2, y2, z2);
@@ -331,21 +841,21 @@ Controller::Res Controller::AddFace(
     if (Point1 == Point2 || Point1 == Point3 || Point2 == Point3) {
         return Res::POINT_DUPLICATED;
     }
-    if (ModelIndex < m_pModel.size()) {
-        // 若面已存在，返回FACE_ALREADY_EXISTS
-        try {
-            m_pModel[ModelIndex]->AddFace(
-                Point3D(x1, y1, z1), 
-                Point3D(x2, y2, z2), 
-                Point3D(x3, y3, z3));
-        } 
-        catch (...) {
-            return Res::FACE_ALREADY_EXISTS;
-        }
-        return Res::OK;
-    }
     // 若Index超出范围找不到指定模型，返回MODEL_NOT_FOUND
-    return Res::MODEL_NOT_FOUND;
+    shared_ptr<ModelSlot> pSlot = FindSlot(ModelIndex);
+    if (pSlot == nullptr) {
+        return Res::MODEL_NOT_FOUND;
+    }
+    unique_lock<shared_mutex> Lock(pSlot->Mutex);
+    // 若面已存在，返回FACE_ALREADY_EXISTS
+    try {
+        pSlot->pModel->AddFace(Point1, Point2, Point3);
+    }
+    catch (...) {
+        return Res::FACE_ALREADY_EXISTS;
+    }
+    pSlot->Journal.RecordInsertFace(pSlot->pModel->GetFaceCount() - 1);
+    return Res::OK;
 }
 /*************************************************************************
 【函数名称】AddFace
@@ -372,17 +882,11 @@ Controller::Res Controller::AddFace(
 【参数】const Face3D& AFace, 要添加的面
 【返回值】Controller::Res枚举类型
 【开发者及日期】谭雯心 2024/8/9
-【更改记录】
+【更改记录】2026/10/19 谭雯心 增加了计时探针
+           2026/10/19 谭雯心 改为调用指定位置的重载，增加了范围检查
 *************************************************************************/
 Controller::Res Controller::AddFace(const Face3D& AFace) {
-    // 若面已存在，返回FACE_ALREADY_EXISTS
-    try {
-        m_pModel[m_ullCurrentModelIndex]->AddFace(AFace);
-    } 
-    catch (...) {
-        return Res::FACE_ALREADY_EXISTS;
-    }
-    return Res::OK;
+    return AddFace(AFace, m_ullCurrentModelIndex);
 }
 /*************************************************************************
 【函数名称】RemoveFace
@@ -391,19 +895,26 @@ Controller::Res Controller::AddFace(const Face3D& AFace) {
        const Model3D& AModel, 指定模型
 【返回值】Controller::Res枚举类型
 【开发者及日期】谭雯心 2024/8/9
-【更改记录】
+【更改记录】2026/10/19 谭雯心 支持多线程并发访问
+           2026/10/19 谭雯心 记录编辑日志，按位置删除
 *************************************************************************/
 Controller::Res Controller::RemoveFace(
     const Face3D& AFace, const Model3D& AModel) {
-    for (auto it = m_pModel.begin(); it != m_pModel.end(); ++it) {
-        // 若找到指定模型，从该模型中删除面
-        if (**it == AModel) {
-            (*it)->RemoveFace(AFace);
-            return Res::OK;
-        }
+    // 查找指定模型，若找到，从该模型中删除面
+    shared_ptr<ModelSlot> pSlot = FindSlot(AModel);
+    if (pSlot == nullptr) {
+        // 若未找到指定模型，返回MODEL_NOT_FOUND
+        return Res::FACE_NOT_FOUND;
+    }
+    unique_lock<shared_mutex> Lock(pSlot->Mutex);
+    // 若模型中没有该面，返回FACE_NOT_FOUND
+    size_t FaceIndex = pSlot->pModel->FindFace(AFace);
+    if (FaceIndex == pSlot->pModel->GetFaceCount()) {
+        return Res::FACE_NOT_FOUND;
     }
-    // 若未找到指定模型，返回MODEL_NOT_FOUND
-    return Res::FACE_NOT_FOUND;
+    pSlot->Journal.RecordRemoveFace(FaceIndex, AFace);
+    pSlot->pModel->RemoveFace(FaceIndex);
+    return Res::OK;
 }
 /*************************************************************************
 【函数名称】RemoveFace
@@ -412,19 +923,23 @@ Controller::Res Controller::RemoveFace(
        size_t FaceIndex, 面位置
 【返回值】Controller::Res枚举类型
 【开发者及日期】谭雯心 2024/8/9
-【更改记录】
+【更改记录】2026/10/19 谭雯心 支持多线程并发访问
+           2026/10/19 谭雯心 记录编辑日志，按位置删除
 *************************************************************************/
 Controller::Res Controller::RemoveFace(size_t ModelIndex, size_t FaceIndex) {
     // 若Index超出范围找不到指定模型，返回MODEL_NOT_FOUND
-    if (ModelIndex >= m_pModel.size()) {
+    shared_ptr<ModelSlot> pSlot = FindSlot(ModelIndex);
+    if (pSlot == nullptr) {
         return Res::MODEL_NOT_FOUND;
     }
+    unique_lock<shared_mutex> Lock(pSlot->Mutex);
     // 若Index超出范围找不到指定面，返回FACE_NOT_FOUND
-    if (FaceIndex >= m_pModel[ModelIndex]->Faces().size()) {
+    if (FaceIndex >= pSlot->pModel->GetFaceCount()) {
         return Res::FACE_NOT_FOUND;
     }
-    m_pModel[ModelIndex]->RemoveFace(
-        *m_pModel[ModelIndex]->Faces()[FaceIndex]);
+    pSlot->Journal.RecordRemoveFace(
+        FaceIndex, pSlot->pModel->GetFace(FaceIndex));
+    pSlot->pModel->RemoveFace(FaceIndex);
     return Res::OK;
 }
 /*************************************************************************
@@ -433,17 +948,10 @@ Controller::Res Controller::RemoveFace(size_t ModelIndex, size_t FaceIndex) {
 【参数】size_t FaceIndex, 面位置
 【返回值】Controller::Res枚举类型
 【开发者及日期】谭雯心 2024/8/9
-【更改记录】
+【更改记录】2026/10/19 谭雯心 改为调用指定位置的重载，增加了范围检查
 *************************************************************************/
 Controller::Res Controller::RemoveFace(size_t FaceIndex) {
-    // 若Index超出范围找不到指定面，返回FACE_NOT_FOUND
-    if (FaceIndex >= m_pModel[m_ullCurrentModelIndex]->Faces().size()) {
-        return Res::FACE_NOT_FOUND;
-    }
-    // 从当前模型中删除面
-    m_pModel[m_ullCurrentModelIndex]->RemoveFace(
-        *m_pModel[m_ullCurrentModelIndex]->Faces()[FaceIndex]);
-    return Res::OK;
+    return RemoveFace(m_ullCurrentModelIndex, FaceIndex);
 }
 /*************************************************************************
 【函数名称】AddLine
@@ -452,19 +960,23 @@ Controller::Res Controller::RemoveFace(size_t FaceIndex) {
        const Model3D& AModel, 指定模型
 【返回值】Controller::Res枚举类型
 【开发者及日期】谭雯心 2024/8/9
-【更改记录】
+【更改记录】2026/10/19 谭雯心 增加了计时探针
+           2026/10/19 谭雯心 支持多线程并发访问
+           2026/10/19 谭雯心 记录编辑日志
 *************************************************************************/
 Controller::Res Controller::AddLine(
     const Line3D& ALine, const Model3D& AModel) {
-    // 遍历模型列表, 若找到指定模型，向该模型中添加线
-    for (auto it = m_pModel.begin(); it != m_pModel.end(); ++it) {
-        if (**it == AModel) {
-            (*it)->AddLine(ALine);
-            return Res::OK;
-        }
+    ScopedTimer Timer(PROBE_ADD_LINE);
+    // 查找指定模型，若找到，向该模型中添加线
+    shared_ptr<ModelSlot> pSlot = FindSlot(AModel);
+    if (pSlot == nullptr) {
+        // 若未找到指定模型，返回MODEL_NOT_FOUND
+        return Res::MODEL_NOT_FOUND;
     }
-    // 若未找到指定模型，返回MODEL_NOT_FOUND
-    return Res::MODEL_NOT_FOUND;
+    unique_lock<shared_mutex> Lock(pSlot->Mutex);
+    pSlot->pModel->AddLine(ALine);
+    pSlot->Journal.RecordInsertLine(pSlot->pModel->GetLineCount() - 1);
+    return Res::OK;
 }
 /*************************************************************************
 【函数名称】AddLine
@@ -473,21 +985,70 @@ Controller::Res Controller::AddLine(
        size_t ModelIndex, 模型位置
 【返回值】Controller::Res枚举类型
 【开发者及日期】谭雯心 2024/8/9
-【更改记录】
+【更改记录】2026/10/19 谭雯心 增加了计时探针
+           2026/10/19 谭雯心 支持多线程并发访问
+           2026/10/19 谭雯心 记录编辑日志
 *************************************************************************/
 Controller::Res Controller::AddLine(const Line3D& ALine, size_t ModelIndex) {
-    if (ModelIndex < m_pModel.size()) {
+    ScopedTimer Timer(PROBE_ADD_LINE);
+    // 若ModelIndex超出范围找不到指定模型，返回MODEL_NOT_FOUND
+    shared_ptr<ModelSlot> pSlot = FindSlot(ModelIndex);
+    if (pSlot == nullptr) {
+        return Res::MODEL_NOT_FOUND;
+    }
+    unique_lock<shared_mutex> Lock(pSlot->Mutex);
+    // 若线已存在，返回LINE_ALREADY_EXISTS
+    try {
+        pSlot->pModel->AddLine(ALine);
+    }
+    catch (...) {
+        return Res::LINE_ALREADY_EXISTS;
+    }
+    pSlot->Journal.RecordInsertLine(pSlot->pModel->GetLineCount() - 1);
+    return Res::OK;
+}
+/*************************************************************************
+【函数名称】AddLines
+【函数功能】向指定位置的模型中依次添加多条线，只查找一次模型并一次性
+       预留容量，遇到第一条失败的线时停止
+【参数】const vector<Line3D>& Lines, 要添加的线
+       size_t ModelIndex, 模型位置
+       size_t& AddedCount, 成功添加的线数
+【返回值】Controller::Res枚举类型，第一条失败的线的结果
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】2026/10/19 谭雯心 支持多线程并发访问
+           2026/10/19 谭雯心 记录编辑日志
+*************************************************************************/
+Controller::Res Controller::AddLines(
+    const vector<Line3D>& Lines, size_t ModelIndex, size_t& AddedCount) {
+    ScopedTimer Timer(PROBE_ADD_LINE);
+    AddedCount = 0;
+    // 若ModelIndex超出范围找不到指定模型，返回MODEL_NOT_FOUND
+    shared_ptr<ModelSlot> pSlot = FindSlot(ModelIndex);
+    if (pSlot == nullptr) {
+        return Res::MODEL_NOT_FOUND;
+    }
+    // 整批添加期间持有独占锁
+    unique_lock<shared_mutex> Lock(pSlot->Mutex);
+    pSlot->pModel->ReserveLines(Lines.size());
+    // 整批添加记为一步编辑
+    pSlot->Journal.BeginGroup();
+    Res Result = Res::OK;
+    for (const auto& ALine : Lines) {
         // 若线已存在，返回LINE_ALREADY_EXISTS
         try {
-            m_pModel[ModelIndex]->AddLine(ALine);
-        } 
+            pSlot->pModel->AddLine(ALine);
+        }
         catch (...) {
-            return Res::LINE_ALREADY_EXISTS;
+            Result = Res::LINE_ALREADY_EXISTS;
+            break;
         }
-        return Res::OK;
+        pSlot->Journal.RecordInsertLine(pSlot->pModel->GetLineCount() - 1);
+        AddedCount++;
     }
-    // 若ModelIndex超出范围找不到指定模型，返回MODEL_NOT_FOUND
-    return Res::MODEL_NOT_FOUND;
+    pSlot->Journal.EndGroup();
+    Timer.AddItems(AddedCount);
+    return Result;
 }
 /*************************************************************************
 【函数名称】AddLine
@@ -498,26 +1059,31 @@ Controller::Res Controller::AddLine(const Line3D& ALine, size_t ModelIndex) {
        size_t ModelIndex, 模型位置
 【返回值】Controller::Res枚举类型
 【开发者及日期】谭雯心 2024/8/9
-【更改记录】
+【更改记录】2026/10/19 谭雯心 增加了计时探针
+           2026/10/19 谭雯心 支持多线程并发访问
+           2026/10/19 谭雯心 记录编辑日志
 *************************************************************************/
 Controller::Res Controller::AddLine(
     const double x1, const double y1,
     const double z1, const double x2,
     const double y2, const double z2,
     size_t ModelIndex) {
-    if (ModelIndex < m_pModel.size()) {
-        // 若线已存在，返回LINE_ALREADY_EXISTS
-        try {
-            m_pModel[ModelIndex]->AddLine(
-                Point3D(x1, y1, z1), Point3D(x2, y2, z2));
-        } 
-        catch (...) {
-            return Res::LINE_ALREADY_EXISTS;
-        }
-        return Res::OK;
-    }
+    ScopedTimer Timer(PROBE_ADD_LINE);
     // 若ModelIndex超出范围找不到指定模型，返回MODEL_NOT_FOUND
-    return Res::MODEL_NOT_FOUND;
+    shared_ptr<ModelSlot> pSlot = FindSlot(ModelIndex);
+    if (pSlot == nullptr) {
+        return Res::MODEL_NOT_FOUND;
+    }
+    unique_lock<shared_mutex> Lock(pSlot->Mutex);
+    // 若线已存在，返回LINE_ALREADY_EXISTS
+    try {
+        pSlot->pModel->AddLine(Point3D(x1, y1, z1), Point3D(x2, y2, z2));
+    }
+    catch (...) {
+        return Res::LINE_ALREADY_EXISTS;
+    }
+    pSlot->Journal.RecordInsertLine(pSlot->pModel->GetLineCount() - 1);
+    return Res::OK;
 }
 /*************************************************************************
 【函数名称】AddLine
@@ -541,17 +1107,11 @@ Controller::Res Controller::AddLine(
 【参数】const Line3D& ALine, 要添加的线
 【返回值】Controller::Res枚举类型
 【开发者及日期】谭雯心 2024/8/9
-【更改记录】
+【更改记录】2026/10/19 谭雯心 增加了计时探针
+           2026/10/19 谭雯心 改为调用指定位置的重载，增加了范围检查
 *************************************************************************/
 Controller::Res Controller::AddLine(const Line3D& ALine) {
-    // 若线已存在，返回LINE_ALREADY_EXISTS
-    try {
-        m_pModel[m_ullCurrentModelIndex]->AddLine(ALine);
-    } 
-    catch (...) {
-        return Res::LINE_ALREADY_EXISTS;
-    }
-    return Res::OK;
+    return AddLine(ALine, m_ullCurrentModelIndex);
 }
 /*************************************************************************
 【函数名称】RemoveLine
@@ -560,19 +1120,26 @@ Controller::Res Controller::AddLine(const Line3D& ALine) {
        const Model3D& AModel, 指定模型
 【返回值】Controller::Res枚举类型
 【开发者及日期】谭雯心 2024/8/9
-【更改记录】
+【更改记录】2026/10/19 谭雯心 支持多线程并发访问
+           2026/10/19 谭雯心 记录编辑日志，按位置删除
 *************************************************************************/
 Controller::Res Controller::RemoveLine(
     const Line3D& ALine, const Model3D& AModel) {
-    // 遍历模型列表, 若找到指定模型，从该模型中删除线
-    for (auto it = m_pModel.begin(); it != m_pModel.end(); ++it) {
-        if (**it == AModel) {
-            (*it)->RemoveLine(ALine);
-            return Res::OK;
-        }
+    // 查找指定模型，若找到，从该模型中删除线
+    shared_ptr<ModelSlot> pSlot = FindSlot(AModel);
+    if (pSlot == nullptr) {
+        // 若未找到指定模型，返回MODEL_NOT_FOUND
+        return Res::LINE_NOT_FOUND;
+    }
+    unique_lock<shared_mutex> Lock(pSlot->Mutex);
+    // 若模型中没有该线，返回LINE_NOT_FOUND
+    size_t LineIndex = pSlot->pModel->FindLine(ALine);
+    if (LineIndex == pSlot->pModel->GetLineCount()) {
+        return Res::LINE_NOT_FOUND;
     }
-    // 若未找到指定模型，返回MODEL_NOT_FOUND
-    return Res::LINE_NOT_FOUND;
+    pSlot->Journal.RecordRemoveLine(LineIndex, ALine);
+    pSlot->pModel->RemoveLine(LineIndex);
+    return Res::OK;
 }
 /*************************************************************************
 【函数名称】RemoveLine
@@ -581,19 +1148,23 @@ Controller::Res Controller::RemoveLine(
        size_t LineIndex, 线位置
 【返回值】Controller::Res枚举类型
 【开发者及日期】谭雯心 2024/8/9
-【更改记录】
+【更改记录】2026/10/19 谭雯心 支持多线程并发访问
+           2026/10/19 谭雯心 记录编辑日志，按位置删除
 *************************************************************************/
 Controller::Res Controller::RemoveLine(size_t ModelIndex, size_t LineIndex) {
     // 若Index超出范围找不到指定模型，返回MODEL_NOT_FOUND
-    if (ModelIndex >= m_pModel.size()) {
+    shared_ptr<ModelSlot> pSlot = FindSlot(ModelIndex);
+    if (pSlot == nullptr) {
         return Res::MODEL_NOT_FOUND;
     }
+    unique_lock<shared_mutex> Lock(pSlot->Mutex);
     // 若Index超出范围找不到指定线，返回LINE_NOT_FOUND
-    if (LineIndex >= m_pModel[ModelIndex]->Lines().size()) {
+    if (LineIndex >= pSlot->pModel->GetLineCount()) {
         return Res::LINE_NOT_FOUND;
     }
-    m_pModel[ModelIndex]->RemoveLine(
-        *m_pModel[ModelIndex]->Lines()[LineIndex]);
+    pSlot->Journal.RecordRemoveLine(
+        LineIndex, pSlot->pModel->GetLine(LineIndex));
+    pSlot->pModel->RemoveLine(LineIndex);
     return Res::OK;
 }
 /*************************************************************************
@@ -602,16 +1173,10 @@ Controller::Res Controller::RemoveLine(size_t ModelIndex, size_t LineIndex) {
 【参数】size_t LineIndex, 线位置
 【返回值】Controller::Res枚举类型
 【开发者及日期】谭雯心 2024/8/9
-【更改记录】
+【更改记录】2026/10/19 谭雯心 改为调用指定位置的重载，增加了范围检查
 *************************************************************************/
 Controller::Res Controller::RemoveLine(size_t LineIndex) {
-    // 若Index超出范围找不到指定线，返回LINE_NOT_FOUND
-    if (LineIndex >= m_pModel[m_ullCurrentModelIndex]->Lines().size()) {
-        return Res::LINE_NOT_FOUND;
-    }
-    m_pModel[m_ullCurrentModelIndex]->RemoveLine(
-        *m_pModel[m_ullCurrentModelIndex]->Lines()[LineIndex]);
-    return Res::OK;
+    return RemoveLine(m_ullCurrentModelIndex, LineIndex);
 }
 /*************************************************************************
 【函数名称】ChangeFacePoint
@@ -623,6 +1188,8 @@ Controller::Res Controller::RemoveLine(size_t LineIndex) {
 【返回值】Controller::Res枚举类型
 【开发者及日期】谭雯心 2024/8/9
 【更改记录】2024/8/12 谭雯心 增加了可能抛出的异常
+           2026/10/19 谭雯心 支持多线程并发访问
+           2026/10/19 谭雯心 记录编辑日志，只复制被修改的面而不复制模型
 *************************************************************************/
 Controller::Res Controller::ChangeFacePoint(
     size_t ModelIndex, 
@@ -630,35 +1197,36 @@ Controller::Res Controller::ChangeFacePoint(
     size_t PointIndex,
     const Point3D& NewPoint) {
     // 若ModelIndex超出范围找不到指定模型，返回MODEL_NOT_FOUND
-    if (ModelIndex >= m_pModel.size()) {
+    shared_ptr<ModelSlot> pSlot = FindSlot(ModelIndex);
+    if (pSlot == nullptr) {
         return Res::MODEL_NOT_FOUND;
     }
+    unique_lock<shared_mutex> Lock(pSlot->Mutex);
     // 若FaceIndex超出范围找不到指定面，返回FACE_NOT_FOUND
-    if (FaceIndex >= m_pModel[ModelIndex]->Faces().size()) {
+    if (FaceIndex >= pSlot->pModel->GetFaceCount()) {
         return Res::FACE_NOT_FOUND;
     }
     // 若PointIndex超出范围找不到指定点，返回POINT_NOT_FOUND
     if (PointIndex >= 3) {
         return Res::POINT_NOT_FOUND;
     }
-    // 创建新的Model3D对象
-    Model3D AModel = *m_pModel[ModelIndex];
+    // 只复制被修改的面
+    const Face3D& OldFace = pSlot->pModel->GetFace(FaceIndex);
+    Face3D NewFace(OldFace);
     // 若存在相同点，返回POINT_DUPLICATED
     try {
-        AModel.ChangeFacePoint(*AModel.Faces()[FaceIndex], PointIndex,
-                               NewPoint);
-    } 
+        NewFace.ChangePoint(NewPoint, PointIndex);
+    }
     catch (...) {
         return Res::POINT_DUPLICATED;
     }
     // 若修改点后的面已存在，返回FACE_ALREADY_EXISTS
-    if (m_pModel[ModelIndex]->ContainFace(*AModel.Faces()[FaceIndex])) {
+    if (pSlot->pModel->ContainFace(NewFace)) {
         return Res::FACE_ALREADY_EXISTS;
-    } 
-    else {
-        // 若无异常则修改指定模型指定面中的指定点
-        m_pModel[ModelIndex] = make_shared<Model3D>(AModel);
     }
+    // 若无异常则修改指定模型指定面中的指定点
+    pSlot->Journal.RecordChangeFace(FaceIndex, OldFace);
+    pSlot->pModel->ChangeFace(FaceIndex, NewFace);
     return Res::OK;
 }
 /*************************************************************************
@@ -728,6 +1296,8 @@ Controller::Res Controller::ChangeFacePoint(
 【返回值】Controller::Res枚举类型
 【开发者及日期】谭雯心 2024/8/9
 【更改记录】2024/8/12 谭雯心 增加了可能抛出的异常
+           2026/10/19 谭雯心 支持多线程并发访问
+           2026/10/19 谭雯心 记录编辑日志，只复制被修改的线而不复制模型
 *************************************************************************/
 Controller::Res Controller::ChangeLinePoint(
     size_t ModelIndex, 
@@ -735,34 +1305,35 @@ Controller::Res Controller::ChangeLinePoint(
     size_t PointIndex,
     const Point3D& NewPoint) {
     // 若ModlIndex超出范围找不到指定模型，返回MODEL_NOT_FOUND
-    if (ModelIndex >= m_pModel.size()) {
+    shared_ptr<ModelSlot> pSlot = FindSlot(ModelIndex);
+    if (pSlot == nullptr) {
         return Res::MODEL_NOT_FOUND;
     }
+    unique_lock<shared_mutex> Lock(pSlot->Mutex);
     // 若LineIndex超出范围找不到指定线，返回LINE_NOT_FOUND
-    if (LineIndex >= m_pModel[ModelIndex]->Lines().size()) {
+    if (LineIndex >= pSlot->pModel->GetLineCount()) {
         return Res::LINE_NOT_FOUND;
     }
     // 若PointIndex超出范围找不到指定点，返回POINT_NOT_FOUND
     if (PointIndex >= 2) {
         return Res::POINT_NOT_FOUND;
     }
-    // 创建新的Model3D对象
-    Model3D AModel = *m_pModel[ModelIndex];
+    // 只复制被修改的线
+    const Line3D& OldLine = pSlot->pModel->GetLine(LineIndex);
+    Line3D NewLine(OldLine);
     // 若存在相同点，返回POINT_DUPLICATED
     try {
-        AModel.ChangeLinePoint(
-            *AModel.Lines()[LineIndex], PointIndex, NewPoint);
-    } 
+        NewLine.ChangePoint(NewPoint, PointIndex);
+    }
     catch (...) {
         return Res::POINT_DUPLICATED;
     }
     // 若修改点后的线已存在，返回LINE_ALREADY_EXISTS
-    if (m_pModel[ModelIndex]->ContainLine(*AModel.Lines()[LineIndex])) {
+    if (pSlot->pModel->ContainLine(NewLine)) {
         return Res::LINE_ALREADY_EXISTS;
-    } 
-    else {
-        m_pModel[ModelIndex] = make_shared<Model3D>(AModel);
     }
+    pSlot->Journal.RecordChangeLine(LineIndex, OldLine);
+    pSlot->pModel->ChangeLine(LineIndex, NewLine);
     return Res::OK;
 }
 /*************************************************************************
@@ -827,17 +1398,22 @@ Controller::Res Controller::ChangeLinePoint(
 【参数】const Model3D& AModel, 指定模型
 【返回值】Controller::Res枚举类型
 【开发者及日期】谭雯心 2024/8/9
-【更改记录】
+【更改记录】2026/10/19 谭雯心 支持多线程并发访问
+           2026/10/19 谭雯心 记录编辑日志，清空的内容交换到日志中
 *************************************************************************/
 Controller::Res Controller::ClearFaces(const Model3D& AModel) {
-    for (auto it = m_pModel.begin(); it != m_pModel.end(); ++it) {
-        if (**it == AModel) {
-            (*it)->ClearFaces();
-            return Res::OK;
-        }
+    // 查找指定模型，若找到，清空该模型
+    shared_ptr<ModelSlot> pSlot = FindSlot(AModel);
+    if (pSlot == nullptr) {
+        // 若未找到指定模型，返回MODEL_NOT_FOUND
+        return Res::MODEL_NOT_FOUND;
     }
-    // 若遍历未找到指定模型，返回MODEL_NOT_FOUND
-    return Res::MODEL_NOT_FOUND;
+    unique_lock<shared_mutex> Lock(pSlot->Mutex);
+    // 把面列表换到日志中，撤销时再换回
+    shared_ptr<Model3D> pHolder = make_shared<Model3D>();
+    pSlot->pModel->SwapFaces(*pHolder);
+    pSlot->Journal.RecordSwapFaces(pHolder);
+    return Res::OK;
 }
 /*************************************************************************
 【函数名称】ClearFaces
@@ -845,15 +1421,21 @@ Controller::Res Controller::ClearFaces(const Model3D& AModel) {
 【参数】size_t Index, 模型位置
 【返回值】Controller::Res枚举类型
 【开发者及日期】谭雯心 2024/8/9
-【更改记录】
+【更改记录】2026/10/19 谭雯心 支持多线程并发访问
+           2026/10/19 谭雯心 记录编辑日志，清空的内容交换到日志中
 *************************************************************************/
 Controller::Res Controller::ClearFaces(size_t ModelIndex) {
-    if (ModelIndex < m_pModel.size()) {
-        m_pModel[ModelIndex]->ClearFaces();
-        return Res::OK;
-    }
     // 若ModelIndex超出范围找不到指定模型，返回MODEL_NOT_FOUND
-    return Res::MODEL_NOT_FOUND;
+    shared_ptr<ModelSlot> pSlot = FindSlot(ModelIndex);
+    if (pSlot == nullptr) {
+        return Res::MODEL_NOT_FOUND;
+    }
+    unique_lock<shared_mutex> Lock(pSlot->Mutex);
+    // 把面列表换到日志中，撤销时再换回
+    shared_ptr<Model3D> pHolder = make_shared<Model3D>();
+    pSlot->pModel->SwapFaces(*pHolder);
+    pSlot->Journal.RecordSwapFaces(pHolder);
+    return Res::OK;
 }
 /*************************************************************************
 【函数名称】ClearFaces
@@ -861,11 +1443,10 @@ Controller::Res Controller::ClearFaces(size_t ModelIndex) {
 【参数】无
 【返回值】Controller::Res枚举类型
 【开发者及日期】谭雯心 2024/8/9
-【更改记录】
+【更改记录】2026/10/19 谭雯心 改为调用指定位置的重载，增加了范围检查
 *************************************************************************/
 Controller::Res Controller::ClearFaces() {
-    m_pModel[m_ullCurrentModelIndex]->ClearFaces();
-    return Res::OK;
+    return ClearFaces(m_ullCurrentModelIndex);
 }
 /*************************************************************************
 【函数名称】ClearLines
@@ -873,17 +1454,22 @@ Controller::Res Controller::ClearFaces() {
 【参数】const Model3D& AModel, 指定模型
 【返回值】Controller::Res枚举类型
 【开发者及日期】谭雯心 2024/8/9
-【更改记录】
+【更改记录】2026/10/19 谭雯心 支持多线程并发访问
+           2026/10/19 谭雯心 记录编辑日志，清空的内容交换到日志中
 *************************************************************************/
 Controller::Res Controller::ClearLines(const Model3D& AModel) {
-    for (auto it = m_pModel.begin(); it != m_pModel.end(); ++it) {
-        if (**it == AModel) {
-            (*it)->ClearLines();
-            return Res::OK;
-        }
+    // 查找指定模型，若找到，清空该模型
+    shared_ptr<ModelSlot> pSlot = FindSlot(AModel);
+    if (pSlot == nullptr) {
+        // 若未找到指定模型，返回MODEL_NOT_FOUND
+        return Res::MODEL_NOT_FOUND;
     }
-    // 若遍历未找到指定模型，返回MODEL_NOT_FOUND
-    return Res::MODEL_NOT_FOUND;
+    unique_lock<shared_mutex> Lock(pSlot->Mutex);
+    // 把线列表换到日志中，撤销时再换回
+    shared_ptr<Model3D> pHolder = make_shared<Model3D>();
+    pSlot->pModel->SwapLines(*pHolder);
+    pSlot->Journal.RecordSwapLines(pHolder);
+    return Res::OK;
 }
 /*************************************************************************
 【函数名称】ClearLines
@@ -891,15 +1477,21 @@ Controller::Res Controller::ClearLines(const Model3D& AModel) {
 【参数】size_t Index, 模型位置
 【返回值】Controller::Res枚举类型
 【开发者及日期】谭雯心 2024/8/9
-【更改记录】
+【更改记录】2026/10/19 谭雯心 支持多线程并发访问
+           2026/10/19 谭雯心 记录编辑日志，清空的内容交换到日志中
 *************************************************************************/
 Controller::Res Controller::ClearLines(size_t ModelIndex) {
-    if (ModelIndex < m_pModel.size()) {
-        m_pModel[ModelIndex]->ClearLines();
-        return Res::OK;
-    }
     // 若ModelIndex超出范围找不到指定模型，返回MODEL_NOT_FOUND
-    return Res::MODEL_NOT_FOUND;
+    shared_ptr<ModelSlot> pSlot = FindSlot(ModelIndex);
+    if (pSlot == nullptr) {
+        return Res::MODEL_NOT_FOUND;
+    }
+    unique_lock<shared_mutex> Lock(pSlot->Mutex);
+    // 把线列表换到日志中，撤销时再换回
+    shared_ptr<Model3D> pHolder = make_shared<Model3D>();
+    pSlot->pModel->SwapLines(*pHolder);
+    pSlot->Journal.RecordSwapLines(pHolder);
+    return Res::OK;
 }
 /*************************************************************************
 【函数名称】ClearLines
@@ -907,11 +1499,10 @@ Controller::Res Controller::ClearLines(size_t ModelIndex) {
 【参数】无
 【返回值】Controller::Res枚举类型
 【开发者及日期】谭雯心 2024/8/9
-【更改记录】
+【更改记录】2026/10/19 谭雯心 改为调用指定位置的重载，增加了范围检查
 *************************************************************************/
 Controller::Res Controller::ClearLines() {
-    m_pModel[m_ullCurrentModelIndex]->ClearLines();
-    return Res::OK;
+    return ClearLines(m_ullCurrentModelIndex);
 }
 /*************************************************************************
 【函数名称】Clear
@@ -919,17 +1510,26 @@ Controller::Res Controller::ClearLines() {
 【参数】const Model3D& AModel, 指定模型
 【返回值】Controller::Res枚举类型
 【开发者及日期】谭雯心 2024/8/9
-【更改记录】
+【更改记录】2026/10/19 谭雯心 支持多线程并发访问
+           2026/10/19 谭雯心 记录编辑日志，清空的内容交换到日志中
 *************************************************************************/
 Controller::Res Controller::Clear(const Model3D& AModel) {
-    for (auto it = m_pModel.begin(); it != m_pModel.end(); ++it) {
-        if (**it == AModel) {
-            (*it)->Clear();
-            return Res::OK;
-        }
+    // 查找指定模型，若找到，清空该模型
+    shared_ptr<ModelSlot> pSlot = FindSlot(AModel);
+    if (pSlot == nullptr) {
+        // 若未找到指定模型，返回MODEL_NOT_FOUND
+        return Res::MODEL_NOT_FOUND;
     }
-    // 若遍历未找到指定模型，返回MODEL_NOT_FOUND
-    return Res::MODEL_NOT_FOUND;
+    unique_lock<shared_mutex> Lock(pSlot->Mutex);
+    // 把面列表和线列表换到日志中，两次交换记为一步
+    shared_ptr<Model3D> pHolder = make_shared<Model3D>();
+    pSlot->pModel->SwapFaces(*pHolder);
+    pSlot->pModel->SwapLines(*pHolder);
+    pSlot->Journal.BeginGroup();
+    pSlot->Journal.RecordSwapFaces(pHolder);
+    pSlot->Journal.RecordSwapLines(pHolder);
+    pSlot->Journal.EndGroup();
+    return Res::OK;
 }
 /*************************************************************************
 【函数名称】Clear
@@ -937,15 +1537,25 @@ Controller::Res Controller::Clear(const Model3D& AModel) {
 【参数】size_t Index, 模型位置
 【返回值】Controller::Res枚举类型
 【开发者及日期】谭雯心 2024/8/9
-【更改记录】
+【更改记录】2026/10/19 谭雯心 支持多线程并发访问
+           2026/10/19 谭雯心 记录编辑日志，清空的内容交换到日志中
 *************************************************************************/
 Controller::Res Controller::Clear(size_t ModelIndex) {
-    if (ModelIndex < m_pModel.size()) {
-        m_pModel[ModelIndex]->Clear();
-        return Res::OK;
-    }
     // 若ModelIndex超出范围找不到指定模型，返回MODEL_NOT_FOUND
-    return Res::MODEL_NOT_FOUND;
+    shared_ptr<ModelSlot> pSlot = FindSlot(ModelIndex);
+    if (pSlot == nullptr) {
+        return Res::MODEL_NOT_FOUND;
+    }
+    unique_lock<shared_mutex> Lock(pSlot->Mutex);
+    // 把面列表和线列表换到日志中，两次交换记为一步
+    shared_ptr<Model3D> pHolder = make_shared<Model3D>();
+    pSlot->pModel->SwapFaces(*pHolder);
+    pSlot->pModel->SwapLines(*pHolder);
+    pSlot->Journal.BeginGroup();
+    pSlot->Journal.RecordSwapFaces(pHolder);
+    pSlot->Journal.RecordSwapLines(pHolder);
+    pSlot->Journal.EndGroup();
+    return Res::OK;
 }
 /*************************************************************************
 【函数名称】Clear
@@ -953,11 +1563,10 @@ Controller::Res Controller::Clear(size_t ModelIndex) {
 【参数】无
 【返回值】Controller::Res枚举类型
 【开发者及日期】谭雯心 2024/8/9
-【更改记录】
+【更改记录】2026/10/19 谭雯心 改为调用指定位置的重载，增加了范围检查
 *************************************************************************/
 Controller::Res Controller::Clear() {
-    m_pModel[m_ullCurrentModelIndex]->Clear();
-    return Res::OK;
+    return Clear(m_ullCurrentModelIndex);
 }
 /*************************************************************************
 【函数名称】ChangeName
@@ -966,16 +1575,20 @@ Controller::Res Controller::Clear() {
        const string& NewName, 新名称
 【返回值】Controller::Res枚举类型
 【开发者及日期】谭雯心 2024/8/9
-【更改记录】
+【更改记录】2026/10/19 谭雯心 支持多线程并发访问
+           2026/10/19 谭雯心 记录编辑日志
 *************************************************************************/
 Controller::Res Controller::ChangeName(
     size_t ModelIndex, const string& NewName) {
-    if (ModelIndex < m_pModel.size()) {
-        m_pModel[ModelIndex]->Name = NewName;
-        return Res::OK;
-    }
     // 若ModelIndex超出范围找不到指定模型，返回MODEL_NOT_FOUND
-    return Res::MODEL_NOT_FOUND;
+    shared_ptr<ModelSlot> pSlot = FindSlot(ModelIndex);
+    if (pSlot == nullptr) {
+        return Res::MODEL_NOT_FOUND;
+    }
+    unique_lock<shared_mutex> Lock(pSlot->Mutex);
+    pSlot->Journal.RecordName(pSlot->pModel->Name);
+    pSlot->pModel->Name = NewName;
+    return Res::OK;
 }
 /*************************************************************************
 【函数名称】ChangeName
@@ -995,16 +1608,20 @@ Controller::Res Controller::ChangeName(const string& NewName) {
        const string& NewDescription, 新注释
 【返回值】Controller::Res枚举类型
 【开发者及日期】谭雯心 2024/8/9
-【更改记录】
+【更改记录】2026/10/19 谭雯心 支持多线程并发访问
+           2026/10/19 谭雯心 记录编辑日志
 *************************************************************************/
 Controller::Res Controller::ChangeDescription(
     size_t ModelIndex, const string& NewDescription) {
-    if (ModelIndex < m_pModel.size()) {
-        m_pModel[ModelIndex]->Description = NewDescription;
-        return Res::OK;
-    }
     // 若ModelIndex超出范围找不到指定模型，返回MODEL_NOT_FOUND
-    return Res::MODEL_NOT_FOUND;
+    shared_ptr<ModelSlot> pSlot = FindSlot(ModelIndex);
+    if (pSlot == nullptr) {
+        return Res::MODEL_NOT_FOUND;
+    }
+    unique_lock<shared_mutex> Lock(pSlot->Mutex);
+    pSlot->Journal.RecordDescription(pSlot->pModel->Description);
+    pSlot->pModel->Description = NewDescription;
+    return Res::OK;
 }
 /*************************************************************************
 【函数名称】ChangeDescription
@@ -1018,6 +1635,582 @@ Controller::Res Controller::ChangeDescription(const string& NewDescription) {
     return ChangeDescription(m_ullCurrentModelIndex, NewDescription);
 }
 
+/*************************************************************************
+【函数名称】BuildLOD
+【函数功能】为指定位置的模型生成LOD链，模型修改后需重新生成
+【参数】size_t ModelIndex, 模型位置
+       size_t LevelCount, 最多生成的级数（含原模型）
+【返回值】Controller::Res枚举类型
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】2026/10/19 谭雯心 支持多线程并发访问
+*************************************************************************/
+Controller::Res Controller::BuildLOD(size_t ModelIndex, size_t LevelCount) {
+    // 若ModelIndex超出范围找不到指定模型，返回MODEL_NOT_FOUND
+    shared_ptr<ModelSlot> pSlot = FindSlot(ModelIndex);
+    if (pSlot == nullptr) {
+        return Res::MODEL_NOT_FOUND;
+    }
+    // 在共享锁下生成LOD链，替换时再持有独占锁
+    shared_ptr<const LODChain> pChain;
+    {
+        shared_lock<shared_mutex> Lock(pSlot->Mutex);
+        pChain = make_shared<const LODChain>(
+            IndexedModel3D::FromModel(*pSlot->pModel), LevelCount);
+    }
+    unique_lock<shared_mutex> Lock(pSlot->Mutex);
+    pSlot->pLOD = pChain;
+    return Res::OK;
+}
+/*************************************************************************
+【函数名称】BuildLOD
+【函数功能】为当前模型生成LOD链
+【参数】size_t LevelCount, 最多生成的级数（含原模型）
+【返回值】Controller::Res枚举类型
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+Controller::Res Controller::BuildLOD(size_t LevelCount) {
+    return BuildLOD(m_ullCurrentModelIndex, LevelCount);
+}
+/*************************************************************************
+【函数名称】SaveLODToFile
+【函数功能】将指定位置模型的LOD链写入文件，
+       通常使用LODChain::SidecarFileName得到与模型文件对应的文件名
+【参数】const string& FileName, 文件名
+       size_t ModelIndex, 模型位置
+【返回值】Controller::Res枚举类型
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】2026/10/19 谭雯心 支持多线程并发访问
+*************************************************************************/
+Controller::Res Controller::SaveLODToFile(
+    const string& FileName, size_t ModelIndex) {
+    // 若ModelIndex超出范围找不到指定模型，返回MODEL_NOT_FOUND
+    shared_ptr<ModelSlot> pSlot = FindSlot(ModelIndex);
+    if (pSlot == nullptr) {
+        return Res::MODEL_NOT_FOUND;
+    }
+    shared_ptr<const LODChain> pChain;
+    {
+        shared_lock<shared_mutex> Lock(pSlot->Mutex);
+        pChain = pSlot->pLOD;
+    }
+    // 若尚未生成LOD链，返回LOD_NOT_FOUND
+    if (pChain == nullptr) {
+        return Res::LOD_NOT_FOUND;
+    }
+    // 尝试写入文件，若失败，返回FILE_NOT_AVAILABLE
+    try {
+        pChain->SaveToFile(FileName);
+    }
+    catch (...) {
+        return Res::FILE_NOT_AVAILABLE;
+    }
+    return Res::OK;
+}
+/*************************************************************************
+【函数名称】SaveLODToFile
+【函数功能】将当前模型的LOD链写入文件
+【参数】const string& FileName, 文件名
+【返回值】Controller::Res枚举类型
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+Controller::Res Controller::SaveLODToFile(const string& FileName) {
+    return SaveLODToFile(FileName, m_ullCurrentModelIndex);
+}
+/*************************************************************************
+【函数名称】LoadLODFromFile
+【函数功能】从文件读取指定位置模型的LOD链
+【参数】const string& FileName, 文件名
+       size_t ModelIndex, 模型位置
+【返回值】Controller::Res枚举类型
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】2026/10/19 谭雯心 支持多线程并发访问
+*************************************************************************/
+Controller::Res Controller::LoadLODFromFile(
+    const string& FileName, size_t ModelIndex) {
+    // 若ModelIndex超出范围找不到指定模型，返回MODEL_NOT_FOUND
+    shared_ptr<ModelSlot> pSlot = FindSlot(ModelIndex);
+    if (pSlot == nullptr) {
+        return Res::MODEL_NOT_FOUND;
+    }
+    // 在锁外读取文件，若失败，返回FILE_NOT_AVAILABLE
+    shared_ptr<const LODChain> pChain;
+    try {
+        pChain = make_shared<const LODChain>(LODChain::LoadFromFile(FileName));
+    }
+    catch (...) {
+        return Res::FILE_NOT_AVAILABLE;
+    }
+    unique_lock<shared_mutex> Lock(pSlot->Mutex);
+    pSlot->pLOD = pChain;
+    return Res::OK;
+}
+/*************************************************************************
+【函数名称】LoadLODFromFile
+【函数功能】从文件读取当前模型的LOD链
+【参数】const string& FileName, 文件名
+【返回值】Controller::Res枚举类型
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+Controller::Res Controller::LoadLODFromFile(const string& FileName) {
+    return LoadLODFromFile(FileName, m_ullCurrentModelIndex);
+}
+/*************************************************************************
+【函数名称】LoadModelInBackground
+【函数功能】在后台线程中导入指定位置的模型。若存在与模型文件对应的.lod文件，
+       先同步读取其中的LOD链，使导入完成前即可通过GetLODByFaceBudget等函数
+       获取粗糙模型；导入期间原模型保持不变，调用FinishLoading后被替换
+【参数】const string& FileName, 文件名
+       size_t ModelIndex, 模型位置
+【返回值】Controller::Res枚举类型
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】2026/10/19 谭雯心 支持多线程并发访问
+           2026/10/19 谭雯心 改为在IO线程池中导入
+           2026/10/19 谭雯心 改为由PorterRegistry选择导入器
+           2026/10/19 谭雯心 在独占锁内循环等待到没有未完成的导入后再登记，
+           并发调用不再覆盖彼此的导入
+*************************************************************************/
+Controller::Res Controller::LoadModelInBackground(
+    const string& FileName, size_t ModelIndex) {
+    // 若ModelIndex超出范围找不到指定模型，返回MODEL_NOT_FOUND
+    shared_ptr<ModelSlot> pSlot = FindSlot(ModelIndex);
+    if (pSlot == nullptr) {
+        return Res::MODEL_NOT_FOUND;
+    }
+    // 选择导入器，若没有能读取的导入器，返回FILE_NOT_SUPPORTED
+    shared_ptr<const Model3D_Importer> pImporter
+        = PorterRegistry::GetInstance()->FindImporter(FileName);
+    if (pImporter == nullptr) {
+        return Res::FILE_NOT_SUPPORTED;
+    }
+    // 读取LOD链，.lod文件不存在或损坏时不影响完整模型的导入
+    shared_ptr<const LODChain> pChain;
+    try {
+        pChain = make_shared<const LODChain>(
+            LODChain::LoadFromFile(LODChain::SidecarFileName(FileName)));
+    }
+    catch (...) {
+        pChain = nullptr;
+    }
+    // 检查和登记在同一把独占锁内进行：该位置尚有未完成的导入时，
+    // 先完成它（或等待正在完成它的线程），再重新检查
+    unique_lock<shared_mutex> Lock(pSlot->Mutex);
+    while (pSlot->Pending.valid() || pSlot->bWaiting) {
+        if (pSlot->Pending.valid()) {
+            Lock.unlock();
+            WaitPending(*pSlot);
+            Lock.lock();
+        }
+        else {
+            pSlot->WaitDone.wait(Lock);
+        }
+    }
+    pSlot->pLOD = pChain;
+    pSlot->bLoading = true;
+    // 在IO线程池中导入完整模型，异常由FinishLoading处理。任务存放在
+    // Pending的共享状态中，只持有槽位的weak_ptr，避免循环引用
+    weak_ptr<ModelSlot> wpSlot = pSlot;
+    auto ClearLoading = [wpSlot]() {
+        shared_ptr<ModelSlot> pOwner = wpSlot.lock();
+        if (pOwner != nullptr) {
+            pOwner->bLoading = false;
+        }
+    };
+    pSlot->Pending = m_IOPool.Submit<shared_ptr<Model3D>>(
+        [FileName, pImporter, ClearLoading]() {
+            shared_ptr<Model3D> pModel = make_shared<Model3D>();
+            try {
+                pImporter->LoadFromFile(FileName, *pModel);
+            }
+            catch (...) {
+                ClearLoading();
+                throw;
+            }
+            ClearLoading();
+            return pModel;
+        });
+    return Res::OK;
+}
+/*************************************************************************
+【函数名称】LoadModelInBackground
+【函数功能】在后台线程中导入当前模型
+【参数】const string& FileName, 文件名
+【返回值】Controller::Res枚举类型
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+Controller::Res Controller::LoadModelInBackground(const string& FileName) {
+    return LoadModelInBackground(FileName, m_ullCurrentModelIndex);
+}
+/*************************************************************************
+【函数名称】FinishLoading
+【函数功能】等待指定位置模型的后台导入完成，成功时用导入的模型替换原模型
+【参数】size_t ModelIndex, 模型位置
+【返回值】Controller::Res枚举类型，没有后台导入时返回OK
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】2026/10/19 谭雯心 支持多线程并发访问
+*************************************************************************/
+Controller::Res Controller::FinishLoading(size_t ModelIndex) {
+    // 若ModelIndex超出范围找不到指定模型，返回MODEL_NOT_FOUND
+    shared_ptr<ModelSlot> pSlot = FindSlot(ModelIndex);
+    if (pSlot == nullptr) {
+        return Res::MODEL_NOT_FOUND;
+    }
+    return WaitPending(*pSlot);
+}
+/*************************************************************************
+【函数名称】FinishLoading
+【函数功能】等待当前模型的后台导入完成并替换模型
+【参数】无
+【返回值】Controller::Res枚举类型
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+Controller::Res Controller::FinishLoading() {
+    return FinishLoading(m_ullCurrentModelIndex);
+}
+/*************************************************************************
+【函数名称】ConvertModelFile
+【函数功能】转换模型文件。目标格式有流式写出器（M3B、OBJ等）时流式转换，
+       不构造完整的Model3D，内存占用与批次大小有关而与模型大小无关；
+       只有导出器的格式（STL、PLY等）导入完整的模型后再导出
+【参数】const string& SourceFileName, 源文件名（任意可导入的格式）
+       const string& TargetFileName, 目标文件名（按扩展名选择写出器）
+【返回值】Controller::Res枚举类型
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】2026/10/19 谭雯心 增加了OBJ目标格式
+           2026/10/19 谭雯心 改为由PorterRegistry选择导入器和流式写出器
+           2026/10/19 谭雯心 改为经临时文件原子保存
+           2026/10/19 谭雯心 源文件和目标文件都可以是gzip压缩的
+           2026/10/19 谭雯心 没有流式写出器的格式改为导入后经导出器保存
+           2026/10/19 谭雯心 源文件只打开一次，选择导入器和读取使用同一个流
+*************************************************************************/
+Controller::Res Controller::ConvertModelFile(
+    const string& SourceFileName, const string& TargetFileName) {
+    shared_ptr<PorterRegistry> pRegistry = PorterRegistry::GetInstance();
+    // 只打开一次源文件，若没有能读取源文件的导入器，返回FILE_NOT_SUPPORTED
+    vector<char> SourceBuffer;
+    ifstream Source;
+    unique_ptr<streambuf> pSourceFilter;
+    shared_ptr<const Model3D_Importer> pImporter;
+    Res Result = OpenSource(SourceFileName, Source, SourceBuffer,
+        pSourceFilter, pImporter);
+    if (Result != Res::OK) {
+        return Result;
+    }
+    // 若目标格式没有流式写出器，导入完整的模型后经导出器保存，
+    // 导出器同样经临时文件原子保存；也没有导出器时返回FILE_NOT_SUPPORTED
+    if (!pRegistry->CanStreamWrite(TargetFileName)) {
+        shared_ptr<const Model3D_Exporter> pExporter
+            = pRegistry->FindExporter(TargetFileName);
+        if (pExporter == nullptr) {
+            return Res::FILE_NOT_SUPPORTED;
+        }
+        try {
+            Model3D AModel = pImporter->LoadFromStream(Source);
+            pExporter->SaveToFile(TargetFileName, AModel);
+        }
+        catch (...) {
+            return Res::FILE_NOT_AVAILABLE;
+        }
+        return Res::OK;
+    }
+    // 尝试边读边写临时文件，完成后原子地替换目标文件，
+    // 若失败，删除临时文件并返回FILE_NOT_AVAILABLE
+    string TempName = Porter::TempFileName(TargetFileName);
+    vector<char> Buffer;
+    ofstream File;
+    try {
+        Porter::OpenOutput(TempName, File, Buffer);
+    }
+    catch (...) {
+        return Res::FILE_NOT_AVAILABLE;
+    }
+    // 目标文件名以".gz"结尾时压缩写出
+    unique_ptr<streambuf> pFilter
+        = Porter::AttachCompressor(TargetFileName, File);
+    try {
+        unique_ptr<ModelStreamStage> pWriter
+            = pRegistry->CreateStreamWriter(TargetFileName, File);
+        {
+            ModelBatcher Batcher(*pWriter);
+            pImporter->StreamFromStream(Source, Batcher);
+            Batcher.Finish();
+        }
+        pWriter.reset();
+        Porter::CommitOutput(File, TempName, TargetFileName);
+    }
+    catch (...) {
+        Porter::DiscardOutput(File, TempName);
+        return Res::FILE_NOT_AVAILABLE;
+    }
+    return Res::OK;
+}
+/*************************************************************************
+【函数名称】LoadModelFromFileAsync
+【函数功能】在IO线程池中从文件导入指定位置的模型。导入期间原模型保持不变，
+       成功后被替换；pTask的回调在IO线程中报告已读字节数和已读面数与线数，
+       任何线程调用pTask->Cancel()后导入在下一个缓冲区或批次处停止，
+       原模型不变
+【参数】const string& FileName, 文件名
+       size_t ModelIndex, 模型位置
+       const shared_ptr<IOTask>& pTask, 报告进度和响应取消的任务，可为空
+【返回值】future<Controller::Res>，导入结束时就绪
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】2026/10/19 谭雯心 记录编辑日志
+*************************************************************************/
+future<Controller::Res> Controller::LoadModelFromFileAsync(
+    const string& FileName, size_t ModelIndex,
+    const shared_ptr<IOTask>& pTask) {
+    shared_ptr<IOTask> pRunning = pTask != nullptr ? pTask : make_shared<IOTask>();
+    // 若ModelIndex超出范围找不到指定模型，直接返回MODEL_NOT_FOUND
+    shared_ptr<ModelSlot> pSlot = FindSlot(ModelIndex);
+    if (pSlot == nullptr) {
+        pRunning->Finish();
+        promise<Res> Ready;
+        Ready.set_value(Res::MODEL_NOT_FOUND);
+        return Ready.get_future();
+    }
+    return m_IOPool.Submit<Res>([pSlot, FileName, pRunning]() {
+        Res Result = Res::OPERATION_CANCELLED;
+        if (!pRunning->IsCancelled()) {
+            shared_ptr<Model3D> pModel = make_shared<Model3D>();
+            Result = LoadWithProgress(FileName, *pModel, *pRunning);
+            // 导入完成后才取消的，同样保持原模型不变
+            if (Result == Res::OK && pRunning->IsCancelled()) {
+                Result = Res::OPERATION_CANCELLED;
+            }
+            if (Result == Res::OK) {
+                unique_lock<shared_mutex> Lock(pSlot->Mutex);
+                pSlot->Journal.RecordModel(pSlot->pModel);
+                pSlot->pModel = pModel;
+            }
+        }
+        pRunning->Finish();
+        return Result;
+    });
+}
+/*************************************************************************
+【函数名称】LoadModelFromFileAsync
+【函数功能】在IO线程池中从文件导入当前模型
+【参数】const string& FileName, 文件名
+       const shared_ptr<IOTask>& pTask, 报告进度和响应取消的任务，可为空
+【返回值】future<Controller::Res>，导入结束时就绪
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+future<Controller::Res> Controller::LoadModelFromFileAsync(
+    const string& FileName, const shared_ptr<IOTask>& pTask) {
+    return LoadModelFromFileAsync(FileName, m_ullCurrentModelIndex, pTask);
+}
+/*************************************************************************
+【函数名称】SaveModelToFileAsync
+【函数功能】在IO线程池中将指定位置的模型导出到文件，导出期间持有模型的
+       读锁；pTask的回调在IO线程中报告已写字节数，完成时报告面数与线数，
+       取消后导出在下一个缓冲区处停止并删除写了一部分的文件
+【参数】const string& FileName, 文件名
+       size_t ModelIndex, 模型位置
+       const shared_ptr<IOTask>& pTask, 报告进度和响应取消的任务，可为空
+【返回值】future<Controller::Res>，导出结束时就绪
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+future<Controller::Res> Controller::SaveModelToFileAsync(
+    const string& FileName, size_t ModelIndex,
+    const shared_ptr<IOTask>& pTask) {
+    shared_ptr<IOTask> pRunning = pTask != nullptr ? pTask : make_shared<IOTask>();
+    // 若ModelIndex超出范围找不到指定模型，直接返回MODEL_NOT_FOUND
+    shared_ptr<ModelSlot> pSlot = FindSlot(ModelIndex);
+    if (pSlot == nullptr) {
+        pRunning->Finish();
+        promise<Res> Ready;
+        Ready.set_value(Res::MODEL_NOT_FOUND);
+        return Ready.get_future();
+    }
+    return m_IOPool.Submit<Res>([pSlot, FileName, pRunning]() {
+        Res Result = Res::OPERATION_CANCELLED;
+        if (!pRunning->IsCancelled()) {
+            shared_lock<shared_mutex> Lock(pSlot->Mutex);
+            Result = SaveWithProgress(FileName, *pSlot->pModel, *pRunning);
+        }
+        pRunning->Finish();
+        return Result;
+    });
+}
+/*************************************************************************
+【函数名称】SaveModelToFileAsync
+【函数功能】在IO线程池中将当前模型导出到文件
+【参数】const string& FileName, 文件名
+       const shared_ptr<IOTask>& pTask, 报告进度和响应取消的任务，可为空
+【返回值】future<Controller::Res>，导出结束时就绪
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+future<Controller::Res> Controller::SaveModelToFileAsync(
+    const string& FileName, const shared_ptr<IOTask>& pTask) {
+    return SaveModelToFileAsync(FileName, m_ullCurrentModelIndex, pTask);
+}
+/*************************************************************************
+【函数名称】Undo
+【函数功能】撤销指定位置模型最近的一步编辑，开销与这一步编辑的规模有关，
+       与模型大小无关；撤销导入时换回导入前的模型
+【参数】size_t ModelIndex, 模型位置
+【返回值】Controller::Res枚举类型，没有可撤销的编辑时返回EDIT_NOT_FOUND
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+Controller::Res Controller::Undo(size_t ModelIndex) {
+    // 若ModelIndex超出范围找不到指定模型，返回MODEL_NOT_FOUND
+    shared_ptr<ModelSlot> pSlot = FindSlot(ModelIndex);
+    if (pSlot == nullptr) {
+        return Res::MODEL_NOT_FOUND;
+    }
+    unique_lock<shared_mutex> Lock(pSlot->Mutex);
+    // 日志与模型不一致时执行会失败，此时清空日志
+    try {
+        if (!pSlot->Journal.Undo(pSlot->pModel)) {
+            return Res::EDIT_NOT_FOUND;
+        }
+    }
+    catch (...) {
+        pSlot->Journal.Clear();
+        return Res::EDIT_NOT_FOUND;
+    }
+    return Res::OK;
+}
+/*************************************************************************
+【函数名称】Undo
+【函数功能】撤销当前模型最近的一步编辑
+【参数】无
+【返回值】Controller::Res枚举类型
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+Controller::Res Controller::Undo() {
+    return Undo(m_ullCurrentModelIndex);
+}
+/*************************************************************************
+【函数名称】Redo
+【函数功能】重做指定位置模型最近撤销的一步编辑，之后有新的编辑时
+       不能再重做
+【参数】size_t ModelIndex, 模型位置
+【返回值】Controller::Res枚举类型，没有可重做的编辑时返回EDIT_NOT_FOUND
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+Controller::Res Controller::Redo(size_t ModelIndex) {
+    // 若ModelIndex超出范围找不到指定模型，返回MODEL_NOT_FOUND
+    shared_ptr<ModelSlot> pSlot = FindSlot(ModelIndex);
+    if (pSlot == nullptr) {
+        return Res::MODEL_NOT_FOUND;
+    }
+    unique_lock<shared_mutex> Lock(pSlot->Mutex);
+    // 日志与模型不一致时执行会失败，此时清空日志
+    try {
+        if (!pSlot->Journal.Redo(pSlot->pModel)) {
+            return Res::EDIT_NOT_FOUND;
+        }
+    }
+    catch (...) {
+        pSlot->Journal.Clear();
+        return Res::EDIT_NOT_FOUND;
+    }
+    return Res::OK;
+}
+/*************************************************************************
+【函数名称】Redo
+【函数功能】重做当前模型最近撤销的一步编辑
+【参数】无
+【返回值】Controller::Res枚举类型
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+Controller::Res Controller::Redo() {
+    return Redo(m_ullCurrentModelIndex);
+}
+/*************************************************************************
+【函数名称】BeginEditGroup
+【函数功能】开始把指定位置模型之后的编辑合并为一步，可嵌套，
+       到最外层的EndEditGroup为止；撤销或重做会结束未结束的组
+【参数】size_t ModelIndex, 模型位置
+【返回值】Controller::Res枚举类型
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+Controller::Res Controller::BeginEditGroup(size_t ModelIndex) {
+    // 若ModelIndex超出范围找不到指定模型，返回MODEL_NOT_FOUND
+    shared_ptr<ModelSlot> pSlot = FindSlot(ModelIndex);
+    if (pSlot == nullptr) {
+        return Res::MODEL_NOT_FOUND;
+    }
+    unique_lock<shared_mutex> Lock(pSlot->Mutex);
+    pSlot->Journal.BeginGroup();
+    return Res::OK;
+}
+/*************************************************************************
+【函数名称】BeginEditGroup
+【函数功能】开始把当前模型之后的编辑合并为一步
+【参数】无
+【返回值】Controller::Res枚举类型
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+Controller::Res Controller::BeginEditGroup() {
+    return BeginEditGroup(m_ullCurrentModelIndex);
+}
+/*************************************************************************
+【函数名称】EndEditGroup
+【函数功能】结束合并指定位置模型的编辑
+【参数】size_t ModelIndex, 模型位置
+【返回值】Controller::Res枚举类型，没有未结束的组时返回EDIT_NOT_FOUND
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+Controller::Res Controller::EndEditGroup(size_t ModelIndex) {
+    // 若ModelIndex超出范围找不到指定模型，返回MODEL_NOT_FOUND
+    shared_ptr<ModelSlot> pSlot = FindSlot(ModelIndex);
+    if (pSlot == nullptr) {
+        return Res::MODEL_NOT_FOUND;
+    }
+    unique_lock<shared_mutex> Lock(pSlot->Mutex);
+    if (!pSlot->Journal.EndGroup()) {
+        return Res::EDIT_NOT_FOUND;
+    }
+    return Res::OK;
+}
+/*************************************************************************
+【函数名称】EndEditGroup
+【函数功能】结束合并当前模型的编辑
+【参数】无
+【返回值】Controller::Res枚举类型
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+Controller::Res Controller::EndEditGroup() {
+    return EndEditGroup(m_ullCurrentModelIndex);
+}
+/*************************************************************************
+【函数名称】SetJournalBudget
+【函数功能】设置每个模型编辑日志的内存预算，对已有模型立即生效，
+       超出预算的最早的编辑不能再撤销
+【参数】size_t Budget, 内存预算（字节）
+【返回值】Controller::Res枚举类型
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+Controller::Res Controller::SetJournalBudget(size_t Budget) {
+    // 先修改预算再遍历快照，之后创建的模型使用新预算
+    m_ullJournalBudget = Budget;
+    shared_ptr<const SlotList> pSlots = Snapshot();
+    for (const auto& pSlot : *pSlots) {
+        unique_lock<shared_mutex> Lock(pSlot->Mutex);
+        pSlot->Journal.SetBudget(Budget);
+    }
+    return Res::OK;
+}
+
 //---------------------------------------------------------------------
 // 静态成员函数
 //---------------------------------------------------------------------
@@ -1028,12 +2221,12 @@ Controller::Res Controller::ChangeDescription(const string& NewDescription) {
 【参数】无
 【返回值】shared_ptr<Controller>类型，Controller类的唯一实例
 【开发者及日期】谭雯心 2024/8/9
-【更改记录】
+【更改记录】2026/10/19 谭雯心 改为用call_once创建，保证线程安全
 *************************************************************************/
 shared_ptr<Controller> Controller::GetInstance() {
-    if (m_pInstance == nullptr) {
+    call_once(m_InstanceFlag, []() {
         m_pInstance = shared_ptr<Controller>(new Controller());
-    }
+    });
     return m_pInstance;
 }
 
@@ -1048,6 +2241,9 @@ shared_ptr<Controller> Controller::GetInstance() {
 【返回值】const string&
 【开发者及日期】谭雯心 2024/8/9
 【更改记录】2024/8/12 谭雯心 修改了将ControllerRes枚举类转为字符串的逻辑
+           2026/10/19 谭雯心 增加了LOD_NOT_FOUND
+           2026/10/19 谭雯心 增加了OPERATION_CANCELLED
+           2026/10/19 谭雯心 增加了EDIT_NOT_FOUND
 *************************************************************************/
 const string& Controller::ControllerResStr(ControllerRes Res) const {
     // ControllerRes枚举类型的字符串
@@ -1063,24 +2259,43 @@ const string& Controller::ControllerResStr(ControllerRes Res) const {
                                     "LINE_NOT_FOUND",
                                     "MODEL_ALREADY_EXISTS",
                                     "MODEL_NOT_FOUND",
-                                    "UNKNOWN_TYPE"};
+                                    "LOD_NOT_FOUND",
+                                    "UNKNOWN_TYPE",
+                                    "OPERATION_CANCELLED",
+                                    "EDIT_NOT_FOUND"};
     return ResStr[static_cast<size_t>(Res)];
 }
 /*************************************************************************
+【函数名称】GetModelCount
+【函数功能】获取模型数量
+【参数】无
+【返回值】size_t，当前快照中的模型数量
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+size_t Controller::GetModelCount() const {
+    return Snapshot()->size();
+}
+/*************************************************************************
 【函数名称】ListALLModelInfo
 【函数功能】列出所有模型统计信息
 【参数】ModelInfoList& InfoList, 模型统计信息列表
 【返回值】Controller::Res枚举类型
 【开发者及日期】谭雯心 2024/8/9
-【更改记录】
+【更改记录】2026/10/19 谭雯心 修正了清空列表后越界写入的问题，支持多线程并发访问
+           2026/10/19 谭雯心 各模型由TaskScheduler并行统计
 *************************************************************************/
 Controller::Res Controller::ListALLModelInfo(ModelInfoList& InfoList) const {
-    // 清空模型统计信息列表
-    InfoList.clear();
-    // 遍历模型列表，调用ListModelInfo函数存储所有模型统计信息
-    for (size_t i = 0; i < m_pModel.size(); i++) {
-        ListModelInfo(i, InfoList[i]);
-    }
+    // 遍历同一个快照，按快照中的模型数设置列表长度
+    shared_ptr<const SlotList> pSlots = Snapshot();
+    InfoList.resize(pSlots->size());
+    TaskScheduler::GetInstance()->ParallelFor(0, pSlots->size(), 1,
+        [&](size_t First, size_t Last) {
+            for (size_t i = First; i < Last; i++) {
+                shared_lock<shared_mutex> Lock((*pSlots)[i]->Mutex);
+                FillModelInfo(*(*pSlots)[i]->pModel, InfoList[i]);
+            }
+        });
     return Res::OK;
 }
 /*************************************************************************
@@ -1091,23 +2306,22 @@ Controller::Res Controller::ListALLModelInfo(ModelInfoList& InfoList) const {
 【返回值】Controller::Res枚举类型
 【开发者及日期】谭雯心 2024/8/9
 【更改记录】2024/8/10 谭雯心 修改了获取模型信息的方式
+           2026/10/19 谭雯心 增加了计时探针
+           2026/10/19 谭雯心 支持多线程并发访问
 *************************************************************************/
 Controller::Res Controller::ListModelInfo(
     size_t ModelIndex, ModelInfo& Info) const {
-    // 若ModelIndex在模型列表范围内，调用Model3D类的相关函数获取模型统计信息
-    if (ModelIndex < m_pModel.size()) {
-        Info.Name = m_pModel[ModelIndex]->Name;
-        Info.FaceCount = m_pModel[ModelIndex]->GetFaceCount();
-        Info.LineCount = m_pModel[ModelIndex]->GetLineCount();
-        Info.PointCount = m_pModel[ModelIndex]->GetPointCount();
-        Info.ElementCount = m_pModel[ModelIndex]->GetElementCount();
-        Info.Area = m_pModel[ModelIndex]->Area();
-        Info.Length = m_pModel[ModelIndex]->Length();
-        Info.Volume = m_pModel[ModelIndex]->BoundingBoxVolume();
-        return Res::OK;
-    }
+    ScopedTimer Timer(PROBE_LIST_INFO);
     // 若ModelIndex超出范围找不到指定模型，返回MODEL_NOT_FOUND
-    return Res::MODEL_NOT_FOUND;
+    shared_ptr<ModelSlot> pSlot = FindSlot(ModelIndex);
+    if (pSlot == nullptr) {
+        return Res::MODEL_NOT_FOUND;
+    }
+    // 持有共享锁，调用Model3D类的相关函数获取模型统计信息
+    shared_lock<shared_mutex> Lock(pSlot->Mutex);
+    FillModelInfo(*pSlot->pModel, Info);
+    Timer.AddItems(Info.ElementCount);
+    return Res::OK;
 }
 /*************************************************************************
 【函数名称】ListModelInfo
@@ -1121,22 +2335,66 @@ Controller::Res Controller::ListModelInfo(ModelInfo& Info) const {
     return ListModelInfo(m_ullCurrentModelIndex, Info);
 }
 /*************************************************************************
+【函数名称】StreamModelInfo
+【函数功能】流式统计模型文件的信息，不导入模型，内存占用与模型大小无关。
+       文件中重复的面和线会被重复计数
+【参数】const string& FileName, 文件名（任意可导入的格式）
+       ModelInfo& Info, 模型统计信息
+【返回值】Controller::Res枚举类型
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】2026/10/19 谭雯心 改为由PorterRegistry选择导入器
+           2026/10/19 谭雯心 文件只打开一次，选择导入器和读取使用同一个流
+*************************************************************************/
+Controller::Res Controller::StreamModelInfo(
+    const string& FileName, ModelInfo& Info) const {
+    // 只打开一次文件，若没有能读取的导入器，返回FILE_NOT_SUPPORTED
+    vector<char> Buffer;
+    ifstream File;
+    unique_ptr<streambuf> pFilter;
+    shared_ptr<const Model3D_Importer> pImporter;
+    Res Result = OpenSource(FileName, File, Buffer, pFilter, pImporter);
+    if (Result != Res::OK) {
+        return Result;
+    }
+    // 尝试流式读取文件，若失败，返回FILE_NOT_AVAILABLE
+    ModelStatisticsStage Statistics;
+    try {
+        ModelBatcher Batcher(Statistics);
+        pImporter->StreamFromStream(File, Batcher);
+        Batcher.Finish();
+    }
+    catch (...) {
+        return Res::FILE_NOT_AVAILABLE;
+    }
+    Info.Name = Statistics.GetName();
+    Info.FaceCount = Statistics.GetFaceCount();
+    Info.LineCount = Statistics.GetLineCount();
+    Info.PointCount = Statistics.GetPointCount();
+    Info.ElementCount = Statistics.GetElementCount();
+    Info.Area = Statistics.GetArea();
+    Info.Length = Statistics.GetLength();
+    Info.Volume = Statistics.GetBoundingBoxVolume();
+    return Res::OK;
+}
+/*************************************************************************
 【函数名称】ListFaceInfo
 【函数功能】列出指定位置模型中所有Face3D的信息
 【参数】size_t ModelIndex, 模型位置
        FaceInfoList& Info, 面信息列表
 【返回值】Controller::Res枚举类型
 【开发者及日期】谭雯心 2024/8/9
-【更改记录】
+【更改记录】2026/10/19 谭雯心 支持多线程并发访问
 *************************************************************************/
 Controller::Res Controller::ListFaceInfo(
     size_t ModelIndex, FaceInfoList& InfoList) const {
     // 若ModelIndex超出范围找不到指定模型，返回MODEL_NOT_FOUND
-    if (ModelIndex >= m_pModel.size()) {
+    shared_ptr<ModelSlot> pSlot = FindSlot(ModelIndex);
+    if (pSlot == nullptr) {
         return Res::MODEL_NOT_FOUND;
     }
+    shared_lock<shared_mutex> Lock(pSlot->Mutex);
     InfoList.clear();
-    for (auto Face : m_pModel[ModelIndex]->Faces()) {
+    for (auto Face : pSlot->pModel->Faces()) {
         FaceInfo AFaceInfo;
         for (size_t i = 0; i < 3; i++) {
             // 将Face3D中的点坐标存入FaceInfo中
@@ -1167,27 +2425,29 @@ Controller::Res Controller::ListFaceInfo(FaceInfoList& InfoList) const {
        LineInfoList& Info, 线信息列表
 【返回值】Controller::Res枚举类型
 【开发者及日期】谭雯心 2024/8/9
-【更改记录】
+【更改记录】2026/10/19 谭雯心 支持多线程并发访问
 *************************************************************************/
 Controller::Res Controller::ListLineInfo(
     size_t ModelIndex, LineInfoList& InfoList) const {
-    if (ModelIndex < m_pModel.size()) {
-        InfoList.clear();
-        for (auto Line : m_pModel[ModelIndex]->Lines()) {
-            LineInfo ALineInfo;
-            for (size_t i = 0; i < 2; i++) {
-                // 将Line3D中的点坐标存入LineInfo中
-                ALineInfo.Points[i].x = Line->Points[i].X;
-                ALineInfo.Points[i].y = Line->Points[i].Y;
-                ALineInfo.Points[i].z = Line->Points[i].Z;
-            }
-            ALineInfo.Length = Line->Length();
-            InfoList.push_back(ALineInfo);
+    // 若ModelIndex超出范围找不到指定模型，返回MODEL_NOT_FOUND
+    shared_ptr<ModelSlot> pSlot = FindSlot(ModelIndex);
+    if (pSlot == nullptr) {
+        return Res::MODEL_NOT_FOUND;
+    }
+    shared_lock<shared_mutex> Lock(pSlot->Mutex);
+    InfoList.clear();
+    for (auto Line : pSlot->pModel->Lines()) {
+        LineInfo ALineInfo;
+        for (size_t i = 0; i < 2; i++) {
+            // 将Line3D中的点坐标存入LineInfo中
+            ALineInfo.Points[i].x = Line->Points[i].X;
+            ALineInfo.Points[i].y = Line->Points[i].Y;
+            ALineInfo.Points[i].z = Line->Points[i].Z;
         }
-        return Res::OK;
+        ALineInfo.Length = Line->Length();
+        InfoList.push_back(ALineInfo);
     }
-    // 若ModelIndex超出范围找不到指定模型，返回MODEL_NOT_FOUND
-    return Res::MODEL_NOT_FOUND;
+    return Res::OK;
 }
 /*************************************************************************
 【函数名称】ListLineInfo
@@ -1200,3 +2460,382 @@ Controller::Res Controller::ListLineInfo(
 Controller::Res Controller::ListLineInfo(LineInfoList& InfoList) const {
     return ListLineInfo(m_ullCurrentModelIndex, InfoList);
 }
+/*************************************************************************
+【函数名称】FindSelfIntersections
+【函数功能】检测指定位置模型的自相交
+【参数】size_t ModelIndex, 模型位置
+       FacePairList& Pairs, 相交的面编号对（编号与ListFaceInfo一致）
+【返回值】Controller::Res枚举类型
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】2026/10/19 谭雯心 支持多线程并发访问
+*************************************************************************/
+Controller::Res Controller::FindSelfIntersections(
+    size_t ModelIndex, FacePairList& Pairs) const {
+    // 若ModelIndex超出范围找不到指定模型，返回MODEL_NOT_FOUND
+    shared_ptr<ModelSlot> pSlot = FindSlot(ModelIndex);
+    if (pSlot == nullptr) {
+        return Res::MODEL_NOT_FOUND;
+    }
+    shared_lock<shared_mutex> Lock(pSlot->Mutex);
+    Pairs = MeshIntersector().SelfIntersections(*pSlot->pModel);
+    return Res::OK;
+}
+/*************************************************************************
+【函数名称】FindSelfIntersections
+【函数功能】检测当前模型的自相交
+【参数】FacePairList& Pairs, 相交的面编号对
+【返回值】Controller::Res枚举类型
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+Controller::Res Controller::FindSelfIntersections(FacePairList& Pairs) const {
+    return FindSelfIntersections(m_ullCurrentModelIndex, Pairs);
+}
+/*************************************************************************
+【函数名称】FindInterference
+【函数功能】检测两个指定位置模型之间的干涉
+【参数】size_t FirstIndex, 第一个模型位置
+       size_t SecondIndex, 第二个模型位置
+       FacePairList& Pairs, 相交的面编号对，第一项属于第一个模型
+【返回值】Controller::Res枚举类型
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】2026/10/19 谭雯心 支持多线程并发访问
+*************************************************************************/
+Controller::Res Controller::FindInterference(
+    size_t FirstIndex, size_t SecondIndex, FacePairList& Pairs) const {
+    // 若任一位置超出范围找不到指定模型，返回MODEL_NOT_FOUND
+    shared_ptr<ModelSlot> pFirst = FindSlot(FirstIndex);
+    shared_ptr<ModelSlot> pSecond = FindSlot(SecondIndex);
+    if (pFirst == nullptr || pSecond == nullptr) {
+        return Res::MODEL_NOT_FOUND;
+    }
+    // 按槽位地址顺序持有两个共享锁，同一模型只加一次锁
+    ModelSlot* pLow = min(pFirst.get(), pSecond.get(), less<ModelSlot*>());
+    ModelSlot* pHigh = max(pFirst.get(), pSecond.get(), less<ModelSlot*>());
+    shared_lock<shared_mutex> LowLock(pLow->Mutex);
+    shared_lock<shared_mutex> HighLock;
+    if (pHigh != pLow) {
+        HighLock = shared_lock<shared_mutex>(pHigh->Mutex);
+    }
+    Pairs = MeshIntersector().Interference(*pFirst->pModel, *pSecond->pModel);
+    return Res::OK;
+}
+/*************************************************************************
+【函数名称】GetMemoryUsage
+【函数功能】获取指定位置模型的内存占用明细
+【参数】size_t ModelIndex, 模型位置
+       MemoryUsage& Usage, 内存占用明细
+【返回值】Controller::Res枚举类型
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】2026/10/19 谭雯心 支持多线程并发访问
+*************************************************************************/
+Controller::Res Controller::GetMemoryUsage(
+    size_t ModelIndex, MemoryUsage& Usage) const {
+    // 若ModelIndex超出范围找不到指定模型，返回MODEL_NOT_FOUND
+    shared_ptr<ModelSlot> pSlot = FindSlot(ModelIndex);
+    if (pSlot == nullptr) {
+        return Res::MODEL_NOT_FOUND;
+    }
+    shared_lock<shared_mutex> Lock(pSlot->Mutex);
+    Usage = pSlot->pModel->GetMemoryUsage();
+    return Res::OK;
+}
+/*************************************************************************
+【函数名称】GetMemoryUsage
+【函数功能】获取当前模型的内存占用明细
+【参数】MemoryUsage& Usage, 内存占用明细
+【返回值】Controller::Res枚举类型
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+Controller::Res Controller::GetMemoryUsage(MemoryUsage& Usage) const {
+    return GetMemoryUsage(m_ullCurrentModelIndex, Usage);
+}
+/*************************************************************************
+【函数名称】GetTotalMemoryUsage
+【函数功能】获取全部模型的内存占用明细之和
+【参数】MemoryUsage& Usage, 内存占用明细
+【返回值】Controller::Res枚举类型
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】2026/10/19 谭雯心 支持多线程并发访问
+           2026/10/19 谭雯心 各模型由TaskScheduler并行统计
+*************************************************************************/
+Controller::Res Controller::GetTotalMemoryUsage(MemoryUsage& Usage) const {
+    shared_ptr<const SlotList> pSlots = Snapshot();
+    Usage = TaskScheduler::GetInstance()->ParallelReduce<MemoryUsage>(
+        0, pSlots->size(), 1, MemoryUsage(),
+        [&](size_t First, size_t Last) {
+            MemoryUsage Part;
+            for (size_t i = First; i < Last; i++) {
+                shared_lock<shared_mutex> Lock((*pSlots)[i]->Mutex);
+                Part += (*pSlots)[i]->pModel->GetMemoryUsage();
+            }
+            return Part;
+        },
+        [](const MemoryUsage& First, const MemoryUsage& Second) {
+            MemoryUsage Result = First;
+            Result += Second;
+            return Result;
+        });
+    return Res::OK;
+}
+/*************************************************************************
+【函数名称】GetJournalInfo
+【函数功能】获取指定位置模型编辑日志的信息
+【参数】size_t ModelIndex, 模型位置
+       JournalInfo& Info, 编辑日志信息
+【返回值】Controller::Res枚举类型
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+Controller::Res Controller::GetJournalInfo(
+    size_t ModelIndex, JournalInfo& Info) const {
+    // 若ModelIndex超出范围找不到指定模型，返回MODEL_NOT_FOUND
+    shared_ptr<ModelSlot> pSlot = FindSlot(ModelIndex);
+    if (pSlot == nullptr) {
+        return Res::MODEL_NOT_FOUND;
+    }
+    shared_lock<shared_mutex> Lock(pSlot->Mutex);
+    Info.UndoCount = pSlot->Journal.GetUndoCount();
+    Info.RedoCount = pSlot->Journal.GetRedoCount();
+    Info.Bytes = pSlot->Journal.GetBytes();
+    Info.Budget = pSlot->Journal.GetBudget();
+    return Res::OK;
+}
+/*************************************************************************
+【函数名称】GetJournalInfo
+【函数功能】获取当前模型编辑日志的信息
+【参数】JournalInfo& Info, 编辑日志信息
+【返回值】Controller::Res枚举类型
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+Controller::Res Controller::GetJournalInfo(JournalInfo& Info) const {
+    return GetJournalInfo(m_ullCurrentModelIndex, Info);
+}
+/*************************************************************************
+【函数名称】IsModelLoading
+【函数功能】判断指定位置的模型是否正在后台导入（导入已结束但尚未调用
+       FinishLoading时返回false）。按导入任务自己维护的标志判断，
+       FinishLoading的调用者取走导入结果等待时同样返回true
+【参数】size_t ModelIndex, 模型位置
+【返回值】bool，是否正在后台导入
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】2026/10/19 谭雯心 支持多线程并发访问
+           2026/10/19 谭雯心 改为按导入任务维护的标志判断
+*************************************************************************/
+bool Controller::IsModelLoading(size_t ModelIndex) const {
+    shared_ptr<ModelSlot> pSlot = FindSlot(ModelIndex);
+    if (pSlot == nullptr) {
+        return false;
+    }
+    return pSlot->bLoading;
+}
+/*************************************************************************
+【函数名称】GetLODByFaceBudget
+【函数功能】按面数预算获取指定位置模型的LOD模型，后台导入期间同样可用
+【参数】size_t ModelIndex, 模型位置
+       size_t FaceBudget, 面数预算
+       Model3D& AModel, 用于存储LOD模型
+【返回值】Controller::Res枚举类型
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】2026/10/19 谭雯心 支持多线程并发访问
+*************************************************************************/
+Controller::Res Controller::GetLODByFaceBudget(
+    size_t ModelIndex, size_t FaceBudget, Model3D& AModel) const {
+    // 若ModelIndex超出范围找不到指定模型，返回MODEL_NOT_FOUND
+    shared_ptr<ModelSlot> pSlot = FindSlot(ModelIndex);
+    if (pSlot == nullptr) {
+        return Res::MODEL_NOT_FOUND;
+    }
+    shared_ptr<const LODChain> pChain;
+    {
+        shared_lock<shared_mutex> Lock(pSlot->Mutex);
+        pChain = pSlot->pLOD;
+    }
+    // 若没有LOD链，返回LOD_NOT_FOUND
+    if (pChain == nullptr || pChain->GetLevelCount() == 0) {
+        return Res::LOD_NOT_FOUND;
+    }
+    AModel = pChain->Level(pChain->SelectByFaceBudget(FaceBudget)).ToModel();
+    return Res::OK;
+}
+/*************************************************************************
+【函数名称】GetLODByFaceBudget
+【函数功能】按面数预算获取当前模型的LOD模型
+【参数】size_t FaceBudget, 面数预算
+       Model3D& AModel, 用于存储LOD模型
+【返回值】Controller::Res枚举类型
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+Controller::Res Controller::GetLODByFaceBudget(
+    size_t FaceBudget, Model3D& AModel) const {
+    return GetLODByFaceBudget(m_ullCurrentModelIndex, FaceBudget, AModel);
+}
+/*************************************************************************
+【函数名称】GetLODByScreenError
+【函数功能】按屏幕空间误差获取指定位置模型的LOD模型，后台导入期间同样可用
+【参数】size_t ModelIndex, 模型位置
+       double Distance, 模型到相机的距离
+       double FieldOfView, 竖直视场角（弧度）
+       double ViewportHeight, 视口高度（像素）
+       double PixelError, 允许的最大屏幕误差（像素）
+       Model3D& AModel, 用于存储LOD模型
+【返回值】Controller::Res枚举类型
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】2026/10/19 谭雯心 支持多线程并发访问
+*************************************************************************/
+Controller::Res Controller::GetLODByScreenError(
+    size_t ModelIndex,
+    double Distance, double FieldOfView,
+    double ViewportHeight, double PixelError,
+    Model3D& AModel) const {
+    // 若ModelIndex超出范围找不到指定模型，返回MODEL_NOT_FOUND
+    shared_ptr<ModelSlot> pSlot = FindSlot(ModelIndex);
+    if (pSlot == nullptr) {
+        return Res::MODEL_NOT_FOUND;
+    }
+    shared_ptr<const LODChain> pChain;
+    {
+        shared_lock<shared_mutex> Lock(pSlot->Mutex);
+        pChain = pSlot->pLOD;
+    }
+    // 若没有LOD链，返回LOD_NOT_FOUND
+    if (pChain == nullptr || pChain->GetLevelCount() == 0) {
+        return Res::LOD_NOT_FOUND;
+    }
+    AModel = pChain->Level(pChain->SelectByScreenError(
+        Distance, FieldOfView, ViewportHeight, PixelError)).ToModel();
+    return Res::OK;
+}
+/*************************************************************************
+【函数名称】GetLODByScreenError
+【函数功能】按屏幕空间误差获取当前模型的LOD模型
+【参数】double Distance, 模型到相机的距离
+       double FieldOfView, 竖直视场角（弧度）
+       double ViewportHeight, 视口高度（像素）
+       double PixelError, 允许的最大屏幕误差（像素）
+       Model3D& AModel, 用于存储LOD模型
+【返回值】Controller::Res枚举类型
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+Controller::Res Controller::GetLODByScreenError(
+    double Distance, double FieldOfView,
+    double ViewportHeight, double PixelError,
+    Model3D& AModel) const {
+    return GetLODByScreenError(m_ullCurrentModelIndex,
+        Distance, FieldOfView, ViewportHeight, PixelError, AModel);
+}
+
+//---------------------------------------------------------------------
+// 私有非静态成员函数
+//---------------------------------------------------------------------
+
+/*************************************************************************
+【函数名称】Snapshot
+【函数功能】获取模型列表的当前快照，快照发布后不再修改，可在不加锁的
+       情况下遍历；快照中的槽位在快照释放前一直有效
+【参数】无
+【返回值】shared_ptr<const SlotList>，当前快照
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+shared_ptr<const Controller::SlotList> Controller::Snapshot() const {
+    return atomic_load(&m_pSlots);
+}
+/*************************************************************************
+【函数名称】FindSlot
+【函数功能】获取当前快照中指定位置的槽位
+【参数】size_t ModelIndex, 模型位置
+【返回值】shared_ptr<ModelSlot>，超出范围时返回nullptr
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+shared_ptr<Controller::ModelSlot> Controller::FindSlot(
+    size_t ModelIndex) const {
+    shared_ptr<const SlotList> pSlots = Snapshot();
+    if (ModelIndex >= pSlots->size()) {
+        return nullptr;
+    }
+    return (*pSlots)[ModelIndex];
+}
+/*************************************************************************
+【函数名称】FindSlot
+【函数功能】获取当前快照中与指定模型相等的第一个槽位，比较时依次持有
+       各模型的共享锁
+【参数】const Model3D& AModel, 指定模型
+【返回值】shared_ptr<ModelSlot>，找不到时返回nullptr
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+shared_ptr<Controller::ModelSlot> Controller::FindSlot(
+    const Model3D& AModel) const {
+    for (const auto& pSlot : *Snapshot()) {
+        shared_lock<shared_mutex> Lock(pSlot->Mutex);
+        if (*pSlot->pModel == AModel) {
+            return pSlot;
+        }
+    }
+    return nullptr;
+}
+/*************************************************************************
+【函数名称】Publish
+【函数功能】发布新的模型列表，此前取得旧快照的线程不受影响
+【参数】const SlotList& Slots, 新的模型列表
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+void Controller::Publish(const SlotList& Slots) {
+    atomic_store(&m_pSlots, make_shared<const SlotList>(Slots));
+}
+
+//---------------------------------------------------------------------
+// 私有静态成员函数
+//---------------------------------------------------------------------
+
+/*************************************************************************
+【函数名称】WaitPending
+【函数功能】等待槽位的后台导入完成，成功时用导入的模型替换原模型。
+       等待期间不持有锁，其他线程仍可查询和编辑原模型；取走导入结果
+       到替换完模型之间置bWaiting，其他调用者等到替换完成后再返回
+【参数】ModelSlot& Slot, 槽位
+【返回值】Controller::Res枚举类型，没有后台导入时返回OK
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】2026/10/19 谭雯心 记录编辑日志
+           2026/10/19 谭雯心 其他线程正在替换模型时等待其完成
+*************************************************************************/
+Controller::Res Controller::WaitPending(ModelSlot& Slot) {
+    future<shared_ptr<Model3D>> Pending;
+    {
+        unique_lock<shared_mutex> Lock(Slot.Mutex);
+        if (!Slot.Pending.valid()) {
+            // 结果已被其他调用者取走时，等它替换完模型
+            while (Slot.bWaiting) {
+                Slot.WaitDone.wait(Lock);
+            }
+            return Res::OK;
+        }
+        Pending = move(Slot.Pending);
+        Slot.bWaiting = true;
+    }
+    // 获取导入结果，若导入失败，返回FILE_NOT_AVAILABLE
+    Res Result = Res::OK;
+    shared_ptr<Model3D> pModel;
+    try {
+        pModel = Pending.get();
+    }
+    catch (...) {
+        Result = Res::FILE_NOT_AVAILABLE;
+    }
+    unique_lock<shared_mutex> Lock(Slot.Mutex);
+    if (pModel != nullptr) {
+        Slot.Journal.RecordModel(Slot.pModel);
+        Slot.pModel = pModel;
+    }
+    Slot.bWaiting = false;
+    Slot.WaitDone.notify_all();
+    return Result;
+}
@@ -4,6 +4,16 @@
 【开发者及日期】谭雯心 2024/8/9
 【更改记录】2024/8/10 谭雯心 修改了获取模型信息的逻辑
            2024/8/11 谭雯心 增加了将ControllerRes转换为字符串的函数接口
+           2026/10/19 谭雯心 增加了LOD链的生成、读写、选取和后台导入模型
+           2026/10/19 谭雯心 增加了M3B格式、流式统计和格式转换
+           2026/10/19 谭雯心 增加了自相交和干涉检测
+           2026/10/19 谭雯心 增加了模型内存占用统计
+           2026/10/19 谭雯心 流式格式转换增加了OBJ目标格式
+           2026/10/19 谭雯心 增加了批量添加面和线
+           2026/10/19 谭雯心 支持多线程并发访问
+           2026/10/19 谭雯心 增加了异步导入和导出
+           2026/10/19 谭雯心 增加了编辑日志、撤销和重做
+           2026/10/19 谭雯心 增加了把OBJ文件的各组导入为多个模型
 *************************************************************************/
 #ifndef CONTROLLER_HPP
 #define CONTROLLER_HPP
@@ -20,6 +30,28 @@
 #include "Model3D_OBJ_Exporter.hpp"
 // Model3D_OBJ_Importer所属头文件
 #include "Model3D_OBJ_Importer.hpp"
+// LODChain所属头文件
+#include "LODChain.hpp"
+// MeshIntersector所属头文件
+#include "MeshIntersector.hpp"
+// MemoryAccounting所属头文件
+#include "MemoryAccounting.hpp"
+// IOTask所属头文件
+#include "IOTask.hpp"
+// IOThreadPool所属头文件
+#include "IOThreadPool.hpp"
+// EditJournal所属头文件
+#include "EditJournal.hpp"
+// future所属头文件
+#include <future>
+// shared_mutex所属头文件
+#include <shared_mutex>
+// mutex、once_flag所属头文件
+#include <mutex>
+// atomic所属头文件
+#include <atomic>
+// condition_variable_any所属头文件
+#include <condition_variable>
 // numeric_limits所属头文件
 #include <limits>
 // shared_ptr所属头文件
@@ -35,7 +67,11 @@ using namespace std;
 
 /*************************************************************************
 【类名】Controller
-【功能】定义Controller类，作为整个系统的控制器
+【功能】定义Controller类，作为整个系统的控制器。全部成员函数可由多个
+       线程并发调用：模型列表以只读快照的形式发布，增删模型时复制列表
+       并原子地替换快照，查询不加全局锁；每个模型有自己的读写锁，查询
+       持有共享锁，编辑只独占所编辑的模型。每个模型有自己的编辑日志，
+       对模型的每次编辑都记录逆操作，可逐步撤销和重做
 【接口说明】
     枚举类型Res，表示Controller的返回值
     非静态成员函数ControllerResStr，将ControllerRes转换为字符串
@@ -43,6 +79,7 @@ using namespace std;
     静态成员函数GetInstance，获取Controller的唯一实例
     非静态成员函数LoadModelFromFile，从文件中导入指定模型
     非静态成员函数LoadModelFromFile，从文件中导入当前模型
+    非静态成员函数LoadModelGroupsFromFile，把OBJ文件的每个组导入为一个新模型
     非静态成员函数SaveModelToFile，将指定模型导出到文件
     非静态成员函数SaveModelToFile，将当前模型导出到文件
     非静态成员函数CreateModel，创建模型并设置为当前模型
@@ -52,10 +89,12 @@ using namespace std;
     非静态成员函数SetCurrentModel，设置指定位置的模型为当前模型
     非静态成员函数AddFace，向指定模型中添加面
     非静态成员函数AddFace，向当前模型中添加面
+    非静态成员函数AddFaces，向指定模型中批量添加面
     非静态成员函数RemoveFace，从指定模型中删除面
     非静态成员函数RemoveFace，从当前模型中删除面
     非静态成员函数AddLine，向指定模型中添加线
     非静态成员函数AddLine，向当前模型中添加线
+    非静态成员函数AddLines，向指定模型中批量添加线
     非静态成员函数RemoveLine，从指定模型中删除线
     非静态成员函数RemoveLine，从当前模型中删除线
     非静态成员函数ChangeFacePoint，修改指定模型指定面中的指定点
@@ -75,9 +114,44 @@ using namespace std;
     非静态成员函数ListFaceInfo，列出当前模型中所有Face3D的信息
     非静态成员函数ListLineInfo，列出指定位置模型中所有Line3D的信息
     非静态成员函数ListLineInfo，列出当前模型中所有Line3D的信息
+    非静态成员函数BuildLOD，为指定模型或当前模型生成LOD链
+    非静态成员函数SaveLODToFile，将指定模型或当前模型的LOD链写入文件
+    非静态成员函数LoadLODFromFile，从文件读取指定模型或当前模型的LOD链
+    非静态成员函数LoadModelInBackground，在后台导入指定模型或当前模型
+    非静态成员函数FinishLoading，等待后台导入完成并替换模型
+    非静态成员函数IsModelLoading，判断指定模型是否正在后台导入
+    非静态成员函数GetLODByFaceBudget，按面数预算获取LOD模型
+    非静态成员函数GetLODByScreenError，按屏幕空间误差获取LOD模型
+    非静态成员函数ConvertModelFile，将模型文件转换为任意可导出的格式
+    非静态成员函数StreamModelInfo，流式统计模型文件的信息
+    非静态成员函数FindSelfIntersections，检测指定模型或当前模型的自相交
+    非静态成员函数FindInterference，检测两个模型之间的干涉
+    非静态成员函数GetMemoryUsage，获取指定模型或当前模型的内存占用明细
+    非静态成员函数GetTotalMemoryUsage，获取全部模型的内存占用明细之和
+    非静态成员函数GetModelCount，获取模型数量
+    非静态成员函数LoadModelFromFileAsync，在IO线程池中导入指定模型或当前模型
+    非静态成员函数SaveModelToFileAsync，在IO线程池中导出指定模型或当前模型
+    非静态成员函数Undo，撤销指定模型或当前模型的一步编辑
+    非静态成员函数Redo，重做指定模型或当前模型的一步编辑
+    非静态成员函数BeginEditGroup，开始把指定模型或当前模型的编辑合并为一步
+    非静态成员函数EndEditGroup，结束合并指定模型或当前模型的编辑
+    非静态成员函数SetJournalBudget，设置每个模型编辑日志的内存预算
+    非静态成员函数GetJournalInfo，获取指定模型或当前模型编辑日志的信息
 【开发者及日期】谭雯心 2024/8/9
 【更改记录】2024/8/10 谭雯心 修改了获取模型信息的逻辑
            2024/8/11 谭雯心 增加了将ControllerRes转换为字符串的函数接口
+           2026/10/19 谭雯心 增加了LOD链的生成、读写、选取和后台导入模型
+           2026/10/19 谭雯心 增加了M3B格式、流式统计和格式转换
+           2026/10/19 谭雯心 增加了自相交和干涉检测
+           2026/10/19 谭雯心 增加了模型内存占用统计
+           2026/10/19 谭雯心 流式格式转换增加了OBJ目标格式
+           2026/10/19 谭雯心 增加了批量添加面和线
+           2026/10/19 谭雯心 支持多线程并发访问，Models改为GetModelCount
+           2026/10/19 谭雯心 增加了异步导入和导出
+           2026/10/19 谭雯心 增加了编辑日志、撤销和重做
+           2026/10/19 谭雯心 增加了把OBJ文件的各组导入为多个模型
+           2026/10/19 谭雯心 格式转换支持没有流式写出器的格式
+           2026/10/19 谭雯心 同一模型的后台导入在锁内检查并登记
 *************************************************************************/
 class Controller {
 public:
@@ -98,7 +172,10 @@ public:
         LINE_NOT_FOUND,
         MODEL_ALREADY_EXISTS,
         MODEL_NOT_FOUND,
-        UNKNOWN_TYPE
+        LOD_NOT_FOUND,
+        UNKNOWN_TYPE,
+        OPERATION_CANCELLED,
+        EDIT_NOT_FOUND
     };
     // PointInfo结构体，用于存储点信息
     struct PointInfo {
@@ -140,13 +217,51 @@ public:
         // 线的长度
         double Length;
     };
+    // JournalInfo结构体，用于存储编辑日志信息
+    struct JournalInfo {
+        // 可撤销的步数
+        size_t UndoCount;
+        // 可重做的步数
+        size_t RedoCount;
+        // 日志占用的内存（字节）
+        size_t Bytes;
+        // 内存预算（字节）
+        size_t Budget;
+    };
     // 使用using语句简化名称
     using Res = ControllerRes;
     using ModelInfoList = vector<ModelInfo>;
     using FaceInfoList = vector<FaceInfo>;
     using LineInfoList = vector<LineInfo>;
+    using FacePairList = MeshIntersector::FacePairList;
+    using MemoryUsage = MemoryAccounting::Usage;
 
 private:
+    //----------------------------------------------------------------
+    // 私有的内嵌类
+    //----------------------------------------------------------------
+    // 模型槽位，存放模型及与之对应的读写锁、LOD链、后台导入和编辑日志，
+    // 槽位的成员（除Mutex外）都受Mutex保护
+    struct ModelSlot {
+        // 模型，导入或撤销导入时整体替换
+        shared_ptr<Model3D> pModel{make_shared<Model3D>()};
+        // 模型的读写锁，查询持有共享锁，编辑持有独占锁
+        mutable shared_mutex Mutex{};
+        // LOD链，未生成时为nullptr
+        shared_ptr<const LODChain> pLOD{};
+        // 尚未被FinishLoading取走的后台导入
+        future<shared_ptr<Model3D>> Pending{};
+        // 后台导入是否仍在IO线程池中执行，由导入任务结束时清除
+        atomic<bool> bLoading{false};
+        // 是否有FinishLoading的调用者取走了Pending、尚未替换完模型
+        bool bWaiting{false};
+        // bWaiting被清除时通知等待者
+        condition_variable_any WaitDone{};
+        // 编辑日志
+        EditJournal Journal{};
+    };
+    // 模型列表，发布后不再修改
+    using SlotList = vector<shared_ptr<ModelSlot>>;
     //----------------------------------------------------------------
     // 私有的构造函数，用于实现单例模式
     //----------------------------------------------------------------
@@ -157,17 +272,42 @@ private:
     // 禁止外界调用赋值运算符
     Controller& operator=(const Controller& Source) = delete;
     //----------------------------------------------------------------
+    // 私有非静态成员函数
+    //----------------------------------------------------------------
+    // 获取模型列表的当前快照
+    shared_ptr<const SlotList> Snapshot() const;
+    // 获取指定位置的槽位，超出范围时返回nullptr
+    shared_ptr<ModelSlot> FindSlot(size_t ModelIndex) const;
+    // 获取与指定模型相等的第一个槽位，找不到时返回nullptr
+    shared_ptr<ModelSlot> FindSlot(const Model3D& AModel) const;
+    // 发布新的模型列表，调用者须持有m_ListMutex
+    void Publish(const SlotList& Slots);
+    //----------------------------------------------------------------
+    // 私有静态成员函数
+    //----------------------------------------------------------------
+    // 等待槽位的后台导入完成，成功时替换模型
+    static ControllerRes WaitPending(ModelSlot& Slot);
+    //----------------------------------------------------------------
     // 私有静态成员
     //----------------------------------------------------------------
     // Controller的唯一实例
     static shared_ptr<Controller> m_pInstance;
+    // 保证唯一实例只创建一次
+    static once_flag m_InstanceFlag;
     //----------------------------------------------------------------
     // 私有非静态成员
     //----------------------------------------------------------------
-    // 全部模型指针
-    vector<shared_ptr<Model3D>> m_pModel{};
+    // 模型列表的当前快照，通过atomic_load和atomic_store访问
+    shared_ptr<const SlotList> m_pSlots{make_shared<const SlotList>()};
+    // 串行化模型列表的修改（创建、添加、删除模型）
+    mutex m_ListMutex{};
     // 当前模型索引, 初始化为最大值
-    size_t m_ullCurrentModelIndex{numeric_limits<size_t>::max()};
+    atomic<size_t> m_ullCurrentModelIndex{numeric_limits<size_t>::max()};
+    // 新建模型的编辑日志内存预算
+    atomic<size_t> m_ullJournalBudget{EditJournal::DEFAULT_BUDGET};
+    // 执行异步导入、导出和后台导入的线程池，最后声明以便最先析构，
+    // 析构时等待的任务仍可访问上面的成员
+    IOThreadPool m_IOPool{};
     
 public:
     //----------------------------------------------------------------
@@ -184,6 +324,8 @@ public:
     Res LoadModelFromFile(const string& FileName, size_t ModelIndex);
     // 从文件中导入当前模型
     Res LoadModelFromFile(const string& FileName);
+    // 把OBJ文件的每个组导入为一个新模型，添加到末尾
+    Res LoadModelGroupsFromFile(const string& FileName, size_t& LoadedCount);
     // 将指定模型导出到文件
     Res SaveModelToFile(const string& FileName, const Model3D& AModel);
     // 将指定模型导出到文件(根据模型位置)
@@ -206,6 +348,9 @@ public:
     Res AddFace(const Face3D& AFace, size_t ModelIndex);
     // 向当前模型中添加面
     Res AddFace(const Face3D& AFace);
+    // 向指定位置的模型中依次添加多个面，遇到失败时停止
+    Res AddFaces(
+        const vector<Face3D>& Faces, size_t ModelIndex, size_t& AddedCount);
     // 向指定位置的模型中添加面(通过三个点坐标)
     Res AddFace(
         const double x1, const double y1, const double z1,
@@ -234,6 +379,9 @@ public:
         size_t ModelIndex);
     // 向当前模型中添加线
     Res AddLine(const Line3D& ALine);
+    // 向指定位置的模型中依次添加多条线，遇到失败时停止
+    Res AddLines(
+        const vector<Line3D>& Lines, size_t ModelIndex, size_t& AddedCount);
     // 向当前模型中添加线(通过两个点坐标)
     Res AddLine(
         const double x1, const double y1, const double z1,
@@ -314,6 +462,61 @@ public:
     Res ChangeDescription(size_t Index, const string& NewDescription);
     // 修改当前模型注释
     Res ChangeDescription(const string& NewDescription);
+    // 为指定位置的模型生成LOD链（模型修改后需重新生成）
+    Res BuildLOD(size_t ModelIndex, size_t LevelCount);
+    // 为当前模型生成LOD链
+    Res BuildLOD(size_t LevelCount);
+    // 将指定位置模型的LOD链写入文件
+    Res SaveLODToFile(const string& FileName, size_t ModelIndex);
+    // 将当前模型的LOD链写入文件
+    Res SaveLODToFile(const string& FileName);
+    // 从文件读取指定位置模型的LOD链
+    Res LoadLODFromFile(const string& FileName, size_t ModelIndex);
+    // 从文件读取当前模型的LOD链
+    Res LoadLODFromFile(const string& FileName);
+    // 在后台导入指定位置的模型，并先读取同名.lod文件中的LOD链
+    Res LoadModelInBackground(const string& FileName, size_t ModelIndex);
+    // 在后台导入当前模型，并先读取同名.lod文件中的LOD链
+    Res LoadModelInBackground(const string& FileName);
+    // 等待指定位置模型的后台导入完成并替换模型
+    Res FinishLoading(size_t ModelIndex);
+    // 等待当前模型的后台导入完成并替换模型
+    Res FinishLoading();
+    // 转换模型文件，有流式写出器的格式边读边写
+    Res ConvertModelFile(
+        const string& SourceFileName, const string& TargetFileName);
+    // 在IO线程池中从文件导入指定位置的模型，pTask用于报告进度和取消
+    future<Res> LoadModelFromFileAsync(
+        const string& FileName, size_t ModelIndex,
+        const shared_ptr<IOTask>& pTask = nullptr);
+    // 在IO线程池中从文件导入当前模型
+    future<Res> LoadModelFromFileAsync(
+        const string& FileName, const shared_ptr<IOTask>& pTask = nullptr);
+    // 在IO线程池中将指定位置的模型导出到文件，pTask用于报告进度和取消
+    future<Res> SaveModelToFileAsync(
+        const string& FileName, size_t ModelIndex,
+        const shared_ptr<IOTask>& pTask = nullptr);
+    // 在IO线程池中将当前模型导出到文件
+    future<Res> SaveModelToFileAsync(
+        const string& FileName, const shared_ptr<IOTask>& pTask = nullptr);
+    // 撤销指定位置模型的一步编辑
+    Res Undo(size_t ModelIndex);
+    // 撤销当前模型的一步编辑
+    Res Undo();
+    // 重做指定位置模型的一步编辑
+    Res Redo(size_t ModelIndex);
+    // 重做当前模型的一步编辑
+    Res Redo();
+    // 开始把指定位置模型之后的编辑合并为一步，可嵌套
+    Res BeginEditGroup(size_t ModelIndex);
+    // 开始把当前模型之后的编辑合并为一步
+    Res BeginEditGroup();
+    // 结束合并指定位置模型的编辑
+    Res EndEditGroup(size_t ModelIndex);
+    // 结束合并当前模型的编辑
+    Res EndEditGroup();
+    // 设置每个模型编辑日志的内存预算（字节）
+    Res SetJournalBudget(size_t Budget);
     //----------------------------------------------------------------
     // 静态Getter成员函数
     //----------------------------------------------------------------
@@ -322,21 +525,23 @@ public:
     //----------------------------------------------------------------
     // 非静态Getter数据成员
     //----------------------------------------------------------------
-    // vector<shared_ptr<Model3D>> Models，用于存储全部模型指针
-    const vector<shared_ptr<Model3D>>& Models{m_pModel};
     // size_t CurrentModelIndex，用于存储当前模型索引
-    const size_t& CurrentModelIndex{m_ullCurrentModelIndex};
+    const atomic<size_t>& CurrentModelIndex{m_ullCurrentModelIndex};
     //----------------------------------------------------------------
     // 非静态成员函数
     //----------------------------------------------------------------
     // 将ControllerRes转换为字符串
     const string& ControllerResStr(ControllerRes Res) const;
+    // 获取模型数量
+    size_t GetModelCount() const;
     // 列出全部模型统计信息
     Res ListALLModelInfo(ModelInfoList& InfoList) const;
     // 列出指定位置模型统计信息
     Res ListModelInfo(size_t ModelIndex, ModelInfo& Info) const;
     // 列出当前模型统计信息
     Res ListModelInfo(ModelInfo& Info) const;
+    // 流式统计模型文件的信息，不导入模型
+    Res StreamModelInfo(const string& FileName, ModelInfo& Info) const;
     // 列出指定位置模型中所有Face3D的信息
     Res ListFaceInfo(size_t ModelIndex, FaceInfoList& Info) const;
     // 列出当前模型中所有Face3D的信息
@@ -345,6 +550,41 @@ public:
     Res ListLineInfo(size_t ModelIndex, LineInfoList& Info) const;
     // 列出当前模型中所有Line3D的信息
     Res ListLineInfo(LineInfoList& InfoList) const;
+    // 检测指定位置模型的自相交
+    Res FindSelfIntersections(size_t ModelIndex, FacePairList& Pairs) const;
+    // 检测当前模型的自相交
+    Res FindSelfIntersections(FacePairList& Pairs) const;
+    // 检测两个指定位置模型之间的干涉
+    Res FindInterference(
+        size_t FirstIndex, size_t SecondIndex, FacePairList& Pairs) const;
+    // 获取指定位置模型的内存占用明细
+    Res GetMemoryUsage(size_t ModelIndex, MemoryUsage& Usage) const;
+    // 获取当前模型的内存占用明细
+    Res GetMemoryUsage(MemoryUsage& Usage) const;
+    // 获取全部模型的内存占用明细之和
+    Res GetTotalMemoryUsage(MemoryUsage& Usage) const;
+    // 获取指定位置模型编辑日志的信息
+    Res GetJournalInfo(size_t ModelIndex, JournalInfo& Info) const;
+    // 获取当前模型编辑日志的信息
+    Res GetJournalInfo(JournalInfo& Info) const;
+    // 判断指定位置的模型是否正在后台导入
+    bool IsModelLoading(size_t ModelIndex) const;
+    // 按面数预算获取指定位置模型的LOD模型
+    Res GetLODByFaceBudget(
+        size_t ModelIndex, size_t FaceBudget, Model3D& AModel) const;
+    // 按面数预算获取当前模型的LOD模型
+    Res GetLODByFaceBudget(size_t FaceBudget, Model3D& AModel) const;
+    // 按屏幕空间误差获取指定位置模型的LOD模型
+    Res GetLODByScreenError(
+        size_t ModelIndex,
+        double Distance, double FieldOfView,
+        double ViewportHeight, double PixelError,
+        Model3D& AModel) const;
+    // 按屏幕空间误差获取当前模型的LOD模型
+    Res GetLODByScreenError(
+        double Distance, double FieldOfView,
+        double ViewportHeight, double PixelError,
+        Model3D& AModel) const;
 };
 
 #endif /* Controller.hpp */
\ No newline at end of file
@@ -0,0 +1,179 @@
+/*************************************************************************
+【文件名】CountingAllocator.hpp
+【功能模块和目的】定义CountingAllocator类模板，分配时向MemoryAccounting计数
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+#ifndef COUNTINGALLOCATOR_HPP
+#define COUNTINGALLOCATOR_HPP
+
+// MemoryAccounting所属头文件
+#include "MemoryAccounting.hpp"
+// allocator所属头文件
+#include <memory>
+// is_same所属头文件
+#include <type_traits>
+// size_t所属头文件
+#include <cstddef>
+
+using namespace std;
+
+/*************************************************************************
+【类名】MemoryCategoryOf
+【功能】元素类型对应的内存类别，默认为容器，需要单独统计的类型
+       （如Point3D）在其头文件中特化
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+template <typename T>
+struct MemoryCategoryOf {
+    static constexpr MemoryAccounting::Category VALUE{
+        MemoryAccounting::Category::CONTAINERS};
+};
+
+/*************************************************************************
+【类名】CountingAllocator
+【功能】无状态的标准分配器，用std::allocator分配内存，并把字节数按类别C
+       记入MemoryAccounting。Payload用于allocate_shared：shared_ptr把控制块
+       和对象放在一次分配中，分配器被重新绑定到控制块类型，此时其中
+       sizeof(Payload)字节记入C，其余记入CONTROL_BLOCKS
+【接口说明】
+    默认构造函数
+    从其他元素类型的同类分配器转换的构造函数
+    分配、释放
+    判断相等、不等（无状态，总是相等）
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+template <typename T, MemoryAccounting::Category C, typename Payload = T>
+class CountingAllocator {
+public:
+    //-------------------------------------------------------------------------
+    // 公有类型
+    //-------------------------------------------------------------------------
+    // 元素类型
+    using value_type = T;
+    // 重新绑定到其他元素类型，保持类别和负载类型
+    template <typename U>
+    struct rebind {
+        using other = CountingAllocator<U, C, Payload>;
+    };
+    //-------------------------------------------------------------------------
+    // 必要的构造、析构、拷贝、赋值运算符重载函数
+    //-------------------------------------------------------------------------
+    // 默认构造函数
+    CountingAllocator() = default;
+    // 从其他元素类型的同类分配器转换的构造函数
+    template <typename U>
+    CountingAllocator(const CountingAllocator<U, C, Payload>& Source) {
+        (void)Source;
+    }
+    //-------------------------------------------------------------------------
+    // 非静态成员函数
+    //-------------------------------------------------------------------------
+    // 分配
+    T* allocate(size_t Count);
+    // 释放
+    void deallocate(T* Pointer, size_t Count);
+
+private:
+    //-------------------------------------------------------------------------
+    // 私有静态成员函数
+    //-------------------------------------------------------------------------
+    // 记录分配或释放
+    static void Record(size_t Count, bool Allocate);
+};
+
+/*************************************************************************
+【函数名称】allocate
+【函数功能】分配Count个元素的内存并计数
+【参数】size_t Count, 表示元素个数
+【返回值】T*，分配的内存
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+template <typename T, MemoryAccounting::Category C, typename Payload>
+T* CountingAllocator<T, C, Payload>::allocate(size_t Count) {
+    T* Pointer = allocator<T>().allocate(Count);
+    Record(Count, true);
+    return Pointer;
+}
+/*************************************************************************
+【函数名称】deallocate
+【函数功能】释放内存并计数
+【参数】T* Pointer, 表示内存
+       size_t Count, 表示元素个数
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+template <typename T, MemoryAccounting::Category C, typename Payload>
+void CountingAllocator<T, C, Payload>::deallocate(T* Pointer, size_t Count) {
+    Record(Count, false);
+    allocator<T>().deallocate(Pointer, Count);
+}
+/*************************************************************************
+【函数名称】Record
+【函数功能】按类别记录分配或释放的字节数，控制块部分记入CONTROL_BLOCKS
+【参数】size_t Count, 表示元素个数
+       bool Allocate, 表示是否为分配
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+template <typename T, MemoryAccounting::Category C, typename Payload>
+void CountingAllocator<T, C, Payload>::Record(size_t Count, bool Allocate) {
+    size_t Bytes = Count * sizeof(T);
+    size_t PayloadBytes = Bytes;
+    if (!is_same<T, Payload>::value && sizeof(T) > sizeof(Payload)) {
+        PayloadBytes = Count * sizeof(Payload);
+    }
+    if (Allocate) {
+        MemoryAccounting::RecordAllocate(C, PayloadBytes);
+        if (Bytes > PayloadBytes) {
+            MemoryAccounting::RecordAllocate(
+                MemoryAccounting::Category::CONTROL_BLOCKS,
+                Bytes - PayloadBytes);
+        }
+    }
+    else {
+        MemoryAccounting::RecordDeallocate(C, PayloadBytes);
+        if (Bytes > PayloadBytes) {
+            MemoryAccounting::RecordDeallocate(
+                MemoryAccounting::Category::CONTROL_BLOCKS,
+                Bytes - PayloadBytes);
+        }
+    }
+}
+/*************************************************************************
+【函数名称】operator==
+【函数功能】判断两个分配器是否相等（无状态，总是相等）
+【参数】两个分配器
+【返回值】bool，true
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+template <typename T, typename U, MemoryAccounting::Category C,
+          typename Payload>
+bool operator==(const CountingAllocator<T, C, Payload>& Left,
+                const CountingAllocator<U, C, Payload>& Right) {
+    (void)Left;
+    (void)Right;
+    return true;
+}
+/*************************************************************************
+【函数名称】operator!=
+【函数功能】判断两个分配器是否不等（无状态，总是相等）
+【参数】两个分配器
+【返回值】bool，false
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+template <typename T, typename U, MemoryAccounting::Category C,
+          typename Payload>
+bool operator!=(const CountingAllocator<T, C, Payload>& Left,
+                const CountingAllocator<U, C, Payload>& Right) {
+    return !(Left == Right);
+}
+
+#endif /* CountingAllocator.hpp */
@@ -0,0 +1,114 @@
+/*************************************************************************
+【文件名】DirtyRanges.cpp
+【功能模块和目的】定义DirtyRanges类的成员函数
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+// DirtyRanges所属头文件
+#include "DirtyRanges.hpp"
+// max所属头文件
+#include <algorithm>
+// map所属头文件
+#include <map>
+// pair所属头文件
+#include <utility>
+// vector所属头文件
+#include <vector>
+// size_t所属头文件
+#include <cstddef>
+
+using namespace std;
+
+//-------------------------------------------------------------------------
+// 非静态Setter成员函数
+//-------------------------------------------------------------------------
+
+/*************************************************************************
+【函数名称】Mark
+【函数功能】标记位置Index
+【参数】size_t Index, 表示被修改的位置
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+void DirtyRanges::Mark(size_t Index) {
+    Mark(Index, Index + 1);
+}
+/*************************************************************************
+【函数名称】Mark
+【函数功能】标记区间[Begin, End)，并与重叠或相邻的区间合并
+【参数】size_t Begin, 表示区间起点
+       size_t End, 表示区间终点（不含）
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+void DirtyRanges::Mark(size_t Begin, size_t End) {
+    if (Begin >= End) {
+        return;
+    }
+    // 第一个可能与之合并的区间：起点不大于Begin的最后一个
+    auto Iterator = m_Ranges.upper_bound(Begin);
+    if (Iterator != m_Ranges.begin() && prev(Iterator)->second >= Begin) {
+        Iterator--;
+    }
+    // 吸收所有与[Begin, End)重叠或相邻的区间
+    while (Iterator != m_Ranges.end() && Iterator->first <= End) {
+        Begin = min(Begin, Iterator->first);
+        End = max(End, Iterator->second);
+        m_ullCount -= Iterator->second - Iterator->first;
+        Iterator = m_Ranges.erase(Iterator);
+    }
+    m_Ranges.emplace(Begin, End);
+    m_ullCount += End - Begin;
+}
+/*************************************************************************
+【函数名称】Clear
+【函数功能】清空全部区间
+【参数】无
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+void DirtyRanges::Clear() {
+    m_Ranges.clear();
+    m_ullCount = 0;
+}
+
+//-------------------------------------------------------------------------
+// 非静态Getter成员函数
+//-------------------------------------------------------------------------
+
+/*************************************************************************
+【函数名称】IsEmpty
+【函数功能】判断是否没有被标记的位置
+【参数】无
+【返回值】bool，是否为空
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+bool DirtyRanges::IsEmpty() const {
+    return m_Ranges.empty();
+}
+/*************************************************************************
+【函数名称】GetCount
+【函数功能】获取被标记的位置数
+【参数】无
+【返回值】size_t，全部区间的长度之和
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+size_t DirtyRanges::GetCount() const {
+    return m_ullCount;
+}
+/*************************************************************************
+【函数名称】GetRanges
+【函数功能】获取全部区间
+【参数】无
+【返回值】vector<pair<size_t, size_t>>，按起点升序排列的区间[Begin, End)
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+vector<pair<size_t, size_t>> DirtyRanges::GetRanges() const {
+    return vector<pair<size_t, size_t>>(m_Ranges.begin(), m_Ranges.end());
+}
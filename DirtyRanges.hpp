@@ -0,0 +1,81 @@
+/*************************************************************************
+【文件名】DirtyRanges.hpp
+【功能模块和目的】定义DirtyRanges类，记录被修改过的元素位置区间
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+#ifndef DIRTYRANGES_HPP
+#define DIRTYRANGES_HPP
+
+// map所属头文件
+#include <map>
+// pair所属头文件
+#include <utility>
+// vector所属头文件
+#include <vector>
+// size_t所属头文件
+#include <cstddef>
+
+using namespace std;
+
+/*************************************************************************
+【类名】DirtyRanges
+【功能】以互不相交、互不相邻的左闭右开区间记录被修改过的元素位置，
+       标记时与重叠或相邻的区间合并，因此区间数不超过修改次数，
+       标记一次的开销为O(log 区间数)，与元素总数无关
+【接口说明】
+    默认构造函数
+    拷贝构造函数
+    赋值运算符
+    虚析构函数
+    标记一个位置、一个区间
+    清空
+    判断是否为空
+    获取被标记的位置数
+    获取全部区间
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+class DirtyRanges {
+public:
+    //-------------------------------------------------------------------------
+    // 必要的构造、析构、拷贝、赋值运算符重载函数
+    //-------------------------------------------------------------------------
+    // 默认构造函数
+    DirtyRanges() = default;
+    // 拷贝构造函数
+    DirtyRanges(const DirtyRanges& Source) = default;
+    // 赋值运算符
+    DirtyRanges& operator=(const DirtyRanges& Source) = default;
+    // 虚析构函数
+    virtual ~DirtyRanges() = default;
+    //-------------------------------------------------------------------------
+    // 非静态Setter成员函数
+    //-------------------------------------------------------------------------
+    // 标记位置Index
+    void Mark(size_t Index);
+    // 标记区间[Begin, End)
+    void Mark(size_t Begin, size_t End);
+    // 清空
+    void Clear();
+    //-------------------------------------------------------------------------
+    // 非静态Getter成员函数
+    //-------------------------------------------------------------------------
+    // 是否没有被标记的位置
+    bool IsEmpty() const;
+    // 被标记的位置数
+    size_t GetCount() const;
+    // 按起点升序排列的全部区间[Begin, End)
+    vector<pair<size_t, size_t>> GetRanges() const;
+
+private:
+    //-------------------------------------------------------------------------
+    // 私有非静态成员
+    //-------------------------------------------------------------------------
+    // 区间起点到终点
+    map<size_t, size_t> m_Ranges{};
+    // 被标记的位置数
+    size_t m_ullCount{0};
+};
+
+#endif /* DirtyRanges.hpp */
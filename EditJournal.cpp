@@ -0,0 +1,577 @@
+/*************************************************************************
+【文件名】EditJournal.cpp
+【功能模块和目的】定义EditJournal类的成员函数
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】2026/10/19 谭雯心 一步中共用的pHolder只计一次内存
+*************************************************************************/
+// EditJournal所属头文件
+#include "EditJournal.hpp"
+// Model3D所属头文件
+#include "Model3D.hpp"
+// Face3D所属头文件
+#include "Face3D.hpp"
+// Line3D所属头文件
+#include "Line3D.hpp"
+// Point3D所属头文件
+#include "Point3D.hpp"
+// shared_ptr所属头文件
+#include <memory>
+// string所属头文件
+#include <string>
+// move所属头文件
+#include <utility>
+// size_t所属头文件
+#include <cstddef>
+
+using namespace std;
+
+namespace {
+    /*************************************************************************
+    【函数名称】PointAt
+    【函数功能】从坐标数组中取出第Index个点
+    【参数】const double* Coordinates, 坐标数组
+           size_t Index, 点的位置
+    【返回值】Point3D，取出的点
+    【开发者及日期】谭雯心 2026/10/19
+    【更改记录】
+    *************************************************************************/
+    Point3D PointAt(const double* Coordinates, size_t Index) {
+        return Point3D(Coordinates[3 * Index], Coordinates[3 * Index + 1],
+            Coordinates[3 * Index + 2]);
+    }
+}
+
+//-------------------------------------------------------------------------
+// 静态常量
+//-------------------------------------------------------------------------
+
+// 默认内存预算（字节）
+constexpr size_t EditJournal::DEFAULT_BUDGET;
+
+//-------------------------------------------------------------------------
+// 必要的构造、析构、拷贝、赋值运算符重载函数
+//-------------------------------------------------------------------------
+
+/*************************************************************************
+【函数名称】EditJournal
+【函数功能】带参构造函数
+【参数】size_t Budget, 表示内存预算（字节）
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+EditJournal::EditJournal(size_t Budget) : m_Budget(Budget) {
+}
+
+//-------------------------------------------------------------------------
+// 非静态Setter成员函数
+//-------------------------------------------------------------------------
+
+/*************************************************************************
+【函数名称】RecordInsertFace
+【函数功能】记录在FaceIndex处添加了面，逆操作为删除该位置的面
+【参数】size_t FaceIndex, 表示添加的位置
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+void EditJournal::RecordInsertFace(size_t FaceIndex) {
+    Append(MakeDelta(Kind::REMOVE_FACE, FaceIndex, nullptr));
+}
+/*************************************************************************
+【函数名称】RecordRemoveFace
+【函数功能】记录删除了FaceIndex处的面，逆操作为在该位置插入原来的面
+【参数】size_t FaceIndex, 表示删除的位置
+       const Face3D& OldFace, 表示被删除的面
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+void EditJournal::RecordRemoveFace(size_t FaceIndex, const Face3D& OldFace) {
+    Append(MakeDelta(Kind::INSERT_FACE, FaceIndex, &OldFace));
+}
+/*************************************************************************
+【函数名称】RecordChangeFace
+【函数功能】记录修改了FaceIndex处的面，逆操作为把该位置改回原来的面
+【参数】size_t FaceIndex, 表示修改的位置
+       const Face3D& OldFace, 表示修改前的面
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+void EditJournal::RecordChangeFace(size_t FaceIndex, const Face3D& OldFace) {
+    Append(MakeDelta(Kind::SET_FACE, FaceIndex, &OldFace));
+}
+/*************************************************************************
+【函数名称】RecordInsertLine
+【函数功能】记录在LineIndex处添加了线，逆操作为删除该位置的线
+【参数】size_t LineIndex, 表示添加的位置
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+void EditJournal::RecordInsertLine(size_t LineIndex) {
+    Append(MakeDelta(Kind::REMOVE_LINE, LineIndex, nullptr));
+}
+/*************************************************************************
+【函数名称】RecordRemoveLine
+【函数功能】记录删除了LineIndex处的线，逆操作为在该位置插入原来的线
+【参数】size_t LineIndex, 表示删除的位置
+       const Line3D& OldLine, 表示被删除的线
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+void EditJournal::RecordRemoveLine(size_t LineIndex, const Line3D& OldLine) {
+    Append(MakeDelta(Kind::INSERT_LINE, LineIndex, &OldLine));
+}
+/*************************************************************************
+【函数名称】RecordChangeLine
+【函数功能】记录修改了LineIndex处的线，逆操作为把该位置改回原来的线
+【参数】size_t LineIndex, 表示修改的位置
+       const Line3D& OldLine, 表示修改前的线
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+void EditJournal::RecordChangeLine(size_t LineIndex, const Line3D& OldLine) {
+    Append(MakeDelta(Kind::SET_LINE, LineIndex, &OldLine));
+}
+/*************************************************************************
+【函数名称】RecordSwapFaces
+【函数功能】记录模型的面列表与pHolder的面列表做了交换（用于清空面），
+       逆操作为再交换一次
+【参数】const shared_ptr<Model3D>& pHolder, 表示换出的面列表
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+void EditJournal::RecordSwapFaces(const shared_ptr<Model3D>& pHolder) {
+    Delta ADelta = MakeDelta(Kind::SWAP_FACES, 0, nullptr);
+    ADelta.pHolder = pHolder;
+    Append(move(ADelta));
+}
+/*************************************************************************
+【函数名称】RecordSwapLines
+【函数功能】记录模型的线列表与pHolder的线列表做了交换（用于清空线），
+       逆操作为再交换一次
+【参数】const shared_ptr<Model3D>& pHolder, 表示换出的线列表
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+void EditJournal::RecordSwapLines(const shared_ptr<Model3D>& pHolder) {
+    Delta ADelta = MakeDelta(Kind::SWAP_LINES, 0, nullptr);
+    ADelta.pHolder = pHolder;
+    Append(move(ADelta));
+}
+/*************************************************************************
+【函数名称】RecordName
+【函数功能】记录修改了名称，逆操作为改回原来的名称
+【参数】const string& OldName, 表示修改前的名称
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+void EditJournal::RecordName(const string& OldName) {
+    Delta ADelta = MakeDelta(Kind::SET_NAME, 0, nullptr);
+    ADelta.Text = OldName;
+    Append(move(ADelta));
+}
+/*************************************************************************
+【函数名称】RecordDescription
+【函数功能】记录修改了注释，逆操作为改回原来的注释
+【参数】const string& OldDescription, 表示修改前的注释
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+void EditJournal::RecordDescription(const string& OldDescription) {
+    Delta ADelta = MakeDelta(Kind::SET_DESCRIPTION, 0, nullptr);
+    ADelta.Text = OldDescription;
+    Append(move(ADelta));
+}
+/*************************************************************************
+【函数名称】RecordModel
+【函数功能】记录整个模型被替换（用于导入），逆操作为换回原模型
+【参数】const shared_ptr<Model3D>& pOldModel, 表示原模型
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+void EditJournal::RecordModel(const shared_ptr<Model3D>& pOldModel) {
+    Delta ADelta = MakeDelta(Kind::SWAP_MODEL, 0, nullptr);
+    ADelta.pHolder = pOldModel;
+    Append(move(ADelta));
+}
+/*************************************************************************
+【函数名称】BeginGroup
+【函数功能】开始一组编辑，到最外层的EndGroup为止的编辑合并为一步。
+       组内没有编辑时不产生步骤
+【参数】无
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+void EditJournal::BeginGroup() {
+    if (m_GroupDepth == 0) {
+        m_bGroupOpen = false;
+    }
+    m_GroupDepth++;
+}
+/*************************************************************************
+【函数名称】EndGroup
+【函数功能】结束一组编辑，结束最外层的组后检查内存预算
+【参数】无
+【返回值】bool，没有未结束的组时返回false
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+bool EditJournal::EndGroup() {
+    if (m_GroupDepth == 0) {
+        return false;
+    }
+    m_GroupDepth--;
+    if (m_GroupDepth == 0) {
+        m_bGroupOpen = false;
+        Trim();
+    }
+    return true;
+}
+/*************************************************************************
+【函数名称】Undo
+【函数功能】撤销最近的一步，并把它的逆步骤放入重做栈。
+       有未结束的组时先结束该组
+【参数】shared_ptr<Model3D>& pModel, 表示日志所属的模型，
+       撤销替换模型时指向原模型
+【返回值】bool，没有可撤销的步骤时返回false
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+bool EditJournal::Undo(shared_ptr<Model3D>& pModel) {
+    m_GroupDepth = 0;
+    m_bGroupOpen = false;
+    if (m_Undo.empty()) {
+        return false;
+    }
+    Step Undone = move(m_Undo.back());
+    m_Undo.pop_back();
+    m_Bytes -= Undone.Bytes;
+    Step Inverse = Revert(Undone, pModel);
+    m_Bytes += Inverse.Bytes;
+    m_Redo.push_back(move(Inverse));
+    Trim();
+    return true;
+}
+/*************************************************************************
+【函数名称】Redo
+【函数功能】重做最近撤销的一步，并把它的逆步骤放回撤销栈
+【参数】shared_ptr<Model3D>& pModel, 表示日志所属的模型
+【返回值】bool，没有可重做的步骤时返回false
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+bool EditJournal::Redo(shared_ptr<Model3D>& pModel) {
+    m_GroupDepth = 0;
+    m_bGroupOpen = false;
+    if (m_Redo.empty()) {
+        return false;
+    }
+    Step Redone = move(m_Redo.back());
+    m_Redo.pop_back();
+    m_Bytes -= Redone.Bytes;
+    Step Inverse = Revert(Redone, pModel);
+    m_Bytes += Inverse.Bytes;
+    m_Undo.push_back(move(Inverse));
+    Trim();
+    return true;
+}
+/*************************************************************************
+【函数名称】Clear
+【函数功能】清空撤销栈和重做栈，并结束未结束的组
+【参数】无
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+void EditJournal::Clear() {
+    m_Undo.clear();
+    m_Redo.clear();
+    m_Bytes = 0;
+    m_GroupDepth = 0;
+    m_bGroupOpen = false;
+}
+/*************************************************************************
+【函数名称】SetBudget
+【函数功能】设置内存预算，超出时立即丢弃最早的步骤
+【参数】size_t Budget, 表示内存预算（字节）
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+void EditJournal::SetBudget(size_t Budget) {
+    m_Budget = Budget;
+    Trim();
+}
+
+//-------------------------------------------------------------------------
+// 非静态Getter成员函数
+//-------------------------------------------------------------------------
+
+/*************************************************************************
+【函数名称】GetBudget
+【函数功能】获取内存预算
+【参数】无
+【返回值】size_t，内存预算（字节）
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+size_t EditJournal::GetBudget() const {
+    return m_Budget;
+}
+/*************************************************************************
+【函数名称】GetUndoCount
+【函数功能】获取可撤销的步数
+【参数】无
+【返回值】size_t，可撤销的步数
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+size_t EditJournal::GetUndoCount() const {
+    return m_Undo.size();
+}
+/*************************************************************************
+【函数名称】GetRedoCount
+【函数功能】获取可重做的步数
+【参数】无
+【返回值】size_t，可重做的步数
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+size_t EditJournal::GetRedoCount() const {
+    return m_Redo.size();
+}
+/*************************************************************************
+【函数名称】GetBytes
+【函数功能】获取撤销栈和重做栈占用的内存
+【参数】无
+【返回值】size_t，占用的内存（字节）
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+size_t EditJournal::GetBytes() const {
+    return m_Bytes;
+}
+
+//-------------------------------------------------------------------------
+// 私有静态成员函数
+//-------------------------------------------------------------------------
+
+/*************************************************************************
+【函数名称】MakeDelta
+【函数功能】创建逆操作，记录位置和元素各点的坐标
+【参数】Kind Type, 表示逆操作的种类
+       size_t Index, 表示面或线的位置
+       const Element3D* pElement, 表示要记录的面或线，可为nullptr
+【返回值】Delta，创建的逆操作
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+EditJournal::Delta EditJournal::MakeDelta(
+    Kind Type, size_t Index, const Element3D* pElement) {
+    Delta ADelta{Type, Index, {}, string(), nullptr};
+    if (pElement != nullptr) {
+        for (size_t i = 0; i < pElement->Points.CountElement() && i < 3; i++) {
+            ADelta.Coordinates[3 * i] = pElement->Points[i].X;
+            ADelta.Coordinates[3 * i + 1] = pElement->Points[i].Y;
+            ADelta.Coordinates[3 * i + 2] = pElement->Points[i].Z;
+        }
+    }
+    return ADelta;
+}
+/*************************************************************************
+【函数名称】SizeOf
+【函数功能】估计一条逆操作占用的内存：结构本身、文本的堆内存，
+       以及只被日志引用的换出列表或原模型
+【参数】const Delta& ADelta, 表示逆操作
+       bool bCountHolder, 表示是否计入pHolder（同一步中已计入时为false）
+【返回值】size_t，占用的内存（字节）
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】2026/10/19 谭雯心 增加了bCountHolder，共用的pHolder只计一次
+*************************************************************************/
+size_t EditJournal::SizeOf(const Delta& ADelta, bool bCountHolder) {
+    size_t Bytes = sizeof(Delta);
+    if (ADelta.Text.capacity() > string().capacity()) {
+        Bytes += ADelta.Text.capacity();
+    }
+    if (bCountHolder && ADelta.pHolder != nullptr) {
+        Bytes += ADelta.pHolder->GetMemoryUsage().GetTotalBytes();
+    }
+    return Bytes;
+}
+/*************************************************************************
+【函数名称】ReferencesHolder
+【函数功能】判断Deltas的前Count条中是否已有引用pHolder的逆操作。
+       一步中的多条逆操作可以共用一个pHolder（如清空模型时面列表和
+       线列表换到同一个模型中），它的内存只应计一次
+【参数】const vector<Delta>& Deltas, 表示一步中的逆操作
+       size_t Count, 表示检查的条数
+       const shared_ptr<Model3D>& pHolder, 表示换出列表或原模型
+【返回值】bool，是否已有引用，pHolder为空时为false
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+bool EditJournal::ReferencesHolder(const vector<Delta>& Deltas,
+    size_t Count, const shared_ptr<Model3D>& pHolder) {
+    if (pHolder == nullptr) {
+        return false;
+    }
+    for (size_t i = 0; i < Count && i < Deltas.size(); i++) {
+        if (Deltas[i].pHolder == pHolder) {
+            return true;
+        }
+    }
+    return false;
+}
+/*************************************************************************
+【函数名称】Apply
+【函数功能】对模型执行一条逆操作，同时生成能撤销这次执行的逆操作
+【参数】const Delta& ADelta, 表示逆操作
+       shared_ptr<Model3D>& pModel, 表示模型，替换模型时被修改
+【返回值】Delta，逆操作的逆操作
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+EditJournal::Delta EditJournal::Apply(
+    const Delta& ADelta, shared_ptr<Model3D>& pModel) {
+    const double* Coordinates = ADelta.Coordinates;
+    Model3D& AModel = *pModel;
+    Delta Inverse = ADelta;
+    switch (ADelta.Type) {
+        case Kind::INSERT_FACE:
+            AModel.InsertFace(ADelta.Index, Face3D(PointAt(Coordinates, 0),
+                PointAt(Coordinates, 1), PointAt(Coordinates, 2)));
+            Inverse.Type = Kind::REMOVE_FACE;
+            break;
+        case Kind::REMOVE_FACE:
+            Inverse = MakeDelta(Kind::INSERT_FACE, ADelta.Index,
+                &AModel.GetFace(ADelta.Index));
+            AModel.RemoveFace(ADelta.Index);
+            break;
+        case Kind::SET_FACE:
+            Inverse = MakeDelta(Kind::SET_FACE, ADelta.Index,
+                &AModel.GetFace(ADelta.Index));
+            AModel.ChangeFace(ADelta.Index, Face3D(PointAt(Coordinates, 0),
+                PointAt(Coordinates, 1), PointAt(Coordinates, 2)));
+            break;
+        case Kind::INSERT_LINE:
+            AModel.InsertLine(ADelta.Index,
+                Line3D(PointAt(Coordinates, 0), PointAt(Coordinates, 1)));
+            Inverse.Type = Kind::REMOVE_LINE;
+            break;
+        case Kind::REMOVE_LINE:
+            Inverse = MakeDelta(Kind::INSERT_LINE, ADelta.Index,
+                &AModel.GetLine(ADelta.Index));
+            AModel.RemoveLine(ADelta.Index);
+            break;
+        case Kind::SET_LINE:
+            Inverse = MakeDelta(Kind::SET_LINE, ADelta.Index,
+                &AModel.GetLine(ADelta.Index));
+            AModel.ChangeLine(ADelta.Index,
+                Line3D(PointAt(Coordinates, 0), PointAt(Coordinates, 1)));
+            break;
+        case Kind::SWAP_FACES:
+            AModel.SwapFaces(*ADelta.pHolder);
+            break;
+        case Kind::SWAP_LINES:
+            AModel.SwapLines(*ADelta.pHolder);
+            break;
+        case Kind::SET_NAME:
+            Inverse.Text = AModel.Name;
+            AModel.Name = ADelta.Text;
+            break;
+        case Kind::SET_DESCRIPTION:
+            Inverse.Text = AModel.Description;
+            AModel.Description = ADelta.Text;
+            break;
+        case Kind::SWAP_MODEL:
+            Inverse.pHolder = pModel;
+            pModel = ADelta.pHolder;
+            break;
+    }
+    return Inverse;
+}
+/*************************************************************************
+【函数名称】Revert
+【函数功能】从后向前执行一步中的逆操作。生成的逆步骤按执行的顺序
+       排列，因此同样从后向前执行即可恢复
+【参数】const Step& AStep, 表示要执行的步骤
+       shared_ptr<Model3D>& pModel, 表示模型
+【返回值】Step，逆步骤
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】2026/10/19 谭雯心 共用的pHolder只计一次内存
+*************************************************************************/
+EditJournal::Step EditJournal::Revert(
+    const Step& AStep, shared_ptr<Model3D>& pModel) {
+    Step Inverse;
+    Inverse.Deltas.reserve(AStep.Deltas.size());
+    for (size_t i = AStep.Deltas.size(); i > 0; i--) {
+        Inverse.Deltas.push_back(Apply(AStep.Deltas[i - 1], pModel));
+    }
+    for (size_t i = 0; i < Inverse.Deltas.size(); i++) {
+        const Delta& ADelta = Inverse.Deltas[i];
+        Inverse.Bytes += SizeOf(ADelta,
+            !ReferencesHolder(Inverse.Deltas, i, ADelta.pHolder));
+    }
+    return Inverse;
+}
+
+//-------------------------------------------------------------------------
+// 私有非静态成员函数
+//-------------------------------------------------------------------------
+
+/*************************************************************************
+【函数名称】Append
+【函数功能】追加一条逆操作：在未结束的组中时并入该组的步骤，
+       否则作为新的一步；新的编辑使重做栈失效。同一步中已有逆操作
+       引用同一个pHolder时，不再重复计入它的内存
+【参数】Delta&& ADelta, 表示逆操作
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】2026/10/19 谭雯心 共用的pHolder只计一次内存
+*************************************************************************/
+void EditJournal::Append(Delta&& ADelta) {
+    for (const Step& AStep : m_Redo) {
+        m_Bytes -= AStep.Bytes;
+    }
+    m_Redo.clear();
+    if (!m_bGroupOpen) {
+        m_Undo.emplace_back();
+        m_bGroupOpen = m_GroupDepth > 0;
+    }
+    Step& Current = m_Undo.back();
+    size_t Bytes = SizeOf(ADelta, !ReferencesHolder(
+        Current.Deltas, Current.Deltas.size(), ADelta.pHolder));
+    Current.Deltas.push_back(move(ADelta));
+    Current.Bytes += Bytes;
+    m_Bytes += Bytes;
+    Trim();
+}
+/*************************************************************************
+【函数名称】Trim
+【函数功能】丢弃撤销栈中最早的步骤直到不超出预算；
+       未结束的组仍在追加，不丢弃
+【参数】无
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+void EditJournal::Trim() {
+    while (m_Bytes > m_Budget && !m_Undo.empty()) {
+        if (m_bGroupOpen && m_Undo.size() == 1) {
+            break;
+        }
+        m_Bytes -= m_Undo.front().Bytes;
+        m_Undo.pop_front();
+    }
+}
@@ -0,0 +1,198 @@
+/*************************************************************************
+【文件名】EditJournal.hpp
+【功能模块和目的】定义EditJournal类，记录模型编辑的逆操作以支持撤销和重做
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】2026/10/19 谭雯心 一步中共用的pHolder只计一次内存
+*************************************************************************/
+#ifndef EDITJOURNAL_HPP
+#define EDITJOURNAL_HPP
+
+// Model3D所属头文件
+#include "Model3D.hpp"
+// Face3D所属头文件
+#include "Face3D.hpp"
+// Line3D所属头文件
+#include "Line3D.hpp"
+// shared_ptr所属头文件
+#include <memory>
+// string所属头文件
+#include <string>
+// deque所属头文件
+#include <deque>
+// vector所属头文件
+#include <vector>
+// size_t所属头文件
+#include <cstddef>
+
+using namespace std;
+
+/*************************************************************************
+【类名】EditJournal
+【功能】一个模型的编辑日志。每次编辑后记录一条逆操作（元素位置和旧值，
+       清空时记录被换出的面、线列表，替换模型时记录原模型），撤销时
+       执行逆操作并把它的逆操作放入重做栈，因此撤销和重做的开销只与
+       这次编辑的规模有关，与模型大小无关。BeginGroup和EndGroup之间的
+       编辑合并为一步；日志占用的内存超出预算时丢弃最早的步骤。
+       日志不加锁，由调用者与模型一起保护
+【接口说明】
+    静态常量：默认内存预算（字节）
+    带参构造函数（内存预算）
+    拷贝构造函数
+    赋值运算符
+    虚析构函数
+    记录添加、删除、修改面和线
+    记录交换面列表、线列表
+    记录修改名称、注释
+    记录替换整个模型
+    开始、结束一组编辑
+    撤销、重做一步
+    清空日志
+    设置、获取内存预算
+    获取可撤销、可重做的步数和日志占用的内存
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+class EditJournal {
+public:
+    //-------------------------------------------------------------------------
+    // 静态常量
+    //-------------------------------------------------------------------------
+    // 默认内存预算（字节）
+    static constexpr size_t DEFAULT_BUDGET{size_t(64) << 20};
+    //-------------------------------------------------------------------------
+    // 必要的构造、析构、拷贝、赋值运算符重载函数
+    //-------------------------------------------------------------------------
+    // 带参构造函数
+    explicit EditJournal(size_t Budget = DEFAULT_BUDGET);
+    // 拷贝构造函数
+    EditJournal(const EditJournal& Source) = default;
+    // 赋值运算符
+    EditJournal& operator=(const EditJournal& Source) = default;
+    // 虚析构函数
+    virtual ~EditJournal() = default;
+    //-------------------------------------------------------------------------
+    // 非静态Setter成员函数
+    //-------------------------------------------------------------------------
+    // 记录在FaceIndex处添加了面
+    void RecordInsertFace(size_t FaceIndex);
+    // 记录删除了FaceIndex处的面OldFace
+    void RecordRemoveFace(size_t FaceIndex, const Face3D& OldFace);
+    // 记录把FaceIndex处的面从OldFace修改为其他面
+    void RecordChangeFace(size_t FaceIndex, const Face3D& OldFace);
+    // 记录在LineIndex处添加了线
+    void RecordInsertLine(size_t LineIndex);
+    // 记录删除了LineIndex处的线OldLine
+    void RecordRemoveLine(size_t LineIndex, const Line3D& OldLine);
+    // 记录把LineIndex处的线从OldLine修改为其他线
+    void RecordChangeLine(size_t LineIndex, const Line3D& OldLine);
+    // 记录模型的面列表与pHolder的面列表做了交换
+    void RecordSwapFaces(const shared_ptr<Model3D>& pHolder);
+    // 记录模型的线列表与pHolder的线列表做了交换
+    void RecordSwapLines(const shared_ptr<Model3D>& pHolder);
+    // 记录把名称从OldName修改为其他名称
+    void RecordName(const string& OldName);
+    // 记录把注释从OldDescription修改为其他注释
+    void RecordDescription(const string& OldDescription);
+    // 记录整个模型被替换，pOldModel为原模型
+    void RecordModel(const shared_ptr<Model3D>& pOldModel);
+    // 开始一组编辑，可嵌套
+    void BeginGroup();
+    // 结束一组编辑，没有未结束的组时返回false
+    bool EndGroup();
+    // 撤销一步，没有可撤销的步骤时返回false
+    bool Undo(shared_ptr<Model3D>& pModel);
+    // 重做一步，没有可重做的步骤时返回false
+    bool Redo(shared_ptr<Model3D>& pModel);
+    // 清空日志
+    void Clear();
+    // 设置内存预算，超出时丢弃最早的步骤
+    void SetBudget(size_t Budget);
+    //-------------------------------------------------------------------------
+    // 非静态Getter成员函数
+    //-------------------------------------------------------------------------
+    // 获取内存预算
+    size_t GetBudget() const;
+    // 获取可撤销的步数
+    size_t GetUndoCount() const;
+    // 获取可重做的步数
+    size_t GetRedoCount() const;
+    // 获取日志占用的内存（字节）
+    size_t GetBytes() const;
+
+private:
+    //-------------------------------------------------------------------------
+    // 私有的内嵌类
+    //-------------------------------------------------------------------------
+    // 逆操作的种类
+    enum class Kind {
+        INSERT_FACE,
+        REMOVE_FACE,
+        SET_FACE,
+        INSERT_LINE,
+        REMOVE_LINE,
+        SET_LINE,
+        SWAP_FACES,
+        SWAP_LINES,
+        SET_NAME,
+        SET_DESCRIPTION,
+        SWAP_MODEL
+    };
+    // 一条逆操作
+    struct Delta {
+        // 种类
+        Kind Type;
+        // 面或线的位置
+        size_t Index;
+        // 面或线的顶点坐标，依次为各点的x、y、z
+        double Coordinates[9];
+        // 名称或注释
+        string Text;
+        // 交换用的面、线列表或原模型
+        shared_ptr<Model3D> pHolder;
+    };
+    // 一步（一次编辑或一组编辑）
+    struct Step {
+        // 逆操作，撤销或重做时从后向前执行
+        vector<Delta> Deltas{};
+        // 占用的内存（字节）
+        size_t Bytes{0};
+    };
+    //-------------------------------------------------------------------------
+    // 私有静态成员函数
+    //-------------------------------------------------------------------------
+    // 创建记录元素位置和顶点坐标的逆操作
+    static Delta MakeDelta(Kind Type, size_t Index, const Element3D* pElement);
+    // 估计一条逆操作占用的内存，bCountHolder为false时不计pHolder
+    static size_t SizeOf(const Delta& ADelta, bool bCountHolder = true);
+    // Deltas的前Count条中是否已有引用pHolder的逆操作
+    static bool ReferencesHolder(const vector<Delta>& Deltas, size_t Count,
+        const shared_ptr<Model3D>& pHolder);
+    // 对模型执行一条逆操作，返回它的逆操作
+    static Delta Apply(const Delta& ADelta, shared_ptr<Model3D>& pModel);
+    // 按相反的顺序执行一步，返回它的逆步骤
+    static Step Revert(const Step& AStep, shared_ptr<Model3D>& pModel);
+    //-------------------------------------------------------------------------
+    // 私有非静态成员函数
+    //-------------------------------------------------------------------------
+    // 追加一条逆操作并清空重做栈
+    void Append(Delta&& ADelta);
+    // 丢弃最早的步骤直到不超出预算，未结束的组不丢弃
+    void Trim();
+    //-------------------------------------------------------------------------
+    // 私有非静态成员
+    //-------------------------------------------------------------------------
+    // 撤销栈，末尾为最近的步骤
+    deque<Step> m_Undo{};
+    // 重做栈，末尾为下一个要重做的步骤
+    vector<Step> m_Redo{};
+    // 内存预算
+    size_t m_Budget;
+    // 撤销栈和重做栈占用的内存
+    size_t m_Bytes{0};
+    // 未结束的组的嵌套深度
+    size_t m_GroupDepth{0};
+    // 撤销栈末尾的步骤是否属于未结束的组
+    bool m_bGroupOpen{false};
+};
+
+#endif /* EditJournal.hpp */
@@ -0,0 +1,277 @@
+/*************************************************************************
+【文件名】EditScript.cpp
+【功能模块和目的】定义EditScript类的成员函数
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】2026/10/19 谭雯心 增加了undo、redo命令
+*************************************************************************/
+// EditScript所属头文件
+#include "EditScript.hpp"
+// ifstream所属头文件
+#include <fstream>
+// istringstream所属头文件
+#include <sstream>
+// string所属头文件
+#include <string>
+// vector所属头文件
+#include <vector>
+// strtod、strtoull所属头文件
+#include <cstdlib>
+// size_t所属头文件
+#include <cstddef>
+
+using namespace std;
+
+namespace {
+    // 一种命令的语法
+    struct Syntax {
+        // 命令名
+        const char* Name;
+        // 操作码
+        EditScript::Opcode Code;
+        // 下标参数个数
+        size_t IndexCount;
+        // 坐标参数个数
+        size_t ValueCount;
+        // 是否以该行其余部分为文本参数
+        bool HasText;
+    };
+    // 全部命令的语法，顺序与EditScript::Opcode一致
+    const Syntax SYNTAXES[] = {
+        {"create", EditScript::Opcode::CREATE, 0, 0, false},
+        {"select", EditScript::Opcode::SELECT, 1, 0, false},
+        {"remove_model", EditScript::Opcode::REMOVE_MODEL, 1, 0, false},
+        {"load", EditScript::Opcode::LOAD, 0, 0, true},
+        {"save", EditScript::Opcode::SAVE, 0, 0, true},
+        {"add_face", EditScript::Opcode::ADD_FACE, 0, 9, false},
+        {"remove_face", EditScript::Opcode::REMOVE_FACE, 1, 0, false},
+        {"change_face_point",
+            EditScript::Opcode::CHANGE_FACE_POINT, 2, 3, false},
+        {"add_line", EditScript::Opcode::ADD_LINE, 0, 6, false},
+        {"remove_line", EditScript::Opcode::REMOVE_LINE, 1, 0, false},
+        {"change_line_point",
+            EditScript::Opcode::CHANGE_LINE_POINT, 2, 3, false},
+        {"clear_faces", EditScript::Opcode::CLEAR_FACES, 0, 0, false},
+        {"clear_lines", EditScript::Opcode::CLEAR_LINES, 0, 0, false},
+        {"clear", EditScript::Opcode::CLEAR, 0, 0, false},
+        {"rename", EditScript::Opcode::RENAME, 0, 0, true},
+        {"describe", EditScript::Opcode::DESCRIBE, 0, 0, true},
+        {"undo", EditScript::Opcode::UNDO, 0, 0, false},
+        {"redo", EditScript::Opcode::REDO, 0, 0, false}
+    };
+    /*********************************************************************
+    【函数名称】Trim
+    【函数功能】去掉字符串首尾的空白
+    【参数】const string& Text, 表示字符串
+    【返回值】string，去掉空白后的字符串
+    【开发者及日期】谭雯心 2026/10/19
+    【更改记录】
+    *********************************************************************/
+    string Trim(const string& Text) {
+        const char* SPACES = " \t\r\n";
+        size_t First = Text.find_first_not_of(SPACES);
+        if (First == string::npos) {
+            return string();
+        }
+        size_t Last = Text.find_last_not_of(SPACES);
+        return Text.substr(First, Last - First + 1);
+    }
+}
+
+//-------------------------------------------------------------------------
+// 内嵌异常类
+//-------------------------------------------------------------------------
+
+/*************************************************************************
+【函数名称】SYNTAX_ERROR
+【函数功能】语法错误异常类的构造函数
+【参数】size_t LineNumber, 表示行号
+       const string& Message, 表示错误原因
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+EditScript::SYNTAX_ERROR::SYNTAX_ERROR(
+    size_t LineNumber, const string& Message)
+    : invalid_argument(string("Line ") + to_string(LineNumber)
+    + string(": ") + Message) {
+}
+/*************************************************************************
+【函数名称】FILE_NOT_AVAILABLE
+【函数功能】文件无法读取异常类的构造函数
+【参数】const string& FileName, 表示文件名
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+EditScript::FILE_NOT_AVAILABLE::FILE_NOT_AVAILABLE(const string& FileName)
+    : invalid_argument(string("File ") + FileName
+    + string(" not available.")) {
+}
+
+//-------------------------------------------------------------------------
+// 非静态Setter成员函数
+//-------------------------------------------------------------------------
+
+/*************************************************************************
+【函数名称】Parse
+【函数功能】从流中逐行解析命令并追加到末尾，遇到语法错误时抛出异常，
+       此前解析的命令保持不变
+【参数】istream& Stream, 表示输入流
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+void EditScript::Parse(istream& Stream) {
+    CommandList Parsed;
+    string Line;
+    size_t LineNumber = 0;
+    while (getline(Stream, Line)) {
+        LineNumber++;
+        Command ACommand;
+        if (ParseLine(Line, LineNumber, ACommand)) {
+            Parsed.push_back(ACommand);
+        }
+    }
+    m_Commands.insert(m_Commands.end(), Parsed.begin(), Parsed.end());
+}
+/*************************************************************************
+【函数名称】ParseFile
+【函数功能】从文件中解析命令并追加到末尾
+【参数】const string& FileName, 表示文件名
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+void EditScript::ParseFile(const string& FileName) {
+    ifstream File(FileName);
+    if (!File.is_open()) {
+        throw FILE_NOT_AVAILABLE(FileName);
+    }
+    Parse(File);
+}
+/*************************************************************************
+【函数名称】Clear
+【函数功能】清空命令
+【参数】无
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+void EditScript::Clear() {
+    m_Commands.clear();
+}
+
+//-------------------------------------------------------------------------
+// 非静态Getter成员函数
+//-------------------------------------------------------------------------
+
+/*************************************************************************
+【函数名称】Commands
+【函数功能】获取命令列表
+【参数】无
+【返回值】const CommandList&，命令列表
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+const EditScript::CommandList& EditScript::Commands() const {
+    return m_Commands;
+}
+/*************************************************************************
+【函数名称】GetCommandCount
+【函数功能】获取命令数
+【参数】无
+【返回值】size_t，命令数
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+size_t EditScript::GetCommandCount() const {
+    return m_Commands.size();
+}
+
+//-------------------------------------------------------------------------
+// 静态成员函数
+//-------------------------------------------------------------------------
+
+/*************************************************************************
+【函数名称】GetOpcodeName
+【函数功能】获取操作码的名称
+【参数】Opcode Code, 表示操作码
+【返回值】const char*，脚本中的命令名
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+const char* EditScript::GetOpcodeName(Opcode Code) {
+    return SYNTAXES[static_cast<size_t>(Code)].Name;
+}
+
+//-------------------------------------------------------------------------
+// 私有静态成员函数
+//-------------------------------------------------------------------------
+
+/*************************************************************************
+【函数名称】ParseLine
+【函数功能】解析一行。空行和注释行返回false；命令名未知、参数个数不对
+       或参数不是有效数值时抛出SYNTAX_ERROR
+【参数】const string& Line, 表示一行文本
+       size_t LineNumber, 表示行号
+       Command& ACommand, 用于返回命令
+【返回值】bool，该行是否为命令
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+bool EditScript::ParseLine(
+    const string& Line, size_t LineNumber, Command& ACommand) {
+    string Content = Trim(Line);
+    if (Content.empty() || Content[0] == '#') {
+        return false;
+    }
+    istringstream Tokens(Content);
+    string Name;
+    Tokens >> Name;
+    const Syntax* pSyntax = nullptr;
+    for (const auto& ASyntax : SYNTAXES) {
+        if (Name == ASyntax.Name) {
+            pSyntax = &ASyntax;
+            break;
+        }
+    }
+    if (pSyntax == nullptr) {
+        throw SYNTAX_ERROR(LineNumber, string("unknown command ") + Name);
+    }
+    ACommand.Code = pSyntax->Code;
+    ACommand.LineNumber = LineNumber;
+    // 文本参数为命令名之后的其余部分
+    if (pSyntax->HasText) {
+        ACommand.Text = Trim(Content.substr(Name.size()));
+        if (ACommand.Text.empty()) {
+            throw SYNTAX_ERROR(LineNumber, Name + " needs an argument");
+        }
+        return true;
+    }
+    string Token;
+    for (size_t i = 0; i < pSyntax->IndexCount; i++) {
+        if (!(Tokens >> Token)
+            || Token.find_first_not_of("0123456789") != string::npos) {
+            throw SYNTAX_ERROR(LineNumber, Name + " expects "
+                + to_string(pSyntax->IndexCount) + " indices");
+        }
+        ACommand.Indices.push_back(
+            static_cast<size_t>(strtoull(Token.c_str(), nullptr, 10)));
+    }
+    for (size_t i = 0; i < pSyntax->ValueCount; i++) {
+        char* End = nullptr;
+        if (!(Tokens >> Token)) {
+            throw SYNTAX_ERROR(LineNumber, Name + " expects "
+                + to_string(pSyntax->ValueCount) + " coordinates");
+        }
+        double Value = strtod(Token.c_str(), &End);
+        if (End == Token.c_str() || *End != '\0') {
+            throw SYNTAX_ERROR(LineNumber, string("invalid number ") + Token);
+        }
+        ACommand.Values.push_back(Value);
+    }
+    if (Tokens >> Token) {
+        throw SYNTAX_ERROR(LineNumber, string("unexpected ") + Token);
+    }
+    return true;
+}
@@ -0,0 +1,159 @@
+/*************************************************************************
+【文件名】EditScript.hpp
+【功能模块和目的】定义EditScript类，解析记录模型编辑过程的命令脚本
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】2026/10/19 谭雯心 增加了undo、redo命令
+*************************************************************************/
+#ifndef EDITSCRIPT_HPP
+#define EDITSCRIPT_HPP
+
+// 流操作所属头文件
+#include <iostream>
+// string所属头文件
+#include <string>
+// vector所属头文件
+#include <vector>
+// 异常类所属头文件
+#include <stdexcept>
+// size_t所属头文件
+#include <cstddef>
+
+using namespace std;
+
+/*************************************************************************
+【类名】EditScript
+【功能】命令脚本。每行一条命令，'#'开头的行和空行被忽略，命令名与参数
+       以空白分隔，文件名、名称和注释取该行其余部分：
+       create                          创建模型并设为当前模型
+       select <model>                  设置当前模型
+       remove_model <model>            删除模型
+       load <file>                     从文件导入当前模型
+       save <file>                     将当前模型导出到文件
+       add_face <x1 y1 z1 x2 y2 z2 x3 y3 z3>
+       remove_face <face>
+       change_face_point <face> <point> <x y z>
+       add_line <x1 y1 z1 x2 y2 z2>
+       remove_line <line>
+       change_line_point <line> <point> <x y z>
+       clear_faces、clear_lines、clear
+       rename <name>                   修改当前模型名称
+       describe <text>                 修改当前模型注释
+       undo、redo                      撤销、重做当前模型的一步编辑
+                                       （连续的add_face或add_line为一步）
+【接口说明】
+    内嵌异常类：语法错误、文件无法读取
+    公有类型：操作码
+    内嵌结构体Command，表示一条命令
+    默认构造函数
+    从流、从文件解析命令并追加到末尾
+    获取命令列表、命令数
+    清空命令
+    静态：获取操作码的名称
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】2026/10/19 谭雯心 增加了undo、redo命令
+*************************************************************************/
+class EditScript {
+public:
+    //-------------------------------------------------------------------------
+    // 内嵌异常类
+    //-------------------------------------------------------------------------
+    // 脚本有语法错误时抛出该异常，信息中包含行号
+    class SYNTAX_ERROR : public invalid_argument {
+    public:
+        SYNTAX_ERROR(size_t LineNumber, const string& Message);
+    };
+    // 脚本文件无法读取时抛出该异常
+    class FILE_NOT_AVAILABLE : public invalid_argument {
+    public:
+        FILE_NOT_AVAILABLE(const string& FileName);
+    };
+    //-------------------------------------------------------------------------
+    // 公有类型
+    //-------------------------------------------------------------------------
+    // 操作码
+    enum class Opcode {
+        CREATE,
+        SELECT,
+        REMOVE_MODEL,
+        LOAD,
+        SAVE,
+        ADD_FACE,
+        REMOVE_FACE,
+        CHANGE_FACE_POINT,
+        ADD_LINE,
+        REMOVE_LINE,
+        CHANGE_LINE_POINT,
+        CLEAR_FACES,
+        CLEAR_LINES,
+        CLEAR,
+        RENAME,
+        DESCRIBE,
+        UNDO,
+        REDO
+    };
+    //-------------------------------------------------------------------------
+    // 公有的内嵌类，用于存储数据
+    //-------------------------------------------------------------------------
+    // 一条命令
+    struct Command {
+        // 操作码
+        Opcode Code;
+        // 所在行号（从1开始）
+        size_t LineNumber;
+        // 下标参数（模型、面、线、点的位置）
+        vector<size_t> Indices;
+        // 坐标参数
+        vector<double> Values;
+        // 文本参数（文件名、名称、注释）
+        string Text;
+    };
+    // 命令列表
+    using CommandList = vector<Command>;
+    //-------------------------------------------------------------------------
+    // 必要的构造、析构、拷贝、赋值运算符重载函数
+    //-------------------------------------------------------------------------
+    // 默认构造函数
+    EditScript() = default;
+    // 拷贝构造函数
+    EditScript(const EditScript& Source) = default;
+    // 赋值运算符
+    EditScript& operator=(const EditScript& Source) = default;
+    // 虚析构函数
+    virtual ~EditScript() = default;
+    //-------------------------------------------------------------------------
+    // 非静态Setter成员函数
+    //-------------------------------------------------------------------------
+    // 从流中解析命令并追加到末尾
+    void Parse(istream& Stream);
+    // 从文件中解析命令并追加到末尾
+    void ParseFile(const string& FileName);
+    // 清空命令
+    void Clear();
+    //-------------------------------------------------------------------------
+    // 非静态Getter成员函数
+    //-------------------------------------------------------------------------
+    // 获取命令列表
+    const CommandList& Commands() const;
+    // 获取命令数
+    size_t GetCommandCount() const;
+    //-------------------------------------------------------------------------
+    // 静态成员函数
+    //-------------------------------------------------------------------------
+    // 获取操作码的名称（即脚本中的命令名）
+    static const char* GetOpcodeName(Opcode Code);
+
+private:
+    //-------------------------------------------------------------------------
+    // 私有静态成员函数
+    //-------------------------------------------------------------------------
+    // 解析一行，若为命令则返回true
+    static bool ParseLine(
+        const string& Line, size_t LineNumber, Command& ACommand);
+    //-------------------------------------------------------------------------
+    // 私有非静态成员
+    //-------------------------------------------------------------------------
+    // 命令列表
+    CommandList m_Commands{};
+};
+
+#endif /* EditScript.hpp */
@@ -3,6 +3,7 @@
 【功能模块和目的】定义Group类模板，存储T类型的元素
 【开发者及日期】谭雯心 2024/8/4
 【更改记录】2024/8/12 谭雯心 增加内嵌异常类的声明与实现
+           2026/10/19 谭雯心 元素存储改用CountingAllocator计数，增加获取容量
 *************************************************************************/
 #ifndef GROUP_HPP
 #define GROUP_HPP
@@ -22,6 +23,8 @@
 #include <iostream>
 // numeric_limits所属头文件
 #include <limits>
+// CountingAllocator所属头文件
+#include "CountingAllocator.hpp"
 
 using namespace std;
 
@@ -67,6 +70,7 @@ ostream& operator<<(ostream& out, const Group<T>& AGroup) {
     判断是否不等的运算符重载
     查找元素的下标
     获取元素个数
+    获取已分配的容量
     判断是否为空
     判断元素是否存在
     向末尾添加元素
@@ -79,6 +83,7 @@ ostream& operator<<(ostream& out, const Group<T>& AGroup) {
     流输出运算符重载
 【开发者及日期】谭雯心 2024/8/4
 【更改记录】2024/8/12 谭雯心 增加内嵌异常类的声明与实现
+           2026/10/19 谭雯心 元素存储改用CountingAllocator计数，增加获取容量
 *************************************************************************/
 template <typename T>
 class Group {
@@ -129,6 +134,8 @@ public:
     size_t CountElement() const;
     // 获取元素数量上限
     size_t MaxElementCount() const;
+    // 获取已分配的容量（元素个数）
+    size_t GetCapacity() const;
     // 判断是否为空
     bool IsEmpty() const;
     // 判断元素是否存在
@@ -154,8 +161,8 @@ public:
     friend ostream& operator<< <T>(ostream& out, const Group<T>& AGroup);
 
 private:
-    // 存储元素的容器，vector类型
-    vector<T> m_Elements;
+    // 存储元素的容器，vector类型，按元素类型对应的类别计数
+    vector<T, CountingAllocator<T, MemoryCategoryOf<T>::VALUE>> m_Elements;
     // 存储元素数量上限
     size_t m_MaxElementCount{numeric_limits<size_t>::max()};
 };
@@ -319,6 +326,18 @@ size_t Group<T>::MaxElementCount() const {
     return m_MaxElementCount;
 }
 /*************************************************************************
+【函数名称】GetCapacity const
+【函数功能】获取已分配的容量
+【参数】无
+【返回值】size_t，容量（元素个数），不小于元素个数
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+template <typename T>
+size_t Group<T>::GetCapacity() const {
+    return m_Elements.capacity();
+}
+/*************************************************************************
 【函数名称】IsEmpty const
 【函数功能】判断是否为空
 【参数】无
@@ -0,0 +1,994 @@
+/*************************************************************************
+【文件名】GzipFormat.cpp
+【功能模块和目的】定义GzipFormat类的成员函数
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+// GzipFormat所属头文件
+#include "GzipFormat.hpp"
+// invalid_argument所属头文件
+#include <stdexcept>
+// function所属头文件
+#include <functional>
+// string所属头文件
+#include <string>
+// vector所属头文件
+#include <vector>
+// min所属头文件
+#include <algorithm>
+// memcpy所属头文件
+#include <cstring>
+// uint8_t、uint16_t、uint32_t、uint64_t所属头文件
+#include <cstdint>
+// size_t所属头文件
+#include <cstddef>
+
+using namespace std;
+
+namespace {
+    // 成员头的标志位：有扩展字段
+    constexpr uint8_t FLAG_EXTRA{0x04};
+    // 成员头的标志位：有文件名
+    constexpr uint8_t FLAG_NAME{0x08};
+    // 成员头的标志位：有注释
+    constexpr uint8_t FLAG_COMMENT{0x10};
+    // 成员头的标志位：有头部校验
+    constexpr uint8_t FLAG_HEADER_CRC{0x02};
+    // 成员头的保留标志位
+    constexpr uint8_t FLAG_RESERVED{0xe0};
+    // 压缩方法：deflate
+    constexpr uint8_t METHOD_DEFLATE{8};
+    // 帧头扩展字段的子字段标识
+    constexpr char FRAME_ID_1{'M'};
+    constexpr char FRAME_ID_2{'F'};
+    // 最短、最长匹配
+    constexpr size_t MIN_MATCH{3};
+    constexpr size_t MAX_MATCH{258};
+    // 压缩时哈希表的位数
+    constexpr unsigned HASH_BITS{15};
+    // 压缩时每个位置最多比较的候选数
+    constexpr unsigned MAX_CHAIN{32};
+    // 长度码257～285的基数和附加位数
+    const uint16_t LENGTH_BASE[29] = {3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17,
+        19, 23, 27, 31, 35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227,
+        258};
+    const uint8_t LENGTH_EXTRA[29] = {0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2,
+        2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0};
+    // 距离码0～29的基数和附加位数
+    const uint16_t DISTANCE_BASE[30] = {1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33,
+        49, 65, 97, 129, 193, 257, 385, 513, 769, 1025, 1537, 2049, 3073,
+        4097, 6145, 8193, 12289, 16385, 24577};
+    const uint8_t DISTANCE_EXTRA[30] = {0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5,
+        5, 6, 6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13};
+    // 不压缩的块的最大字节数
+    constexpr size_t MAX_STORED{65535};
+    // 不压缩的块的块头字节数
+    constexpr size_t STORED_OVERHEAD{5};
+    // 动态码表中码长码的存放顺序
+    const uint8_t CODE_LENGTH_ORDER[19] = {16, 17, 18, 0, 8, 7, 9, 6, 10, 5,
+        11, 4, 12, 3, 13, 2, 14, 1, 15};
+
+    /*************************************************************************
+    【函数名称】Reverse
+    【函数功能】把Code的低Length位逆序（deflate的Huffman码高位在前存放）
+    【参数】uint32_t Code, 码
+           unsigned Length, 码长
+    【返回值】uint32_t，逆序后的码
+    【开发者及日期】谭雯心 2026/10/19
+    【更改记录】
+    *************************************************************************/
+    uint32_t Reverse(uint32_t Code, unsigned Length) {
+        uint32_t Result = 0;
+        for (unsigned i = 0; i < Length; i++) {
+            Result = (Result << 1) | ((Code >> i) & 1);
+        }
+        return Result;
+    }
+
+    /*************************************************************************
+    【函数名称】ReadLE32
+    【函数功能】读取小端序的32位整数
+    【参数】const char* pData, 数据
+    【返回值】uint32_t，整数
+    【开发者及日期】谭雯心 2026/10/19
+    【更改记录】
+    *************************************************************************/
+    uint32_t ReadLE32(const char* pData) {
+        const unsigned char* p = reinterpret_cast<const unsigned char*>(pData);
+        return uint32_t(p[0]) | uint32_t(p[1]) << 8 | uint32_t(p[2]) << 16
+            | uint32_t(p[3]) << 24;
+    }
+
+    /*************************************************************************
+    【函数名称】AppendLE32
+    【函数功能】以小端序追加32位整数
+    【参数】string& Text, 字符串
+           uint32_t Value, 整数
+    【返回值】无
+    【开发者及日期】谭雯心 2026/10/19
+    【更改记录】
+    *************************************************************************/
+    void AppendLE32(string& Text, uint32_t Value) {
+        for (unsigned i = 0; i < 4; i++) {
+            Text += static_cast<char>((Value >> (8 * i)) & 0xff);
+        }
+    }
+
+    /*************************************************************************
+    【类名】FixedEncoder
+    【功能】固定Huffman编码的逆序码表，以及长度、距离到码的映射，只建立一次
+    【接口说明】
+        默认构造函数
+    【开发者及日期】谭雯心 2026/10/19
+    【更改记录】
+    *************************************************************************/
+    struct FixedEncoder {
+        // 字面量和长度码的逆序码
+        uint16_t LiteralCode[288];
+        // 字面量和长度码的码长
+        uint8_t LiteralLength[288];
+        // 距离码的逆序码
+        uint16_t DistanceCode[30];
+        // 长度3～258对应的长度码序号（0～28）
+        uint8_t LengthSymbol[MAX_MATCH + 1];
+        // 距离1～32768对应的距离码
+        uint8_t DistanceSymbol[GzipFormat::WINDOW_SIZE + 1];
+        FixedEncoder() {
+            for (unsigned Symbol = 0; Symbol < 288; Symbol++) {
+                uint32_t Code;
+                unsigned Length;
+                if (Symbol < 144) {
+                    Code = 0x30 + Symbol;
+                    Length = 8;
+                }
+                else if (Symbol < 256) {
+                    Code = 0x190 + (Symbol - 144);
+                    Length = 9;
+                }
+                else if (Symbol < 280) {
+                    Code = Symbol - 256;
+                    Length = 7;
+                }
+                else {
+                    Code = 0xc0 + (Symbol - 280);
+                    Length = 8;
+                }
+                LiteralCode[Symbol] = static_cast<uint16_t>(Reverse(Code, Length));
+                LiteralLength[Symbol] = static_cast<uint8_t>(Length);
+            }
+            for (unsigned Symbol = 0; Symbol < 30; Symbol++) {
+                DistanceCode[Symbol] = static_cast<uint16_t>(Reverse(Symbol, 5));
+            }
+            for (uint8_t i = 0; i < 29; i++) {
+                size_t End = i + 1 < 29 ? LENGTH_BASE[i + 1] : MAX_MATCH + 1;
+                for (size_t Length = LENGTH_BASE[i]; Length < End; Length++) {
+                    LengthSymbol[Length] = i;
+                }
+            }
+            // 长度258只能用码285表示
+            LengthSymbol[MAX_MATCH] = 28;
+            for (uint8_t i = 0; i < 30; i++) {
+                size_t End = i + 1 < 30 ? DISTANCE_BASE[i + 1]
+                    : GzipFormat::WINDOW_SIZE + 1;
+                for (size_t Distance = DISTANCE_BASE[i]; Distance < End;
+                    Distance++) {
+                    DistanceSymbol[Distance] = i;
+                }
+            }
+        }
+    };
+
+    /*************************************************************************
+    【类名】BitWriter
+    【功能】按deflate的位序（低位在前）向字符串追加位
+    【接口说明】
+        带参构造函数
+        追加Length位
+        写出不足一字节的剩余位
+    【开发者及日期】谭雯心 2026/10/19
+    【更改记录】
+    *************************************************************************/
+    class BitWriter {
+    public:
+        explicit BitWriter(string& Output) : m_Output(Output) {
+        }
+        void Put(uint32_t Value, unsigned Length) {
+            m_Bits |= uint64_t(Value) << m_Count;
+            m_Count += Length;
+            if (m_Count >= 32) {
+                AppendLE32(m_Output, static_cast<uint32_t>(m_Bits));
+                m_Bits >>= 32;
+                m_Count -= 32;
+            }
+        }
+        void Flush() {
+            while (m_Count > 0) {
+                m_Output += static_cast<char>(m_Bits & 0xff);
+                m_Bits >>= 8;
+                m_Count = m_Count > 8 ? m_Count - 8 : 0;
+            }
+        }
+
+    private:
+        // 输出
+        string& m_Output;
+        // 未写出的位
+        uint64_t m_Bits{0};
+        // 未写出的位数
+        unsigned m_Count{0};
+    };
+
+    /*************************************************************************
+    【函数名称】Store
+    【函数功能】把数据写为不压缩的deflate块，每块至多MAX_STORED字节
+    【参数】const char* pData, 数据
+           size_t Size, 字节数
+           string& Output, 追加结果的字符串
+    【返回值】无
+    【开发者及日期】谭雯心 2026/10/19
+    【更改记录】
+    *************************************************************************/
+    void Store(const char* pData, size_t Size, string& Output) {
+        size_t Offset = 0;
+        do {
+            size_t Length = min(MAX_STORED, Size - Offset);
+            bool bLast = Offset + Length == Size;
+            // BFINAL，BTYPE = 00，其余位补0到字节边界
+            Output += static_cast<char>(bLast ? 1 : 0);
+            Output += static_cast<char>(Length & 0xff);
+            Output += static_cast<char>(Length >> 8);
+            Output += static_cast<char>(~Length & 0xff);
+            Output += static_cast<char>((~Length >> 8) & 0xff);
+            Output.append(pData + Offset, Length);
+            Offset += Length;
+        } while (Offset < Size);
+    }
+
+    /*************************************************************************
+    【函数名称】Deflate
+    【函数功能】把数据压缩为一个固定Huffman编码的deflate块。LZ77匹配用
+           3字节哈希链查找，每个位置至多比较MAX_CHAIN个候选，贪心选取
+    【参数】const char* pData, 数据
+           size_t Size, 字节数
+           string& Output, 追加压缩结果的字符串
+    【返回值】无
+    【开发者及日期】谭雯心 2026/10/19
+    【更改记录】
+    *************************************************************************/
+    void Deflate(const char* pData, size_t Size, string& Output) {
+        static const FixedEncoder Encoder;
+        const unsigned char* p = reinterpret_cast<const unsigned char*>(pData);
+        BitWriter Writer(Output);
+        // BFINAL = 1，BTYPE = 01（固定Huffman编码）
+        Writer.Put(1, 1);
+        Writer.Put(1, 2);
+        vector<int32_t> Head(size_t(1) << HASH_BITS, -1);
+        vector<int32_t> Previous(GzipFormat::WINDOW_SIZE, -1);
+        const size_t WINDOW_MASK = GzipFormat::WINDOW_SIZE - 1;
+        auto Hash = [p](size_t i) {
+            uint32_t Key = uint32_t(p[i]) | uint32_t(p[i + 1]) << 8
+                | uint32_t(p[i + 2]) << 16;
+            return (Key * 2654435761u) >> (32 - HASH_BITS);
+        };
+        auto Insert = [&](size_t i) {
+            uint32_t Key = Hash(i);
+            Previous[i & WINDOW_MASK] = Head[Key];
+            Head[Key] = static_cast<int32_t>(i);
+        };
+        size_t i = 0;
+        while (i < Size) {
+            size_t BestLength = 0;
+            size_t BestDistance = 0;
+            if (i + MIN_MATCH <= Size) {
+                size_t Limit = min(MAX_MATCH, Size - i);
+                int32_t Candidate = Head[Hash(i)];
+                unsigned Chain = MAX_CHAIN;
+                while (Candidate >= 0 && Chain-- > 0
+                    && i - static_cast<size_t>(Candidate)
+                    <= GzipFormat::WINDOW_SIZE) {
+                    const unsigned char* pCandidate = p + Candidate;
+                    if (pCandidate[BestLength] == p[i + BestLength]) {
+                        size_t Length = 0;
+                        while (Length < Limit && pCandidate[Length] == p[i + Length]) {
+                            Length++;
+                        }
+                        if (Length > BestLength) {
+                            BestLength = Length;
+                            BestDistance = i - static_cast<size_t>(Candidate);
+                            if (Length == Limit) {
+                                break;
+                            }
+                        }
+                    }
+                    int32_t Next = Previous[Candidate & WINDOW_MASK];
+                    // 链上的位置须严格递减，否则是被覆盖的旧记录
+                    if (Next >= Candidate) {
+                        break;
+                    }
+                    Candidate = Next;
+                }
+                Insert(i);
+            }
+            if (BestLength >= MIN_MATCH) {
+                uint8_t LengthIndex = Encoder.LengthSymbol[BestLength];
+                unsigned Symbol = 257 + LengthIndex;
+                Writer.Put(Encoder.LiteralCode[Symbol], Encoder.LiteralLength[Symbol]);
+                Writer.Put(static_cast<uint32_t>(BestLength - LENGTH_BASE[LengthIndex]),
+                    LENGTH_EXTRA[LengthIndex]);
+                uint8_t DistanceIndex = Encoder.DistanceSymbol[BestDistance];
+                Writer.Put(Encoder.DistanceCode[DistanceIndex], 5);
+                Writer.Put(static_cast<uint32_t>(
+                    BestDistance - DISTANCE_BASE[DistanceIndex]),
+                    DISTANCE_EXTRA[DistanceIndex]);
+                for (size_t j = i + 1; j < i + BestLength; j++) {
+                    if (j + MIN_MATCH <= Size) {
+                        Insert(j);
+                    }
+                }
+                i += BestLength;
+            }
+            else {
+                Writer.Put(Encoder.LiteralCode[p[i]], Encoder.LiteralLength[p[i]]);
+                i++;
+            }
+        }
+        // 块结束符
+        Writer.Put(Encoder.LiteralCode[256], Encoder.LiteralLength[256]);
+        Writer.Flush();
+    }
+}
+
+//-------------------------------------------------------------------------
+// 静态常量
+//-------------------------------------------------------------------------
+
+// 魔数的第一个字节
+constexpr uint8_t GzipFormat::MAGIC_1;
+// 魔数的第二个字节
+constexpr uint8_t GzipFormat::MAGIC_2;
+// 每帧压缩前的字节数
+constexpr size_t GzipFormat::FRAME_SIZE;
+// 本类写出的帧头的字节数
+constexpr size_t GzipFormat::FRAME_HEADER_SIZE;
+// 成员尾的字节数
+constexpr size_t GzipFormat::TRAILER_SIZE;
+// deflate的最大回溯距离
+constexpr size_t GzipFormat::WINDOW_SIZE;
+// Huffman码表的快速查找位数
+constexpr unsigned GzipFormat::Inflater::FAST_BITS;
+// Huffman码的最大长度
+constexpr unsigned GzipFormat::Inflater::MAX_BITS;
+// 字面量和长度码表的最大符号数
+constexpr size_t GzipFormat::Inflater::MAX_SYMBOLS;
+// 输出环形缓冲区的字节数
+constexpr size_t GzipFormat::Inflater::RING_SIZE;
+
+//-------------------------------------------------------------------------
+// 内嵌异常类
+//-------------------------------------------------------------------------
+
+/*************************************************************************
+【函数名称】FORMAT_ERROR
+【函数功能】内嵌异常类构造函数，数据不是有效的gzip格式或已截断时抛出
+【参数】无
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+GzipFormat::FORMAT_ERROR::FORMAT_ERROR()
+    : invalid_argument("Invalid gzip data") {
+}
+
+//-------------------------------------------------------------------------
+// 内嵌解压器
+//-------------------------------------------------------------------------
+
+/*************************************************************************
+【函数名称】Inflater
+【函数功能】带参构造函数，输入从[pNext, pEnd)开始，用完后调用AFill补充；
+       AFill为空时输入只有[pNext, pEnd)
+【参数】const char* pNext, 输入的起点
+       const char* pEnd, 输入的终点
+       const Refill& AFill, 补充输入的函数
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+GzipFormat::Inflater::Inflater(
+    const char* pNext, const char* pEnd, const Refill& AFill)
+    : m_pNext(pNext), m_pEnd(pEnd), m_Refill(AFill), m_Ring(RING_SIZE) {
+}
+/*************************************************************************
+【函数名称】Read
+【函数功能】解压至多Capacity字节到pOut。每轮向环形缓冲区解码至多
+       WINDOW_SIZE字节，再复制到pOut并计入CRC-32，因此环形缓冲区中
+       总保留完整的回溯窗口；遇到成员尾时校验CRC-32和长度
+【参数】char* pOut, 输出
+       size_t Capacity, 输出的容量
+【返回值】size_t，写入的字节数，小于Capacity时成员已结束
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+size_t GzipFormat::Inflater::Read(char* pOut, size_t Capacity) {
+    size_t Done = 0;
+    while (m_State != State::DONE && (Done < Capacity
+        || m_State == State::TRAILER)) {
+        uint64_t Start = m_Total;
+        Produce(min(Capacity - Done, WINDOW_SIZE));
+        size_t Produced = static_cast<size_t>(m_Total - Start);
+        size_t Offset = static_cast<size_t>(Start % RING_SIZE);
+        size_t First = min(Produced, RING_SIZE - Offset);
+        memcpy(pOut + Done, &m_Ring[Offset], First);
+        memcpy(pOut + Done + First, &m_Ring[0], Produced - First);
+        m_Crc = Crc32(m_Crc, pOut + Done, Produced);
+        Done += Produced;
+        if (m_State == State::TRAILER) {
+            ReadTrailer();
+        }
+    }
+    return Done;
+}
+/*************************************************************************
+【函数名称】IsFinished
+【函数功能】成员是否已结束并通过校验
+【参数】无
+【返回值】bool，是否已结束
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+bool GzipFormat::Inflater::IsFinished() const {
+    return m_State == State::DONE;
+}
+/*************************************************************************
+【函数名称】GetPosition
+【函数功能】获取已结束的成员之后的第一个输入字节。查找符号时至多预读
+       两个字节，它们一定属于8字节的成员尾，因此成员结束时位缓冲区为空
+【参数】无
+【返回值】const char*，输入位置
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+const char* GzipFormat::Inflater::GetPosition() const {
+    return m_pNext;
+}
+/*************************************************************************
+【函数名称】Build
+【函数功能】按各符号的码长建立规范Huffman码表，码长不超过FAST_BITS的码
+       同时填入快速查找表。码长超额时抛出异常，不完整的码允许
+【参数】Huffman& Table, 码表
+       const uint8_t* pLengths, 各符号的码长，0表示不使用
+       size_t Count, 符号数
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+void GzipFormat::Inflater::Build(
+    Huffman& Table, const uint8_t* pLengths, size_t Count) {
+    fill(begin(Table.Count), end(Table.Count), uint16_t(0));
+    for (size_t i = 0; i < Count; i++) {
+        Table.Count[pLengths[i]]++;
+    }
+    Table.Count[0] = 0;
+    int Left = 1;
+    for (unsigned Length = 1; Length <= MAX_BITS; Length++) {
+        Left = (Left << 1) - Table.Count[Length];
+        if (Left < 0) {
+            throw FORMAT_ERROR();
+        }
+    }
+    uint16_t Offsets[MAX_BITS + 2] = {0};
+    for (unsigned Length = 1; Length <= MAX_BITS; Length++) {
+        Offsets[Length + 1] = Offsets[Length] + Table.Count[Length];
+    }
+    for (size_t i = 0; i < Count; i++) {
+        if (pLengths[i] != 0) {
+            Table.Symbol[Offsets[pLengths[i]]++] = static_cast<uint16_t>(i);
+        }
+    }
+    fill(begin(Table.Fast), end(Table.Fast), uint16_t(0));
+    uint32_t Code = 0;
+    size_t Index = 0;
+    for (unsigned Length = 1; Length <= FAST_BITS; Length++) {
+        for (unsigned k = 0; k < Table.Count[Length]; k++) {
+            uint16_t Entry = static_cast<uint16_t>(
+                Table.Symbol[Index + k] << 4 | Length);
+            for (uint32_t Slot = Reverse(Code, Length); Slot < (1u << FAST_BITS);
+                Slot += 1u << Length) {
+                Table.Fast[Slot] = Entry;
+            }
+            Code++;
+        }
+        Index += Table.Count[Length];
+        Code <<= 1;
+    }
+}
+/*************************************************************************
+【函数名称】FixedLiterals
+【函数功能】获取固定Huffman编码的字面量和长度码表，第一次使用时建立
+【参数】无
+【返回值】const Huffman&，码表
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+const GzipFormat::Inflater::Huffman& GzipFormat::Inflater::FixedLiterals() {
+    static const Huffman Table = [] {
+        uint8_t Lengths[MAX_SYMBOLS];
+        fill(Lengths, Lengths + 144, uint8_t(8));
+        fill(Lengths + 144, Lengths + 256, uint8_t(9));
+        fill(Lengths + 256, Lengths + 280, uint8_t(7));
+        fill(Lengths + 280, Lengths + 288, uint8_t(8));
+        Huffman Result;
+        Build(Result, Lengths, MAX_SYMBOLS);
+        return Result;
+    }();
+    return Table;
+}
+/*************************************************************************
+【函数名称】FixedDistances
+【函数功能】获取固定Huffman编码的距离码表，第一次使用时建立
+【参数】无
+【返回值】const Huffman&，码表
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+const GzipFormat::Inflater::Huffman& GzipFormat::Inflater::FixedDistances() {
+    static const Huffman Table = [] {
+        uint8_t Lengths[30];
+        fill(Lengths, Lengths + 30, uint8_t(5));
+        Huffman Result;
+        Build(Result, Lengths, 30);
+        return Result;
+    }();
+    return Table;
+}
+/*************************************************************************
+【函数名称】NextByte
+【函数功能】读取下一个输入字节，当前输入用完时调用m_Refill补充
+【参数】无
+【返回值】int，字节，没有更多输入时为-1
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+int GzipFormat::Inflater::NextByte() {
+    if (m_pNext == m_pEnd) {
+        if (!m_Refill || !m_Refill(m_pNext, m_pEnd) || m_pNext == m_pEnd) {
+            return -1;
+        }
+    }
+    return static_cast<unsigned char>(*m_pNext++);
+}
+/*************************************************************************
+【函数名称】Need
+【函数功能】逐字节补充位缓冲区直到至少有Bits位。输入结束时补0并记录，
+       以便查找表在数据末尾也能预读；真正用到补上的位时Drop抛出异常
+【参数】unsigned Bits, 位数，不超过32
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+void GzipFormat::Inflater::Need(unsigned Bits) {
+    while (m_BitCount < Bits) {
+        int Byte = NextByte();
+        if (Byte < 0) {
+            Byte = 0;
+            m_Padding += 8;
+        }
+        m_Bits |= uint64_t(Byte) << m_BitCount;
+        m_BitCount += 8;
+    }
+}
+/*************************************************************************
+【函数名称】Drop
+【函数功能】丢弃位缓冲区的低Bits位，丢弃了补上的0时说明数据已截断
+【参数】unsigned Bits, 位数
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+void GzipFormat::Inflater::Drop(unsigned Bits) {
+    m_Bits >>= Bits;
+    m_BitCount -= Bits;
+    if (m_BitCount < m_Padding) {
+        throw FORMAT_ERROR();
+    }
+}
+/*************************************************************************
+【函数名称】GetBits
+【函数功能】读取Bits位，低位在前
+【参数】unsigned Bits, 位数，不超过16
+【返回值】uint32_t，读取的值
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+uint32_t GzipFormat::Inflater::GetBits(unsigned Bits) {
+    if (Bits == 0) {
+        return 0;
+    }
+    Need(Bits);
+    uint32_t Value = static_cast<uint32_t>(m_Bits & ((uint64_t(1) << Bits) - 1));
+    Drop(Bits);
+    return Value;
+}
+/*************************************************************************
+【函数名称】Align
+【函数功能】丢弃到字节边界
+【参数】无
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+void GzipFormat::Inflater::Align() {
+    Drop(m_BitCount % 8);
+}
+/*************************************************************************
+【函数名称】Decode
+【函数功能】按码表解码一个符号：先用FAST_BITS位查快速查找表，
+       码更长时逐位按规范Huffman码的顺序查找
+【参数】const Huffman& Table, 码表
+【返回值】unsigned，符号
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+unsigned GzipFormat::Inflater::Decode(const Huffman& Table) {
+    Need(FAST_BITS);
+    uint16_t Entry = Table.Fast[m_Bits & ((1u << FAST_BITS) - 1)];
+    if ((Entry & 0xf) != 0) {
+        Drop(Entry & 0xf);
+        return Entry >> 4;
+    }
+    int Code = 0;
+    int First = 0;
+    int Index = 0;
+    for (unsigned Length = 1; Length <= MAX_BITS; Length++) {
+        Code |= static_cast<int>(GetBits(1));
+        int Count = Table.Count[Length];
+        if (Code - Count < First) {
+            return Table.Symbol[Index + (Code - First)];
+        }
+        Index += Count;
+        First = (First + Count) << 1;
+        Code <<= 1;
+    }
+    throw FORMAT_ERROR();
+}
+/*************************************************************************
+【函数名称】ReadHeader
+【函数功能】读取成员头，跳过扩展字段、文件名、注释和头部校验
+【参数】无
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+void GzipFormat::Inflater::ReadHeader() {
+    if (GetBits(8) != MAGIC_1 || GetBits(8) != MAGIC_2
+        || GetBits(8) != METHOD_DEFLATE) {
+        throw FORMAT_ERROR();
+    }
+    uint32_t Flags = GetBits(8);
+    if ((Flags & FLAG_RESERVED) != 0) {
+        throw FORMAT_ERROR();
+    }
+    // 修改时间、压缩级别和操作系统
+    for (unsigned i = 0; i < 6; i++) {
+        GetBits(8);
+    }
+    if ((Flags & FLAG_EXTRA) != 0) {
+        uint32_t Length = GetBits(16);
+        for (uint32_t i = 0; i < Length; i++) {
+            GetBits(8);
+        }
+    }
+    if ((Flags & FLAG_NAME) != 0) {
+        while (GetBits(8) != 0) {
+        }
+    }
+    if ((Flags & FLAG_COMMENT) != 0) {
+        while (GetBits(8) != 0) {
+        }
+    }
+    if ((Flags & FLAG_HEADER_CRC) != 0) {
+        GetBits(16);
+    }
+}
+/*************************************************************************
+【函数名称】ReadBlockHeader
+【函数功能】读取块头：不压缩的块读取长度，压缩的块选择或建立码表
+【参数】无
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+void GzipFormat::Inflater::ReadBlockHeader() {
+    m_bLastBlock = GetBits(1) != 0;
+    switch (GetBits(2)) {
+        case 0: {
+            Align();
+            uint32_t Length = GetBits(16);
+            if ((GetBits(16) ^ 0xffff) != Length) {
+                throw FORMAT_ERROR();
+            }
+            m_StoredLeft = Length;
+            m_State = State::STORED;
+            break;
+        }
+        case 1:
+            m_pLiterals = &FixedLiterals();
+            m_pDistances = &FixedDistances();
+            m_State = State::CODES;
+            break;
+        case 2:
+            ReadDynamicTables();
+            m_pLiterals = &m_DynamicLiterals;
+            m_pDistances = &m_DynamicDistances;
+            m_State = State::CODES;
+            break;
+        default:
+            throw FORMAT_ERROR();
+    }
+}
+/*************************************************************************
+【函数名称】ReadDynamicTables
+【函数功能】读取动态Huffman编码的码表：先读码长码的码表，再用它解码
+       字面量和长度、距离两个码表的码长（含16、17、18三种重复码）
+【参数】无
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+void GzipFormat::Inflater::ReadDynamicTables() {
+    size_t LiteralCount = GetBits(5) + 257;
+    size_t DistanceCount = GetBits(5) + 1;
+    size_t CodeLengthCount = GetBits(4) + 4;
+    if (LiteralCount > 286 || DistanceCount > 30) {
+        throw FORMAT_ERROR();
+    }
+    uint8_t Lengths[MAX_SYMBOLS + 32] = {0};
+    for (size_t i = 0; i < CodeLengthCount; i++) {
+        Lengths[CODE_LENGTH_ORDER[i]] = static_cast<uint8_t>(GetBits(3));
+    }
+    Huffman CodeLengths;
+    Build(CodeLengths, Lengths, 19);
+    size_t Total = LiteralCount + DistanceCount;
+    size_t Index = 0;
+    while (Index < Total) {
+        unsigned Symbol = Decode(CodeLengths);
+        if (Symbol < 16) {
+            Lengths[Index++] = static_cast<uint8_t>(Symbol);
+            continue;
+        }
+        uint8_t Value = 0;
+        size_t Repeat;
+        if (Symbol == 16) {
+            if (Index == 0) {
+                throw FORMAT_ERROR();
+            }
+            Value = Lengths[Index - 1];
+            Repeat = 3 + GetBits(2);
+        }
+        else if (Symbol == 17) {
+            Repeat = 3 + GetBits(3);
+        }
+        else {
+            Repeat = 11 + GetBits(7);
+        }
+        if (Index + Repeat > Total) {
+            throw FORMAT_ERROR();
+        }
+        fill(Lengths + Index, Lengths + Index + Repeat, Value);
+        Index += Repeat;
+    }
+    // 必须有块结束符
+    if (Lengths[256] == 0) {
+        throw FORMAT_ERROR();
+    }
+    Build(m_DynamicLiterals, Lengths, LiteralCount);
+    Build(m_DynamicDistances, Lengths + LiteralCount, DistanceCount);
+}
+/*************************************************************************
+【函数名称】ReadTrailer
+【函数功能】读取成员尾，校验CRC-32和原始长度（模2^32）
+【参数】无
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+void GzipFormat::Inflater::ReadTrailer() {
+    Align();
+    uint32_t Crc = GetBits(16);
+    Crc |= GetBits(16) << 16;
+    uint32_t Size = GetBits(16);
+    Size |= GetBits(16) << 16;
+    if (Crc != m_Crc || Size != static_cast<uint32_t>(m_Total)) {
+        throw FORMAT_ERROR();
+    }
+    m_State = State::DONE;
+}
+/*************************************************************************
+【函数名称】Produce
+【函数功能】按状态向环形缓冲区解码至多Limit字节；读完最后一块时
+       停在TRAILER状态，由Read在复制输出后校验成员尾
+【参数】size_t Limit, 本轮至多解码的字节数，不超过WINDOW_SIZE
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+void GzipFormat::Inflater::Produce(size_t Limit) {
+    const size_t RING_MASK = RING_SIZE - 1;
+    char* pRing = m_Ring.data();
+    uint64_t End = m_Total + Limit;
+    while (m_Total < End) {
+        switch (m_State) {
+            case State::HEADER:
+                ReadHeader();
+                m_State = State::BLOCK;
+                break;
+            case State::BLOCK:
+                if (m_bLastBlock) {
+                    m_State = State::TRAILER;
+                    return;
+                }
+                ReadBlockHeader();
+                break;
+            case State::STORED: {
+                size_t Count = static_cast<size_t>(
+                    min<uint64_t>(m_StoredLeft, End - m_Total));
+                for (size_t i = 0; i < Count; i++) {
+                    pRing[m_Total++ & RING_MASK] = static_cast<char>(GetBits(8));
+                }
+                m_StoredLeft -= Count;
+                if (m_StoredLeft == 0) {
+                    m_State = State::BLOCK;
+                }
+                break;
+            }
+            case State::CODES: {
+                if (m_MatchLeft > 0) {
+                    size_t Count = static_cast<size_t>(
+                        min<uint64_t>(m_MatchLeft, End - m_Total));
+                    for (size_t i = 0; i < Count; i++) {
+                        pRing[m_Total & RING_MASK]
+                            = pRing[(m_Total - m_MatchDistance) & RING_MASK];
+                        m_Total++;
+                    }
+                    m_MatchLeft -= Count;
+                    break;
+                }
+                unsigned Symbol = Decode(*m_pLiterals);
+                if (Symbol < 256) {
+                    pRing[m_Total++ & RING_MASK] = static_cast<char>(Symbol);
+                }
+                else if (Symbol == 256) {
+                    m_State = State::BLOCK;
+                }
+                else {
+                    Symbol -= 257;
+                    if (Symbol >= 29) {
+                        throw FORMAT_ERROR();
+                    }
+                    m_MatchLeft = LENGTH_BASE[Symbol]
+                        + GetBits(LENGTH_EXTRA[Symbol]);
+                    unsigned DistanceSymbol = Decode(*m_pDistances);
+                    if (DistanceSymbol >= 30) {
+                        throw FORMAT_ERROR();
+                    }
+                    m_MatchDistance = DISTANCE_BASE[DistanceSymbol]
+                        + GetBits(DISTANCE_EXTRA[DistanceSymbol]);
+                    if (m_MatchDistance > m_Total) {
+                        throw FORMAT_ERROR();
+                    }
+                }
+                break;
+            }
+            default:
+                return;
+        }
+    }
+}
+
+//-------------------------------------------------------------------------
+// 静态成员函数
+//-------------------------------------------------------------------------
+
+/*************************************************************************
+【函数名称】IsGzip
+【函数功能】测试数据开头是否为gzip魔数和deflate压缩方法
+【参数】const char* pHead, 数据开头
+       size_t Size, 数据开头的字节数
+【返回值】bool，是否为gzip数据
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+bool GzipFormat::IsGzip(const char* pHead, size_t Size) {
+    return Size >= 3 && static_cast<uint8_t>(pHead[0]) == MAGIC_1
+        && static_cast<uint8_t>(pHead[1]) == MAGIC_2
+        && static_cast<uint8_t>(pHead[2]) == METHOD_DEFLATE;
+}
+/*************************************************************************
+【函数名称】Crc32
+【函数功能】在Crc的基础上继续计算CRC-32（多项式0xEDB88320），
+       按字节查表，表在第一次使用时建立
+【参数】uint32_t Crc, 已计算部分的CRC-32，开始时为0
+       const char* pData, 数据
+       size_t Size, 字节数
+【返回值】uint32_t，CRC-32
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+uint32_t GzipFormat::Crc32(uint32_t Crc, const char* pData, size_t Size) {
+    static const vector<uint32_t> Table = [] {
+        vector<uint32_t> Result(256);
+        for (uint32_t i = 0; i < 256; i++) {
+            uint32_t Value = i;
+            for (unsigned k = 0; k < 8; k++) {
+                Value = (Value & 1) != 0 ? 0xedb88320u ^ (Value >> 1)
+                    : Value >> 1;
+            }
+            Result[i] = Value;
+        }
+        return Result;
+    }();
+    const unsigned char* p = reinterpret_cast<const unsigned char*>(pData);
+    Crc = ~Crc;
+    for (size_t i = 0; i < Size; i++) {
+        Crc = Table[(Crc ^ p[i]) & 0xff] ^ (Crc >> 8);
+    }
+    return ~Crc;
+}
+/*************************************************************************
+【函数名称】CompressFrame
+【函数功能】把一帧数据压缩为一个gzip成员并追加到Frame：帧头的扩展字段
+       记录整个成员的字节数，之后是deflate数据、CRC-32和原始长度。
+       固定Huffman编码使数据变大时改用不压缩的块。
+       各帧互不引用，可以并行压缩和解压
+【参数】const char* pData, 数据
+       size_t Size, 字节数，不超过FRAME_SIZE
+       string& Frame, 追加成员的字符串
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+void GzipFormat::CompressFrame(const char* pData, size_t Size, string& Frame) {
+    size_t Begin = Frame.size();
+    const char Header[FRAME_HEADER_SIZE] = {
+        static_cast<char>(MAGIC_1), static_cast<char>(MAGIC_2),
+        static_cast<char>(METHOD_DEFLATE), static_cast<char>(FLAG_EXTRA),
+        // 修改时间、压缩级别、操作系统（未知）
+        0, 0, 0, 0, 0, static_cast<char>(0xff),
+        // 扩展字段长度8，子字段"MF"长度4，成员的字节数稍后填入
+        8, 0, FRAME_ID_1, FRAME_ID_2, 4, 0, 0, 0, 0, 0};
+    Frame.append(Header, FRAME_HEADER_SIZE);
+    Deflate(pData, Size, Frame);
+    // 压缩后更大（如已压缩的数据）时改用不压缩的块
+    size_t StoredSize = Size + STORED_OVERHEAD
+        * max(size_t(1), (Size + MAX_STORED - 1) / MAX_STORED);
+    if (Frame.size() - Begin - FRAME_HEADER_SIZE > StoredSize) {
+        Frame.resize(Begin + FRAME_HEADER_SIZE);
+        Store(pData, Size, Frame);
+    }
+    AppendLE32(Frame, Crc32(0, pData, Size));
+    AppendLE32(Frame, static_cast<uint32_t>(Size));
+    uint32_t MemberSize = static_cast<uint32_t>(Frame.size() - Begin);
+    for (unsigned i = 0; i < 4; i++) {
+        Frame[Begin + 16 + i] = static_cast<char>((MemberSize >> (8 * i)) & 0xff);
+    }
+}
+/*************************************************************************
+【函数名称】FrameSize
+【函数功能】从帧头读取成员的字节数。只识别CompressFrame写出的帧头，
+       其他gzip成员返回0，由调用者逐字节解压
+【参数】const char* pHead, 至少FRAME_HEADER_SIZE字节的成员头
+【返回值】size_t，成员的字节数，不是帧头时为0
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+size_t GzipFormat::FrameSize(const char* pHead) {
+    if (!IsGzip(pHead, FRAME_HEADER_SIZE)
+        || static_cast<uint8_t>(pHead[3]) != FLAG_EXTRA
+        || pHead[10] != 8 || pHead[11] != 0
+        || pHead[12] != FRAME_ID_1 || pHead[13] != FRAME_ID_2
+        || pHead[14] != 4 || pHead[15] != 0) {
+        return 0;
+    }
+    size_t Size = ReadLE32(pHead + 16);
+    return Size >= FRAME_HEADER_SIZE + TRAILER_SIZE ? Size : 0;
+}
@@ -0,0 +1,200 @@
+/*************************************************************************
+【文件名】GzipFormat.hpp
+【功能模块和目的】定义GzipFormat类，gzip压缩格式（RFC 1951、1952）的
+       压缩、解压和分帧，不依赖外部库
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+#ifndef GZIPFORMAT_HPP
+#define GZIPFORMAT_HPP
+
+// invalid_argument所属头文件
+#include <stdexcept>
+// function所属头文件
+#include <functional>
+// string所属头文件
+#include <string>
+// vector所属头文件
+#include <vector>
+// uint8_t、uint16_t、uint32_t、uint64_t所属头文件
+#include <cstdint>
+// size_t所属头文件
+#include <cstddef>
+
+using namespace std;
+
+/*************************************************************************
+【类名】GzipFormat
+【功能】gzip格式的工具类。压缩时把数据按FRAME_SIZE分成互相独立的帧，
+       每帧是一个完整的gzip成员（固定Huffman编码的deflate块，
+       数据变大时改用不压缩的块），
+       成员头的扩展字段（子字段"MF"）记录整个成员的字节数，读取时不必
+       解码即可找到下一帧，从而并行解压；多成员的gzip文件可被gzip等
+       通用工具直接解压。解压器Inflater支持任意gzip成员（动态、固定
+       Huffman和不压缩的块），可分多次输出，内存占用与数据大小无关
+【接口说明】
+    内嵌异常类FORMAT_ERROR
+    内嵌解压器Inflater
+    静态常量：魔数、帧大小、帧头和成员尾的字节数、窗口大小
+    静态：测试数据开头是否为gzip魔数
+    静态：计算CRC-32
+    静态：把一帧数据压缩为一个gzip成员
+    静态：从帧头读取成员的字节数
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+class GzipFormat {
+public:
+    //-------------------------------------------------------------------------
+    // 内嵌异常类
+    //-------------------------------------------------------------------------
+    // 数据不是有效的gzip格式或已截断
+    class FORMAT_ERROR : public invalid_argument {
+    public:
+        FORMAT_ERROR();
+    };
+    //-------------------------------------------------------------------------
+    // 静态常量
+    //-------------------------------------------------------------------------
+    // 魔数的第一个字节
+    static constexpr uint8_t MAGIC_1{0x1f};
+    // 魔数的第二个字节
+    static constexpr uint8_t MAGIC_2{0x8b};
+    // 每帧压缩前的字节数
+    static constexpr size_t FRAME_SIZE{size_t(1) << 20};
+    // 本类写出的帧头的字节数（含扩展字段）
+    static constexpr size_t FRAME_HEADER_SIZE{20};
+    // 成员尾（CRC-32和原始长度）的字节数
+    static constexpr size_t TRAILER_SIZE{8};
+    // deflate的最大回溯距离
+    static constexpr size_t WINDOW_SIZE{32768};
+    //-------------------------------------------------------------------------
+    // 内嵌类
+    //-------------------------------------------------------------------------
+    // 解压器：从输入中依次解码一个gzip成员，可分多次输出
+    class Inflater {
+    public:
+        // 补充输入：在pNext、pEnd中返回新的输入，没有更多输入时返回false
+        using Refill = function<bool(const char*& pNext, const char*& pEnd)>;
+        // 带参构造函数，输入为[pNext, pEnd)，用完后调用AFill补充
+        Inflater(const char* pNext, const char* pEnd,
+            const Refill& AFill = nullptr);
+        // 禁止拷贝构造函数
+        Inflater(const Inflater& Source) = delete;
+        // 禁止赋值运算符
+        Inflater& operator=(const Inflater& Source) = delete;
+        // 虚析构函数
+        virtual ~Inflater() = default;
+        // 解压至多Capacity字节到pOut，返回值小于Capacity时成员已结束
+        size_t Read(char* pOut, size_t Capacity);
+        // 成员是否已结束并通过校验
+        bool IsFinished() const;
+        // 已结束的成员之后的第一个输入字节
+        const char* GetPosition() const;
+
+    private:
+        // Huffman码表的快速查找位数
+        static constexpr unsigned FAST_BITS{10};
+        // Huffman码的最大长度
+        static constexpr unsigned MAX_BITS{15};
+        // 字面量和长度码表的最大符号数
+        static constexpr size_t MAX_SYMBOLS{288};
+        // 输出环形缓冲区的字节数，为窗口大小的两倍
+        static constexpr size_t RING_SIZE{WINDOW_SIZE * 2};
+        // 解码状态
+        enum class State {
+            HEADER,
+            BLOCK,
+            STORED,
+            CODES,
+            TRAILER,
+            DONE
+        };
+        // 规范Huffman码表
+        struct Huffman {
+            // 快速查找表，元素为符号 << 4 | 码长，码长超过FAST_BITS时为0
+            uint16_t Fast[1 << FAST_BITS];
+            // 各码长的符号数
+            uint16_t Count[MAX_BITS + 1];
+            // 按码长和符号排序的符号
+            uint16_t Symbol[MAX_SYMBOLS];
+        };
+        // 按各符号的码长建立码表
+        static void Build(Huffman& Table, const uint8_t* pLengths, size_t Count);
+        // 获取固定Huffman编码的字面量和长度码表
+        static const Huffman& FixedLiterals();
+        // 获取固定Huffman编码的距离码表
+        static const Huffman& FixedDistances();
+        // 读取下一个输入字节，没有更多输入时返回-1
+        int NextByte();
+        // 保证位缓冲区中至少有Bits位，输入结束时补0
+        void Need(unsigned Bits);
+        // 丢弃Bits位，丢弃了补上的0时抛出异常
+        void Drop(unsigned Bits);
+        // 读取Bits位（低位在前）
+        uint32_t GetBits(unsigned Bits);
+        // 丢弃到字节边界
+        void Align();
+        // 按码表解码一个符号
+        unsigned Decode(const Huffman& Table);
+        // 读取成员头
+        void ReadHeader();
+        // 读取块头，建立码表
+        void ReadBlockHeader();
+        // 读取动态Huffman编码的码表
+        void ReadDynamicTables();
+        // 读取并校验成员尾
+        void ReadTrailer();
+        // 向环形缓冲区解码至多Limit字节
+        void Produce(size_t Limit);
+        // 输入
+        const char* m_pNext;
+        // 输入的终点
+        const char* m_pEnd;
+        // 补充输入的函数
+        Refill m_Refill;
+        // 位缓冲区
+        uint64_t m_Bits{0};
+        // 位缓冲区中的位数
+        unsigned m_BitCount{0};
+        // 位缓冲区中输入结束后补上的0的位数
+        unsigned m_Padding{0};
+        // 解码状态
+        State m_State{State::HEADER};
+        // 当前块是否为最后一块
+        bool m_bLastBlock{false};
+        // 不压缩的块中剩余的字节数
+        size_t m_StoredLeft{0};
+        // 未复制完的匹配的剩余长度
+        size_t m_MatchLeft{0};
+        // 未复制完的匹配的距离
+        size_t m_MatchDistance{0};
+        // 当前块的字面量和长度码表
+        const Huffman* m_pLiterals{nullptr};
+        // 当前块的距离码表
+        const Huffman* m_pDistances{nullptr};
+        // 动态Huffman编码的字面量和长度码表
+        Huffman m_DynamicLiterals{};
+        // 动态Huffman编码的距离码表
+        Huffman m_DynamicDistances{};
+        // 输出环形缓冲区
+        vector<char> m_Ring;
+        // 已解码的字节数
+        uint64_t m_Total{0};
+        // 已输出数据的CRC-32
+        uint32_t m_Crc{0};
+    };
+    //-------------------------------------------------------------------------
+    // 静态成员函数
+    //-------------------------------------------------------------------------
+    // 测试数据开头是否为gzip魔数
+    static bool IsGzip(const char* pHead, size_t Size);
+    // 在Crc的基础上继续计算[pData, pData + Size)的CRC-32
+    static uint32_t Crc32(uint32_t Crc, const char* pData, size_t Size);
+    // 把至多FRAME_SIZE字节的数据压缩为一个带帧头的gzip成员，追加到Frame
+    static void CompressFrame(const char* pData, size_t Size, string& Frame);
+    // 从至少FRAME_HEADER_SIZE字节的帧头读取成员的字节数，不是帧头时返回0
+    static size_t FrameSize(const char* pHead);
+};
+
+#endif /* GzipFormat.hpp */
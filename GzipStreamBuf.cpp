@@ -0,0 +1,368 @@
+/*************************************************************************
+【文件名】GzipStreamBuf.cpp
+【功能模块和目的】定义GzipStreamBuf类的成员函数
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+// GzipStreamBuf所属头文件
+#include "GzipStreamBuf.hpp"
+// GzipFormat所属头文件
+#include "GzipFormat.hpp"
+// TaskScheduler所属头文件
+#include "TaskScheduler.hpp"
+// streambuf所属头文件
+#include <streambuf>
+// unique_ptr所属头文件
+#include <memory>
+// string所属头文件
+#include <string>
+// vector所属头文件
+#include <vector>
+// pair所属头文件
+#include <utility>
+// min、max所属头文件
+#include <algorithm>
+// memmove所属头文件
+#include <cstring>
+// uint32_t所属头文件
+#include <cstdint>
+// size_t所属头文件
+#include <cstddef>
+
+using namespace std;
+
+namespace {
+    // 逐段解压时每次输出的字节数
+    constexpr size_t CHUNK_SIZE{size_t(1) << 16};
+
+    /*************************************************************************
+    【函数名称】OriginalSize
+    【函数功能】从成员尾读取压缩前的字节数（模2^32）
+    【参数】const char* pEnd, 成员的末尾
+    【返回值】size_t，压缩前的字节数
+    【开发者及日期】谭雯心 2026/10/19
+    【更改记录】
+    *************************************************************************/
+    size_t OriginalSize(const char* pEnd) {
+        const unsigned char* p = reinterpret_cast<const unsigned char*>(pEnd - 4);
+        return size_t(p[0]) | size_t(p[1]) << 8 | size_t(p[2]) << 16
+            | size_t(p[3]) << 24;
+    }
+}
+
+//-------------------------------------------------------------------------
+// 静态常量
+//-------------------------------------------------------------------------
+
+// 每个工作者一次解压的帧数
+constexpr size_t GzipStreamBuf::BATCH_PER_WORKER;
+
+//-------------------------------------------------------------------------
+// 必要的构造、析构、拷贝、赋值运算符重载函数
+//-------------------------------------------------------------------------
+
+/*************************************************************************
+【函数名称】GzipStreamBuf
+【函数功能】带参构造函数，缓冲区在第一次读或写时分配
+【参数】streambuf& Target, 表示被包装的流缓冲区
+       Mode AMode, 表示解压或压缩
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+GzipStreamBuf::GzipStreamBuf(streambuf& Target, Mode AMode)
+    : m_Target(Target), m_Mode(AMode),
+    m_BatchSize(BATCH_PER_WORKER
+        * TaskScheduler::GetInstance()->GetWorkerCount()) {
+}
+/*************************************************************************
+【函数名称】~GzipStreamBuf
+【函数功能】析构函数，压缩时写出写缓冲区中剩余的数据。被包装的
+       ProgressStreamBuf已取消时写出会抛出异常，此时输出已被丢弃，
+       异常不传出析构函数
+【参数】无
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+GzipStreamBuf::~GzipStreamBuf() {
+    if (m_Mode == Mode::COMPRESS) {
+        try {
+            FlushOutput();
+        }
+        catch (...) {
+        }
+    }
+}
+
+//-------------------------------------------------------------------------
+// 受保护的成员函数
+//-------------------------------------------------------------------------
+
+/*************************************************************************
+【函数名称】underflow
+【函数功能】读缓冲区为空时取下一个已解压的帧；帧用完时读入并解压下一批，
+       逐段解压的成员每次输出至多CHUNK_SIZE字节
+【参数】无
+【返回值】int_type，下一个字符，没有更多数据时返回eof
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+GzipStreamBuf::int_type GzipStreamBuf::underflow() {
+    if (m_Mode != Mode::DECOMPRESS) {
+        return traits_type::eof();
+    }
+    while (true) {
+        if (m_pInflater != nullptr) {
+            m_Buffer.resize(CHUNK_SIZE);
+            size_t Count = m_pInflater->Read(m_Buffer.data(), m_Buffer.size());
+            if (m_pInflater->IsFinished()) {
+                m_RawBegin = static_cast<size_t>(
+                    m_pInflater->GetPosition() - m_Raw.data());
+                m_pInflater.reset();
+            }
+            if (Count > 0) {
+                setg(m_Buffer.data(), m_Buffer.data(), m_Buffer.data() + Count);
+                return traits_type::to_int_type(m_Buffer[0]);
+            }
+            continue;
+        }
+        while (m_NextFrame < m_Frames.size()) {
+            string& Frame = m_Frames[m_NextFrame++];
+            if (!Frame.empty()) {
+                setg(&Frame[0], &Frame[0], &Frame[0] + Frame.size());
+                return traits_type::to_int_type(Frame[0]);
+            }
+        }
+        if (!DecodeBatch()) {
+            return traits_type::eof();
+        }
+    }
+}
+/*************************************************************************
+【函数名称】overflow
+【函数功能】写缓冲区已满时压缩并写出，再放入Char
+【参数】int_type Char, 表示要写入的字符，可为eof
+【返回值】int_type，成功时返回非eof的值，失败时返回eof
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+GzipStreamBuf::int_type GzipStreamBuf::overflow(int_type Char) {
+    if (m_Mode != Mode::COMPRESS) {
+        return traits_type::eof();
+    }
+    if (m_Buffer.empty()) {
+        m_Buffer.resize(GzipFormat::FRAME_SIZE * m_BatchSize);
+    }
+    else if (!FlushOutput()) {
+        return traits_type::eof();
+    }
+    setp(m_Buffer.data(), m_Buffer.data() + m_Buffer.size());
+    if (!traits_type::eq_int_type(Char, traits_type::eof())) {
+        *pptr() = traits_type::to_char_type(Char);
+        pbump(1);
+    }
+    return traits_type::not_eof(Char);
+}
+/*************************************************************************
+【函数名称】sync
+【函数功能】压缩时写出写缓冲区中的数据并同步被包装的流缓冲区
+【参数】无
+【返回值】int，成功返回0，失败返回-1
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+int GzipStreamBuf::sync() {
+    if (m_Mode != Mode::COMPRESS) {
+        return 0;
+    }
+    if (!FlushOutput()) {
+        return -1;
+    }
+    return m_Target.pubsync();
+}
+/*************************************************************************
+【函数名称】seekoff
+【函数功能】相对定位，只支持解压时回到开头；不支持的定位返回-1，
+       调用者（如STL导入器）据此改为顺序读取
+【参数】off_type Offset, 表示偏移
+       ios_base::seekdir Direction, 表示基准
+       ios_base::openmode Which, 表示读或写位置
+【返回值】pos_type，新位置，失败返回-1
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+GzipStreamBuf::pos_type GzipStreamBuf::seekoff(off_type Offset,
+    ios_base::seekdir Direction, ios_base::openmode Which) {
+    if (Direction != ios_base::beg) {
+        return pos_type(off_type(-1));
+    }
+    return seekpos(pos_type(Offset), Which);
+}
+/*************************************************************************
+【函数名称】seekpos
+【函数功能】绝对定位，只支持解压时回到开头：被包装的流缓冲区回到开头，
+       丢弃已解压的数据
+【参数】pos_type Position, 表示位置
+       ios_base::openmode Which, 表示读或写位置
+【返回值】pos_type，新位置，失败返回-1
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+GzipStreamBuf::pos_type GzipStreamBuf::seekpos(
+    pos_type Position, ios_base::openmode Which) {
+    if (m_Mode != Mode::DECOMPRESS || Position != pos_type(0)
+        || (Which & ios_base::in) == 0
+        || m_Target.pubseekpos(0, ios_base::in) != pos_type(0)) {
+        return pos_type(off_type(-1));
+    }
+    m_RawBegin = 0;
+    m_RawEnd = 0;
+    m_Frames.clear();
+    m_NextFrame = 0;
+    m_pInflater.reset();
+    setg(nullptr, nullptr, nullptr);
+    return pos_type(0);
+}
+
+//-------------------------------------------------------------------------
+// 私有非静态成员函数
+//-------------------------------------------------------------------------
+
+/*************************************************************************
+【函数名称】FillRaw
+【函数功能】保证未解压的输入中至少有Bytes字节：先把剩余输入移到开头，
+       缓冲区不足时扩大，再从被包装的流缓冲区读取
+【参数】size_t Bytes, 表示需要的字节数
+【返回值】bool，输入是否足够
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+bool GzipStreamBuf::FillRaw(size_t Bytes) {
+    if (m_RawEnd - m_RawBegin >= Bytes) {
+        return true;
+    }
+    if (m_RawBegin > 0) {
+        memmove(m_Raw.data(), m_Raw.data() + m_RawBegin, m_RawEnd - m_RawBegin);
+        m_RawEnd -= m_RawBegin;
+        m_RawBegin = 0;
+    }
+    if (m_Raw.size() < Bytes || m_Raw.empty()) {
+        m_Raw.resize(max(Bytes, GzipFormat::FRAME_SIZE));
+    }
+    while (m_RawEnd < Bytes) {
+        streamsize Count = m_Target.sgetn(m_Raw.data() + m_RawEnd,
+            static_cast<streamsize>(m_Raw.size() - m_RawEnd));
+        if (Count <= 0) {
+            return false;
+        }
+        m_RawEnd += static_cast<size_t>(Count);
+    }
+    return true;
+}
+/*************************************************************************
+【函数名称】DecodeBatch
+【函数功能】读入至多m_BatchSize个带帧头的成员，按帧头记录的字节数切分，
+       各帧互不依赖，用TaskScheduler并行解压到m_Frames；开头不是帧头时
+       创建逐段解压的Inflater，输入用完时继续从被包装的流缓冲区读取
+【参数】无
+【返回值】bool，是否还有数据，输入已结束时返回false
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+bool GzipStreamBuf::DecodeBatch() {
+    m_Frames.clear();
+    m_NextFrame = 0;
+    vector<pair<size_t, size_t>> Members;
+    size_t Scan = 0;
+    while (Members.size() < m_BatchSize
+        && FillRaw(Scan + GzipFormat::FRAME_HEADER_SIZE)) {
+        size_t Size = GzipFormat::FrameSize(m_Raw.data() + m_RawBegin + Scan);
+        if (Size == 0) {
+            break;
+        }
+        if (!FillRaw(Scan + Size)) {
+            throw GzipFormat::FORMAT_ERROR();
+        }
+        Members.emplace_back(Scan, Size);
+        Scan += Size;
+    }
+    if (!Members.empty()) {
+        const char* pBase = m_Raw.data() + m_RawBegin;
+        m_Frames.resize(Members.size());
+        TaskScheduler::GetInstance()->ParallelFor(0, Members.size(), 1,
+            [&](size_t First, size_t Last) {
+            for (size_t i = First; i < Last; i++) {
+                const char* pBegin = pBase + Members[i].first;
+                const char* pEnd = pBegin + Members[i].second;
+                size_t Size = OriginalSize(pEnd);
+                if (Size > GzipFormat::FRAME_SIZE) {
+                    throw GzipFormat::FORMAT_ERROR();
+                }
+                GzipFormat::Inflater Decoder(pBegin, pEnd);
+                // 多留一个字节，确认成员恰好在此结束
+                string& Frame = m_Frames[i];
+                Frame.resize(Size + 1);
+                if (Decoder.Read(&Frame[0], Frame.size()) != Size
+                    || !Decoder.IsFinished() || Decoder.GetPosition() != pEnd) {
+                    throw GzipFormat::FORMAT_ERROR();
+                }
+                Frame.resize(Size);
+            }
+        });
+        m_RawBegin += Scan;
+        return true;
+    }
+    if (!FillRaw(1)) {
+        return false;
+    }
+    m_pInflater.reset(new GzipFormat::Inflater(
+        m_Raw.data() + m_RawBegin, m_Raw.data() + m_RawEnd,
+        [this](const char*& pNext, const char*& pEnd) {
+        m_RawBegin = m_RawEnd;
+        if (!FillRaw(1)) {
+            return false;
+        }
+        pNext = m_Raw.data() + m_RawBegin;
+        pEnd = m_Raw.data() + m_RawEnd;
+        return true;
+    }));
+    return true;
+}
+/*************************************************************************
+【函数名称】FlushOutput
+【函数功能】把写缓冲区中的数据按FRAME_SIZE切分，用TaskScheduler并行
+       压缩为独立的帧后按顺序写出。还没有写出任何成员时，空的写缓冲区
+       也写出一个空成员，使空数据仍是有效的gzip文件
+【参数】无
+【返回值】bool，是否全部写出
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+bool GzipStreamBuf::FlushOutput() {
+    size_t Count = static_cast<size_t>(pptr() - pbase());
+    if (Count == 0 && m_bWritten) {
+        return true;
+    }
+    const char* pData = pbase();
+    size_t FrameCount = max(size_t(1),
+        (Count + GzipFormat::FRAME_SIZE - 1) / GzipFormat::FRAME_SIZE);
+    vector<string> Frames(FrameCount);
+    TaskScheduler::GetInstance()->ParallelFor(0, FrameCount, 1,
+        [&](size_t First, size_t Last) {
+        for (size_t i = First; i < Last; i++) {
+            size_t Offset = i * GzipFormat::FRAME_SIZE;
+            GzipFormat::CompressFrame(pData + Offset,
+                min(GzipFormat::FRAME_SIZE, Count - Offset), Frames[i]);
+        }
+    });
+    setp(m_Buffer.data(), m_Buffer.data() + m_Buffer.size());
+    m_bWritten = true;
+    for (const string& Frame : Frames) {
+        streamsize Size = static_cast<streamsize>(Frame.size());
+        if (m_Target.sputn(Frame.data(), Size) != Size) {
+            return false;
+        }
+    }
+    return true;
+}
@@ -0,0 +1,125 @@
+/*************************************************************************
+【文件名】GzipStreamBuf.hpp
+【功能模块和目的】定义GzipStreamBuf类，对另一个流缓冲区透明地解压或压缩
+       gzip数据的流缓冲区
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+#ifndef GZIPSTREAMBUF_HPP
+#define GZIPSTREAMBUF_HPP
+
+// GzipFormat所属头文件
+#include "GzipFormat.hpp"
+// streambuf所属头文件
+#include <streambuf>
+// unique_ptr所属头文件
+#include <memory>
+// string所属头文件
+#include <string>
+// vector所属头文件
+#include <vector>
+// size_t所属头文件
+#include <cstddef>
+
+using namespace std;
+
+/*************************************************************************
+【类名】GzipStreamBuf
+【功能】包装另一个流缓冲区（filebuf或ProgressStreamBuf），在其上解压或
+       压缩gzip数据。解压时一次读入至多BATCH_PER_WORKER倍工作者数个
+       带帧头的成员，用TaskScheduler并行解压；没有帧头的成员（如gzip
+       工具生成的文件）逐段解压。压缩时每满工作者数个FRAME_SIZE字节
+       并行压缩为独立的帧，按顺序写出。只支持顺序读或顺序写，读时
+       可回到开头以便先识别格式再导入。数据有误时underflow抛出
+       GzipFormat::FORMAT_ERROR
+【接口说明】
+    内嵌枚举Mode：解压、压缩
+    静态常量：每个工作者一次解压的帧数
+    带参构造函数（被包装的流缓冲区、模式）
+    禁止拷贝构造和赋值
+    析构函数（压缩时写出剩余数据）
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+class GzipStreamBuf : public streambuf {
+public:
+    //-------------------------------------------------------------------------
+    // 内嵌枚举
+    //-------------------------------------------------------------------------
+    // 工作模式
+    enum class Mode {
+        DECOMPRESS,
+        COMPRESS
+    };
+    //-------------------------------------------------------------------------
+    // 静态常量
+    //-------------------------------------------------------------------------
+    // 每个工作者一次解压的帧数
+    static constexpr size_t BATCH_PER_WORKER{2};
+    //-------------------------------------------------------------------------
+    // 必要的构造、析构、拷贝、赋值运算符重载函数
+    //-------------------------------------------------------------------------
+    // 带参构造函数
+    GzipStreamBuf(streambuf& Target, Mode AMode);
+    // 禁止拷贝构造
+    GzipStreamBuf(const GzipStreamBuf& Source) = delete;
+    // 禁止赋值
+    GzipStreamBuf& operator=(const GzipStreamBuf& Source) = delete;
+    // 析构函数
+    virtual ~GzipStreamBuf();
+
+protected:
+    //-------------------------------------------------------------------------
+    // 受保护的成员函数
+    //-------------------------------------------------------------------------
+    // 读缓冲区为空时解压下一批数据
+    virtual int_type underflow() override;
+    // 写缓冲区已满时压缩并写出
+    virtual int_type overflow(int_type Char) override;
+    // 压缩并写出写缓冲区中的数据
+    virtual int sync() override;
+    // 相对定位，只支持回到开头
+    virtual pos_type seekoff(off_type Offset, ios_base::seekdir Direction,
+        ios_base::openmode Which) override;
+    // 绝对定位，只支持回到开头
+    virtual pos_type seekpos(pos_type Position,
+        ios_base::openmode Which) override;
+
+private:
+    //-------------------------------------------------------------------------
+    // 私有非静态成员函数
+    //-------------------------------------------------------------------------
+    // 保证未解压的输入中至少有Bytes字节，输入不足时返回false
+    bool FillRaw(size_t Bytes);
+    // 读入并行解压一批带帧头的成员，没有帧头时开始逐段解压
+    bool DecodeBatch();
+    // 压缩写缓冲区中的数据并写出，失败时返回false
+    bool FlushOutput();
+    //-------------------------------------------------------------------------
+    // 私有非静态成员
+    //-------------------------------------------------------------------------
+    // 被包装的流缓冲区
+    streambuf& m_Target;
+    // 工作模式
+    Mode m_Mode;
+    // 每批的帧数
+    size_t m_BatchSize;
+    // 未解压的输入
+    vector<char> m_Raw{};
+    // 未解压输入的起点
+    size_t m_RawBegin{0};
+    // 未解压输入的终点
+    size_t m_RawEnd{0};
+    // 已并行解压的帧
+    vector<string> m_Frames{};
+    // 下一个要交给读缓冲区的帧
+    size_t m_NextFrame{0};
+    // 逐段解压的成员
+    unique_ptr<GzipFormat::Inflater> m_pInflater{};
+    // 逐段解压的输出，或压缩前的写缓冲区
+    vector<char> m_Buffer{};
+    // 是否已写出至少一个成员
+    bool m_bWritten{false};
+};
+
+#endif /* GzipStreamBuf.hpp */
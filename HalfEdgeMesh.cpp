@@ -0,0 +1,702 @@
+/*************************************************************************
+【文件名】HalfEdgeMesh.cpp
+【功能模块和目的】定义HalfEdgeMesh类的成员函数
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+// HalfEdgeMesh所属头文件
+#include "HalfEdgeMesh.hpp"
+// IndexedModel3D所属头文件
+#include "IndexedModel3D.hpp"
+// Model3D所属头文件
+#include "Model3D.hpp"
+// Point3D所属头文件
+#include "Point3D.hpp"
+// sort, unique, min, max所属头文件
+#include <algorithm>
+// vector所属头文件
+#include <vector>
+// size_t所属头文件
+#include <cstddef>
+
+using namespace std;
+
+//-------------------------------------------------------------------------
+// 内嵌异常类
+//-------------------------------------------------------------------------
+
+/*************************************************************************
+【函数名称】FACE_NOT_FOUND
+【函数功能】构造函数，用于初始化FACE_NOT_FOUND异常类
+【参数】无
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+HalfEdgeMesh::FACE_NOT_FOUND::FACE_NOT_FOUND()
+    : out_of_range("Face not found") {
+    }
+/*************************************************************************
+【函数名称】VERTEX_NOT_FOUND
+【函数功能】构造函数，用于初始化VERTEX_NOT_FOUND异常类
+【参数】无
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+HalfEdgeMesh::VERTEX_NOT_FOUND::VERTEX_NOT_FOUND()
+    : out_of_range("Vertex not found") {
+    }
+/*************************************************************************
+【函数名称】POINT_NOT_FOUND
+【函数功能】构造函数，用于初始化POINT_NOT_FOUND异常类
+【参数】无
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+HalfEdgeMesh::POINT_NOT_FOUND::POINT_NOT_FOUND()
+    : logic_error("Point not found") {
+    }
+/*************************************************************************
+【函数名称】POINT_DUPLICATED
+【函数功能】构造函数，用于初始化POINT_DUPLICATED异常类
+【参数】无
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+HalfEdgeMesh::POINT_DUPLICATED::POINT_DUPLICATED()
+    : logic_error("Point duplicated") {
+    }
+
+//-------------------------------------------------------------------------
+// 必要的构造、析构、拷贝、赋值运算符重载函数
+//-------------------------------------------------------------------------
+
+/*************************************************************************
+【函数名称】HalfEdgeMesh
+【函数功能】带参构造函数，由索引模型建立半边结构。坐标相同的顶点先被合并，
+       面的顺序与AModel一致（顶点编号可能因合并而改变）
+【参数】const IndexedModel3D& AModel，表示索引模型
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+HalfEdgeMesh::HalfEdgeMesh(const IndexedModel3D& AModel) : m_Model(AModel) {
+    m_Model.WeldVertices();
+    Build();
+}
+/*************************************************************************
+【函数名称】HalfEdgeMesh
+【函数功能】带参构造函数，由Model3D建立半边结构，面的顺序与AModel一致
+【参数】const Model3D& AModel，表示模型
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+HalfEdgeMesh::HalfEdgeMesh(const Model3D& AModel)
+    : m_Model(IndexedModel3D::FromModel(AModel)) {
+    Build();
+}
+
+//-------------------------------------------------------------------------
+// 非静态Setter成员函数
+//-------------------------------------------------------------------------
+
+/*************************************************************************
+【函数名称】ChangeFacePoint
+【函数功能】修改指定面的指定位置的点，只更新受影响的两条边和两个顶点，
+       复杂度与相关顶点的度数成正比
+【参数】size_t FaceIndex，表示面索引
+       size_t PointIndex，表示点在面中的位置(0-2)
+       const Point3D& PointTo，表示修改后的点
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+void HalfEdgeMesh::ChangeFacePoint(
+    size_t FaceIndex,
+    size_t PointIndex,
+    const Point3D& PointTo) {
+    CheckFace(FaceIndex);
+    // 若找不到对应点，抛出POINT_NOT_FOUND异常
+    if (PointIndex > 2) {
+        throw POINT_NOT_FOUND();
+    }
+    // 查找或创建目标顶点
+    auto Key = VertexKeyHash::MakeKey(PointTo.X, PointTo.Y, PointTo.Z);
+    auto Found = m_VertexLookup.find(Key);
+    size_t NewVertex;
+    if (Found != m_VertexLookup.end()) {
+        NewVertex = Found->second;
+    }
+    else {
+        NewVertex = m_Model.AddVertex(PointTo);
+        m_VertexLookup.emplace(Key, NewVertex);
+        m_VertexCorners.push_back(INVALID);
+    }
+    // 与Face3D一致：若新点与面中任一点相同（包括被替换的点），
+    // 抛出POINT_DUPLICATED异常
+    for (size_t i = 0; i < 3; i++) {
+        if (Origin(FaceIndex * 3 + i) == NewVertex) {
+            throw POINT_DUPLICATED();
+        }
+    }
+    size_t HalfEdge = FaceIndex * 3 + PointIndex;
+    size_t Previous = Prev(HalfEdge);
+    // 摘除以旧顶点为端点的两条半边及旧顶点的角点
+    EdgeKeyType OldIn = EdgeKey(Origin(Previous), Target(Previous));
+    EdgeKeyType OldOut = EdgeKey(Origin(HalfEdge), Target(HalfEdge));
+    UnlinkEdge(HalfEdge);
+    UnlinkEdge(Previous);
+    UnlinkCorner(HalfEdge);
+    m_Twins[HalfEdge] = INVALID;
+    m_Twins[Previous] = INVALID;
+    UpdateTwins(OldIn);
+    UpdateTwins(OldOut);
+    // 修改角点的顶点后重新挂入
+    m_Model.SetFaceVertex(FaceIndex, PointIndex, NewVertex);
+    LinkCorner(HalfEdge);
+    LinkEdge(HalfEdge);
+    LinkEdge(Previous);
+    UpdateTwins(EdgeKey(Origin(Previous), Target(Previous)));
+    UpdateTwins(EdgeKey(Origin(HalfEdge), Target(HalfEdge)));
+}
+/*************************************************************************
+【函数名称】ChangeFacePoint
+【函数功能】修改指定面的指定点
+【参数】size_t FaceIndex，表示面索引
+       const Point3D& PointFrom，表示要修改的点
+       const Point3D& PointTo，表示修改后的点
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+void HalfEdgeMesh::ChangeFacePoint(
+    size_t FaceIndex,
+    const Point3D& PointFrom,
+    const Point3D& PointTo) {
+    CheckFace(FaceIndex);
+    for (size_t i = 0; i < 3; i++) {
+        // 若找到对应点，则修改该位置的点
+        if (m_Model.GetPoint(Origin(FaceIndex * 3 + i)) == PointFrom) {
+            ChangeFacePoint(FaceIndex, i, PointTo);
+            return;
+        }
+    }
+    // 若找不到对应点，抛出POINT_NOT_FOUND异常
+    throw POINT_NOT_FOUND();
+}
+
+//-------------------------------------------------------------------------
+// 非静态Getter成员函数
+//-------------------------------------------------------------------------
+
+/*************************************************************************
+【函数名称】Model
+【函数功能】获取底层索引模型
+【参数】无
+【返回值】const IndexedModel3D&，底层索引模型
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+const IndexedModel3D& HalfEdgeMesh::Model() const {
+    return m_Model;
+}
+/*************************************************************************
+【函数名称】GetVertexCount
+【函数功能】获取顶点数量
+【参数】无
+【返回值】size_t，顶点数量
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+size_t HalfEdgeMesh::GetVertexCount() const {
+    return m_Model.GetVertexCount();
+}
+/*************************************************************************
+【函数名称】GetFaceCount
+【函数功能】获取面数量
+【参数】无
+【返回值】size_t，面数量
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+size_t HalfEdgeMesh::GetFaceCount() const {
+    return m_Model.GetFaceCount();
+}
+/*************************************************************************
+【函数名称】GetHalfEdgeCount
+【函数功能】获取半边数量
+【参数】无
+【返回值】size_t，半边数量（面数的3倍）
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+size_t HalfEdgeMesh::GetHalfEdgeCount() const {
+    return m_Model.FaceIndices().size();
+}
+/*************************************************************************
+【函数名称】Origin
+【函数功能】获取半边的起点
+【参数】size_t HalfEdge，表示半边
+【返回值】size_t，起点的顶点索引
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+size_t HalfEdgeMesh::Origin(size_t HalfEdge) const {
+    return m_Model.FaceIndices()[HalfEdge];
+}
+/*************************************************************************
+【函数名称】Target
+【函数功能】获取半边的终点
+【参数】size_t HalfEdge，表示半边
+【返回值】size_t，终点的顶点索引
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+size_t HalfEdgeMesh::Target(size_t HalfEdge) const {
+    return m_Model.FaceIndices()[Next(HalfEdge)];
+}
+/*************************************************************************
+【函数名称】Face
+【函数功能】获取半边所属的面
+【参数】size_t HalfEdge，表示半边
+【返回值】size_t，面索引
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+size_t HalfEdgeMesh::Face(size_t HalfEdge) const {
+    return HalfEdge / 3;
+}
+/*************************************************************************
+【函数名称】Next
+【函数功能】获取同一面内的下一条半边
+【参数】size_t HalfEdge，表示半边
+【返回值】size_t，下一条半边
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+size_t HalfEdgeMesh::Next(size_t HalfEdge) const {
+    return HalfEdge % 3 == 2 ? HalfEdge - 2 : HalfEdge + 1;
+}
+/*************************************************************************
+【函数名称】Prev
+【函数功能】获取同一面内的上一条半边
+【参数】size_t HalfEdge，表示半边
+【返回值】size_t，上一条半边
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+size_t HalfEdgeMesh::Prev(size_t HalfEdge) const {
+    return HalfEdge % 3 == 0 ? HalfEdge + 2 : HalfEdge - 1;
+}
+/*************************************************************************
+【函数名称】Twin
+【函数功能】获取半边的对边
+【参数】size_t HalfEdge，表示半边
+【返回值】size_t，对边，边界边或非流形边返回INVALID
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+size_t HalfEdgeMesh::Twin(size_t HalfEdge) const {
+    return m_Twins[HalfEdge];
+}
+/*************************************************************************
+【函数名称】VertexHalfEdge
+【函数功能】获取顶点的一条出半边。若顶点位于边界，返回没有对边的出半边，
+       从它出发按Twin(Prev(h))旋转即可遍历整个扇区
+【参数】size_t VertexIndex，表示顶点索引
+【返回值】size_t，出半边，孤立顶点返回INVALID
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+size_t HalfEdgeMesh::VertexHalfEdge(size_t VertexIndex) const {
+    CheckVertex(VertexIndex);
+    size_t Corner = m_VertexCorners[VertexIndex];
+    size_t Result = Corner;
+    while (Corner != INVALID) {
+        if (m_Twins[Corner] == INVALID) {
+            return Corner;
+        }
+        Corner = m_CornerNext[Corner];
+    }
+    return Result;
+}
+/*************************************************************************
+【函数名称】VertexFaces
+【函数功能】获取顶点的一环邻接面
+【参数】size_t VertexIndex，表示顶点索引
+【返回值】vector<size_t>，邻接面的索引
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+vector<size_t> HalfEdgeMesh::VertexFaces(size_t VertexIndex) const {
+    CheckVertex(VertexIndex);
+    vector<size_t> Result;
+    for (size_t Corner = m_VertexCorners[VertexIndex]; Corner != INVALID;
+         Corner = m_CornerNext[Corner]) {
+        Result.push_back(Face(Corner));
+    }
+    return Result;
+}
+/*************************************************************************
+【函数名称】VertexNeighbors
+【函数功能】获取顶点的一环邻接顶点
+【参数】size_t VertexIndex，表示顶点索引
+【返回值】vector<size_t>，邻接顶点的索引（升序，无重复）
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+vector<size_t> HalfEdgeMesh::VertexNeighbors(size_t VertexIndex) const {
+    CheckVertex(VertexIndex);
+    vector<size_t> Result;
+    for (size_t Corner = m_VertexCorners[VertexIndex]; Corner != INVALID;
+         Corner = m_CornerNext[Corner]) {
+        Result.push_back(Target(Corner));
+        Result.push_back(Origin(Prev(Corner)));
+    }
+    sort(Result.begin(), Result.end());
+    Result.erase(unique(Result.begin(), Result.end()), Result.end());
+    return Result;
+}
+/*************************************************************************
+【函数名称】FaceNeighbors
+【函数功能】获取与指定面共享一条边的全部面（包括非流形边上的多个面）
+【参数】size_t FaceIndex，表示面索引
+【返回值】vector<size_t>，邻接面的索引（升序，无重复）
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+vector<size_t> HalfEdgeMesh::FaceNeighbors(size_t FaceIndex) const {
+    CheckFace(FaceIndex);
+    vector<size_t> Result;
+    for (size_t i = 0; i < 3; i++) {
+        size_t HalfEdge = FaceIndex * 3 + i;
+        auto Head = m_EdgeHeads.find(
+            EdgeKey(Origin(HalfEdge), Target(HalfEdge)));
+        for (size_t Other = Head->second; Other != INVALID;
+             Other = m_EdgeNext[Other]) {
+            if (Face(Other) != FaceIndex) {
+                Result.push_back(Face(Other));
+            }
+        }
+    }
+    sort(Result.begin(), Result.end());
+    Result.erase(unique(Result.begin(), Result.end()), Result.end());
+    return Result;
+}
+/*************************************************************************
+【函数名称】IsBoundaryHalfEdge
+【函数功能】判断半边是否为边界半边（所在无向边只属于一个面）
+【参数】size_t HalfEdge，表示半边
+【返回值】bool，是否为边界半边
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+bool HalfEdgeMesh::IsBoundaryHalfEdge(size_t HalfEdge) const {
+    auto Head = m_EdgeHeads.find(EdgeKey(Origin(HalfEdge), Target(HalfEdge)));
+    return m_EdgeNext[Head->second] == INVALID;
+}
+/*************************************************************************
+【函数名称】IsBoundaryVertex
+【函数功能】判断顶点是否为边界顶点
+【参数】size_t VertexIndex，表示顶点索引
+【返回值】bool，是否为边界顶点
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+bool HalfEdgeMesh::IsBoundaryVertex(size_t VertexIndex) const {
+    CheckVertex(VertexIndex);
+    for (size_t Corner = m_VertexCorners[VertexIndex]; Corner != INVALID;
+         Corner = m_CornerNext[Corner]) {
+        if (IsBoundaryHalfEdge(Corner) || IsBoundaryHalfEdge(Prev(Corner))) {
+            return true;
+        }
+    }
+    return false;
+}
+/*************************************************************************
+【函数名称】BoundaryHalfEdges
+【函数功能】获取全部边界半边
+【参数】无
+【返回值】vector<size_t>，边界半边
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+vector<size_t> HalfEdgeMesh::BoundaryHalfEdges() const {
+    vector<size_t> Result;
+    for (const auto& Edge : m_EdgeHeads) {
+        if (m_EdgeNext[Edge.second] == INVALID) {
+            Result.push_back(Edge.second);
+        }
+    }
+    sort(Result.begin(), Result.end());
+    return Result;
+}
+/*************************************************************************
+【函数名称】IsManifoldEdge
+【函数功能】判断半边所在的无向边是否流形：边界边，或恰好两个方向相反的半边
+【参数】size_t HalfEdge，表示半边
+【返回值】bool，是否流形
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+bool HalfEdgeMesh::IsManifoldEdge(size_t HalfEdge) const {
+    return IsBoundaryHalfEdge(HalfEdge) || m_Twins[HalfEdge] != INVALID;
+}
+/*************************************************************************
+【函数名称】IsManifoldVertex
+【函数功能】判断顶点是否流形：从出半边开始按扇区旋转能访问到全部邻接面
+【参数】size_t VertexIndex，表示顶点索引
+【返回值】bool，是否流形
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+bool HalfEdgeMesh::IsManifoldVertex(size_t VertexIndex) const {
+    size_t Start = VertexHalfEdge(VertexIndex);
+    // 孤立顶点视为流形
+    if (Start == INVALID) {
+        return true;
+    }
+    size_t Valence = 0;
+    for (size_t Corner = m_VertexCorners[VertexIndex]; Corner != INVALID;
+         Corner = m_CornerNext[Corner]) {
+        Valence++;
+    }
+    size_t FanSize = 0;
+    size_t HalfEdge = Start;
+    do {
+        FanSize++;
+        HalfEdge = m_Twins[Prev(HalfEdge)];
+    } while (HalfEdge != INVALID && HalfEdge != Start && FanSize <= Valence);
+    return FanSize == Valence;
+}
+/*************************************************************************
+【函数名称】IsManifold
+【函数功能】判断整个网格是否流形
+【参数】无
+【返回值】bool，是否流形
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+bool HalfEdgeMesh::IsManifold() const {
+    return NonManifoldEdges().empty() && NonManifoldVertices().empty();
+}
+/*************************************************************************
+【函数名称】NonManifoldEdges
+【函数功能】获取全部非流形边（超过两个面，或两个面方向不一致）
+【参数】无
+【返回值】vector<size_t>，每条非流形边的一条半边
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+vector<size_t> HalfEdgeMesh::NonManifoldEdges() const {
+    vector<size_t> Result;
+    for (const auto& Edge : m_EdgeHeads) {
+        if (!IsManifoldEdge(Edge.second)) {
+            Result.push_back(Edge.second);
+        }
+    }
+    sort(Result.begin(), Result.end());
+    return Result;
+}
+/*************************************************************************
+【函数名称】NonManifoldVertices
+【函数功能】获取全部非流形顶点
+【参数】无
+【返回值】vector<size_t>，非流形顶点的索引
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+vector<size_t> HalfEdgeMesh::NonManifoldVertices() const {
+    vector<size_t> Result;
+    for (size_t i = 0; i < GetVertexCount(); i++) {
+        if (!IsManifoldVertex(i)) {
+            Result.push_back(i);
+        }
+    }
+    return Result;
+}
+
+//-------------------------------------------------------------------------
+// 私有非静态成员函数
+//-------------------------------------------------------------------------
+
+/*************************************************************************
+【函数名称】Build
+【函数功能】建立全部邻接关系，复杂度O(V + F)
+【参数】无
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+void HalfEdgeMesh::Build() {
+    size_t HalfEdgeCount = GetHalfEdgeCount();
+    size_t VertexCount = GetVertexCount();
+    m_Twins.assign(HalfEdgeCount, INVALID);
+    m_EdgeNext.assign(HalfEdgeCount, INVALID);
+    m_CornerNext.assign(HalfEdgeCount, INVALID);
+    m_VertexCorners.assign(VertexCount, INVALID);
+    m_EdgeHeads.clear();
+    m_EdgeHeads.reserve(HalfEdgeCount);
+    m_VertexLookup.clear();
+    m_VertexLookup.reserve(VertexCount);
+    const vector<double>& Vertices = m_Model.Vertices();
+    for (size_t i = 0; i < VertexCount; i++) {
+        m_VertexLookup.emplace(VertexKeyHash::MakeKey(
+            Vertices[i * 3], Vertices[i * 3 + 1], Vertices[i * 3 + 2]), i);
+    }
+    // 逆序挂入，使链表中的顺序与编号顺序一致
+    for (size_t i = HalfEdgeCount; i > 0; i--) {
+        LinkCorner(i - 1);
+        LinkEdge(i - 1);
+    }
+    for (const auto& Edge : m_EdgeHeads) {
+        UpdateTwins(Edge.first);
+    }
+}
+/*************************************************************************
+【函数名称】EdgeKey
+【函数功能】由两个顶点索引生成无向边的键
+【参数】size_t Vertex1, size_t Vertex2，表示边的两个顶点
+【返回值】EdgeKeyType，无向边的键
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+HalfEdgeMesh::EdgeKeyType HalfEdgeMesh::EdgeKey(
+    size_t Vertex1, size_t Vertex2) {
+    return EdgeKeyType(min(Vertex1, Vertex2), max(Vertex1, Vertex2));
+}
+/*************************************************************************
+【函数名称】LinkEdge
+【函数功能】将半边挂入其无向边的链表头部
+【参数】size_t HalfEdge，表示半边
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+void HalfEdgeMesh::LinkEdge(size_t HalfEdge) {
+    auto Result = m_EdgeHeads.emplace(
+        EdgeKey(Origin(HalfEdge), Target(HalfEdge)), HalfEdge);
+    if (!Result.second) {
+        m_EdgeNext[HalfEdge] = Result.first->second;
+        Result.first->second = HalfEdge;
+    }
+}
+/*************************************************************************
+【函数名称】UnlinkEdge
+【函数功能】将半边从其无向边的链表中摘除，链表为空时删除该无向边
+【参数】size_t HalfEdge，表示半边
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+void HalfEdgeMesh::UnlinkEdge(size_t HalfEdge) {
+    auto Head = m_EdgeHeads.find(EdgeKey(Origin(HalfEdge), Target(HalfEdge)));
+    if (Head->second == HalfEdge) {
+        if (m_EdgeNext[HalfEdge] == INVALID) {
+            m_EdgeHeads.erase(Head);
+        }
+        else {
+            Head->second = m_EdgeNext[HalfEdge];
+        }
+    }
+    else {
+        size_t Previous = Head->second;
+        while (m_EdgeNext[Previous] != HalfEdge) {
+            Previous = m_EdgeNext[Previous];
+        }
+        m_EdgeNext[Previous] = m_EdgeNext[HalfEdge];
+    }
+    m_EdgeNext[HalfEdge] = INVALID;
+}
+/*************************************************************************
+【函数名称】UpdateTwins
+【函数功能】重新计算无向边上全部半边的对边：仅当恰有两条方向相反的半边时配对
+【参数】const EdgeKeyType& Key，表示无向边的键
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+void HalfEdgeMesh::UpdateTwins(const EdgeKeyType& Key) {
+    auto Head = m_EdgeHeads.find(Key);
+    // 无向边已不存在，无需处理
+    if (Head == m_EdgeHeads.end()) {
+        return;
+    }
+    size_t First = Head->second;
+    size_t Second = m_EdgeNext[First];
+    for (size_t HalfEdge = First; HalfEdge != INVALID;
+         HalfEdge = m_EdgeNext[HalfEdge]) {
+        m_Twins[HalfEdge] = INVALID;
+    }
+    if (Second != INVALID && m_EdgeNext[Second] == INVALID
+        && Origin(First) == Target(Second)
+        && Origin(First) != Origin(Second)) {
+        m_Twins[First] = Second;
+        m_Twins[Second] = First;
+    }
+}
+/*************************************************************************
+【函数名称】LinkCorner
+【函数功能】将角点挂入其顶点的角点链表头部
+【参数】size_t Corner，表示角点
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+void HalfEdgeMesh::LinkCorner(size_t Corner) {
+    size_t Vertex = Origin(Corner);
+    m_CornerNext[Corner] = m_VertexCorners[Vertex];
+    m_VertexCorners[Vertex] = Corner;
+}
+/*************************************************************************
+【函数名称】UnlinkCorner
+【函数功能】将角点从其顶点的角点链表中摘除
+【参数】size_t Corner，表示角点
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+void HalfEdgeMesh::UnlinkCorner(size_t Corner) {
+    size_t Vertex = Origin(Corner);
+    if (m_VertexCorners[Vertex] == Corner) {
+        m_VertexCorners[Vertex] = m_CornerNext[Corner];
+    }
+    else {
+        size_t Previous = m_VertexCorners[Vertex];
+        while (m_CornerNext[Previous] != Corner) {
+            Previous = m_CornerNext[Previous];
+        }
+        m_CornerNext[Previous] = m_CornerNext[Corner];
+    }
+    m_CornerNext[Corner] = INVALID;
+}
+/*************************************************************************
+【函数名称】CheckFace
+【函数功能】检查面索引，超出范围时抛出FACE_NOT_FOUND异常
+【参数】size_t FaceIndex，表示面索引
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+void HalfEdgeMesh::CheckFace(size_t FaceIndex) const {
+    if (FaceIndex >= GetFaceCount()) {
+        throw FACE_NOT_FOUND();
+    }
+}
+/*************************************************************************
+【函数名称】CheckVertex
+【函数功能】检查顶点索引，超出范围时抛出VERTEX_NOT_FOUND异常
+【参数】size_t VertexIndex，表示顶点索引
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+void HalfEdgeMesh::CheckVertex(size_t VertexIndex) const {
+    if (VertexIndex >= GetVertexCount()) {
+        throw VERTEX_NOT_FOUND();
+    }
+}
@@ -0,0 +1,211 @@
+/*************************************************************************
+【文件名】HalfEdgeMesh.hpp
+【功能模块和目的】定义HalfEdgeMesh类，为三角网格提供半边邻接关系
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+#ifndef HALFEDGEMESH_HPP
+#define HALFEDGEMESH_HPP
+
+// IndexedModel3D所属头文件
+#include "IndexedModel3D.hpp"
+// Model3D所属头文件
+#include "Model3D.hpp"
+// Point3D所属头文件
+#include "Point3D.hpp"
+// logic_error, out_of_range所属头文件
+#include <stdexcept>
+// unordered_map所属头文件
+#include <unordered_map>
+// vector所属头文件
+#include <vector>
+// pair所属头文件
+#include <utility>
+// size_t所属头文件
+#include <cstddef>
+// numeric_limits所属头文件
+#include <limits>
+
+using namespace std;
+
+/*************************************************************************
+【类名】HalfEdgeMesh
+【功能】以角点表（corner table）形式实现的半边结构：面f的第c个角点即半边3f+c，
+       由该角点的顶点指向下一角点的顶点。半边的next/prev/face由编号隐式得到，
+       仅显式存储twin、每条无向边上的半边链表和每个顶点的角点链表，
+       因此能在O(F)内由IndexedModel3D建立，并在修改面上的点时局部更新
+【接口说明】
+    带参构造函数（由IndexedModel3D或Model3D建立）
+    拷贝构造函数
+    赋值运算符
+    虚析构函数
+    修改指定面的指定位置的点（局部更新邻接关系）
+    修改指定面的指定点（局部更新邻接关系）
+    获取底层索引模型
+    获取顶点、面、半边的数量
+    半边的起点、终点、所属面、下一条、上一条、对边
+    顶点的一条出半边
+    顶点的一环邻接面、一环邻接顶点
+    面的邻接面
+    判断半边、顶点是否位于边界
+    获取全部边界半边
+    判断边、顶点是否流形
+    判断整个网格是否流形
+    获取全部非流形边、非流形顶点
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+class HalfEdgeMesh {
+public:
+    //-------------------------------------------------------------------------
+    // 内嵌异常类
+    //-------------------------------------------------------------------------
+    // 面未找到类异常
+    class FACE_NOT_FOUND : public out_of_range {
+    public:
+        FACE_NOT_FOUND();
+    };
+    // 顶点未找到类异常
+    class VERTEX_NOT_FOUND : public out_of_range {
+    public:
+        VERTEX_NOT_FOUND();
+    };
+    // 点未找到类异常
+    class POINT_NOT_FOUND : public logic_error {
+    public:
+        POINT_NOT_FOUND();
+    };
+    // 点重复类异常
+    class POINT_DUPLICATED : public logic_error {
+    public:
+        POINT_DUPLICATED();
+    };
+    //-------------------------------------------------------------------------
+    // 静态常量
+    //-------------------------------------------------------------------------
+    // 无效索引（边界半边的对边、孤立顶点的出半边等）
+    static constexpr size_t INVALID{numeric_limits<size_t>::max()};
+    //-------------------------------------------------------------------------
+    // 必要的构造、析构、拷贝、赋值运算符重载函数
+    //-------------------------------------------------------------------------
+    // 带参构造函数
+    explicit HalfEdgeMesh(const IndexedModel3D& AModel);
+    // 带参构造函数
+    explicit HalfEdgeMesh(const Model3D& AModel);
+    // 拷贝构造函数
+    HalfEdgeMesh(const HalfEdgeMesh& Source) = default;
+    // 赋值运算符
+    HalfEdgeMesh& operator=(const HalfEdgeMesh& Source) = default;
+    // 虚析构函数
+    virtual ~HalfEdgeMesh() = default;
+    //-------------------------------------------------------------------------
+    // 非静态Setter成员函数
+    //-------------------------------------------------------------------------
+    // 修改指定面的指定位置的点，与Model3D::ChangeFacePoint保持一致
+    void ChangeFacePoint(size_t FaceIndex, size_t PointIndex,
+                         const Point3D& PointTo);
+    // 修改指定面的指定点，与Model3D::ChangeFacePoint保持一致
+    void ChangeFacePoint(size_t FaceIndex, const Point3D& PointFrom,
+                         const Point3D& PointTo);
+    //-------------------------------------------------------------------------
+    // 非静态Getter成员函数
+    //-------------------------------------------------------------------------
+    // 获取底层索引模型
+    const IndexedModel3D& Model() const;
+    // 获取顶点数量
+    size_t GetVertexCount() const;
+    // 获取面数量
+    size_t GetFaceCount() const;
+    // 获取半边数量
+    size_t GetHalfEdgeCount() const;
+    // 半边的起点
+    size_t Origin(size_t HalfEdge) const;
+    // 半边的终点
+    size_t Target(size_t HalfEdge) const;
+    // 半边所属面
+    size_t Face(size_t HalfEdge) const;
+    // 同一面内的下一条半边
+    size_t Next(size_t HalfEdge) const;
+    // 同一面内的上一条半边
+    size_t Prev(size_t HalfEdge) const;
+    // 对边（边界边或非流形边返回INVALID）
+    size_t Twin(size_t HalfEdge) const;
+    // 顶点的一条出半边（边界顶点优先返回边界出半边，孤立顶点返回INVALID）
+    size_t VertexHalfEdge(size_t VertexIndex) const;
+    // 顶点的一环邻接面（包括非流形顶点的全部扇区）
+    vector<size_t> VertexFaces(size_t VertexIndex) const;
+    // 顶点的一环邻接顶点
+    vector<size_t> VertexNeighbors(size_t VertexIndex) const;
+    // 面的邻接面（共享一条边）
+    vector<size_t> FaceNeighbors(size_t FaceIndex) const;
+    // 判断半边是否为边界半边
+    bool IsBoundaryHalfEdge(size_t HalfEdge) const;
+    // 判断顶点是否为边界顶点
+    bool IsBoundaryVertex(size_t VertexIndex) const;
+    // 获取全部边界半边
+    vector<size_t> BoundaryHalfEdges() const;
+    // 判断半边所在的无向边是否流形（至多两个面且方向相反）
+    bool IsManifoldEdge(size_t HalfEdge) const;
+    // 判断顶点是否流形（邻接面构成单一扇区）
+    bool IsManifoldVertex(size_t VertexIndex) const;
+    // 判断整个网格是否流形
+    bool IsManifold() const;
+    // 获取全部非流形边（每条无向边返回一条半边）
+    vector<size_t> NonManifoldEdges() const;
+    // 获取全部非流形顶点
+    vector<size_t> NonManifoldVertices() const;
+
+private:
+    //-------------------------------------------------------------------------
+    // 私有内嵌类型
+    //-------------------------------------------------------------------------
+    // 无向边的键，存储较小和较大的顶点索引
+    using EdgeKeyType = pair<size_t, size_t>;
+    // 无向边键的哈希函数
+    struct EdgeKeyHash {
+        size_t operator()(const EdgeKeyType& Key) const {
+            return Key.first * 0x9e3779b97f4a7c15ULL
+                ^ (Key.second + 0x7f4a7c159e3779b9ULL + (Key.first >> 7));
+        }
+    };
+    //-------------------------------------------------------------------------
+    // 私有非静态成员函数
+    //-------------------------------------------------------------------------
+    // 建立全部邻接关系
+    void Build();
+    // 由两个顶点索引生成无向边的键
+    static EdgeKeyType EdgeKey(size_t Vertex1, size_t Vertex2);
+    // 将半边挂入其无向边的链表
+    void LinkEdge(size_t HalfEdge);
+    // 将半边从其无向边的链表中摘除
+    void UnlinkEdge(size_t HalfEdge);
+    // 重新计算无向边上全部半边的对边
+    void UpdateTwins(const EdgeKeyType& Key);
+    // 将角点挂入顶点的角点链表
+    void LinkCorner(size_t Corner);
+    // 将角点从顶点的角点链表中摘除
+    void UnlinkCorner(size_t Corner);
+    // 检查面索引
+    void CheckFace(size_t FaceIndex) const;
+    // 检查顶点索引
+    void CheckVertex(size_t VertexIndex) const;
+    //-------------------------------------------------------------------------
+    // 私有非静态成员
+    //-------------------------------------------------------------------------
+    // 底层索引模型
+    IndexedModel3D m_Model;
+    // 每条半边的对边
+    vector<size_t> m_Twins{};
+    // 无向边到其首条半边的映射
+    unordered_map<EdgeKeyType, size_t, EdgeKeyHash> m_EdgeHeads{};
+    // 同一无向边上的下一条半边
+    vector<size_t> m_EdgeNext{};
+    // 每个顶点的首个角点
+    vector<size_t> m_VertexCorners{};
+    // 同一顶点的下一个角点
+    vector<size_t> m_CornerNext{};
+    // 坐标到顶点索引的映射，用于修改点时复用已有顶点
+    unordered_map<VertexKeyHash::Key, size_t, VertexKeyHash> m_VertexLookup{};
+};
+
+#endif /* HalfEdgeMesh.hpp */
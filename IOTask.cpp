@@ -0,0 +1,182 @@
+/*************************************************************************
+【文件名】IOTask.cpp
+【功能模块和目的】定义IOTask类的成员函数
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+// IOTask所属头文件
+#include "IOTask.hpp"
+// uint64_t所属头文件
+#include <cstdint>
+// size_t所属头文件
+#include <cstddef>
+
+using namespace std;
+
+//-------------------------------------------------------------------------
+// 静态常量
+//-------------------------------------------------------------------------
+
+// 两次进度回调之间的最少字节数
+constexpr uint64_t IOTask::REPORT_INTERVAL;
+
+//-------------------------------------------------------------------------
+// 内嵌异常类
+//-------------------------------------------------------------------------
+
+/*************************************************************************
+【函数名称】CANCELLED
+【函数功能】已取消异常类的构造函数
+【参数】无
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+IOTask::CANCELLED::CANCELLED() : runtime_error("IO task cancelled.") {
+}
+
+//-------------------------------------------------------------------------
+// 必要的构造、析构、拷贝、赋值运算符重载函数
+//-------------------------------------------------------------------------
+
+/*************************************************************************
+【函数名称】IOTask
+【函数功能】带参构造函数
+【参数】const ProgressCallback& Callback, 表示进度回调，可为空
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+IOTask::IOTask(const ProgressCallback& Callback) : m_Callback(Callback) {
+}
+
+//-------------------------------------------------------------------------
+// 非静态Setter成员函数
+//-------------------------------------------------------------------------
+
+/*************************************************************************
+【函数名称】Cancel
+【函数功能】请求取消，可由任何线程调用
+【参数】无
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+void IOTask::Cancel() {
+    m_bCancelled = true;
+}
+/*************************************************************************
+【函数名称】Start
+【函数功能】开始处理，记录总字节数并调用一次进度回调
+【参数】uint64_t TotalBytes, 表示总字节数，未知时为0
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+void IOTask::Start(uint64_t TotalBytes) {
+    m_TotalBytes = TotalBytes;
+    Report();
+}
+/*************************************************************************
+【函数名称】AddBytes
+【函数功能】累加已读写的字节数，距上次回调超过REPORT_INTERVAL字节时
+       调用进度回调
+【参数】uint64_t Count, 表示字节数
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+void IOTask::AddBytes(uint64_t Count) {
+    uint64_t Bytes = m_Bytes += Count;
+    if (Bytes - m_ReportedBytes >= REPORT_INTERVAL) {
+        Report();
+    }
+}
+/*************************************************************************
+【函数名称】AddElements
+【函数功能】累加已处理的元素数并调用进度回调
+【参数】size_t Count, 表示元素数
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+void IOTask::AddElements(size_t Count) {
+    m_Elements += Count;
+    Report();
+}
+/*************************************************************************
+【函数名称】Finish
+【函数功能】结束处理并调用最后一次进度回调
+【参数】无
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+void IOTask::Finish() {
+    m_bFinished = true;
+    Report();
+}
+
+//-------------------------------------------------------------------------
+// 非静态Getter成员函数
+//-------------------------------------------------------------------------
+
+/*************************************************************************
+【函数名称】IsCancelled
+【函数功能】判断是否已请求取消
+【参数】无
+【返回值】bool，是否已请求取消
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+bool IOTask::IsCancelled() const {
+    return m_bCancelled;
+}
+/*************************************************************************
+【函数名称】ThrowIfCancelled
+【函数功能】若已请求取消则抛出CANCELLED
+【参数】无
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+void IOTask::ThrowIfCancelled() const {
+    if (m_bCancelled) {
+        throw CANCELLED();
+    }
+}
+/*************************************************************************
+【函数名称】GetProgress
+【函数功能】获取进度，可由任何线程调用
+【参数】无
+【返回值】Progress，进度
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+IOTask::Progress IOTask::GetProgress() const {
+    Progress Current;
+    Current.Bytes = m_Bytes;
+    Current.TotalBytes = m_TotalBytes;
+    Current.Elements = m_Elements;
+    Current.Finished = m_bFinished;
+    return Current;
+}
+
+//-------------------------------------------------------------------------
+// 私有非静态成员函数
+//-------------------------------------------------------------------------
+
+/*************************************************************************
+【函数名称】Report
+【函数功能】调用进度回调（若有）
+【参数】无
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+void IOTask::Report() {
+    m_ReportedBytes = m_Bytes;
+    if (m_Callback) {
+        m_Callback(GetProgress());
+    }
+}
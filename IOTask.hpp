@@ -0,0 +1,133 @@
+/*************************************************************************
+【文件名】IOTask.hpp
+【功能模块和目的】定义IOTask类，表示一次异步导入或导出的进度和取消状态
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+#ifndef IOTASK_HPP
+#define IOTASK_HPP
+
+// function所属头文件
+#include <functional>
+// atomic所属头文件
+#include <atomic>
+// runtime_error所属头文件
+#include <stdexcept>
+// uint64_t所属头文件
+#include <cstdint>
+// size_t所属头文件
+#include <cstddef>
+
+using namespace std;
+
+/*************************************************************************
+【类名】IOTask
+【功能】一次异步导入或导出的进度和取消状态，由发起者创建并传给
+       Controller的异步函数，发起者与执行的IO线程共享同一个对象。
+       IO线程每处理REPORT_INTERVAL字节（及结束时）调用一次进度回调，
+       回调在IO线程中执行；任何线程都可以查询进度或请求取消，IO线程在
+       下一次读写缓冲区时停止
+【接口说明】
+    内嵌异常类：已取消
+    内嵌结构体Progress，表示进度
+    静态常量：两次进度回调之间的最少字节数
+    带参构造函数（进度回调，可为空）
+    禁止拷贝构造和赋值
+    虚析构函数
+    请求取消、判断是否已请求取消
+    获取进度
+    以下由IO线程调用：开始、累加字节数、累加元素数、结束、若已取消则抛出异常
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+class IOTask {
+public:
+    //-------------------------------------------------------------------------
+    // 内嵌异常类
+    //-------------------------------------------------------------------------
+    // 已请求取消时由IO线程抛出，用于中止正在进行的读写
+    class CANCELLED : public runtime_error {
+    public:
+        CANCELLED();
+    };
+    //-------------------------------------------------------------------------
+    // 公有的内嵌类，用于存储数据
+    //-------------------------------------------------------------------------
+    // 进度
+    struct Progress {
+        // 已读取或写入的字节数
+        uint64_t Bytes{0};
+        // 总字节数，导出时未知，为0
+        uint64_t TotalBytes{0};
+        // 已处理的元素数（面数与线数之和），导出时在结束时给出
+        size_t Elements{0};
+        // 是否已结束（成功、失败或取消）
+        bool Finished{false};
+    };
+    // 进度回调
+    using ProgressCallback = function<void(const Progress&)>;
+    //-------------------------------------------------------------------------
+    // 静态常量
+    //-------------------------------------------------------------------------
+    // 两次进度回调之间的最少字节数
+    static constexpr uint64_t REPORT_INTERVAL{1 << 20};
+    //-------------------------------------------------------------------------
+    // 必要的构造、析构、拷贝、赋值运算符重载函数
+    //-------------------------------------------------------------------------
+    // 带参构造函数
+    explicit IOTask(const ProgressCallback& Callback = nullptr);
+    // 禁止拷贝构造
+    IOTask(const IOTask& Source) = delete;
+    // 禁止赋值
+    IOTask& operator=(const IOTask& Source) = delete;
+    // 虚析构函数
+    virtual ~IOTask() = default;
+    //-------------------------------------------------------------------------
+    // 非静态Setter成员函数
+    //-------------------------------------------------------------------------
+    // 请求取消
+    void Cancel();
+    // 开始处理（IO线程调用）
+    void Start(uint64_t TotalBytes);
+    // 累加已读写的字节数（IO线程调用）
+    void AddBytes(uint64_t Count);
+    // 累加已处理的元素数（IO线程调用）
+    void AddElements(size_t Count);
+    // 结束处理（IO线程调用）
+    void Finish();
+    //-------------------------------------------------------------------------
+    // 非静态Getter成员函数
+    //-------------------------------------------------------------------------
+    // 判断是否已请求取消
+    bool IsCancelled() const;
+    // 若已请求取消则抛出CANCELLED（IO线程调用）
+    void ThrowIfCancelled() const;
+    // 获取进度
+    Progress GetProgress() const;
+
+private:
+    //-------------------------------------------------------------------------
+    // 私有非静态成员函数
+    //-------------------------------------------------------------------------
+    // 调用进度回调
+    void Report();
+    //-------------------------------------------------------------------------
+    // 私有非静态成员
+    //-------------------------------------------------------------------------
+    // 进度回调
+    ProgressCallback m_Callback;
+    // 是否已请求取消
+    atomic<bool> m_bCancelled{false};
+    // 已读写的字节数
+    atomic<uint64_t> m_Bytes{0};
+    // 总字节数
+    atomic<uint64_t> m_TotalBytes{0};
+    // 已处理的元素数
+    atomic<size_t> m_Elements{0};
+    // 是否已结束
+    atomic<bool> m_bFinished{false};
+    // 上次回调时的字节数（只由IO线程访问）
+    uint64_t m_ReportedBytes{0};
+};
+
+#endif /* IOTask.hpp */
@@ -0,0 +1,137 @@
+/*************************************************************************
+【文件名】IOThreadPool.cpp
+【功能模块和目的】定义IOThreadPool类的成员函数
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+// IOThreadPool所属头文件
+#include "IOThreadPool.hpp"
+// thread所属头文件
+#include <thread>
+// mutex、unique_lock所属头文件
+#include <mutex>
+// size_t所属头文件
+#include <cstddef>
+
+using namespace std;
+
+//-------------------------------------------------------------------------
+// 静态常量
+//-------------------------------------------------------------------------
+
+// 默认线程数上限
+constexpr size_t IOThreadPool::DEFAULT_THREAD_COUNT;
+
+//-------------------------------------------------------------------------
+// 必要的构造、析构、拷贝、赋值运算符重载函数
+//-------------------------------------------------------------------------
+
+/*************************************************************************
+【函数名称】IOThreadPool
+【函数功能】带参构造函数，线程在提交任务时按需创建
+【参数】size_t ThreadCount, 表示线程数上限，为0时按1处理
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+IOThreadPool::IOThreadPool(size_t ThreadCount)
+    : m_ThreadCount(ThreadCount == 0 ? 1 : ThreadCount) {
+}
+/*************************************************************************
+【函数名称】~IOThreadPool
+【函数功能】析构函数，等待已提交的任务执行完毕后结束全部线程
+【参数】无
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+IOThreadPool::~IOThreadPool() {
+    {
+        lock_guard<mutex> Lock(m_Mutex);
+        m_bStopping = true;
+    }
+    m_Wakeup.notify_all();
+    for (auto& Worker : m_Workers) {
+        Worker.join();
+    }
+}
+
+//-------------------------------------------------------------------------
+// 非静态成员函数
+//-------------------------------------------------------------------------
+
+/*************************************************************************
+【函数名称】GetThreadCount
+【函数功能】获取线程数上限
+【参数】无
+【返回值】size_t，线程数上限
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+size_t IOThreadPool::GetThreadCount() const {
+    return m_ThreadCount;
+}
+/*************************************************************************
+【函数名称】GetStartedCount
+【函数功能】获取已创建的线程数
+【参数】无
+【返回值】size_t，已创建的线程数
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+size_t IOThreadPool::GetStartedCount() const {
+    lock_guard<mutex> Lock(m_Mutex);
+    return m_Workers.size();
+}
+
+//-------------------------------------------------------------------------
+// 私有非静态成员函数
+//-------------------------------------------------------------------------
+
+/*************************************************************************
+【函数名称】Enqueue
+【函数功能】把任务加入队列；若没有空闲线程且线程数未达上限，创建线程
+【参数】const function<void()>& Job, 表示任务
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+void IOThreadPool::Enqueue(const function<void()>& Job) {
+    {
+        lock_guard<mutex> Lock(m_Mutex);
+        m_Jobs.push_back(Job);
+        if (m_IdleCount < m_Jobs.size() && m_Workers.size() < m_ThreadCount) {
+            m_Workers.emplace_back(&IOThreadPool::WorkerLoop, this);
+        }
+    }
+    m_Wakeup.notify_one();
+}
+/*************************************************************************
+【函数名称】WorkerLoop
+【函数功能】线程主循环：依次取出任务执行，队列为空时等待，
+       正在析构且队列为空时返回
+【参数】无
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+void IOThreadPool::WorkerLoop() {
+    unique_lock<mutex> Lock(m_Mutex);
+    while (true) {
+        if (m_Jobs.empty()) {
+            if (m_bStopping) {
+                return;
+            }
+            m_IdleCount++;
+            m_Wakeup.wait(Lock);
+            m_IdleCount--;
+            continue;
+        }
+        function<void()> Job = move(m_Jobs.front());
+        m_Jobs.pop_front();
+        Lock.unlock();
+        // 任务由packaged_task包装，异常保存在future中
+        Job();
+        Lock.lock();
+    }
+}
@@ -0,0 +1,123 @@
+/*************************************************************************
+【文件名】IOThreadPool.hpp
+【功能模块和目的】定义IOThreadPool类，用固定上限的线程执行文件读写任务
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+#ifndef IOTHREADPOOL_HPP
+#define IOTHREADPOOL_HPP
+
+// function所属头文件
+#include <functional>
+// packaged_task、future所属头文件
+#include <future>
+// thread所属头文件
+#include <thread>
+// mutex所属头文件
+#include <mutex>
+// condition_variable所属头文件
+#include <condition_variable>
+// deque所属头文件
+#include <deque>
+// vector所属头文件
+#include <vector>
+// shared_ptr所属头文件
+#include <memory>
+// size_t所属头文件
+#include <cstddef>
+
+using namespace std;
+
+/*************************************************************************
+【类名】IOThreadPool
+【功能】执行文件读写任务的线程池。任务按提交顺序排队，线程在有任务
+       排队且没有空闲线程时按需创建，总数不超过构造时给定的上限，
+       因此同时打开的文件数和读写线程数有界；析构时执行完已提交的
+       任务后结束全部线程
+【接口说明】
+    静态常量：默认线程数上限
+    带参构造函数（线程数上限）
+    禁止拷贝构造和赋值
+    虚析构函数
+    提交任务，返回其结果的future
+    获取线程数上限、已创建的线程数
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+class IOThreadPool {
+public:
+    //-------------------------------------------------------------------------
+    // 静态常量
+    //-------------------------------------------------------------------------
+    // 默认线程数上限
+    static constexpr size_t DEFAULT_THREAD_COUNT{4};
+    //-------------------------------------------------------------------------
+    // 必要的构造、析构、拷贝、赋值运算符重载函数
+    //-------------------------------------------------------------------------
+    // 带参构造函数，ThreadCount为0时按1处理
+    explicit IOThreadPool(size_t ThreadCount = DEFAULT_THREAD_COUNT);
+    // 禁止拷贝构造
+    IOThreadPool(const IOThreadPool& Source) = delete;
+    // 禁止赋值
+    IOThreadPool& operator=(const IOThreadPool& Source) = delete;
+    // 虚析构函数
+    virtual ~IOThreadPool();
+    //-------------------------------------------------------------------------
+    // 非静态成员函数
+    //-------------------------------------------------------------------------
+    // 提交任务，返回其结果的future，任务抛出的异常在get时重新抛出
+    template<class Result>
+    future<Result> Submit(const function<Result()>& Task);
+    // 获取线程数上限
+    size_t GetThreadCount() const;
+    // 获取已创建的线程数
+    size_t GetStartedCount() const;
+
+private:
+    //-------------------------------------------------------------------------
+    // 私有非静态成员函数
+    //-------------------------------------------------------------------------
+    // 把任务加入队列，必要时创建线程
+    void Enqueue(const function<void()>& Job);
+    // 线程主循环
+    void WorkerLoop();
+    //-------------------------------------------------------------------------
+    // 私有非静态成员
+    //-------------------------------------------------------------------------
+    // 线程数上限
+    size_t m_ThreadCount;
+    // 保护以下成员
+    mutable mutex m_Mutex{};
+    // 有新任务或需要结束时通知线程
+    condition_variable m_Wakeup{};
+    // 排队的任务
+    deque<function<void()>> m_Jobs{};
+    // 已创建的线程
+    vector<thread> m_Workers{};
+    // 空闲（等待任务）的线程数
+    size_t m_IdleCount{0};
+    // 是否正在析构
+    bool m_bStopping{false};
+};
+
+/*************************************************************************
+【函数名称】Submit
+【函数功能】提交任务，返回其结果的future
+【参数】const function<Result()>& Task, 表示任务
+【返回值】future<Result>，任务的结果
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+template<class Result>
+future<Result> IOThreadPool::Submit(const function<Result()>& Task) {
+    // packaged_task不可拷贝，用shared_ptr包装后放入function
+    shared_ptr<packaged_task<Result()>> pTask
+        = make_shared<packaged_task<Result()>>(Task);
+    future<Result> Future = pTask->get_future();
+    Enqueue([pTask]() {
+        (*pTask)();
+    });
+    return Future;
+}
+
+#endif /* IOThreadPool.hpp */
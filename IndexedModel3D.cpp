@@ -0,0 +1,505 @@
+/*************************************************************************
+【文件名】IndexedModel3D.cpp
+【功能模块和目的】定义IndexedModel3D类的成员函数
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】2026/10/19 谭雯心 增加了修改线的指定端点的顶点索引
+*************************************************************************/
+// IndexedModel3D所属头文件
+#include "IndexedModel3D.hpp"
+// Model3D所属头文件
+#include "Model3D.hpp"
+// Face3D所属头文件
+#include "Face3D.hpp"
+// Line3D所属头文件
+#include "Line3D.hpp"
+// Point3D所属头文件
+#include "Point3D.hpp"
+// unordered_map, unordered_set所属头文件
+#include <unordered_map>
+#include <unordered_set>
+// vector所属头文件
+#include <vector>
+// sort, min, max所属头文件
+#include <algorithm>
+// array所属头文件
+#include <array>
+// memcpy所属头文件
+#include <cstring>
+// size_t所属头文件
+#include <cstddef>
+
+using namespace std;
+
+//-------------------------------------------------------------------------
+// 内嵌异常类
+//-------------------------------------------------------------------------
+
+/*************************************************************************
+【函数名称】VERTEX_NOT_FOUND
+【函数功能】构造函数，用于初始化VERTEX_NOT_FOUND异常类
+【参数】无
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+IndexedModel3D::VERTEX_NOT_FOUND::VERTEX_NOT_FOUND()
+    : out_of_range("Vertex index out of range") {
+    }
+/*************************************************************************
+【函数名称】FACE_NOT_FOUND
+【函数功能】构造函数，用于初始化FACE_NOT_FOUND异常类
+【参数】无
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+IndexedModel3D::FACE_NOT_FOUND::FACE_NOT_FOUND()
+    : out_of_range("Face index out of range") {
+    }
+/*************************************************************************
+【函数名称】LINE_NOT_FOUND
+【函数功能】构造函数，用于初始化LINE_NOT_FOUND异常类
+【参数】无
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+IndexedModel3D::LINE_NOT_FOUND::LINE_NOT_FOUND()
+    : out_of_range("Line index out of range") {
+    }
+
+//-------------------------------------------------------------------------
+// 非静态Setter成员函数
+//-------------------------------------------------------------------------
+
+/*************************************************************************
+【函数名称】Reserve
+【函数功能】预留顶点、面、线的存储空间，避免批量添加时反复扩容
+【参数】size_t VertexCount, size_t FaceCount, size_t LineCount，
+       分别表示顶点、面、线的预计数量
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+void IndexedModel3D::Reserve(
+    size_t VertexCount, size_t FaceCount, size_t LineCount) {
+    m_Vertices.reserve(VertexCount * 3);
+    m_FaceIndices.reserve(FaceCount * 3);
+    m_LineIndices.reserve(LineCount * 2);
+}
+/*************************************************************************
+【函数名称】AddVertex
+【函数功能】添加顶点到顶点数组末尾
+【参数】double x, double y, double z，表示顶点坐标
+【返回值】size_t，新顶点的索引
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+size_t IndexedModel3D::AddVertex(double x, double y, double z) {
+    m_Vertices.push_back(x);
+    m_Vertices.push_back(y);
+    m_Vertices.push_back(z);
+    return m_Vertices.size() / 3 - 1;
+}
+/*************************************************************************
+【函数名称】AddVertex
+【函数功能】添加顶点到顶点数组末尾
+【参数】const Point3D& APoint，表示顶点
+【返回值】size_t，新顶点的索引
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+size_t IndexedModel3D::AddVertex(const Point3D& APoint) {
+    return AddVertex(APoint.X, APoint.Y, APoint.Z);
+}
+/*************************************************************************
+【函数名称】AddFace
+【函数功能】添加面到面索引数组末尾（不检查索引范围，由调用者保证）
+【参数】size_t Index1, size_t Index2, size_t Index3，表示面的三个顶点索引
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+void IndexedModel3D::AddFace(size_t Index1, size_t Index2, size_t Index3) {
+    m_FaceIndices.push_back(Index1);
+    m_FaceIndices.push_back(Index2);
+    m_FaceIndices.push_back(Index3);
+}
+/*************************************************************************
+【函数名称】AddLine
+【函数功能】添加线到线索引数组末尾（不检查索引范围，由调用者保证）
+【参数】size_t Index1, size_t Index2，表示线的两个顶点索引
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+void IndexedModel3D::AddLine(size_t Index1, size_t Index2) {
+    m_LineIndices.push_back(Index1);
+    m_LineIndices.push_back(Index2);
+}
+/*************************************************************************
+【函数名称】SetVertex
+【函数功能】修改指定顶点的坐标
+【参数】size_t VertexIndex，表示顶点索引
+       double x, double y, double z，表示新坐标
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+void IndexedModel3D::SetVertex(
+    size_t VertexIndex, double x, double y, double z) {
+    // 若顶点索引超出范围，抛出VERTEX_NOT_FOUND异常
+    if (VertexIndex >= GetVertexCount()) {
+        throw VERTEX_NOT_FOUND();
+    }
+    m_Vertices[VertexIndex * 3] = x;
+    m_Vertices[VertexIndex * 3 + 1] = y;
+    m_Vertices[VertexIndex * 3 + 2] = z;
+}
+/*************************************************************************
+【函数名称】SetFaceVertex
+【函数功能】修改指定面的指定角点所引用的顶点
+【参数】size_t FaceIndex，表示面索引
+       size_t Corner，表示角点位置(0-2)
+       size_t VertexIndex，表示新的顶点索引
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+void IndexedModel3D::SetFaceVertex(
+    size_t FaceIndex, size_t Corner, size_t VertexIndex) {
+    // 若面索引或角点位置超出范围，抛出FACE_NOT_FOUND异常
+    if (FaceIndex >= GetFaceCount() || Corner > 2) {
+        throw FACE_NOT_FOUND();
+    }
+    // 若顶点索引超出范围，抛出VERTEX_NOT_FOUND异常
+    if (VertexIndex >= GetVertexCount()) {
+        throw VERTEX_NOT_FOUND();
+    }
+    m_FaceIndices[FaceIndex * 3 + Corner] = VertexIndex;
+}
+/*************************************************************************
+【函数名称】SetLineVertex
+【函数功能】修改指定线的指定端点所引用的顶点
+【参数】size_t LineIndex，表示线索引
+       size_t Corner，表示端点位置(0-1)
+       size_t VertexIndex，表示新的顶点索引
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+void IndexedModel3D::SetLineVertex(
+    size_t LineIndex, size_t Corner, size_t VertexIndex) {
+    // 若线索引或端点位置超出范围，抛出LINE_NOT_FOUND异常
+    if (LineIndex >= GetLineCount() || Corner > 1) {
+        throw LINE_NOT_FOUND();
+    }
+    // 若顶点索引超出范围，抛出VERTEX_NOT_FOUND异常
+    if (VertexIndex >= GetVertexCount()) {
+        throw VERTEX_NOT_FOUND();
+    }
+    m_LineIndices[LineIndex * 2 + Corner] = VertexIndex;
+}
+/*************************************************************************
+【函数名称】WeldVertices
+【函数功能】合并坐标完全相同的顶点，并重写面和线的索引，复杂度O(V + F + L)
+【参数】无
+【返回值】size_t，合并后的顶点数量
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+size_t IndexedModel3D::WeldVertices() {
+    size_t VertexCount = GetVertexCount();
+    unordered_map<VertexKeyHash::Key, size_t, VertexKeyHash> Lookup;
+    Lookup.reserve(VertexCount);
+    // Remap[i]为旧顶点i在合并后的新索引
+    vector<size_t> Remap(VertexCount);
+    size_t NewCount = 0;
+    for (size_t i = 0; i < VertexCount; i++) {
+        double x = m_Vertices[i * 3];
+        double y = m_Vertices[i * 3 + 1];
+        double z = m_Vertices[i * 3 + 2];
+        auto Result =
+            Lookup.emplace(VertexKeyHash::MakeKey(x, y, z), NewCount);
+        // 若是首次出现的坐标，则将其前移到压缩后的位置
+        if (Result.second) {
+            m_Vertices[NewCount * 3] = x;
+            m_Vertices[NewCount * 3 + 1] = y;
+            m_Vertices[NewCount * 3 + 2] = z;
+            NewCount++;
+        }
+        Remap[i] = Result.first->second;
+    }
+    m_Vertices.resize(NewCount * 3);
+    for (auto& Index : m_FaceIndices) {
+        Index = Remap[Index];
+    }
+    for (auto& Index : m_LineIndices) {
+        Index = Remap[Index];
+    }
+    return NewCount;
+}
+/*************************************************************************
+【函数名称】Clear
+【函数功能】清空模型中的顶点、面和线
+【参数】无
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+void IndexedModel3D::Clear() {
+    m_Vertices.clear();
+    m_FaceIndices.clear();
+    m_LineIndices.clear();
+}
+
+//-------------------------------------------------------------------------
+// 非静态Getter成员函数
+//-------------------------------------------------------------------------
+
+/*************************************************************************
+【函数名称】GetVertexCount
+【函数功能】获取顶点数量
+【参数】无
+【返回值】size_t，顶点数量
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+size_t IndexedModel3D::GetVertexCount() const {
+    return m_Vertices.size() / 3;
+}
+/*************************************************************************
+【函数名称】GetFaceCount
+【函数功能】获取面数量
+【参数】无
+【返回值】size_t，面数量
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+size_t IndexedModel3D::GetFaceCount() const {
+    return m_FaceIndices.size() / 3;
+}
+/*************************************************************************
+【函数名称】GetLineCount
+【函数功能】获取线数量
+【参数】无
+【返回值】size_t，线数量
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+size_t IndexedModel3D::GetLineCount() const {
+    return m_LineIndices.size() / 2;
+}
+/*************************************************************************
+【函数名称】Vertices
+【函数功能】获取顶点坐标数组
+【参数】无
+【返回值】const vector<double>&，顶点坐标数组（x, y, z交错存放）
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+const vector<double>& IndexedModel3D::Vertices() const {
+    return m_Vertices;
+}
+/*************************************************************************
+【函数名称】FaceIndices
+【函数功能】获取面索引数组
+【参数】无
+【返回值】const vector<size_t>&，面索引数组（每3个索引一个面）
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+const vector<size_t>& IndexedModel3D::FaceIndices() const {
+    return m_FaceIndices;
+}
+/*************************************************************************
+【函数名称】LineIndices
+【函数功能】获取线索引数组
+【参数】无
+【返回值】const vector<size_t>&，线索引数组（每2个索引一条线）
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+const vector<size_t>& IndexedModel3D::LineIndices() const {
+    return m_LineIndices;
+}
+/*************************************************************************
+【函数名称】GetPoint
+【函数功能】获取指定顶点的Point3D
+【参数】size_t VertexIndex，表示顶点索引
+【返回值】Point3D，顶点
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+Point3D IndexedModel3D::GetPoint(size_t VertexIndex) const {
+    // 若顶点索引超出范围，抛出VERTEX_NOT_FOUND异常
+    if (VertexIndex >= GetVertexCount()) {
+        throw VERTEX_NOT_FOUND();
+    }
+    return Point3D(m_Vertices[VertexIndex * 3],
+        m_Vertices[VertexIndex * 3 + 1],
+        m_Vertices[VertexIndex * 3 + 2]);
+}
+/*************************************************************************
+【函数名称】CanonicalVertexIndices
+【函数功能】对每个顶点求出坐标与其相同的首个顶点的索引，不修改模型本身
+【参数】无
+【返回值】vector<size_t>，第i项为与顶点i坐标相同的最小顶点索引
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+vector<size_t> IndexedModel3D::CanonicalVertexIndices() const {
+    size_t VertexCount = GetVertexCount();
+    unordered_map<VertexKeyHash::Key, size_t, VertexKeyHash> Lookup;
+    Lookup.reserve(VertexCount);
+    vector<size_t> Result(VertexCount);
+    for (size_t i = 0; i < VertexCount; i++) {
+        Result[i] = Lookup.emplace(VertexKeyHash::MakeKey(
+            m_Vertices[i * 3], m_Vertices[i * 3 + 1], m_Vertices[i * 3 + 2]),
+            i).first->second;
+    }
+    return Result;
+}
+/*************************************************************************
+【函数名称】ToModel
+【函数功能】转换为Model3D。Model3D要求面内点互不相同且面、线不重复，
+       因此跳过退化的面和线，并用哈希表在O(F + L)内去除重复的面和线
+【参数】无
+【返回值】Model3D，转换得到的模型
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+Model3D IndexedModel3D::ToModel() const {
+    vector<size_t> Canonical = CanonicalVertexIndices();
+    // 用排序后的规范顶点索引作为面、线的键（面、线的相等与点的顺序无关）
+    struct TripleHash {
+        size_t operator()(const array<size_t, 3>& Key) const {
+            size_t Seed = Key[0];
+            Seed ^= Key[1] + 0x9e3779b97f4a7c15ULL + (Seed << 6) + (Seed >> 2);
+            Seed ^= Key[2] + 0x9e3779b97f4a7c15ULL + (Seed << 6) + (Seed >> 2);
+            return Seed;
+        }
+    };
+    vector<Face3D> VFaces;
+    VFaces.reserve(GetFaceCount());
+    unordered_set<array<size_t, 3>, TripleHash> FaceKeys;
+    FaceKeys.reserve(GetFaceCount());
+    for (size_t i = 0; i < GetFaceCount(); i++) {
+        array<size_t, 3> Key{Canonical[m_FaceIndices[i * 3]],
+                             Canonical[m_FaceIndices[i * 3 + 1]],
+                             Canonical[m_FaceIndices[i * 3 + 2]]};
+        // 跳过退化面
+        if (Key[0] == Key[1] || Key[1] == Key[2] || Key[0] == Key[2]) {
+            continue;
+        }
+        array<size_t, 3> Sorted = Key;
+        sort(Sorted.begin(), Sorted.end());
+        // 跳过重复面
+        if (!FaceKeys.insert(Sorted).second) {
+            continue;
+        }
+        VFaces.push_back(Face3D(
+            GetPoint(Key[0]), GetPoint(Key[1]), GetPoint(Key[2])));
+    }
+    vector<Line3D> VLines;
+    VLines.reserve(GetLineCount());
+    unordered_set<array<size_t, 3>, TripleHash> LineKeys;
+    LineKeys.reserve(GetLineCount());
+    for (size_t i = 0; i < GetLineCount(); i++) {
+        size_t Index1 = Canonical[m_LineIndices[i * 2]];
+        size_t Index2 = Canonical[m_LineIndices[i * 2 + 1]];
+        // 跳过退化线
+        if (Index1 == Index2) {
+            continue;
+        }
+        // 跳过重复线
+        if (!LineKeys.insert({min(Index1, Index2), max(Index1, Index2), 0})
+                 .second) {
+            continue;
+        }
+        VLines.push_back(Line3D(GetPoint(Index1), GetPoint(Index2)));
+    }
+    Model3D Result(VLines, VFaces);
+    Result.Name = Name;
+    Result.Description = Description;
+    return Result;
+}
+
+//-------------------------------------------------------------------------
+// 静态成员函数
+//-------------------------------------------------------------------------
+
+/*************************************************************************
+【函数名称】FromModel
+【函数功能】由Model3D构造IndexedModel3D，面和线的顺序与原模型一致，
+       坐标相同的点合并为同一顶点
+【参数】const Model3D& AModel，表示源模型
+【返回值】IndexedModel3D，构造得到的索引模型
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+IndexedModel3D IndexedModel3D::FromModel(const Model3D& AModel) {
+    IndexedModel3D Result;
+    Result.Name = AModel.Name;
+    Result.Description = AModel.Description;
+    Result.Reserve(AModel.GetPointCount(),
+        AModel.GetFaceCount(), AModel.GetLineCount());
+    for (const auto& Face : AModel.Faces()) {
+        size_t First = Result.GetVertexCount();
+        for (size_t i = 0; i < 3; i++) {
+            Result.AddVertex(Face->Points[i]);
+        }
+        Result.AddFace(First, First + 1, First + 2);
+    }
+    for (const auto& Line : AModel.Lines()) {
+        size_t First = Result.GetVertexCount();
+        for (size_t i = 0; i < 2; i++) {
+            Result.AddVertex(Line->Points[i]);
+        }
+        Result.AddLine(First, First + 1);
+    }
+    Result.WeldVertices();
+    return Result;
+}
+
+//-------------------------------------------------------------------------
+// VertexKeyHash成员函数
+//-------------------------------------------------------------------------
+
+/*************************************************************************
+【函数名称】MakeKey
+【函数功能】由坐标生成顶点键，-0.0按0.0处理，与Point3D的==运算符保持一致
+【参数】double x, double y, double z，表示顶点坐标
+【返回值】VertexKeyHash::Key，顶点键
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+VertexKeyHash::Key VertexKeyHash::MakeKey(double x, double y, double z) {
+    Key Result;
+    double Coordinates[3] = {x, y, z};
+    for (size_t i = 0; i < 3; i++) {
+        // 加0.0将-0.0规范为+0.0
+        double Value = Coordinates[i] + 0.0;
+        memcpy(&Result.Bits[i], &Value, sizeof(double));
+    }
+    return Result;
+}
+/*************************************************************************
+【函数名称】operator()
+【函数功能】计算顶点键的哈希值
+【参数】const Key& AKey，表示顶点键
+【返回值】size_t，哈希值
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+size_t VertexKeyHash::operator()(const Key& AKey) const {
+    unsigned long long Seed = 0;
+    for (size_t i = 0; i < 3; i++) {
+        // splitmix64混合，避免整数坐标的低位聚集
+        unsigned long long Value = AKey.Bits[i] + 0x9e3779b97f4a7c15ULL + Seed;
+        Value = (Value ^ (Value >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        Value = (Value ^ (Value >> 27)) * 0x94d049bb133111ebULL;
+        Seed = Value ^ (Value >> 31);
+    }
+    return static_cast<size_t>(Seed);
+}
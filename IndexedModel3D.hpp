@@ -0,0 +1,179 @@
+/*************************************************************************
+【文件名】IndexedModel3D.hpp
+【功能模块和目的】定义IndexedModel3D类，以顶点数组+索引数组的紧凑形式表示三维模型
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】2026/10/19 谭雯心 增加了修改线的指定端点的顶点索引
+*************************************************************************/
+#ifndef INDEXEDMODEL3D_HPP
+#define INDEXEDMODEL3D_HPP
+
+// Model3D所属头文件
+#include "Model3D.hpp"
+// Point3D所属头文件
+#include "Point3D.hpp"
+// out_of_range所属头文件
+#include <stdexcept>
+// string所属头文件
+#include <string>
+// vector所属头文件
+#include <vector>
+// size_t所属头文件
+#include <cstddef>
+
+using namespace std;
+
+/*************************************************************************
+【类名】IndexedModel3D
+【功能】以连续的顶点坐标数组（x, y, z交错存放）和面、线的顶点索引数组
+       表示三维模型，作为邻接结构、简化、二进制读写等批量算法的公共输入输出
+【接口说明】
+    默认构造函数
+    拷贝构造函数
+    赋值运算符
+    虚析构函数
+    预留顶点、面、线的存储空间
+    添加顶点
+    添加面（三个顶点索引）
+    添加线（两个顶点索引）
+    修改顶点坐标
+    修改面的指定角点的顶点索引
+    修改线的指定端点的顶点索引
+    合并坐标相同的顶点
+    清空模型
+    获取顶点、面、线的数量
+    获取顶点坐标数组、面索引数组、线索引数组
+    获取指定顶点的Point3D
+    转换为Model3D（去除退化面、重复面和重复线）
+    静态：由Model3D构造（合并坐标相同的顶点）
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+class IndexedModel3D {
+public:
+    //-------------------------------------------------------------------------
+    // 内嵌异常类
+    //-------------------------------------------------------------------------
+    // 顶点索引超出范围异常类
+    class VERTEX_NOT_FOUND : public out_of_range {
+    public:
+        VERTEX_NOT_FOUND();
+    };
+    // 面索引超出范围异常类
+    class FACE_NOT_FOUND : public out_of_range {
+    public:
+        FACE_NOT_FOUND();
+    };
+    // 线索引超出范围异常类
+    class LINE_NOT_FOUND : public out_of_range {
+    public:
+        LINE_NOT_FOUND();
+    };
+    //-------------------------------------------------------------------------
+    // 必要的构造、析构、拷贝、赋值运算符重载函数
+    //-------------------------------------------------------------------------
+    // 默认构造函数
+    IndexedModel3D() = default;
+    // 拷贝构造函数
+    IndexedModel3D(const IndexedModel3D& Source) = default;
+    // 赋值运算符
+    IndexedModel3D& operator=(const IndexedModel3D& Source) = default;
+    // 移动构造函数（大模型避免深拷贝）
+    IndexedModel3D(IndexedModel3D&& Source) = default;
+    // 移动赋值运算符
+    IndexedModel3D& operator=(IndexedModel3D&& Source) = default;
+    // 虚析构函数
+    virtual ~IndexedModel3D() = default;
+    //-------------------------------------------------------------------------
+    // 非静态Setter成员函数
+    //-------------------------------------------------------------------------
+    // 预留顶点、面、线的存储空间
+    void Reserve(size_t VertexCount, size_t FaceCount, size_t LineCount);
+    // 添加顶点，返回顶点索引
+    size_t AddVertex(double x, double y, double z);
+    // 添加顶点，返回顶点索引
+    size_t AddVertex(const Point3D& APoint);
+    // 添加面
+    void AddFace(size_t Index1, size_t Index2, size_t Index3);
+    // 添加线
+    void AddLine(size_t Index1, size_t Index2);
+    // 修改顶点坐标
+    void SetVertex(size_t VertexIndex, double x, double y, double z);
+    // 修改面的指定角点的顶点索引
+    void SetFaceVertex(size_t FaceIndex, size_t Corner, size_t VertexIndex);
+    // 修改线的指定端点的顶点索引
+    void SetLineVertex(size_t LineIndex, size_t Corner, size_t VertexIndex);
+    // 合并坐标相同的顶点，返回合并后的顶点数
+    size_t WeldVertices();
+    // 清空模型
+    void Clear();
+    //-------------------------------------------------------------------------
+    // 非静态Getter成员函数
+    //-------------------------------------------------------------------------
+    // 获取顶点数量
+    size_t GetVertexCount() const;
+    // 获取面数量
+    size_t GetFaceCount() const;
+    // 获取线数量
+    size_t GetLineCount() const;
+    // 获取顶点坐标数组（x, y, z交错存放）
+    const vector<double>& Vertices() const;
+    // 获取面索引数组（每3个索引一个面）
+    const vector<size_t>& FaceIndices() const;
+    // 获取线索引数组（每2个索引一条线）
+    const vector<size_t>& LineIndices() const;
+    // 获取指定顶点的Point3D
+    Point3D GetPoint(size_t VertexIndex) const;
+    // 获取每个顶点对应的首个坐标相同顶点的索引
+    vector<size_t> CanonicalVertexIndices() const;
+    // 转换为Model3D
+    Model3D ToModel() const;
+    //-------------------------------------------------------------------------
+    // 静态成员函数
+    //-------------------------------------------------------------------------
+    // 由Model3D构造
+    static IndexedModel3D FromModel(const Model3D& AModel);
+    // ------------------------------------------------------------------------
+    // 公有数据成员
+    // ------------------------------------------------------------------------
+    // 模型名称
+    string Name{string("EMPTY")};
+    // 模型注释
+    string Description{string("EMPTY")};
+
+private:
+    //-------------------------------------------------------------------------
+    // 私有非静态成员
+    //-------------------------------------------------------------------------
+    // 顶点坐标数组
+    vector<double> m_Vertices{};
+    // 面索引数组
+    vector<size_t> m_FaceIndices{};
+    // 线索引数组
+    vector<size_t> m_LineIndices{};
+};
+
+/*************************************************************************
+【类名】VertexKeyHash
+【功能】按坐标的位模式计算顶点哈希值，用于顶点去重（-0.0与0.0视为相同）
+【接口说明】
+    静态：由坐标生成键
+    计算键的哈希值
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+struct VertexKeyHash {
+    // 顶点键类型，存储三个坐标的位模式
+    struct Key {
+        unsigned long long Bits[3];
+        bool operator==(const Key& AKey) const {
+            return Bits[0] == AKey.Bits[0] && Bits[1] == AKey.Bits[1]
+                && Bits[2] == AKey.Bits[2];
+        }
+    };
+    // 由坐标生成键
+    static Key MakeKey(double x, double y, double z);
+    // 计算键的哈希值
+    size_t operator()(const Key& AKey) const;
+};
+
+#endif /* IndexedModel3D.hpp */
@@ -0,0 +1,464 @@
+/*************************************************************************
+【文件名】Instrumentation.cpp
+【功能模块和目的】定义Instrumentation类的成员函数
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+// Instrumentation所属头文件
+#include "Instrumentation.hpp"
+// atomic所属头文件
+#include <atomic>
+// ostream所属头文件
+#include <iostream>
+// mutex, lock_guard所属头文件
+#include <mutex>
+// set所属头文件
+#include <set>
+// length_error所属头文件
+#include <stdexcept>
+// string所属头文件
+#include <string>
+// unordered_map所属头文件
+#include <unordered_map>
+// vector所属头文件
+#include <vector>
+// uint64_t, UINT64_MAX所属头文件
+#include <cstdint>
+// size_t所属头文件
+#include <cstddef>
+
+using namespace std;
+
+namespace {
+    // 是否开启
+    atomic<bool> g_Enabled{false};
+
+    /*************************************************************************
+    【类名】Slot
+    【功能】一个线程中一个探针的累加值。只有所属线程写入，写入用relaxed的
+           读后写而不是读改写指令；汇总线程用relaxed读取，读到的是某一时刻
+           各字段各自的值
+    【开发者及日期】谭雯心 2026/10/19
+    【更改记录】
+    *************************************************************************/
+    struct Slot {
+        atomic<uint64_t> Calls{0};
+        atomic<uint64_t> Nanoseconds{0};
+        atomic<uint64_t> Min{UINT64_MAX};
+        atomic<uint64_t> Max{0};
+        atomic<uint64_t> Items{0};
+    };
+
+    /*************************************************************************
+    【函数名称】Increase
+    【函数功能】所属线程累加一个字段
+    【参数】atomic<uint64_t>& Field, 表示字段
+           uint64_t Value, 表示增量
+    【返回值】无
+    【开发者及日期】谭雯心 2026/10/19
+    【更改记录】
+    *************************************************************************/
+    void Increase(atomic<uint64_t>& Field, uint64_t Value) {
+        Field.store(Field.load(memory_order_relaxed) + Value,
+            memory_order_relaxed);
+    }
+
+    struct ThreadTable;
+
+    /*************************************************************************
+    【类名】Registry
+    【功能】全局登记表：探针名称、在世线程的累加表和已退出线程的累加结果，
+           均由Mutex保护
+    【开发者及日期】谭雯心 2026/10/19
+    【更改记录】
+    *************************************************************************/
+    struct Registry {
+        mutex Mutex;
+        vector<string> Names;
+        unordered_map<string, size_t> Ids;
+        set<ThreadTable*> Tables;
+        vector<Instrumentation::Record> Retired{Instrumentation::MAX_PROBES};
+    };
+
+    /*************************************************************************
+    【函数名称】GetRegistry
+    【函数功能】获取全局登记表（首次使用时构造，避免静态初始化顺序问题）
+    【参数】无
+    【返回值】Registry&，全局登记表
+    【开发者及日期】谭雯心 2026/10/19
+    【更改记录】
+    *************************************************************************/
+    Registry& GetRegistry() {
+        static Registry TheRegistry;
+        return TheRegistry;
+    }
+
+    /*************************************************************************
+    【函数名称】Accumulate
+    【函数功能】把一组累加值合并到汇总结果
+    【参数】Instrumentation::Record& Target, 表示汇总结果
+           uint64_t Calls, Nanoseconds, Min, Max, Items, 表示累加值
+    【返回值】无
+    【开发者及日期】谭雯心 2026/10/19
+    【更改记录】
+    *************************************************************************/
+    void Accumulate(Instrumentation::Record& Target, uint64_t Calls,
+        uint64_t Nanoseconds, uint64_t Min, uint64_t Max, uint64_t Items) {
+        if (Calls > 0) {
+            Target.MinNanoseconds = Target.Calls == 0
+                ? Min : (Min < Target.MinNanoseconds
+                    ? Min : Target.MinNanoseconds);
+            Target.MaxNanoseconds = Max > Target.MaxNanoseconds
+                ? Max : Target.MaxNanoseconds;
+        }
+        Target.Calls += Calls;
+        Target.TotalNanoseconds += Nanoseconds;
+        Target.Items += Items;
+    }
+
+    /*************************************************************************
+    【类名】ThreadTable
+    【功能】一个线程的累加表，线程首次记录时构造并登记，
+           线程退出时把累加值并入已退出线程的结果并注销
+    【开发者及日期】谭雯心 2026/10/19
+    【更改记录】
+    *************************************************************************/
+    struct ThreadTable {
+        Slot Slots[Instrumentation::MAX_PROBES];
+        ThreadTable() {
+            Registry& TheRegistry = GetRegistry();
+            lock_guard<mutex> Lock(TheRegistry.Mutex);
+            TheRegistry.Tables.insert(this);
+        }
+        ~ThreadTable() {
+            Registry& TheRegistry = GetRegistry();
+            lock_guard<mutex> Lock(TheRegistry.Mutex);
+            for (size_t i = 0; i < Instrumentation::MAX_PROBES; i++) {
+                const Slot& ASlot = Slots[i];
+                Accumulate(TheRegistry.Retired[i], ASlot.Calls.load(),
+                    ASlot.Nanoseconds.load(), ASlot.Min.load(),
+                    ASlot.Max.load(), ASlot.Items.load());
+            }
+            TheRegistry.Tables.erase(this);
+        }
+    };
+
+    /*************************************************************************
+    【函数名称】LocalTable
+    【函数功能】获取当前线程的累加表
+    【参数】无
+    【返回值】ThreadTable&，当前线程的累加表
+    【开发者及日期】谭雯心 2026/10/19
+    【更改记录】
+    *************************************************************************/
+    ThreadTable& LocalTable() {
+        thread_local ThreadTable Table;
+        return Table;
+    }
+
+    /*************************************************************************
+    【函数名称】SnapshotLocked
+    【函数功能】在已持有登记表锁时汇总全部已注册探针
+    【参数】Registry& TheRegistry, 表示登记表
+    【返回值】Instrumentation::RecordList，按注册顺序排列的汇总结果
+    【开发者及日期】谭雯心 2026/10/19
+    【更改记录】
+    *************************************************************************/
+    Instrumentation::RecordList SnapshotLocked(Registry& TheRegistry) {
+        Instrumentation::RecordList Records;
+        for (size_t i = 0; i < TheRegistry.Names.size(); i++) {
+            Instrumentation::Record ARecord = TheRegistry.Retired[i];
+            ARecord.Name = TheRegistry.Names[i];
+            for (ThreadTable* pTable : TheRegistry.Tables) {
+                const Slot& ASlot = pTable->Slots[i];
+                Accumulate(ARecord, ASlot.Calls.load(memory_order_relaxed),
+                    ASlot.Nanoseconds.load(memory_order_relaxed),
+                    ASlot.Min.load(memory_order_relaxed),
+                    ASlot.Max.load(memory_order_relaxed),
+                    ASlot.Items.load(memory_order_relaxed));
+            }
+            Records.push_back(ARecord);
+        }
+        return Records;
+    }
+
+    /*************************************************************************
+    【函数名称】JsonString
+    【函数功能】把字符串转换为带引号的JSON字符串
+    【参数】const string& Text, 表示字符串
+    【返回值】string，JSON字符串
+    【开发者及日期】谭雯心 2026/10/19
+    【更改记录】
+    *************************************************************************/
+    string JsonString(const string& Text) {
+        string Result = "\"";
+        for (char c : Text) {
+            if (c == '"' || c == '\\') {
+                Result += '\\';
+                Result += c;
+            }
+            else if (static_cast<unsigned char>(c) < 0x20) {
+                const char* HEX = "0123456789abcdef";
+                Result += "\\u00";
+                Result += HEX[(c >> 4) & 0xf];
+                Result += HEX[c & 0xf];
+            }
+            else {
+                Result += c;
+            }
+        }
+        return Result + "\"";
+    }
+
+    /*************************************************************************
+    【函数名称】CsvString
+    【函数功能】把字符串转换为CSV字段，含逗号、引号或换行时加引号
+    【参数】const string& Text, 表示字符串
+    【返回值】string，CSV字段
+    【开发者及日期】谭雯心 2026/10/19
+    【更改记录】
+    *************************************************************************/
+    string CsvString(const string& Text) {
+        if (Text.find_first_of(",\"\n") == string::npos) {
+            return Text;
+        }
+        string Result = "\"";
+        for (char c : Text) {
+            if (c == '"') {
+                Result += '"';
+            }
+            Result += c;
+        }
+        return Result + "\"";
+    }
+}
+
+//-------------------------------------------------------------------------
+// 内嵌异常类
+//-------------------------------------------------------------------------
+
+/*************************************************************************
+【函数名称】TOO_MANY_PROBES
+【函数功能】内嵌异常类构造函数，若注册的探针超过最大探针数，则抛出该异常
+【参数】无
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+Instrumentation::TOO_MANY_PROBES::TOO_MANY_PROBES()
+    : length_error("Too many instrumentation probes") {
+}
+
+//-------------------------------------------------------------------------
+// 静态常量
+//-------------------------------------------------------------------------
+
+// 最大探针数
+constexpr size_t Instrumentation::MAX_PROBES;
+
+//-------------------------------------------------------------------------
+// 静态成员函数
+//-------------------------------------------------------------------------
+
+/*************************************************************************
+【函数名称】SetEnabled
+【函数功能】开启或关闭
+【参数】bool Enabled, 表示是否开启
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+void Instrumentation::SetEnabled(bool Enabled) {
+    g_Enabled.store(Enabled, memory_order_relaxed);
+}
+/*************************************************************************
+【函数名称】IsEnabled
+【函数功能】是否开启
+【参数】无
+【返回值】bool，是否开启
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+bool Instrumentation::IsEnabled() {
+    return g_Enabled.load(memory_order_relaxed);
+}
+/*************************************************************************
+【函数名称】RegisterProbe
+【函数功能】注册探针，同名探针返回同一编号。通常在探针点所在源文件的
+       匿名命名空间中注册一次并保存编号
+【参数】const string& Name, 表示探针名称
+【返回值】size_t，探针编号
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+size_t Instrumentation::RegisterProbe(const string& Name) {
+    Registry& TheRegistry = GetRegistry();
+    lock_guard<mutex> Lock(TheRegistry.Mutex);
+    auto Found = TheRegistry.Ids.find(Name);
+    if (Found != TheRegistry.Ids.end()) {
+        return Found->second;
+    }
+    if (TheRegistry.Names.size() >= MAX_PROBES) {
+        throw TOO_MANY_PROBES();
+    }
+    size_t Probe = TheRegistry.Names.size();
+    TheRegistry.Names.push_back(Name);
+    TheRegistry.Ids.emplace(Name, Probe);
+    return Probe;
+}
+/*************************************************************************
+【函数名称】GetProbeName
+【函数功能】获取探针名称
+【参数】size_t Probe, 表示探针编号
+【返回值】string，探针名称，编号未注册时为空字符串
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+string Instrumentation::GetProbeName(size_t Probe) {
+    Registry& TheRegistry = GetRegistry();
+    lock_guard<mutex> Lock(TheRegistry.Mutex);
+    return Probe < TheRegistry.Names.size() ? TheRegistry.Names[Probe] : "";
+}
+/*************************************************************************
+【函数名称】AddSample
+【函数功能】把一次耗时记入当前线程的累加表（不加锁）
+【参数】size_t Probe, 表示探针编号
+       uint64_t Nanoseconds, 表示耗时（纳秒）
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+void Instrumentation::AddSample(size_t Probe, uint64_t Nanoseconds) {
+    if (Probe >= MAX_PROBES) {
+        return;
+    }
+    Slot& ASlot = LocalTable().Slots[Probe];
+    Increase(ASlot.Calls, 1);
+    Increase(ASlot.Nanoseconds, Nanoseconds);
+    if (Nanoseconds < ASlot.Min.load(memory_order_relaxed)) {
+        ASlot.Min.store(Nanoseconds, memory_order_relaxed);
+    }
+    if (Nanoseconds > ASlot.Max.load(memory_order_relaxed)) {
+        ASlot.Max.store(Nanoseconds, memory_order_relaxed);
+    }
+}
+/*************************************************************************
+【函数名称】Count
+【函数功能】开启时把处理量记入当前线程的累加表（不加锁）
+【参数】size_t Probe, 表示探针编号
+       uint64_t Items, 表示处理量
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+void Instrumentation::Count(size_t Probe, uint64_t Items) {
+    if (!IsEnabled() || Probe >= MAX_PROBES) {
+        return;
+    }
+    Increase(LocalTable().Slots[Probe].Items, Items);
+}
+/*************************************************************************
+【函数名称】Snapshot
+【函数功能】汇总全部已注册探针在所有线程中的累加值
+【参数】无
+【返回值】RecordList，按注册顺序排列的汇总结果
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+Instrumentation::RecordList Instrumentation::Snapshot() {
+    Registry& TheRegistry = GetRegistry();
+    lock_guard<mutex> Lock(TheRegistry.Mutex);
+    return SnapshotLocked(TheRegistry);
+}
+/*************************************************************************
+【函数名称】Query
+【函数功能】按名称查询一个探针的汇总结果
+【参数】const string& Name, 表示探针名称
+       Record& ARecord, 用于存储汇总结果
+【返回值】bool，探针是否已注册
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+bool Instrumentation::Query(const string& Name, Record& ARecord) {
+    RecordList Records = Snapshot();
+    for (const Record& Candidate : Records) {
+        if (Candidate.Name == Name) {
+            ARecord = Candidate;
+            return true;
+        }
+    }
+    return false;
+}
+/*************************************************************************
+【函数名称】Reset
+【函数功能】清零全部探针。其他线程正在记录的样本可能在清零后才写入
+【参数】无
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+void Instrumentation::Reset() {
+    Registry& TheRegistry = GetRegistry();
+    lock_guard<mutex> Lock(TheRegistry.Mutex);
+    for (Record& ARecord : TheRegistry.Retired) {
+        ARecord = Record();
+    }
+    for (ThreadTable* pTable : TheRegistry.Tables) {
+        for (Slot& ASlot : pTable->Slots) {
+            ASlot.Calls.store(0, memory_order_relaxed);
+            ASlot.Nanoseconds.store(0, memory_order_relaxed);
+            ASlot.Min.store(UINT64_MAX, memory_order_relaxed);
+            ASlot.Max.store(0, memory_order_relaxed);
+            ASlot.Items.store(0, memory_order_relaxed);
+        }
+    }
+}
+/*************************************************************************
+【函数名称】WriteJson
+【函数功能】以JSON格式导出全部探针的汇总结果
+【参数】ostream& Stream, 表示输出流
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+void Instrumentation::WriteJson(ostream& Stream) {
+    RecordList Records = Snapshot();
+    Stream << "{\n";
+    Stream << "  \"enabled\": " << (IsEnabled() ? "true" : "false") << ",\n";
+    Stream << "  \"probes\": [";
+    for (size_t i = 0; i < Records.size(); i++) {
+        const Record& ARecord = Records[i];
+        Stream << (i == 0 ? "\n" : ",\n");
+        Stream << "    {\n";
+        Stream << "      \"name\": " << JsonString(ARecord.Name) << ",\n";
+        Stream << "      \"calls\": " << ARecord.Calls << ",\n";
+        Stream << "      \"total_ns\": " << ARecord.TotalNanoseconds << ",\n";
+        Stream << "      \"mean_ns\": " << (ARecord.Calls == 0
+            ? 0 : ARecord.TotalNanoseconds / ARecord.Calls) << ",\n";
+        Stream << "      \"min_ns\": " << ARecord.MinNanoseconds << ",\n";
+        Stream << "      \"max_ns\": " << ARecord.MaxNanoseconds << ",\n";
+        Stream << "      \"items\": " << ARecord.Items << "\n";
+        Stream << "    }";
+    }
+    Stream << "\n  ]\n}\n";
+}
+/*************************************************************************
+【函数名称】WriteCsv
+【函数功能】以CSV格式导出全部探针的汇总结果，首行为表头
+【参数】ostream& Stream, 表示输出流
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+void Instrumentation::WriteCsv(ostream& Stream) {
+    RecordList Records = Snapshot();
+    Stream << "name,calls,total_ns,mean_ns,min_ns,max_ns,items\n";
+    for (const Record& ARecord : Records) {
+        Stream << CsvString(ARecord.Name) << ',' << ARecord.Calls << ','
+            << ARecord.TotalNanoseconds << ','
+            << (ARecord.Calls == 0
+                ? 0 : ARecord.TotalNanoseconds / ARecord.Calls) << ','
+            << ARecord.MinNanoseconds << ',' << ARecord.MaxNanoseconds << ','
+            << ARecord.Items << '\n';
+    }
+}
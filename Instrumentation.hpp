@@ -0,0 +1,112 @@
+/*************************************************************************
+【文件名】Instrumentation.hpp
+【功能模块和目的】定义Instrumentation类，按探针累计热点操作的调用次数、耗时和处理量
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+#ifndef INSTRUMENTATION_HPP
+#define INSTRUMENTATION_HPP
+
+// ostream所属头文件
+#include <iostream>
+// length_error所属头文件
+#include <stdexcept>
+// string所属头文件
+#include <string>
+// vector所属头文件
+#include <vector>
+// uint64_t所属头文件
+#include <cstdint>
+// size_t所属头文件
+#include <cstddef>
+
+using namespace std;
+
+/*************************************************************************
+【类名】Instrumentation
+【功能】进程内的计时与计数设施。每个被观测的操作注册为一个探针（按名称去重，
+       得到从0开始的编号），ScopedTimer和Count把样本写入当前线程私有的
+       累加表，写入时不加锁；查询和导出时在锁内汇总所有线程的累加表
+       以及已退出线程留下的结果。
+       默认关闭，关闭时每个探针点只读取一次原子标志，不读时钟也不写内存
+【接口说明】
+    内嵌异常类TOO_MANY_PROBES
+    内嵌结构体Record，表示一个探针的汇总结果
+    静态常量：最大探针数
+    禁止构造
+    静态：开启或关闭、是否开启
+    静态：注册探针、获取探针名称
+    静态：记录一次耗时、累加处理量
+    静态：汇总全部探针、按名称查询一个探针
+    静态：清零
+    静态：以JSON或CSV格式导出
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+class Instrumentation {
+public:
+    //-------------------------------------------------------------------------
+    // 内嵌异常类
+    //-------------------------------------------------------------------------
+    // 若注册的探针超过最大探针数，则抛出该异常
+    class TOO_MANY_PROBES : public length_error {
+    public:
+        TOO_MANY_PROBES();
+    };
+    //-------------------------------------------------------------------------
+    // 公有的内嵌类，用于存储数据
+    //-------------------------------------------------------------------------
+    // 一个探针的汇总结果
+    struct Record {
+        // 探针名称
+        string Name;
+        // 计时次数
+        uint64_t Calls{0};
+        // 总耗时（纳秒）
+        uint64_t TotalNanoseconds{0};
+        // 单次最短耗时（纳秒），没有计时时为0
+        uint64_t MinNanoseconds{0};
+        // 单次最长耗时（纳秒）
+        uint64_t MaxNanoseconds{0};
+        // 累计处理量（面数、线数等，由探针点决定含义）
+        uint64_t Items{0};
+    };
+    using RecordList = vector<Record>;
+    //-------------------------------------------------------------------------
+    // 静态常量
+    //-------------------------------------------------------------------------
+    // 最大探针数（每个线程的累加表按此预先分配）
+    static constexpr size_t MAX_PROBES{128};
+    //-------------------------------------------------------------------------
+    // 必要的构造、析构、拷贝、赋值运算符重载函数
+    //-------------------------------------------------------------------------
+    // 禁止构造
+    Instrumentation() = delete;
+    //-------------------------------------------------------------------------
+    // 静态成员函数
+    //-------------------------------------------------------------------------
+    // 开启或关闭
+    static void SetEnabled(bool Enabled);
+    // 是否开启
+    static bool IsEnabled();
+    // 注册探针（同名探针返回同一编号）
+    static size_t RegisterProbe(const string& Name);
+    // 获取探针名称
+    static string GetProbeName(size_t Probe);
+    // 记录一次耗时
+    static void AddSample(size_t Probe, uint64_t Nanoseconds);
+    // 累加处理量（关闭时不记录）
+    static void Count(size_t Probe, uint64_t Items = 1);
+    // 汇总全部已注册探针
+    static RecordList Snapshot();
+    // 按名称查询一个探针，未注册时返回false
+    static bool Query(const string& Name, Record& ARecord);
+    // 清零全部探针（不注销探针）
+    static void Reset();
+    // 以JSON格式导出
+    static void WriteJson(ostream& Stream);
+    // 以CSV格式导出
+    static void WriteCsv(ostream& Stream);
+};
+
+#endif /* Instrumentation.hpp */
@@ -0,0 +1,412 @@
+/*************************************************************************
+【文件名】LODChain.cpp
+【功能模块和目的】定义LODChain类的成员函数
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+// LODChain所属头文件
+#include "LODChain.hpp"
+// IndexedModel3D所属头文件
+#include "IndexedModel3D.hpp"
+// MeshSimplifier所属头文件
+#include "MeshSimplifier.hpp"
+// ifstream, ofstream所属头文件
+#include <fstream>
+// string所属头文件
+#include <string>
+// vector所属头文件
+#include <vector>
+// max所属头文件
+#include <algorithm>
+// sqrt, tan所属头文件
+#include <cmath>
+// uint64_t所属头文件
+#include <cstdint>
+// memcmp所属头文件
+#include <cstring>
+// size_t所属头文件
+#include <cstddef>
+
+using namespace std;
+
+namespace {
+
+// LOD文件的魔数（含格式版本）
+const char LOD_MAGIC[8] = {'M', '3', 'D', 'L', 'O', 'D', '0', '1'};
+// 生成下一级时面数至少应减少的比例，否则认为无法继续简化
+constexpr double MIN_REDUCTION{0.9};
+// 最粗糙级别的最少面数
+constexpr size_t MIN_FACE_COUNT{8};
+
+/*************************************************************************
+【函数名称】WriteValue
+【函数功能】以二进制形式写入一个定长值
+【参数】ofstream& Stream, 表示输出流
+       const T& Value, 表示要写入的值
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+template <typename T>
+void WriteValue(ofstream& Stream, const T& Value) {
+    Stream.write(reinterpret_cast<const char*>(&Value), sizeof(T));
+}
+/*************************************************************************
+【函数名称】ReadValue
+【函数功能】以二进制形式读取一个定长值
+【参数】ifstream& Stream, 表示输入流
+【返回值】T，读取的值（流出错时由调用者检查流状态）
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+template <typename T>
+T ReadValue(ifstream& Stream) {
+    T Value{};
+    Stream.read(reinterpret_cast<char*>(&Value), sizeof(T));
+    return Value;
+}
+/*************************************************************************
+【函数名称】WriteString
+【函数功能】写入长度前缀的字符串
+【参数】ofstream& Stream, 表示输出流
+       const string& Text, 表示要写入的字符串
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+void WriteString(ofstream& Stream, const string& Text) {
+    WriteValue<uint64_t>(Stream, Text.size());
+    Stream.write(Text.data(), Text.size());
+}
+/*************************************************************************
+【函数名称】ReadString
+【函数功能】读取长度前缀的字符串
+【参数】ifstream& Stream, 表示输入流
+【返回值】string，读取的字符串
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+string ReadString(ifstream& Stream) {
+    uint64_t Length = ReadValue<uint64_t>(Stream);
+    string Text;
+    if (Stream) {
+        Text.resize(Length);
+        Stream.read(&Text[0], Length);
+    }
+    return Text;
+}
+
+} // namespace
+
+//-------------------------------------------------------------------------
+// 内嵌异常类
+//-------------------------------------------------------------------------
+
+/*************************************************************************
+【函数名称】FILE_NOT_AVAILABLE
+【函数功能】构造函数，用于初始化FILE_NOT_AVAILABLE异常类
+【参数】const string& FileName, 表示文件名
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+LODChain::FILE_NOT_AVAILABLE::FILE_NOT_AVAILABLE(const string& FileName)
+    : invalid_argument(string("File ") + FileName + string(" not opened.")) {
+}
+/*************************************************************************
+【函数名称】FILE_FORMAT_ERROR
+【函数功能】构造函数，用于初始化FILE_FORMAT_ERROR异常类
+【参数】const string& FileName, 表示文件名
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+LODChain::FILE_FORMAT_ERROR::FILE_FORMAT_ERROR(const string& FileName)
+    : invalid_argument(string("File ") + FileName
+        + string(" is not a valid LOD file.")) {
+}
+/*************************************************************************
+【函数名称】LEVEL_NOT_FOUND
+【函数功能】构造函数，用于初始化LEVEL_NOT_FOUND异常类
+【参数】无
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+LODChain::LEVEL_NOT_FOUND::LEVEL_NOT_FOUND()
+    : out_of_range("LOD level out of range") {
+}
+
+//-------------------------------------------------------------------------
+// 必要的构造、析构、拷贝、赋值运算符重载函数
+//-------------------------------------------------------------------------
+
+/*************************************************************************
+【函数名称】LODChain
+【函数功能】带参构造函数，由原模型逐级简化生成LOD链。每一级由上一级简化得到，
+       总代价约为原模型简化一次的两倍；面数无法继续明显减少时提前结束
+【参数】const IndexedModel3D& AModel, 表示原模型
+       size_t LevelCount, 表示最多生成的级数（含原模型）
+       double Ratio, 表示相邻两级的目标面数之比
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+LODChain::LODChain(const IndexedModel3D& AModel, size_t LevelCount,
+                   double Ratio) {
+    m_Levels.push_back(AModel);
+    m_Errors.push_back(0);
+    MeshSimplifier Simplifier;
+    while (m_Levels.size() < LevelCount) {
+        size_t FaceCount = m_Levels.back().GetFaceCount();
+        size_t Target = static_cast<size_t>(FaceCount * Ratio);
+        if (Target < MIN_FACE_COUNT) {
+            break;
+        }
+        Simplifier.SetTargetFaceCount(Target);
+        IndexedModel3D Coarse = Simplifier.Simplify(m_Levels.back());
+        if (Coarse.GetFaceCount() > FaceCount * MIN_REDUCTION) {
+            break;
+        }
+        // 二次误差为距离的平方和，开方后作为该级的几何误差估计，并保证单调
+        m_Errors.push_back(max(m_Errors.back(),
+            sqrt(Simplifier.GetLastError())));
+        m_Levels.push_back(move(Coarse));
+    }
+}
+
+//-------------------------------------------------------------------------
+// 非静态Getter成员函数
+//-------------------------------------------------------------------------
+
+/*************************************************************************
+【函数名称】SaveToFile
+【函数功能】将LOD链以二进制形式写入文件。格式为魔数、模型名称和注释、级数，
+       随后每级依次为几何误差、顶点数、面数、线数、顶点坐标、面索引、线索引
+【参数】const string& FileName, 表示文件名
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+void LODChain::SaveToFile(const string& FileName) const {
+    ofstream Stream(FileName, ios::binary);
+    if (!Stream.is_open()) {
+        throw FILE_NOT_AVAILABLE(FileName);
+    }
+    Stream.write(LOD_MAGIC, sizeof(LOD_MAGIC));
+    WriteString(Stream, m_Levels.empty() ? string() : m_Levels[0].Name);
+    WriteString(Stream,
+        m_Levels.empty() ? string() : m_Levels[0].Description);
+    WriteValue<uint64_t>(Stream, m_Levels.size());
+    for (size_t i = 0; i < m_Levels.size(); i++) {
+        const IndexedModel3D& Model = m_Levels[i];
+        WriteValue<double>(Stream, m_Errors[i]);
+        WriteValue<uint64_t>(Stream, Model.GetVertexCount());
+        WriteValue<uint64_t>(Stream, Model.GetFaceCount());
+        WriteValue<uint64_t>(Stream, Model.GetLineCount());
+        Stream.write(reinterpret_cast<const char*>(Model.Vertices().data()),
+            Model.Vertices().size() * sizeof(double));
+        for (size_t Index : Model.FaceIndices()) {
+            WriteValue<uint64_t>(Stream, Index);
+        }
+        for (size_t Index : Model.LineIndices()) {
+            WriteValue<uint64_t>(Stream, Index);
+        }
+    }
+    if (!Stream) {
+        throw FILE_NOT_AVAILABLE(FileName);
+    }
+}
+/*************************************************************************
+【函数名称】GetLevelCount
+【函数功能】获取级数
+【参数】无
+【返回值】size_t，级数（含原模型，空链为0）
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+size_t LODChain::GetLevelCount() const {
+    return m_Levels.size();
+}
+/*************************************************************************
+【函数名称】Level
+【函数功能】获取指定级别的模型
+【参数】size_t LevelIndex, 表示级别
+【返回值】const IndexedModel3D&，该级别的模型
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+const IndexedModel3D& LODChain::Level(size_t LevelIndex) const {
+    CheckLevel(LevelIndex);
+    return m_Levels[LevelIndex];
+}
+/*************************************************************************
+【函数名称】GetLevelError
+【函数功能】获取指定级别相对原模型的几何误差
+【参数】size_t LevelIndex, 表示级别
+【返回值】double，几何误差（模型坐标单位）
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+double LODChain::GetLevelError(size_t LevelIndex) const {
+    CheckLevel(LevelIndex);
+    return m_Errors[LevelIndex];
+}
+/*************************************************************************
+【函数名称】GetLevelFaceCount
+【函数功能】获取指定级别的面数
+【参数】size_t LevelIndex, 表示级别
+【返回值】size_t，面数
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+size_t LODChain::GetLevelFaceCount(size_t LevelIndex) const {
+    CheckLevel(LevelIndex);
+    return m_Levels[LevelIndex].GetFaceCount();
+}
+/*************************************************************************
+【函数名称】SelectByFaceBudget
+【函数功能】按面数预算选取级别
+【参数】size_t FaceBudget, 表示面数预算
+【返回值】size_t，面数不超过预算的最精细级别；若均超过预算则返回最粗糙级别
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+size_t LODChain::SelectByFaceBudget(size_t FaceBudget) const {
+    CheckLevel(0);
+    for (size_t i = 0; i < m_Levels.size(); i++) {
+        if (m_Levels[i].GetFaceCount() <= FaceBudget) {
+            return i;
+        }
+    }
+    return m_Levels.size() - 1;
+}
+/*************************************************************************
+【函数名称】SelectByScreenError
+【函数功能】按屏幕空间误差选取级别。几何误差e在距离d处投影到屏幕上的像素数为
+       e * ViewportHeight / (2 * d * tan(FieldOfView / 2))
+【参数】double Distance, 表示模型到相机的距离
+       double FieldOfView, 表示竖直视场角（弧度）
+       double ViewportHeight, 表示视口高度（像素）
+       double PixelError, 表示允许的最大屏幕误差（像素）
+【返回值】size_t，投影误差不超过允许值的最粗糙级别
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+size_t LODChain::SelectByScreenError(double Distance, double FieldOfView,
+                                     double ViewportHeight,
+                                     double PixelError) const {
+    CheckLevel(0);
+    if (Distance <= 0) {
+        return 0;
+    }
+    double PixelsPerUnit = ViewportHeight
+        / (2 * Distance * tan(FieldOfView / 2));
+    size_t Result = 0;
+    for (size_t i = 1; i < m_Levels.size(); i++) {
+        if (m_Errors[i] * PixelsPerUnit > PixelError) {
+            break;
+        }
+        Result = i;
+    }
+    return Result;
+}
+
+//-------------------------------------------------------------------------
+// 静态成员函数
+//-------------------------------------------------------------------------
+
+/*************************************************************************
+【函数名称】LoadFromFile
+【函数功能】从SaveToFile写入的文件读取LOD链
+【参数】const string& FileName, 表示文件名
+【返回值】LODChain，读取的LOD链
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+LODChain LODChain::LoadFromFile(const string& FileName) {
+    ifstream Stream(FileName, ios::binary);
+    if (!Stream.is_open()) {
+        throw FILE_NOT_AVAILABLE(FileName);
+    }
+    char Magic[sizeof(LOD_MAGIC)];
+    Stream.read(Magic, sizeof(Magic));
+    if (!Stream || memcmp(Magic, LOD_MAGIC, sizeof(LOD_MAGIC)) != 0) {
+        throw FILE_FORMAT_ERROR(FileName);
+    }
+    string Name = ReadString(Stream);
+    string Description = ReadString(Stream);
+    uint64_t LevelCount = ReadValue<uint64_t>(Stream);
+    LODChain Chain;
+    for (uint64_t i = 0; i < LevelCount && Stream; i++) {
+        double Error = ReadValue<double>(Stream);
+        uint64_t VertexCount = ReadValue<uint64_t>(Stream);
+        uint64_t FaceCount = ReadValue<uint64_t>(Stream);
+        uint64_t LineCount = ReadValue<uint64_t>(Stream);
+        if (!Stream) {
+            break;
+        }
+        IndexedModel3D Model;
+        Model.Name = Name;
+        Model.Description = Description;
+        Model.Reserve(VertexCount, FaceCount, LineCount);
+        for (uint64_t v = 0; v < VertexCount; v++) {
+            double Coordinates[3]{};
+            Stream.read(reinterpret_cast<char*>(Coordinates),
+                sizeof(Coordinates));
+            Model.AddVertex(Coordinates[0], Coordinates[1], Coordinates[2]);
+        }
+        for (uint64_t f = 0; f < FaceCount; f++) {
+            uint64_t Indices[3]{};
+            Stream.read(reinterpret_cast<char*>(Indices), sizeof(Indices));
+            if (Indices[0] >= VertexCount || Indices[1] >= VertexCount
+                || Indices[2] >= VertexCount) {
+                throw FILE_FORMAT_ERROR(FileName);
+            }
+            Model.AddFace(Indices[0], Indices[1], Indices[2]);
+        }
+        for (uint64_t l = 0; l < LineCount; l++) {
+            uint64_t Indices[2]{};
+            Stream.read(reinterpret_cast<char*>(Indices), sizeof(Indices));
+            if (Indices[0] >= VertexCount || Indices[1] >= VertexCount) {
+                throw FILE_FORMAT_ERROR(FileName);
+            }
+            Model.AddLine(Indices[0], Indices[1]);
+        }
+        Chain.m_Levels.push_back(move(Model));
+        Chain.m_Errors.push_back(Error);
+    }
+    if (!Stream || Chain.m_Levels.size() != LevelCount) {
+        throw FILE_FORMAT_ERROR(FileName);
+    }
+    return Chain;
+}
+/*************************************************************************
+【函数名称】SidecarFileName
+【函数功能】获取模型文件对应的LOD文件名（在模型文件名后追加".lod"）
+【参数】const string& ModelFileName, 表示模型文件名
+【返回值】string，LOD文件名
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+string LODChain::SidecarFileName(const string& ModelFileName) {
+    return ModelFileName + ".lod";
+}
+
+//-------------------------------------------------------------------------
+// 私有非静态成员函数
+//-------------------------------------------------------------------------
+
+/*************************************************************************
+【函数名称】CheckLevel
+【函数功能】检查级别索引，超出范围时抛出LEVEL_NOT_FOUND
+【参数】size_t LevelIndex, 表示级别
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+void LODChain::CheckLevel(size_t LevelIndex) const {
+    if (LevelIndex >= m_Levels.size()) {
+        throw LEVEL_NOT_FOUND();
+    }
+}
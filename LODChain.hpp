@@ -0,0 +1,129 @@
+/*************************************************************************
+【文件名】LODChain.hpp
+【功能模块和目的】定义LODChain类，由原模型逐级简化得到的多级细节（LOD）链
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+#ifndef LODCHAIN_HPP
+#define LODCHAIN_HPP
+
+// IndexedModel3D所属头文件
+#include "IndexedModel3D.hpp"
+// invalid_argument, out_of_range所属头文件
+#include <stdexcept>
+// string所属头文件
+#include <string>
+// vector所属头文件
+#include <vector>
+// size_t所属头文件
+#include <cstddef>
+
+using namespace std;
+
+/*************************************************************************
+【类名】LODChain
+【功能】保存由原模型逐级简化得到的模型序列：第0级为原模型，级别越高面数越少。
+       每一级记录相对原模型的几何误差（模型坐标单位），可按面数预算或
+       屏幕空间误差选取合适的级别；整条链可写入与模型文件同名的.lod文件，
+       在完整模型导入前先行读取
+【接口说明】
+    默认构造函数
+    带参构造函数（由原模型生成指定级数）
+    拷贝构造函数
+    赋值运算符
+    虚析构函数
+    写入文件
+    静态：从文件读取
+    静态：获取模型文件对应的LOD文件名
+    获取级数
+    获取指定级别的模型、几何误差、面数
+    按面数预算选取级别
+    按屏幕空间误差选取级别
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+class LODChain {
+public:
+    //-------------------------------------------------------------------------
+    // 内嵌异常类
+    //-------------------------------------------------------------------------
+    // 文件无法打开类异常
+    class FILE_NOT_AVAILABLE : public invalid_argument {
+    public:
+        FILE_NOT_AVAILABLE(const string& FileName);
+    };
+    // 文件格式错误类异常
+    class FILE_FORMAT_ERROR : public invalid_argument {
+    public:
+        FILE_FORMAT_ERROR(const string& FileName);
+    };
+    // 级别超出范围类异常
+    class LEVEL_NOT_FOUND : public out_of_range {
+    public:
+        LEVEL_NOT_FOUND();
+    };
+    //-------------------------------------------------------------------------
+    // 静态常量
+    //-------------------------------------------------------------------------
+    // 默认级数（含原模型）
+    static constexpr size_t DEFAULT_LEVEL_COUNT{5};
+    // 默认相邻两级的面数之比
+    static constexpr double DEFAULT_RATIO{0.5};
+    //-------------------------------------------------------------------------
+    // 必要的构造、析构、拷贝、赋值运算符重载函数
+    //-------------------------------------------------------------------------
+    // 默认构造函数
+    LODChain() = default;
+    // 带参构造函数
+    explicit LODChain(const IndexedModel3D& AModel,
+                      size_t LevelCount = DEFAULT_LEVEL_COUNT,
+                      double Ratio = DEFAULT_RATIO);
+    // 拷贝构造函数
+    LODChain(const LODChain& Source) = default;
+    // 赋值运算符
+    LODChain& operator=(const LODChain& Source) = default;
+    // 虚析构函数
+    virtual ~LODChain() = default;
+    //-------------------------------------------------------------------------
+    // 非静态Getter成员函数
+    //-------------------------------------------------------------------------
+    // 写入文件
+    void SaveToFile(const string& FileName) const;
+    // 获取级数
+    size_t GetLevelCount() const;
+    // 获取指定级别的模型
+    const IndexedModel3D& Level(size_t LevelIndex) const;
+    // 获取指定级别的几何误差
+    double GetLevelError(size_t LevelIndex) const;
+    // 获取指定级别的面数
+    size_t GetLevelFaceCount(size_t LevelIndex) const;
+    // 按面数预算选取级别（面数不超过预算的最精细级别）
+    size_t SelectByFaceBudget(size_t FaceBudget) const;
+    // 按屏幕空间误差选取级别（投影误差不超过允许像素数的最粗糙级别）
+    size_t SelectByScreenError(double Distance, double FieldOfView,
+                               double ViewportHeight,
+                               double PixelError) const;
+    //-------------------------------------------------------------------------
+    // 静态成员函数
+    //-------------------------------------------------------------------------
+    // 从文件读取
+    static LODChain LoadFromFile(const string& FileName);
+    // 获取模型文件对应的LOD文件名
+    static string SidecarFileName(const string& ModelFileName);
+
+private:
+    //-------------------------------------------------------------------------
+    // 私有非静态成员函数
+    //-------------------------------------------------------------------------
+    // 检查级别索引
+    void CheckLevel(size_t LevelIndex) const;
+    //-------------------------------------------------------------------------
+    // 私有非静态成员
+    //-------------------------------------------------------------------------
+    // 各级模型
+    vector<IndexedModel3D> m_Levels{};
+    // 各级相对原模型的几何误差
+    vector<double> m_Errors{};
+};
+
+#endif /* LODChain.hpp */
@@ -0,0 +1,144 @@
+/*************************************************************************
+【文件名】M3BFormat.cpp
+【功能模块和目的】定义M3BFormat类的成员函数
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】2026/10/19 谭雯心 增加了修订号，可读取版本1和版本2
+*************************************************************************/
+// M3BFormat所属头文件
+#include "M3BFormat.hpp"
+// istream, ostream所属头文件
+#include <iostream>
+// string所属头文件
+#include <string>
+// memcmp所属头文件
+#include <cstring>
+// uint8_t, uint32_t, uint64_t所属头文件
+#include <cstdint>
+// atomic所属头文件
+#include <atomic>
+// random_device所属头文件
+#include <random>
+// steady_clock所属头文件
+#include <chrono>
+
+using namespace std;
+
+//-------------------------------------------------------------------------
+// 静态常量
+//-------------------------------------------------------------------------
+
+// 魔数
+constexpr char M3BFormat::MAGIC[4];
+
+//-------------------------------------------------------------------------
+// 静态成员函数
+//-------------------------------------------------------------------------
+
+/*************************************************************************
+【函数名称】NewRevision
+【函数功能】生成新的修订号。以随机数为起点按调用次数递增，同一进程中
+       不会重复，不同进程或多次运行之间也几乎不会相同
+【参数】无
+【返回值】uint64_t，修订号，不为0
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+uint64_t M3BFormat::NewRevision() {
+    static atomic<uint64_t> Next{
+        (uint64_t(random_device()()) << 32) ^ uint64_t(
+            chrono::steady_clock::now().time_since_epoch().count())};
+    uint64_t Revision;
+    do {
+        Revision = Next.fetch_add(1);
+    } while (Revision == 0);
+    return Revision;
+}
+/*************************************************************************
+【函数名称】WriteHeader
+【函数功能】写入文件头（魔数和版本号）
+【参数】ostream& Stream, 表示输出流
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+void M3BFormat::WriteHeader(ostream& Stream) {
+    Stream.write(MAGIC, sizeof(MAGIC));
+    WriteValue<uint32_t>(Stream, VERSION);
+}
+/*************************************************************************
+【函数名称】ReadHeader
+【函数功能】读取并检查文件头
+【参数】istream& Stream, 表示输入流
+【返回值】bool，魔数和版本号是否正确
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】2026/10/19 谭雯心 接受1至VERSION的版本号
+*************************************************************************/
+bool M3BFormat::ReadHeader(istream& Stream) {
+    char Magic[sizeof(MAGIC)];
+    Stream.read(Magic, sizeof(Magic));
+    uint32_t Version = ReadValue<uint32_t>(Stream);
+    return Stream && memcmp(Magic, MAGIC, sizeof(MAGIC)) == 0
+        && Version >= 1 && Version <= VERSION;
+}
+/*************************************************************************
+【函数名称】WriteChunkHeader
+【函数功能】写入数据块头
+【参数】ostream& Stream, 表示输出流
+       uint8_t Type, 表示数据块类型
+       uint64_t Count, 表示数量
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+void M3BFormat::WriteChunkHeader(ostream& Stream, uint8_t Type,
+                                 uint64_t Count) {
+    WriteValue<uint8_t>(Stream, Type);
+    WriteValue<uint64_t>(Stream, Count);
+}
+/*************************************************************************
+【函数名称】ReadChunkHeader
+【函数功能】读取数据块头
+【参数】istream& Stream, 表示输入流
+       uint8_t& Type, 用于存储数据块类型
+       uint64_t& Count, 用于存储数量
+【返回值】bool，是否读取成功
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+bool M3BFormat::ReadChunkHeader(istream& Stream, uint8_t& Type,
+                                uint64_t& Count) {
+    Type = ReadValue<uint8_t>(Stream);
+    Count = ReadValue<uint64_t>(Stream);
+    return static_cast<bool>(Stream);
+}
+/*************************************************************************
+【函数名称】WriteStringChunk
+【函数功能】写入字符串数据块（名称或注释）
+【参数】ostream& Stream, 表示输出流
+       uint8_t Type, 表示数据块类型
+       const string& Text, 表示字符串
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+void M3BFormat::WriteStringChunk(ostream& Stream, uint8_t Type,
+                                 const string& Text) {
+    WriteChunkHeader(Stream, Type, Text.size());
+    Stream.write(Text.data(), Text.size());
+}
+/*************************************************************************
+【函数名称】ReadString
+【函数功能】读取字符串数据块的数据
+【参数】istream& Stream, 表示输入流
+       uint64_t Length, 表示字节数
+【返回值】string，读取的字符串
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+string M3BFormat::ReadString(istream& Stream, uint64_t Length) {
+    string Text(Length, '\0');
+    if (Length > 0) {
+        Stream.read(&Text[0], Length);
+    }
+    return Text;
+}
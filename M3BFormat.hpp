@@ -0,0 +1,111 @@
+/*************************************************************************
+【文件名】M3BFormat.hpp
+【功能模块和目的】定义M3BFormat类，描述M3B二进制模型格式的常量和基本读写
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】2026/10/19 谭雯心 增加了修订号和增量块，版本号改为2
+*************************************************************************/
+#ifndef M3BFORMAT_HPP
+#define M3BFORMAT_HPP
+
+// istream, ostream所属头文件
+#include <iostream>
+// string所属头文件
+#include <string>
+// uint8_t, uint32_t, uint64_t所属头文件
+#include <cstdint>
+// size_t所属头文件
+#include <cstddef>
+
+using namespace std;
+
+/*************************************************************************
+【类名】M3BFormat
+【功能】M3B二进制模型格式。文件以8字节文件头（4字节魔数和4字节版本号）开始，
+       之后是若干数据块，每块由1字节类型、8字节数量和数据组成，以END块结束。
+       顶点按出现顺序从0开始全局编号，面、线块存放全局顶点索引，
+       因此可以边读边写，无需把整个模型放入内存。数值按小端序存放。
+       版本2起，整体写出的文件在文件头之后紧跟修订号块；增量导出时
+       把新的增量块追加到文件末尾，再把修订号块改为REVISION_PATCHED
+       并换上新的修订号，最后把原来的END块改写为DELTA块，使读取者
+       继续读入其后的增量。增量块中的面、线补丁直接带有坐标，位置
+       小于已读的数量时替换，等于时追加；同名的名称、注释块以最后
+       一个为准
+【接口说明】
+    静态常量：魔数、版本号、文件头和数据块头长度、各数据块类型
+    静态：生成新的修订号
+    静态：写入、读取文件头
+    静态：写入、读取数据块头
+    静态：写入、读取定长值
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+class M3BFormat {
+public:
+    //-------------------------------------------------------------------------
+    // 静态常量
+    //-------------------------------------------------------------------------
+    // 魔数
+    static constexpr char MAGIC[4] = {'M', '3', 'B', '\x1a'};
+    // 版本号，可读取1至VERSION
+    static constexpr uint32_t VERSION{2};
+    // 文件头长度
+    static constexpr uint64_t HEADER_SIZE{8};
+    // 数据块头长度
+    static constexpr uint64_t CHUNK_HEADER_SIZE{9};
+    // 结束块，数量为0
+    static constexpr uint8_t CHUNK_END{0};
+    // 名称块，数量为字节数
+    static constexpr uint8_t CHUNK_NAME{1};
+    // 注释块，数量为字节数
+    static constexpr uint8_t CHUNK_DESCRIPTION{2};
+    // 顶点块，数量为顶点数，每个顶点3个double
+    static constexpr uint8_t CHUNK_VERTICES{3};
+    // 面块，数量为面数，每个面3个uint64_t顶点索引
+    static constexpr uint8_t CHUNK_FACES{4};
+    // 线块，数量为线数，每条线2个uint64_t顶点索引
+    static constexpr uint8_t CHUNK_LINES{5};
+    // 修订号块，数量为修订号，没有数据，整体写出时紧跟文件头
+    static constexpr uint8_t CHUNK_REVISION{6};
+    // 已追加增量的修订号块，流式读取须先读完整个文件
+    static constexpr uint8_t CHUNK_REVISION_PATCHED{7};
+    // 增量开始块，由原来的END块改写而成，数量为0
+    static constexpr uint8_t CHUNK_DELTA{8};
+    // 面补丁块，数量为条数，每条1个uint64_t面位置和9个double坐标
+    static constexpr uint8_t CHUNK_FACE_PATCHES{9};
+    // 线补丁块，数量为条数，每条1个uint64_t线位置和6个double坐标
+    static constexpr uint8_t CHUNK_LINE_PATCHES{10};
+    //-------------------------------------------------------------------------
+    // 静态成员函数
+    //-------------------------------------------------------------------------
+    // 生成新的修订号，不为0
+    static uint64_t NewRevision();
+    // 写入文件头
+    static void WriteHeader(ostream& Stream);
+    // 读取并检查文件头
+    static bool ReadHeader(istream& Stream);
+    // 写入数据块头
+    static void WriteChunkHeader(ostream& Stream, uint8_t Type,
+                                 uint64_t Count);
+    // 读取数据块头
+    static bool ReadChunkHeader(istream& Stream, uint8_t& Type,
+                                uint64_t& Count);
+    // 写入字符串数据块
+    static void WriteStringChunk(ostream& Stream, uint8_t Type,
+                                 const string& Text);
+    // 读取字符串数据块的数据
+    static string ReadString(istream& Stream, uint64_t Length);
+    // 写入定长值
+    template <typename T>
+    static void WriteValue(ostream& Stream, const T& Value) {
+        Stream.write(reinterpret_cast<const char*>(&Value), sizeof(T));
+    }
+    // 读取定长值
+    template <typename T>
+    static T ReadValue(istream& Stream) {
+        T Value{};
+        Stream.read(reinterpret_cast<char*>(&Value), sizeof(T));
+        return Value;
+    }
+};
+
+#endif /* M3BFormat.hpp */
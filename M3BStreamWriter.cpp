@@ -0,0 +1,112 @@
+/*************************************************************************
+【文件名】M3BStreamWriter.cpp
+【功能模块和目的】定义M3BStreamWriter类的成员函数
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+// M3BStreamWriter所属头文件
+#include "M3BStreamWriter.hpp"
+// M3BFormat所属头文件
+#include "M3BFormat.hpp"
+// ModelStreamStage所属头文件
+#include "ModelStreamStage.hpp"
+// ostream所属头文件
+#include <iostream>
+// uint64_t所属头文件
+#include <cstdint>
+// size_t所属头文件
+#include <cstddef>
+
+using namespace std;
+
+//-------------------------------------------------------------------------
+// 必要的构造、析构、拷贝、赋值运算符重载函数
+//-------------------------------------------------------------------------
+
+/*************************************************************************
+【函数名称】M3BStreamWriter
+【函数功能】带参构造函数
+【参数】ostream& Stream, 表示输出流（以二进制方式打开）
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+M3BStreamWriter::M3BStreamWriter(ostream& Stream) : m_Stream(Stream) {
+}
+
+//-------------------------------------------------------------------------
+// 非静态Setter成员函数
+//-------------------------------------------------------------------------
+
+/*************************************************************************
+【函数名称】ProcessBatch
+【函数功能】将一个批次写成M3B数据块
+【参数】const Batch& ABatch, 表示批次
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+void M3BStreamWriter::ProcessBatch(const Batch& ABatch) {
+    WriteHeaderOnce();
+    if (ABatch.Name != m_Name) {
+        m_Name = ABatch.Name;
+        M3BFormat::WriteStringChunk(m_Stream, M3BFormat::CHUNK_NAME, m_Name);
+    }
+    if (ABatch.Description != m_Description) {
+        m_Description = ABatch.Description;
+        M3BFormat::WriteStringChunk(m_Stream, M3BFormat::CHUNK_DESCRIPTION,
+            m_Description);
+    }
+    if (!ABatch.Vertices.empty()) {
+        M3BFormat::WriteChunkHeader(m_Stream, M3BFormat::CHUNK_VERTICES,
+            ABatch.Vertices.size() / 3);
+        m_Stream.write(reinterpret_cast<const char*>(ABatch.Vertices.data()),
+            ABatch.Vertices.size() * sizeof(double));
+    }
+    if (!ABatch.FaceIndices.empty()) {
+        M3BFormat::WriteChunkHeader(m_Stream, M3BFormat::CHUNK_FACES,
+            ABatch.FaceIndices.size() / 3);
+        for (size_t Index : ABatch.FaceIndices) {
+            M3BFormat::WriteValue<uint64_t>(m_Stream, Index);
+        }
+    }
+    if (!ABatch.LineIndices.empty()) {
+        M3BFormat::WriteChunkHeader(m_Stream, M3BFormat::CHUNK_LINES,
+            ABatch.LineIndices.size() / 2);
+        for (size_t Index : ABatch.LineIndices) {
+            M3BFormat::WriteValue<uint64_t>(m_Stream, Index);
+        }
+    }
+}
+/*************************************************************************
+【函数名称】Finish
+【函数功能】写入END块（空模型也会得到完整的文件头）
+【参数】无
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+void M3BStreamWriter::Finish() {
+    WriteHeaderOnce();
+    M3BFormat::WriteChunkHeader(m_Stream, M3BFormat::CHUNK_END, 0);
+    m_Stream.flush();
+}
+
+//-------------------------------------------------------------------------
+// 私有非静态成员函数
+//-------------------------------------------------------------------------
+
+/*************************************************************************
+【函数名称】WriteHeaderOnce
+【函数功能】尚未写入文件头时写入文件头
+【参数】无
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+void M3BStreamWriter::WriteHeaderOnce() {
+    if (!m_HeaderWritten) {
+        M3BFormat::WriteHeader(m_Stream);
+        m_HeaderWritten = true;
+    }
+}
@@ -0,0 +1,74 @@
+/*************************************************************************
+【文件名】M3BStreamWriter.hpp
+【功能模块和目的】定义M3BStreamWriter类，把流式导入的批次写成M3B二进制文件
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+#ifndef M3BSTREAMWRITER_HPP
+#define M3BSTREAMWRITER_HPP
+
+// ModelStreamStage所属头文件
+#include "ModelStreamStage.hpp"
+// ostream所属头文件
+#include <iostream>
+// string所属头文件
+#include <string>
+
+using namespace std;
+
+/*************************************************************************
+【类名】M3BStreamWriter
+【功能】流式处理阶段：收到第一个批次前写入文件头，每个批次写成顶点块、面块
+       和线块（名称、注释变化时写入对应数据块），结束时写入END块。
+       与流式导入器配合可在有限内存内完成任意大小模型到M3B的转换
+【接口说明】
+    带参构造函数（输出流）
+    禁止拷贝构造函数
+    禁止赋值运算符
+    虚析构函数
+    处理一个批次
+    全部批次处理完毕
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+class M3BStreamWriter : public ModelStreamStage {
+public:
+    //-------------------------------------------------------------------------
+    // 必要的构造、析构、拷贝、赋值运算符重载函数
+    //-------------------------------------------------------------------------
+    // 带参构造函数
+    explicit M3BStreamWriter(ostream& Stream);
+    // 禁止拷贝构造函数
+    M3BStreamWriter(const M3BStreamWriter& Source) = delete;
+    // 禁止赋值运算符
+    M3BStreamWriter& operator=(const M3BStreamWriter& Source) = delete;
+    // 虚析构函数
+    virtual ~M3BStreamWriter() = default;
+    //-------------------------------------------------------------------------
+    // 非静态Setter成员函数
+    //-------------------------------------------------------------------------
+    // 处理一个批次
+    virtual void ProcessBatch(const Batch& ABatch) override;
+    // 全部批次处理完毕
+    virtual void Finish() override;
+
+private:
+    //-------------------------------------------------------------------------
+    // 私有非静态成员函数
+    //-------------------------------------------------------------------------
+    // 尚未写入文件头时写入文件头
+    void WriteHeaderOnce();
+    //-------------------------------------------------------------------------
+    // 私有非静态成员
+    //-------------------------------------------------------------------------
+    // 输出流
+    ostream& m_Stream;
+    // 是否已写入文件头
+    bool m_HeaderWritten{false};
+    // 已写入的名称
+    string m_Name{};
+    // 已写入的注释
+    string m_Description{};
+};
+
+#endif /* M3BStreamWriter.hpp */
@@ -0,0 +1,189 @@
+/*************************************************************************
+【文件名】MemoryAccounting.cpp
+【功能模块和目的】定义MemoryAccounting类的成员函数
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+// MemoryAccounting所属头文件
+#include "MemoryAccounting.hpp"
+// atomic所属头文件
+#include <atomic>
+// uint64_t所属头文件
+#include <cstdint>
+// size_t所属头文件
+#include <cstddef>
+
+using namespace std;
+
+namespace {
+    // 各类别当前占用的字节数
+    atomic<uint64_t> g_LiveBytes[MemoryAccounting::CATEGORY_COUNT]{};
+    // 各类别的峰值字节数
+    atomic<uint64_t> g_PeakBytes[MemoryAccounting::CATEGORY_COUNT]{};
+    // 当前线程各类别累计分配的字节数
+    thread_local uint64_t t_AllocatedBytes[MemoryAccounting::CATEGORY_COUNT]{};
+}
+
+//-------------------------------------------------------------------------
+// 内嵌结构体Usage的成员函数
+//-------------------------------------------------------------------------
+
+/*************************************************************************
+【函数名称】Usage::operator+=
+【函数功能】累加另一份明细
+【参数】const Usage& Source, 表示另一份明细
+【返回值】Usage&，自身的引用
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+MemoryAccounting::Usage& MemoryAccounting::Usage::operator+=(
+    const Usage& Source) {
+    VertexBytes += Source.VertexBytes;
+    ElementBytes += Source.ElementBytes;
+    ControlBlockBytes += Source.ControlBlockBytes;
+    ContainerBytes += Source.ContainerBytes;
+    SlackBytes += Source.SlackBytes;
+    OtherBytes += Source.OtherBytes;
+    return *this;
+}
+/*************************************************************************
+【函数名称】Usage::GetTotalBytes
+【函数功能】获取总字节数
+【参数】无
+【返回值】uint64_t，各项之和
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+uint64_t MemoryAccounting::Usage::GetTotalBytes() const {
+    return VertexBytes + ElementBytes + ControlBlockBytes + ContainerBytes
+        + SlackBytes + OtherBytes;
+}
+
+//-------------------------------------------------------------------------
+// 静态常量
+//-------------------------------------------------------------------------
+
+// 类别数
+constexpr size_t MemoryAccounting::CATEGORY_COUNT;
+
+//-------------------------------------------------------------------------
+// 静态成员函数
+//-------------------------------------------------------------------------
+
+/*************************************************************************
+【函数名称】RecordAllocate
+【函数功能】记录一次分配，更新当前占用、峰值和当前线程的累计分配
+【参数】Category ACategory, 表示类别
+       size_t Bytes, 表示字节数
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+void MemoryAccounting::RecordAllocate(Category ACategory, size_t Bytes) {
+    size_t Index = static_cast<size_t>(ACategory);
+    uint64_t Live = g_LiveBytes[Index].fetch_add(Bytes,
+        memory_order_relaxed) + Bytes;
+    uint64_t Peak = g_PeakBytes[Index].load(memory_order_relaxed);
+    while (Live > Peak && !g_PeakBytes[Index].compare_exchange_weak(
+        Peak, Live, memory_order_relaxed)) {
+    }
+    t_AllocatedBytes[Index] += Bytes;
+}
+/*************************************************************************
+【函数名称】RecordDeallocate
+【函数功能】记录一次释放
+【参数】Category ACategory, 表示类别
+       size_t Bytes, 表示字节数
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+void MemoryAccounting::RecordDeallocate(Category ACategory, size_t Bytes) {
+    g_LiveBytes[static_cast<size_t>(ACategory)].fetch_sub(Bytes,
+        memory_order_relaxed);
+}
+/*************************************************************************
+【函数名称】GetLiveBytes
+【函数功能】获取某类别当前占用的字节数
+【参数】Category ACategory, 表示类别
+【返回值】uint64_t，字节数
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+uint64_t MemoryAccounting::GetLiveBytes(Category ACategory) {
+    return g_LiveBytes[static_cast<size_t>(ACategory)].load(
+        memory_order_relaxed);
+}
+/*************************************************************************
+【函数名称】GetLiveBytes
+【函数功能】获取全部类别当前占用的字节数
+【参数】无
+【返回值】uint64_t，字节数
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+uint64_t MemoryAccounting::GetLiveBytes() {
+    uint64_t Total = 0;
+    for (const auto& Live : g_LiveBytes) {
+        Total += Live.load(memory_order_relaxed);
+    }
+    return Total;
+}
+/*************************************************************************
+【函数名称】GetPeakBytes
+【函数功能】获取某类别的峰值字节数
+【参数】Category ACategory, 表示类别
+【返回值】uint64_t，字节数
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+uint64_t MemoryAccounting::GetPeakBytes(Category ACategory) {
+    return g_PeakBytes[static_cast<size_t>(ACategory)].load(
+        memory_order_relaxed);
+}
+/*************************************************************************
+【函数名称】ResetPeak
+【函数功能】把各类别的峰值重置为当前占用
+【参数】无
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+void MemoryAccounting::ResetPeak() {
+    for (size_t i = 0; i < CATEGORY_COUNT; i++) {
+        g_PeakBytes[i].store(g_LiveBytes[i].load(memory_order_relaxed),
+            memory_order_relaxed);
+    }
+}
+/*************************************************************************
+【函数名称】GetThreadAllocatedBytes
+【函数功能】获取当前线程某类别累计分配的字节数，两次调用之差即为
+       其间当前线程在该类别分配的字节数
+【参数】Category ACategory, 表示类别
+【返回值】uint64_t，字节数
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+uint64_t MemoryAccounting::GetThreadAllocatedBytes(Category ACategory) {
+    return t_AllocatedBytes[static_cast<size_t>(ACategory)];
+}
+/*************************************************************************
+【函数名称】GetCategoryName
+【函数功能】获取类别名称
+【参数】Category ACategory, 表示类别
+【返回值】const char*，类别名称
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+const char* MemoryAccounting::GetCategoryName(Category ACategory) {
+    switch (ACategory) {
+        case Category::VERTICES:
+            return "vertices";
+        case Category::ELEMENTS:
+            return "elements";
+        case Category::CONTROL_BLOCKS:
+            return "control_blocks";
+        default:
+            return "containers";
+    }
+}
@@ -0,0 +1,106 @@
+/*************************************************************************
+【文件名】MemoryAccounting.hpp
+【功能模块和目的】定义MemoryAccounting类，按类别统计模型数据结构占用的堆内存
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+#ifndef MEMORYACCOUNTING_HPP
+#define MEMORYACCOUNTING_HPP
+
+// uint64_t所属头文件
+#include <cstdint>
+// size_t所属头文件
+#include <cstddef>
+
+using namespace std;
+
+/*************************************************************************
+【类名】MemoryAccounting
+【功能】内存计数钩子。CountingAllocator在每次分配和释放时按类别调用
+       RecordAllocate和RecordDeallocate，本类维护进程内各类别当前占用和
+       峰值字节数（原子计数），以及每个线程累计分配的字节数（用于测量一段
+       代码分配了多少内存）。字节数为向分配器申请的字节数，不含malloc自身
+       的对齐和簿记开销
+【接口说明】
+    公有类型Category（顶点存储、元素对象、shared_ptr控制块、容器）
+    内嵌结构体Usage，表示一个模型的内存占用明细
+    静态常量：类别数
+    禁止构造
+    静态：记录分配、释放
+    静态：获取某类别或全部类别当前占用的字节数、峰值字节数
+    静态：把峰值重置为当前占用
+    静态：获取当前线程某类别累计分配的字节数
+    静态：获取类别名称
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+class MemoryAccounting {
+public:
+    //-------------------------------------------------------------------------
+    // 公有类型
+    //-------------------------------------------------------------------------
+    // 内存类别
+    enum class Category {
+        // 顶点存储（元素中的Point3D）
+        VERTICES,
+        // 元素对象（Face3D、Line3D本身）
+        ELEMENTS,
+        // shared_ptr控制块
+        CONTROL_BLOCKS,
+        // 容器（存放元素指针等的vector）
+        CONTAINERS
+    };
+    //-------------------------------------------------------------------------
+    // 公有的内嵌类，用于存储数据
+    //-------------------------------------------------------------------------
+    // 一个模型的内存占用明细（字节）
+    struct Usage {
+        // 顶点存储中已使用的部分
+        uint64_t VertexBytes{0};
+        // 元素对象
+        uint64_t ElementBytes{0};
+        // shared_ptr控制块
+        uint64_t ControlBlockBytes{0};
+        // 容器中已使用的部分
+        uint64_t ContainerBytes{0};
+        // 顶点存储和容器中已分配未使用的部分
+        uint64_t SlackBytes{0};
+        // 模型对象本身和名称、注释等
+        uint64_t OtherBytes{0};
+        // 累加另一份明细
+        Usage& operator+=(const Usage& Source);
+        // 获取总字节数
+        uint64_t GetTotalBytes() const;
+    };
+    //-------------------------------------------------------------------------
+    // 静态常量
+    //-------------------------------------------------------------------------
+    // 类别数
+    static constexpr size_t CATEGORY_COUNT{4};
+    //-------------------------------------------------------------------------
+    // 必要的构造、析构、拷贝、赋值运算符重载函数
+    //-------------------------------------------------------------------------
+    // 禁止构造
+    MemoryAccounting() = delete;
+    //-------------------------------------------------------------------------
+    // 静态成员函数
+    //-------------------------------------------------------------------------
+    // 记录分配
+    static void RecordAllocate(Category ACategory, size_t Bytes);
+    // 记录释放
+    static void RecordDeallocate(Category ACategory, size_t Bytes);
+    // 获取某类别当前占用的字节数
+    static uint64_t GetLiveBytes(Category ACategory);
+    // 获取全部类别当前占用的字节数
+    static uint64_t GetLiveBytes();
+    // 获取某类别的峰值字节数
+    static uint64_t GetPeakBytes(Category ACategory);
+    // 把各类别的峰值重置为当前占用
+    static void ResetPeak();
+    // 获取当前线程某类别累计分配的字节数（只增不减）
+    static uint64_t GetThreadAllocatedBytes(Category ACategory);
+    // 获取类别名称
+    static const char* GetCategoryName(Category ACategory);
+};
+
+#endif /* MemoryAccounting.hpp */
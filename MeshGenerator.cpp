@@ -0,0 +1,660 @@
+/*************************************************************************
+【文件名】MeshGenerator.cpp
+【功能模块和目的】定义MeshGenerator类的成员函数
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】2026/10/19 谭雯心 流式写出器改由PorterRegistry选择
+           2026/10/19 谭雯心 写入文件改为经临时文件原子保存
+           2026/10/19 谭雯心 文件名以".gz"结尾时压缩写出
+*************************************************************************/
+// MeshGenerator所属头文件
+#include "MeshGenerator.hpp"
+// ModelStreamStage所属头文件
+#include "ModelStreamStage.hpp"
+// ModelBatcher所属头文件
+#include "ModelBatcher.hpp"
+// IndexedModel3D所属头文件
+#include "IndexedModel3D.hpp"
+// Model3D所属头文件
+#include "Model3D.hpp"
+// PorterRegistry所属头文件
+#include "PorterRegistry.hpp"
+// Porter所属头文件
+#include "Porter.hpp"
+// ofstream所属头文件
+#include <fstream>
+// invalid_argument所属头文件
+#include <stdexcept>
+// shared_ptr、unique_ptr所属头文件
+#include <memory>
+// string, to_string所属头文件
+#include <string>
+// sqrt所属头文件
+#include <cmath>
+// uint64_t所属头文件
+#include <cstdint>
+// size_t所属头文件
+#include <cstddef>
+// vector所属头文件
+#include <vector>
+// streambuf所属头文件
+#include <streambuf>
+
+using namespace std;
+
+namespace {
+    /*************************************************************************
+    【类名】SplitMix64
+    【功能】SplitMix64伪随机数发生器。结果只由种子决定，
+           不依赖标准库随机数分布的实现
+    【接口说明】
+        带参构造函数（种子）
+        获取下一个64位随机数
+        获取[0, 1)内的下一个随机实数
+        获取[Low, High)内的下一个随机实数
+    【开发者及日期】谭雯心 2026/10/19
+    【更改记录】
+    *************************************************************************/
+    class SplitMix64 {
+    public:
+        explicit SplitMix64(uint64_t Seed) : m_State(Seed) {
+        }
+        uint64_t Next() {
+            uint64_t z = (m_State += 0x9E3779B97F4A7C15ULL);
+            z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+            z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+            return z ^ (z >> 31);
+        }
+        double NextDouble() {
+            return static_cast<double>(Next() >> 11) * 0x1.0p-53;
+        }
+        double NextDouble(double Low, double High) {
+            return Low + (High - Low) * NextDouble();
+        }
+
+    private:
+        uint64_t m_State;
+    };
+
+    // 正二十面体的顶点（未归一化）
+    const double ICOSAHEDRON_VERTICES[12][3] = {
+        {-1, 1.6180339887498949, 0}, {1, 1.6180339887498949, 0},
+        {-1, -1.6180339887498949, 0}, {1, -1.6180339887498949, 0},
+        {0, -1, 1.6180339887498949}, {0, 1, 1.6180339887498949},
+        {0, -1, -1.6180339887498949}, {0, 1, -1.6180339887498949},
+        {1.6180339887498949, 0, -1}, {1.6180339887498949, 0, 1},
+        {-1.6180339887498949, 0, -1}, {-1.6180339887498949, 0, 1}
+    };
+    // 正二十面体的面（从外侧看为逆时针）
+    const size_t ICOSAHEDRON_FACES[20][3] = {
+        {0, 11, 5}, {0, 5, 1}, {0, 1, 7}, {0, 7, 10}, {0, 10, 11},
+        {1, 5, 9}, {5, 11, 4}, {11, 10, 2}, {10, 7, 6}, {7, 1, 8},
+        {3, 9, 4}, {3, 4, 2}, {3, 2, 6}, {3, 6, 8}, {3, 8, 9},
+        {4, 9, 5}, {2, 4, 11}, {6, 2, 10}, {8, 6, 7}, {9, 8, 1}
+    };
+
+    /*************************************************************************
+    【函数名称】ShapeName
+    【函数功能】获取形状对应的模型名称
+    【参数】MeshGenerator::Shape AShape, 表示形状
+    【返回值】string，模型名称
+    【开发者及日期】谭雯心 2026/10/19
+    【更改记录】
+    *************************************************************************/
+    string ShapeName(MeshGenerator::Shape AShape) {
+        switch (AShape) {
+            case MeshGenerator::Shape::GRID:
+                return "Grid";
+            case MeshGenerator::Shape::SPHERE:
+                return "Sphere";
+            case MeshGenerator::Shape::SOUP:
+                return "Soup";
+            default:
+                return "Wireframe";
+        }
+    }
+}
+
+//-------------------------------------------------------------------------
+// 内嵌异常类
+//-------------------------------------------------------------------------
+
+/*************************************************************************
+【函数名称】FILE_NOT_SUPPORTED
+【函数功能】内嵌异常类构造函数，若文件类型没有流式写出器，则抛出该异常
+【参数】const string& FileName，文件名
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+MeshGenerator::FILE_NOT_SUPPORTED::FILE_NOT_SUPPORTED(const string& FileName)
+    : invalid_argument(string("File ") + FileName
+    + string(" is not supported type.")) {
+}
+/*************************************************************************
+【函数名称】FILE_NOT_AVAILABLE
+【函数功能】内嵌异常类构造函数，若文件无法写入，则抛出该异常
+【参数】const string& FileName，文件名
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+MeshGenerator::FILE_NOT_AVAILABLE::FILE_NOT_AVAILABLE(const string& FileName)
+    : invalid_argument(string("File ") + FileName
+    + string(" not available.")) {
+}
+
+//-------------------------------------------------------------------------
+// 静态常量
+//-------------------------------------------------------------------------
+
+// 默认种子
+constexpr uint64_t MeshGenerator::DEFAULT_SEED;
+
+//-------------------------------------------------------------------------
+// 必要的构造、析构、拷贝、赋值运算符重载函数
+//-------------------------------------------------------------------------
+
+/*************************************************************************
+【函数名称】MeshGenerator
+【函数功能】带参构造函数
+【参数】Shape AShape, 表示形状
+       size_t ElementCount, 表示元素数（球面为目标面数）
+       uint64_t Seed, 表示种子
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+MeshGenerator::MeshGenerator(Shape AShape, size_t ElementCount, uint64_t Seed)
+    : m_Shape(AShape), m_ElementCount(ElementCount), m_Seed(Seed) {
+}
+
+//-------------------------------------------------------------------------
+// 非静态Getter成员函数
+//-------------------------------------------------------------------------
+
+/*************************************************************************
+【函数名称】GetShape
+【函数功能】获取形状
+【参数】无
+【返回值】Shape，形状
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+MeshGenerator::Shape MeshGenerator::GetShape() const {
+    return m_Shape;
+}
+/*************************************************************************
+【函数名称】GetElementCount
+【函数功能】获取元素数
+【参数】无
+【返回值】size_t，元素数
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+size_t MeshGenerator::GetElementCount() const {
+    return m_ElementCount;
+}
+/*************************************************************************
+【函数名称】GetSeed
+【函数功能】获取种子
+【参数】无
+【返回值】uint64_t，种子
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+uint64_t MeshGenerator::GetSeed() const {
+    return m_Seed;
+}
+/*************************************************************************
+【函数名称】GetVertexCount
+【函数功能】获取将生成的顶点数
+【参数】无
+【返回值】size_t，顶点数（球面含各细分块重复的边界顶点）
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+size_t MeshGenerator::GetVertexCount() const {
+    if (m_ElementCount == 0) {
+        return 0;
+    }
+    switch (m_Shape) {
+        case Shape::GRID: {
+            size_t Side = GridSide();
+            return (Side + 1) * (Side + 1);
+        }
+        case Shape::SPHERE: {
+            size_t n = SphereFrequency();
+            return 20 * ((n + 1) * (n + 2) / 2);
+        }
+        case Shape::SOUP:
+            return m_ElementCount * 3;
+        default: {
+            size_t Side = LatticeSide();
+            return (Side + 1) * (Side + 1) * (Side + 1);
+        }
+    }
+}
+/*************************************************************************
+【函数名称】GetFaceCount
+【函数功能】获取将生成的面数
+【参数】无
+【返回值】size_t，面数
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+size_t MeshGenerator::GetFaceCount() const {
+    switch (m_Shape) {
+        case Shape::GRID:
+        case Shape::SOUP:
+            return m_ElementCount;
+        case Shape::SPHERE: {
+            size_t n = SphereFrequency();
+            return 20 * n * n;
+        }
+        default:
+            return 0;
+    }
+}
+/*************************************************************************
+【函数名称】GetLineCount
+【函数功能】获取将生成的线数
+【参数】无
+【返回值】size_t，线数
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+size_t MeshGenerator::GetLineCount() const {
+    return m_Shape == Shape::WIREFRAME ? m_ElementCount : 0;
+}
+/*************************************************************************
+【函数名称】Generate
+【函数功能】生成到ModelBatcher，不调用Finish
+【参数】ModelBatcher& Batcher, 表示批次组装器
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+void MeshGenerator::Generate(ModelBatcher& Batcher) const {
+    Batcher.SetName(ShapeName(m_Shape));
+    Batcher.SetDescription(string("Generated, ")
+        + to_string(m_ElementCount) + string(" elements, seed ")
+        + to_string(m_Seed));
+    Emit(Batcher);
+}
+/*************************************************************************
+【函数名称】Generate
+【函数功能】生成到流式处理阶段，结束时通知处理阶段
+【参数】ModelStreamStage& Stage, 表示处理阶段
+       size_t BatchSize, 表示批次大小
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+void MeshGenerator::Generate(ModelStreamStage& Stage, size_t BatchSize) const {
+    ModelBatcher Batcher(Stage, BatchSize);
+    Generate(Batcher);
+    Batcher.Finish();
+}
+/*************************************************************************
+【函数名称】GenerateIndexed
+【函数功能】生成IndexedModel3D，预先按将生成的数量分配空间
+【参数】无
+【返回值】IndexedModel3D，生成的模型
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+IndexedModel3D MeshGenerator::GenerateIndexed() const {
+    IndexedModel3D Model;
+    Model.Name = ShapeName(m_Shape);
+    Model.Description = string("Generated, ") + to_string(m_ElementCount)
+        + string(" elements, seed ") + to_string(m_Seed);
+    Model.Reserve(GetVertexCount(), GetFaceCount(), GetLineCount());
+    Emit(Model);
+    return Model;
+}
+/*************************************************************************
+【函数名称】GenerateModel
+【函数功能】生成Model3D（经IndexedModel3D线性时间构造，球面的重复顶点被合并）
+【参数】无
+【返回值】Model3D，生成的模型
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+Model3D MeshGenerator::GenerateModel() const {
+    return GenerateIndexed().ToModel();
+}
+/*************************************************************************
+【函数名称】GenerateToFile
+【函数功能】按扩展名把模型流式写入文件，写出器由PorterRegistry选择
+       （.obj、.m3b等），内存占用与模型大小无关；文件名以".gz"结尾时
+       压缩写出（如.obj.gz）
+【参数】const string& FileName, 表示文件名
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】2026/10/19 谭雯心 改为由PorterRegistry选择流式写出器
+           2026/10/19 谭雯心 改为经临时文件原子保存
+           2026/10/19 谭雯心 文件名以".gz"结尾时压缩写出
+*************************************************************************/
+void MeshGenerator::GenerateToFile(const string& FileName) const {
+    shared_ptr<PorterRegistry> pRegistry = PorterRegistry::GetInstance();
+    if (!pRegistry->CanStreamWrite(FileName)) {
+        throw FILE_NOT_SUPPORTED(FileName);
+    }
+    // 写入同目录的临时文件，完成后原子地替换目标文件
+    string TempName = Porter::TempFileName(FileName);
+    vector<char> Buffer;
+    ofstream File;
+    try {
+        Porter::OpenOutput(TempName, File, Buffer);
+    }
+    catch (...) {
+        throw FILE_NOT_AVAILABLE(FileName);
+    }
+    unique_ptr<streambuf> pFilter = Porter::AttachCompressor(FileName, File);
+    try {
+        unique_ptr<ModelStreamStage> pWriter
+            = pRegistry->CreateStreamWriter(FileName, File);
+        Generate(*pWriter);
+        pWriter.reset();
+        Porter::CommitOutput(File, TempName, FileName);
+    }
+    catch (...) {
+        Porter::DiscardOutput(File, TempName);
+        throw FILE_NOT_AVAILABLE(FileName);
+    }
+}
+
+//-------------------------------------------------------------------------
+// 私有非静态成员函数
+//-------------------------------------------------------------------------
+
+/*************************************************************************
+【函数名称】SphereFrequency
+【函数功能】计算球面每条二十面体棱的细分段数n，使20*n*n最接近元素数
+【参数】无
+【返回值】size_t，细分段数，元素数为0时为0
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+size_t MeshGenerator::SphereFrequency() const {
+    if (m_ElementCount == 0) {
+        return 0;
+    }
+    size_t n = static_cast<size_t>(sqrt(m_ElementCount / 20.0));
+    if (n == 0) {
+        n = 1;
+    }
+    // 在n和n+1中取面数更接近元素数的一个
+    size_t Lower = 20 * n * n;
+    size_t Upper = 20 * (n + 1) * (n + 1);
+    if (Lower < m_ElementCount && Upper - m_ElementCount < m_ElementCount - Lower) {
+        n++;
+    }
+    return n;
+}
+/*************************************************************************
+【函数名称】LatticeSide
+【函数功能】计算线框晶格每条边的最小格数s，使晶格线数3*s*(s+1)^2不少于元素数
+【参数】无
+【返回值】size_t，格数
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+size_t MeshGenerator::LatticeSide() const {
+    size_t s = 1;
+    while (3 * s * (s + 1) * (s + 1) < m_ElementCount) {
+        s++;
+    }
+    return s;
+}
+/*************************************************************************
+【函数名称】GridSide
+【函数功能】计算网格每条边的最小格数s，使网格面数2*s*s不少于元素数
+【参数】无
+【返回值】size_t，格数
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+size_t MeshGenerator::GridSide() const {
+    size_t s = static_cast<size_t>(sqrt(m_ElementCount / 2.0));
+    if (s == 0) {
+        s = 1;
+    }
+    while (2 * s * s < m_ElementCount) {
+        s++;
+    }
+    return s;
+}
+/*************************************************************************
+【函数名称】Emit
+【函数功能】按形状把模型逐条交给Sink
+【参数】Sink& Target, 表示接收顶点、面和线的对象
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+template <class Sink>
+void MeshGenerator::Emit(Sink& Target) const {
+    if (m_ElementCount == 0) {
+        return;
+    }
+    switch (m_Shape) {
+        case Shape::GRID:
+            EmitGrid(Target);
+            break;
+        case Shape::SPHERE:
+            EmitSphere(Target);
+            break;
+        case Shape::SOUP:
+            EmitSoup(Target);
+            break;
+        default:
+            EmitWireframe(Target);
+            break;
+    }
+}
+/*************************************************************************
+【函数名称】EmitGrid
+【函数功能】生成起伏网格：顶点高度为随机值，每个方格分为两个三角形，
+       逐行先交出下一行顶点再交出本行的面，面数达到元素数时停止
+【参数】Sink& Target, 表示接收顶点、面和线的对象
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+template <class Sink>
+void MeshGenerator::EmitGrid(Sink& Target) const {
+    SplitMix64 Random(m_Seed);
+    size_t Side = GridSide();
+    size_t Row = Side + 1;
+    for (size_t j = 0; j <= Side; j++) {
+        Target.AddVertex(0.0, static_cast<double>(j),
+            Random.NextDouble(0, 0.5));
+    }
+    size_t Added = 0;
+    for (size_t i = 0; i < Side; i++) {
+        for (size_t j = 0; j <= Side; j++) {
+            Target.AddVertex(static_cast<double>(i + 1),
+                static_cast<double>(j), Random.NextDouble(0, 0.5));
+        }
+        for (size_t j = 0; j < Side && Added < m_ElementCount; j++) {
+            size_t a = i * Row + j;
+            size_t b = a + 1;
+            size_t c = a + Row;
+            size_t d = c + 1;
+            Target.AddFace(a, c, d);
+            if (++Added < m_ElementCount) {
+                Target.AddFace(a, d, b);
+                Added++;
+            }
+        }
+    }
+}
+/*************************************************************************
+【函数名称】EmitSphere
+【函数功能】生成测地线细分球面：正二十面体经随机旋转后，每个面按重心坐标
+       细分为n*n个三角形并投影到单位球面。每块的顶点坐标按固定的
+       两端点加权和计算，相邻块共享棱上的顶点坐标逐位相同
+【参数】Sink& Target, 表示接收顶点、面和线的对象
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+template <class Sink>
+void MeshGenerator::EmitSphere(Sink& Target) const {
+    SplitMix64 Random(m_Seed);
+    // 随机单位四元数对应的旋转矩阵
+    double q[4];
+    double Norm = 0;
+    do {
+        Norm = 0;
+        for (double& Component : q) {
+            Component = Random.NextDouble(-1, 1);
+            Norm += Component * Component;
+        }
+    } while (Norm < 1e-6 || Norm > 1);
+    Norm = sqrt(Norm);
+    for (double& Component : q) {
+        Component /= Norm;
+    }
+    double w = q[0], x = q[1], y = q[2], z = q[3];
+    double Rotation[3][3] = {
+        {1 - 2 * (y * y + z * z), 2 * (x * y - w * z), 2 * (x * z + w * y)},
+        {2 * (x * y + w * z), 1 - 2 * (x * x + z * z), 2 * (y * z - w * x)},
+        {2 * (x * z - w * y), 2 * (y * z + w * x), 1 - 2 * (x * x + y * y)}
+    };
+    double Base[12][3];
+    for (size_t i = 0; i < 12; i++) {
+        const double* v = ICOSAHEDRON_VERTICES[i];
+        double Length = sqrt(v[0] * v[0] + v[1] * v[1] + v[2] * v[2]);
+        for (size_t k = 0; k < 3; k++) {
+            Base[i][k] = (Rotation[k][0] * v[0] + Rotation[k][1] * v[1]
+                + Rotation[k][2] * v[2]) / Length;
+        }
+    }
+    size_t n = SphereFrequency();
+    double Frequency = static_cast<double>(n);
+    size_t First = 0;
+    for (const auto& Face : ICOSAHEDRON_FACES) {
+        const double* A = Base[Face[0]];
+        const double* B = Base[Face[1]];
+        const double* C = Base[Face[2]];
+        // 第r行第c个顶点为A*(n-r)+B*(r-c)+C*c
+        for (size_t r = 0; r <= n; r++) {
+            double wA = Frequency - static_cast<double>(r);
+            for (size_t c = 0; c <= r; c++) {
+                double wB = static_cast<double>(r - c);
+                double wC = static_cast<double>(c);
+                double p[3];
+                for (size_t k = 0; k < 3; k++) {
+                    p[k] = A[k] * wA + B[k] * wB + C[k] * wC;
+                }
+                double Length = sqrt(p[0] * p[0] + p[1] * p[1] + p[2] * p[2]);
+                Target.AddVertex(p[0] / Length, p[1] / Length, p[2] / Length);
+            }
+        }
+        for (size_t r = 0; r < n; r++) {
+            size_t Top = First + r * (r + 1) / 2;
+            size_t Bottom = First + (r + 1) * (r + 2) / 2;
+            for (size_t c = 0; c <= r; c++) {
+                Target.AddFace(Top + c, Bottom + c, Bottom + c + 1);
+                if (c < r) {
+                    Target.AddFace(Top + c, Bottom + c + 1, Top + c + 1);
+                }
+            }
+        }
+        First += (n + 1) * (n + 2) / 2;
+    }
+}
+/*************************************************************************
+【函数名称】EmitSoup
+【函数功能】生成随机三角形汤：每个面的三个顶点分布在以随机点为中心的
+       单位立方体内，中心分布在边长为s的立方体内（s*s*s不少于元素数），
+       使平均密度与元素数无关
+【参数】Sink& Target, 表示接收顶点、面和线的对象
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+template <class Sink>
+void MeshGenerator::EmitSoup(Sink& Target) const {
+    SplitMix64 Random(m_Seed);
+    size_t s = 1;
+    while (s * s * s < m_ElementCount) {
+        s++;
+    }
+    double Extent = static_cast<double>(s);
+    for (size_t i = 0; i < m_ElementCount; i++) {
+        double Center[3];
+        for (double& Coordinate : Center) {
+            Coordinate = Random.NextDouble(0, Extent);
+        }
+        for (size_t k = 0; k < 3; k++) {
+            Target.AddVertex(Center[0] + Random.NextDouble(-0.5, 0.5),
+                Center[1] + Random.NextDouble(-0.5, 0.5),
+                Center[2] + Random.NextDouble(-0.5, 0.5));
+        }
+        Target.AddFace(i * 3, i * 3 + 1, i * 3 + 2);
+    }
+}
+/*************************************************************************
+【函数名称】EmitWireframe
+【函数功能】生成抖动的立方晶格线框：每个格点向+x、+y、+z方向的相邻格点连线，
+       逐层先交出下一层格点再交出本层的线，线数达到元素数时停止
+【参数】Sink& Target, 表示接收顶点、面和线的对象
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+template <class Sink>
+void MeshGenerator::EmitWireframe(Sink& Target) const {
+    SplitMix64 Random(m_Seed);
+    size_t s = LatticeSide();
+    size_t Row = s + 1;
+    size_t Layer = Row * Row;
+    size_t Added = 0;
+    for (size_t z = 0; z <= s; z++) {
+        for (size_t y = 0; y <= s; y++) {
+            for (size_t x = 0; x <= s; x++) {
+                Target.AddVertex(x + Random.NextDouble(-0.1, 0.1),
+                    y + Random.NextDouble(-0.1, 0.1),
+                    z + Random.NextDouble(-0.1, 0.1));
+            }
+        }
+        if (z == 0) {
+            continue;
+        }
+        // 交出上一层的线（其+z方向的端点在刚交出的这一层）
+        for (size_t y = 0; y <= s; y++) {
+            for (size_t x = 0; x <= s; x++) {
+                size_t a = (z - 1) * Layer + y * Row + x;
+                if (x < s && Added < m_ElementCount) {
+                    Target.AddLine(a, a + 1);
+                    Added++;
+                }
+                if (y < s && Added < m_ElementCount) {
+                    Target.AddLine(a, a + Row);
+                    Added++;
+                }
+                if (Added < m_ElementCount) {
+                    Target.AddLine(a, a + Layer);
+                    Added++;
+                }
+            }
+        }
+    }
+    // 最上层没有+z方向的线
+    for (size_t y = 0; y <= s; y++) {
+        for (size_t x = 0; x <= s; x++) {
+            size_t a = s * Layer + y * Row + x;
+            if (x < s && Added < m_ElementCount) {
+                Target.AddLine(a, a + 1);
+                Added++;
+            }
+            if (y < s && Added < m_ElementCount) {
+                Target.AddLine(a, a + Row);
+                Added++;
+            }
+        }
+    }
+}
@@ -0,0 +1,163 @@
+/*************************************************************************
+【文件名】MeshGenerator.hpp
+【功能模块和目的】定义MeshGenerator类，按种子确定性地生成测试和基准用的模型
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】2026/10/19 谭雯心 流式生成到文件支持PorterRegistry登记的格式
+*************************************************************************/
+#ifndef MESHGENERATOR_HPP
+#define MESHGENERATOR_HPP
+
+// ModelStreamStage所属头文件
+#include "ModelStreamStage.hpp"
+// ModelBatcher所属头文件
+#include "ModelBatcher.hpp"
+// IndexedModel3D所属头文件
+#include "IndexedModel3D.hpp"
+// Model3D所属头文件
+#include "Model3D.hpp"
+// invalid_argument所属头文件
+#include <stdexcept>
+// string所属头文件
+#include <string>
+// uint64_t所属头文件
+#include <cstdint>
+// size_t所属头文件
+#include <cstddef>
+
+using namespace std;
+
+/*************************************************************************
+【类名】MeshGenerator
+【功能】按形状、元素数和种子生成模型，相同参数生成相同的模型
+       （随机数由SplitMix64产生，不依赖标准库随机数分布的实现）。
+       生成过程边算边交出顶点、面和线，可直接写入流式处理阶段
+       （OBJStreamWriter、M3BStreamWriter等），也可生成IndexedModel3D或Model3D。
+       支持的形状：
+       GRID      起伏网格，恰好ElementCount个面
+       SPHERE    测地线细分的二十面体球面，面数为20*n*n中最接近ElementCount
+                 的值；各细分块边界上的顶点按块重复输出，坐标逐位相同，
+                 焊接或转换为Model3D时合并
+       SOUP      随机三角形汤，恰好ElementCount个互不相连的面
+       WIREFRAME 抖动的立方晶格线框，恰好ElementCount条线
+【接口说明】
+    内嵌异常类FILE_NOT_SUPPORTED、FILE_NOT_AVAILABLE
+    公有类型Shape
+    带参构造函数（形状、元素数、种子）
+    拷贝构造函数
+    赋值运算符
+    虚析构函数
+    获取形状、元素数、种子
+    获取将生成的顶点数、面数、线数
+    生成到ModelBatcher（不调用Finish）
+    生成到流式处理阶段
+    生成IndexedModel3D、Model3D
+    按扩展名（.obj、.m3b等）流式生成到文件
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+class MeshGenerator {
+public:
+    //-------------------------------------------------------------------------
+    // 内嵌异常类
+    //-------------------------------------------------------------------------
+    // 若文件类型没有流式写出器，则抛出该异常
+    class FILE_NOT_SUPPORTED : public invalid_argument {
+    public:
+        FILE_NOT_SUPPORTED(const string& FileName);
+    };
+    // 若文件无法写入，则抛出该异常
+    class FILE_NOT_AVAILABLE : public invalid_argument {
+    public:
+        FILE_NOT_AVAILABLE(const string& FileName);
+    };
+    //-------------------------------------------------------------------------
+    // 公有类型
+    //-------------------------------------------------------------------------
+    // 形状
+    enum class Shape {
+        GRID,
+        SPHERE,
+        SOUP,
+        WIREFRAME
+    };
+    //-------------------------------------------------------------------------
+    // 静态常量
+    //-------------------------------------------------------------------------
+    // 默认种子
+    static constexpr uint64_t DEFAULT_SEED{20241019};
+    //-------------------------------------------------------------------------
+    // 必要的构造、析构、拷贝、赋值运算符重载函数
+    //-------------------------------------------------------------------------
+    // 带参构造函数
+    MeshGenerator(Shape AShape, size_t ElementCount,
+                  uint64_t Seed = DEFAULT_SEED);
+    // 拷贝构造函数
+    MeshGenerator(const MeshGenerator& Source) = default;
+    // 赋值运算符
+    MeshGenerator& operator=(const MeshGenerator& Source) = default;
+    // 虚析构函数
+    virtual ~MeshGenerator() = default;
+    //-------------------------------------------------------------------------
+    // 非静态Getter成员函数
+    //-------------------------------------------------------------------------
+    // 获取形状
+    Shape GetShape() const;
+    // 获取元素数
+    size_t GetElementCount() const;
+    // 获取种子
+    uint64_t GetSeed() const;
+    // 获取将生成的顶点数（球面含各细分块重复的边界顶点）
+    size_t GetVertexCount() const;
+    // 获取将生成的面数
+    size_t GetFaceCount() const;
+    // 获取将生成的线数
+    size_t GetLineCount() const;
+    // 生成到ModelBatcher（不调用Finish，便于继续追加）
+    void Generate(ModelBatcher& Batcher) const;
+    // 生成到流式处理阶段
+    void Generate(ModelStreamStage& Stage,
+        size_t BatchSize = ModelBatcher::DEFAULT_BATCH_SIZE) const;
+    // 生成IndexedModel3D
+    IndexedModel3D GenerateIndexed() const;
+    // 生成Model3D
+    Model3D GenerateModel() const;
+    // 按扩展名（.obj、.m3b等有流式写出器的格式）流式生成到文件
+    void GenerateToFile(const string& FileName) const;
+
+private:
+    //-------------------------------------------------------------------------
+    // 私有非静态成员函数
+    //-------------------------------------------------------------------------
+    // 球面每条二十面体棱的细分段数
+    size_t SphereFrequency() const;
+    // 线框晶格每条边的格数
+    size_t LatticeSide() const;
+    // 网格每条边的格数
+    size_t GridSide() const;
+    // 把模型逐条交给Sink（ModelBatcher或IndexedModel3D）
+    template <class Sink>
+    void Emit(Sink& Target) const;
+    // 生成起伏网格
+    template <class Sink>
+    void EmitGrid(Sink& Target) const;
+    // 生成测地线细分球面
+    template <class Sink>
+    void EmitSphere(Sink& Target) const;
+    // 生成随机三角形汤
+    template <class Sink>
+    void EmitSoup(Sink& Target) const;
+    // 生成抖动的立方晶格线框
+    template <class Sink>
+    void EmitWireframe(Sink& Target) const;
+    //-------------------------------------------------------------------------
+    // 私有非静态成员
+    //-------------------------------------------------------------------------
+    // 形状
+    Shape m_Shape;
+    // 元素数
+    size_t m_ElementCount;
+    // 种子
+    uint64_t m_Seed;
+};
+
+#endif /* MeshGenerator.hpp */
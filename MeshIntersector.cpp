@@ -0,0 +1,570 @@
+/*************************************************************************
+【文件名】MeshIntersector.cpp
+【功能模块和目的】定义MeshIntersector类的成员函数
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】2026/10/19 谭雯心 遍历任务改由TaskScheduler执行
+*************************************************************************/
+// MeshIntersector所属头文件
+#include "MeshIntersector.hpp"
+// IndexedModel3D所属头文件
+#include "IndexedModel3D.hpp"
+// Model3D所属头文件
+#include "Model3D.hpp"
+// TriangleIntersection所属头文件
+#include "TriangleIntersection.hpp"
+// TaskScheduler所属头文件
+#include "TaskScheduler.hpp"
+// sort, min, max所属头文件
+#include <algorithm>
+// sqrt所属头文件
+#include <cmath>
+// numeric_limits所属头文件
+#include <limits>
+// pair所属头文件
+#include <utility>
+// vector所属头文件
+#include <vector>
+// size_t所属头文件
+#include <cstddef>
+
+using namespace std;
+
+namespace {
+    /*************************************************************************
+    【类名】FaceBVH
+    【功能】以面包围盒构建的层次包围盒树（BVH）。按质心在最长轴上取中位数
+           二分，叶结点最多包含LEAF_SIZE个面；结点存放在连续数组中，
+           叶结点的面编号存放在Order的[First, First + Count)区间
+    【接口说明】
+        带参构造函数（模型、包围盒外扩量）
+        判断两个结点的包围盒是否重叠
+        获取结点
+    【开发者及日期】谭雯心 2026/10/19
+    【更改记录】
+    *************************************************************************/
+    class FaceBVH {
+    public:
+        // 叶结点最多包含的面数
+        static constexpr size_t LEAF_SIZE{4};
+        // 树结点
+        struct Node {
+            // 包围盒的最小坐标和最大坐标
+            double Min[3];
+            double Max[3];
+            // 叶结点：面在Order中的起始位置和数量；内部结点：Count为0
+            size_t First;
+            size_t Count;
+            // 内部结点的两个子结点编号
+            size_t Left;
+            size_t Right;
+        };
+        // 带参构造函数
+        FaceBVH(const IndexedModel3D& AModel, double Margin);
+        // 两个结点的包围盒是否重叠
+        static bool Overlap(const Node& a, const Node& b) {
+            return a.Min[0] <= b.Max[0] && b.Min[0] <= a.Max[0]
+                && a.Min[1] <= b.Max[1] && b.Min[1] <= a.Max[1]
+                && a.Min[2] <= b.Max[2] && b.Min[2] <= a.Max[2];
+        }
+        // 全部结点，0号为根结点（没有面时为空）
+        vector<Node> Nodes{};
+        // 叶结点引用的面编号
+        vector<size_t> Order{};
+
+    private:
+        // 构建[First, Last)区间内的面的子树，返回结点编号
+        size_t Build(size_t First, size_t Last);
+        // 每个面的包围盒（6个数：最小x、y、z，最大x、y、z）
+        vector<double> m_Boxes{};
+    };
+    /*************************************************************************
+    【函数名称】FaceBVH::FaceBVH
+    【函数功能】带参构造函数，计算每个面的包围盒（向外扩展Margin）并建树
+    【参数】const IndexedModel3D& AModel, 表示模型
+           double Margin, 表示包围盒外扩量
+    【返回值】无
+    【开发者及日期】谭雯心 2026/10/19
+    【更改记录】
+    *************************************************************************/
+    FaceBVH::FaceBVH(const IndexedModel3D& AModel, double Margin) {
+        const vector<double>& V = AModel.Vertices();
+        const vector<size_t>& F = AModel.FaceIndices();
+        size_t FaceCount = AModel.GetFaceCount();
+        m_Boxes.resize(FaceCount * 6);
+        Order.resize(FaceCount);
+        for (size_t f = 0; f < FaceCount; f++) {
+            const double* a = &V[F[f * 3] * 3];
+            const double* b = &V[F[f * 3 + 1] * 3];
+            const double* c = &V[F[f * 3 + 2] * 3];
+            for (size_t k = 0; k < 3; k++) {
+                m_Boxes[f * 6 + k] = min({a[k], b[k], c[k]}) - Margin;
+                m_Boxes[f * 6 + 3 + k] = max({a[k], b[k], c[k]}) + Margin;
+            }
+            Order[f] = f;
+        }
+        if (FaceCount > 0) {
+            Nodes.reserve(FaceCount / LEAF_SIZE * 2 + 1);
+            Build(0, FaceCount);
+        }
+    }
+    /*************************************************************************
+    【函数名称】FaceBVH::Build
+    【函数功能】构建Order中[First, Last)区间内的面的子树
+    【参数】size_t First, size_t Last, 表示区间
+    【返回值】size_t，子树根结点的编号
+    【开发者及日期】谭雯心 2026/10/19
+    【更改记录】
+    *************************************************************************/
+    size_t FaceBVH::Build(size_t First, size_t Last) {
+        size_t Index = Nodes.size();
+        Nodes.push_back(Node());
+        Node Current;
+        for (size_t k = 0; k < 3; k++) {
+            Current.Min[k] = numeric_limits<double>::infinity();
+            Current.Max[k] = -numeric_limits<double>::infinity();
+        }
+        for (size_t i = First; i < Last; i++) {
+            const double* Box = &m_Boxes[Order[i] * 6];
+            for (size_t k = 0; k < 3; k++) {
+                Current.Min[k] = min(Current.Min[k], Box[k]);
+                Current.Max[k] = max(Current.Max[k], Box[3 + k]);
+            }
+        }
+        Current.First = First;
+        Current.Count = Last - First;
+        Current.Left = 0;
+        Current.Right = 0;
+        if (Last - First > LEAF_SIZE) {
+            // 在包围盒最长的轴上按质心中位数二分
+            size_t Axis = 0;
+            for (size_t k = 1; k < 3; k++) {
+                if (Current.Max[k] - Current.Min[k]
+                    > Current.Max[Axis] - Current.Min[Axis]) {
+                    Axis = k;
+                }
+            }
+            size_t Middle = First + (Last - First) / 2;
+            nth_element(Order.begin() + First, Order.begin() + Middle,
+                Order.begin() + Last, [this, Axis](size_t a, size_t b) {
+                    return m_Boxes[a * 6 + Axis] + m_Boxes[a * 6 + 3 + Axis]
+                        < m_Boxes[b * 6 + Axis] + m_Boxes[b * 6 + 3 + Axis];
+                });
+            Current.Count = 0;
+            Current.Left = Build(First, Middle);
+            Current.Right = Build(Middle, Last);
+        }
+        Nodes[Index] = Current;
+        return Index;
+    }
+    /*************************************************************************
+    【类名】PairTraversal
+    【功能】同时遍历两棵BVH（或同一棵BVH与自身），对包围盒重叠的叶结点中的
+           面对调用精确测试。先在调用线程中把遍历展开成足够多的独立任务，
+           再由TaskScheduler并行执行，各任务单独收集结果
+    【接口说明】
+        带参构造函数（两棵树、是否为自相交、精确测试）
+        执行遍历并返回排序后的结果
+    【开发者及日期】谭雯心 2026/10/19
+    【更改记录】2026/10/19 谭雯心 任务改由TaskScheduler执行
+    *************************************************************************/
+    template <class TestType>
+    class PairTraversal {
+    public:
+        // 带参构造函数
+        PairTraversal(const FaceBVH& First, const FaceBVH& Second,
+                      bool IsSelf, const TestType& Test)
+            : m_First(First), m_Second(Second), m_IsSelf(IsSelf),
+              m_Test(Test) {
+        }
+        // 执行遍历
+        MeshIntersector::FacePairList Run(size_t ThreadCount);
+
+    private:
+        // 遍历任务：Self为true时表示结点A与自身，否则为A与B
+        struct Task {
+            size_t A;
+            size_t B;
+            bool Self;
+        };
+        // 把任务展开一层，结果追加到Next，不可展开的任务原样追加
+        bool Expand(const Task& ATask, vector<Task>& Next) const;
+        // 在当前线程中递归完成一个任务
+        void Process(const Task& ATask,
+                     MeshIntersector::FacePairList& Found) const;
+        // 测试两个叶结点中的全部面对
+        void TestLeaves(const FaceBVH::Node& a, const FaceBVH::Node& b,
+                        bool Self, MeshIntersector::FacePairList& Found) const;
+        // 第一棵树
+        const FaceBVH& m_First;
+        // 第二棵树（自相交时与第一棵相同）
+        const FaceBVH& m_Second;
+        // 是否为自相交
+        bool m_IsSelf;
+        // 精确测试
+        const TestType& m_Test;
+    };
+    /*************************************************************************
+    【函数名称】PairTraversal::Run
+    【函数功能】按并行度展开任务，在TaskScheduler中执行遍历
+    【参数】size_t ThreadCount, 表示并行度，为1时不展开
+    【返回值】MeshIntersector::FacePairList，排序后的相交面对
+    【开发者及日期】谭雯心 2026/10/19
+    【更改记录】2026/10/19 谭雯心 改为由TaskScheduler执行，不再自行创建线程
+    *************************************************************************/
+    template <class TestType>
+    MeshIntersector::FacePairList PairTraversal<TestType>::Run(
+        size_t ThreadCount) {
+        MeshIntersector::FacePairList Result;
+        if (m_First.Nodes.empty() || m_Second.Nodes.empty()) {
+            return Result;
+        }
+        // 展开到任务数足以让各线程负载均衡，或无法继续展开为止
+        vector<Task> Tasks{Task{0, 0, m_IsSelf}};
+        const size_t TASKS_PER_THREAD = 64;
+        bool Expanded = true;
+        while (ThreadCount > 1 && Expanded
+               && Tasks.size() < ThreadCount * TASKS_PER_THREAD) {
+            vector<Task> Next;
+            Expanded = false;
+            for (const Task& ATask : Tasks) {
+                Expanded = Expand(ATask, Next) || Expanded;
+            }
+            Tasks.swap(Next);
+        }
+        vector<MeshIntersector::FacePairList> Partial(Tasks.size());
+        TaskScheduler::GetInstance()->ParallelFor(0, Tasks.size(), 1,
+            [&](size_t First, size_t Last) {
+                for (size_t i = First; i < Last; i++) {
+                    Process(Tasks[i], Partial[i]);
+                }
+            });
+        for (auto& Found : Partial) {
+            Result.insert(Result.end(), Found.begin(), Found.end());
+        }
+        sort(Result.begin(), Result.end());
+        return Result;
+    }
+    /*************************************************************************
+    【函数名称】PairTraversal::Expand
+    【函数功能】把任务展开一层：结点与自身展开为两个子结点各自与自身及
+           两个子结点之间；两个结点展开为较大结点的子结点与另一结点。
+           包围盒不重叠的任务被丢弃，两个叶结点的任务原样保留
+    【参数】const Task& ATask, 表示任务；vector<Task>& Next, 用于追加结果
+    【返回值】bool，是否展开
+    【开发者及日期】谭雯心 2026/10/19
+    【更改记录】
+    *************************************************************************/
+    template <class TestType>
+    bool PairTraversal<TestType>::Expand(
+        const Task& ATask, vector<Task>& Next) const {
+        const FaceBVH::Node& a = m_First.Nodes[ATask.A];
+        const FaceBVH::Node& b = m_Second.Nodes[ATask.B];
+        if (ATask.Self) {
+            if (a.Count > 0) {
+                Next.push_back(ATask);
+                return false;
+            }
+            Next.push_back(Task{a.Left, a.Left, true});
+            Next.push_back(Task{a.Right, a.Right, true});
+            Next.push_back(Task{a.Left, a.Right, false});
+            return true;
+        }
+        if (!FaceBVH::Overlap(a, b)) {
+            return true;
+        }
+        if (a.Count > 0 && b.Count > 0) {
+            Next.push_back(ATask);
+            return false;
+        }
+        bool SplitA = b.Count > 0 || (a.Count == 0
+            && a.Max[0] - a.Min[0] + a.Max[1] - a.Min[1] + a.Max[2] - a.Min[2]
+            >= b.Max[0] - b.Min[0] + b.Max[1] - b.Min[1] + b.Max[2] - b.Min[2]);
+        if (SplitA) {
+            Next.push_back(Task{a.Left, ATask.B, false});
+            Next.push_back(Task{a.Right, ATask.B, false});
+        }
+        else {
+            Next.push_back(Task{ATask.A, b.Left, false});
+            Next.push_back(Task{ATask.A, b.Right, false});
+        }
+        return true;
+    }
+    /*************************************************************************
+    【函数名称】PairTraversal::Process
+    【函数功能】在当前线程中用显式栈完成一个任务
+    【参数】const Task& ATask, 表示任务
+           MeshIntersector::FacePairList& Found, 用于收集相交面对
+    【返回值】无
+    【开发者及日期】谭雯心 2026/10/19
+    【更改记录】
+    *************************************************************************/
+    template <class TestType>
+    void PairTraversal<TestType>::Process(
+        const Task& ATask, MeshIntersector::FacePairList& Found) const {
+        vector<Task> Stack{ATask};
+        vector<Task> Next;
+        while (!Stack.empty()) {
+            Task Current = Stack.back();
+            Stack.pop_back();
+            Next.clear();
+            if (Expand(Current, Next)) {
+                Stack.insert(Stack.end(), Next.begin(), Next.end());
+            }
+            else {
+                TestLeaves(m_First.Nodes[Current.A],
+                    m_Second.Nodes[Current.B], Current.Self, Found);
+            }
+        }
+    }
+    /*************************************************************************
+    【函数名称】PairTraversal::TestLeaves
+    【函数功能】测试两个叶结点（或一个叶结点与自身）中的全部面对
+    【参数】const FaceBVH::Node& a, const FaceBVH::Node& b, 表示叶结点
+           bool Self, 表示是否为叶结点与自身
+           MeshIntersector::FacePairList& Found, 用于收集相交面对
+    【返回值】无
+    【开发者及日期】谭雯心 2026/10/19
+    【更改记录】
+    *************************************************************************/
+    template <class TestType>
+    void PairTraversal<TestType>::TestLeaves(
+        const FaceBVH::Node& a, const FaceBVH::Node& b, bool Self,
+        MeshIntersector::FacePairList& Found) const {
+        MeshIntersector::FacePair Pair;
+        for (size_t i = 0; i < a.Count; i++) {
+            size_t f = m_First.Order[a.First + i];
+            for (size_t j = Self ? i + 1 : 0; j < b.Count; j++) {
+                size_t g = m_Second.Order[b.First + j];
+                if (m_Test(f, g, Pair)) {
+                    Found.push_back(Pair);
+                }
+            }
+        }
+    }
+    /*************************************************************************
+    【函数名称】ResolveThreadCount
+    【函数功能】确定实际使用的并行度
+    【参数】size_t ThreadCount, 表示设置的并行度，0表示使用TaskScheduler
+           的工作者数
+    【返回值】size_t，实际并行度，至少为1
+    【开发者及日期】谭雯心 2026/10/19
+    【更改记录】2026/10/19 谭雯心 0改为使用TaskScheduler的工作者数
+    *************************************************************************/
+    size_t ResolveThreadCount(size_t ThreadCount) {
+        if (ThreadCount == 0) {
+            ThreadCount = TaskScheduler::GetInstance()->GetWorkerCount();
+        }
+        return max<size_t>(ThreadCount, 1);
+    }
+    /*************************************************************************
+    【函数名称】Diagonal
+    【函数功能】计算模型全部面顶点的包围盒对角线长度
+    【参数】const IndexedModel3D& AModel, 表示模型
+    【返回值】double，对角线长度，没有面时为0
+    【开发者及日期】谭雯心 2026/10/19
+    【更改记录】
+    *************************************************************************/
+    double Diagonal(const IndexedModel3D& AModel) {
+        double Min[3];
+        double Max[3];
+        for (size_t k = 0; k < 3; k++) {
+            Min[k] = numeric_limits<double>::infinity();
+            Max[k] = -numeric_limits<double>::infinity();
+        }
+        const vector<double>& V = AModel.Vertices();
+        for (size_t Index : AModel.FaceIndices()) {
+            for (size_t k = 0; k < 3; k++) {
+                Min[k] = min(Min[k], V[Index * 3 + k]);
+                Max[k] = max(Max[k], V[Index * 3 + k]);
+            }
+        }
+        if (AModel.GetFaceCount() == 0) {
+            return 0;
+        }
+        double Sum = 0;
+        for (size_t k = 0; k < 3; k++) {
+            Sum += (Max[k] - Min[k]) * (Max[k] - Min[k]);
+        }
+        return sqrt(Sum);
+    }
+}
+
+//-------------------------------------------------------------------------
+// 静态常量
+//-------------------------------------------------------------------------
+
+// 默认相对容差
+constexpr double MeshIntersector::DEFAULT_TOLERANCE;
+
+//-------------------------------------------------------------------------
+// 非静态Setter成员函数
+//-------------------------------------------------------------------------
+
+/*************************************************************************
+【函数名称】SetThreadCount
+【函数功能】设置并行度（遍历展开的目标线程数），任务在TaskScheduler中
+       执行，为1时在调用线程中串行执行
+【参数】size_t ThreadCount, 表示并行度，0表示使用TaskScheduler的工作者数
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】2026/10/19 谭雯心 改为并行度，任务在TaskScheduler中执行
+*************************************************************************/
+void MeshIntersector::SetThreadCount(size_t ThreadCount) {
+    m_ThreadCount = ThreadCount;
+}
+/*************************************************************************
+【函数名称】SetTolerance
+【函数功能】设置相对容差，负数按0处理
+【参数】double Tolerance, 表示相对容差
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+void MeshIntersector::SetTolerance(double Tolerance) {
+    m_Tolerance = max(Tolerance, 0.0);
+}
+
+//-------------------------------------------------------------------------
+// 非静态Getter成员函数
+//-------------------------------------------------------------------------
+
+/*************************************************************************
+【函数名称】GetThreadCount
+【函数功能】获取并行度
+【参数】无
+【返回值】size_t，并行度，0表示使用TaskScheduler的工作者数
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】2026/10/19 谭雯心 改为并行度，任务在TaskScheduler中执行
+*************************************************************************/
+size_t MeshIntersector::GetThreadCount() const {
+    return m_ThreadCount;
+}
+/*************************************************************************
+【函数名称】GetTolerance
+【函数功能】获取相对容差
+【参数】无
+【返回值】double，相对容差
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+double MeshIntersector::GetTolerance() const {
+    return m_Tolerance;
+}
+/*************************************************************************
+【函数名称】SelfIntersections
+【函数功能】检测索引模型的自相交
+【参数】const IndexedModel3D& AModel, 表示模型
+【返回值】FacePairList，相交的面对，每对中第一个编号较小
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+MeshIntersector::FacePairList MeshIntersector::SelfIntersections(
+    const IndexedModel3D& AModel) const {
+    double Tolerance = m_Tolerance * Diagonal(AModel);
+    FaceBVH Tree(AModel, Tolerance);
+    // 用规范顶点索引判断面是否共享顶点，坐标相同的顶点视为同一顶点
+    vector<size_t> Canonical = AModel.CanonicalVertexIndices();
+    const vector<double>& V = AModel.Vertices();
+    const vector<size_t>& F = AModel.FaceIndices();
+    auto Test = [&](size_t f, size_t g, FacePair& Pair) {
+        size_t A[3];
+        size_t B[3];
+        const double* P[3];
+        const double* Q[3];
+        for (size_t k = 0; k < 3; k++) {
+            A[k] = Canonical[F[f * 3 + k]];
+            B[k] = Canonical[F[g * 3 + k]];
+            P[k] = &V[A[k] * 3];
+            Q[k] = &V[B[k] * 3];
+        }
+        // 统计共享顶点，记录最后一个共享顶点在两个面中的位置
+        size_t SharedCount = 0;
+        size_t SharedA = 0;
+        size_t SharedB = 0;
+        for (size_t a = 0; a < 3; a++) {
+            for (size_t b = 0; b < 3; b++) {
+                if (A[a] == B[b]) {
+                    SharedCount++;
+                    SharedA = a;
+                    SharedB = b;
+                }
+            }
+        }
+        bool Hit;
+        if (SharedCount == 0) {
+            Hit = TriangleIntersection::TriangleTriangle(
+                P[0], P[1], P[2], Q[0], Q[1], Q[2], Tolerance);
+        }
+        else if (SharedCount == 1) {
+            // 交线必经过共享顶点，其另一端位于某个面的对边上
+            Hit = TriangleIntersection::SegmentTriangle(
+                      P[(SharedA + 1) % 3], P[(SharedA + 2) % 3],
+                      Q[0], Q[1], Q[2], Tolerance)
+                || TriangleIntersection::SegmentTriangle(
+                      Q[(SharedB + 1) % 3], Q[(SharedB + 2) % 3],
+                      P[0], P[1], P[2], Tolerance);
+        }
+        else {
+            Hit = false;
+        }
+        Pair = FacePair(min(f, g), max(f, g));
+        return Hit;
+    };
+    PairTraversal<decltype(Test)> Traversal(Tree, Tree, true, Test);
+    return Traversal.Run(ResolveThreadCount(m_ThreadCount));
+}
+/*************************************************************************
+【函数名称】SelfIntersections
+【函数功能】检测Model3D的自相交
+【参数】const Model3D& AModel, 表示模型
+【返回值】FacePairList，相交的面对，编号为面在Faces()中的位置
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+MeshIntersector::FacePairList MeshIntersector::SelfIntersections(
+    const Model3D& AModel) const {
+    return SelfIntersections(IndexedModel3D::FromModel(AModel));
+}
+/*************************************************************************
+【函数名称】Interference
+【函数功能】检测两个索引模型之间的干涉
+【参数】const IndexedModel3D& First, 表示第一个模型
+       const IndexedModel3D& Second, 表示第二个模型
+【返回值】FacePairList，相交的面对，第一项属于First，第二项属于Second
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+MeshIntersector::FacePairList MeshIntersector::Interference(
+    const IndexedModel3D& First, const IndexedModel3D& Second) const {
+    double Tolerance = m_Tolerance * max(Diagonal(First), Diagonal(Second));
+    FaceBVH FirstTree(First, Tolerance);
+    FaceBVH SecondTree(Second, Tolerance);
+    auto Test = [&](size_t f, size_t g, FacePair& Pair) {
+        const double* P[3];
+        const double* Q[3];
+        for (size_t k = 0; k < 3; k++) {
+            P[k] = &First.Vertices()[First.FaceIndices()[f * 3 + k] * 3];
+            Q[k] = &Second.Vertices()[Second.FaceIndices()[g * 3 + k] * 3];
+        }
+        Pair = FacePair(f, g);
+        return TriangleIntersection::TriangleTriangle(
+            P[0], P[1], P[2], Q[0], Q[1], Q[2], Tolerance);
+    };
+    PairTraversal<decltype(Test)> Traversal(
+        FirstTree, SecondTree, false, Test);
+    return Traversal.Run(ResolveThreadCount(m_ThreadCount));
+}
+/*************************************************************************
+【函数名称】Interference
+【函数功能】检测两个Model3D之间的干涉
+【参数】const Model3D& First, 表示第一个模型
+       const Model3D& Second, 表示第二个模型
+【返回值】FacePairList，相交的面对，编号为面在各自Faces()中的位置
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+MeshIntersector::FacePairList MeshIntersector::Interference(
+    const Model3D& First, const Model3D& Second) const {
+    return Interference(IndexedModel3D::FromModel(First),
+                        IndexedModel3D::FromModel(Second));
+}
@@ -0,0 +1,105 @@
+/*************************************************************************
+【文件名】MeshIntersector.hpp
+【功能模块和目的】定义MeshIntersector类，检测模型的自相交和两个模型间的干涉
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】2026/10/19 谭雯心 遍历任务改由TaskScheduler执行
+*************************************************************************/
+#ifndef MESHINTERSECTOR_HPP
+#define MESHINTERSECTOR_HPP
+
+// IndexedModel3D所属头文件
+#include "IndexedModel3D.hpp"
+// Model3D所属头文件
+#include "Model3D.hpp"
+// pair所属头文件
+#include <utility>
+// vector所属头文件
+#include <vector>
+// size_t所属头文件
+#include <cstddef>
+
+using namespace std;
+
+/*************************************************************************
+【类名】MeshIntersector
+【功能】网格相交检测器。粗筛阶段为面包围盒建立层次包围盒树（BVH），
+       同时遍历两棵树（自相交时为同一棵树），只对包围盒重叠的面对执行
+       TriangleIntersection的精确测试；遍历展开为独立任务后由
+       TaskScheduler并行执行。
+       自相交检测中，共享一条边的相邻面不算相交，共享一个顶点的面只在
+       除该顶点外仍有交点时算相交；共面且仅共享顶点的重叠不做检测。
+       结果中的面编号为面在IndexedModel3D（或Model3D::Faces()）中的位置，
+       按字典序排列
+【接口说明】
+    默认构造函数
+    拷贝构造函数
+    赋值运算符
+    虚析构函数
+    设置并行度、相对容差
+    获取并行度、相对容差
+    检测索引模型或Model3D的自相交
+    检测两个索引模型或Model3D之间的干涉
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】2026/10/19 谭雯心 遍历任务改由TaskScheduler执行
+*************************************************************************/
+class MeshIntersector {
+public:
+    //-------------------------------------------------------------------------
+    // 公有类型
+    //-------------------------------------------------------------------------
+    // 相交的面编号对
+    using FacePair = pair<size_t, size_t>;
+    // 相交的面编号对列表
+    using FacePairList = vector<FacePair>;
+    //-------------------------------------------------------------------------
+    // 静态常量
+    //-------------------------------------------------------------------------
+    // 默认相对容差（乘以包围盒对角线长度得到距离容差）
+    static constexpr double DEFAULT_TOLERANCE{1e-9};
+    //-------------------------------------------------------------------------
+    // 必要的构造、析构、拷贝、赋值运算符重载函数
+    //-------------------------------------------------------------------------
+    // 默认构造函数
+    MeshIntersector() = default;
+    // 拷贝构造函数
+    MeshIntersector(const MeshIntersector& Source) = default;
+    // 赋值运算符
+    MeshIntersector& operator=(const MeshIntersector& Source) = default;
+    // 虚析构函数
+    virtual ~MeshIntersector() = default;
+    //-------------------------------------------------------------------------
+    // 非静态Setter成员函数
+    //-------------------------------------------------------------------------
+    // 设置并行度（0表示使用TaskScheduler的工作者数）
+    void SetThreadCount(size_t ThreadCount);
+    // 设置相对容差
+    void SetTolerance(double Tolerance);
+    //-------------------------------------------------------------------------
+    // 非静态Getter成员函数
+    //-------------------------------------------------------------------------
+    // 获取并行度
+    size_t GetThreadCount() const;
+    // 获取相对容差
+    double GetTolerance() const;
+    // 检测索引模型的自相交
+    FacePairList SelfIntersections(const IndexedModel3D& AModel) const;
+    // 检测Model3D的自相交
+    FacePairList SelfIntersections(const Model3D& AModel) const;
+    // 检测两个索引模型之间的干涉，面对的第一项属于First，第二项属于Second
+    FacePairList Interference(
+        const IndexedModel3D& First, const IndexedModel3D& Second) const;
+    // 检测两个Model3D之间的干涉
+    FacePairList Interference(
+        const Model3D& First, const Model3D& Second) const;
+
+private:
+    //-------------------------------------------------------------------------
+    // 私有非静态成员
+    //-------------------------------------------------------------------------
+    // 并行度，0表示使用TaskScheduler的工作者数
+    size_t m_ThreadCount{0};
+    // 相对容差
+    double m_Tolerance{DEFAULT_TOLERANCE};
+};
+
+#endif /* MeshIntersector.hpp */
@@ -0,0 +1,616 @@
+/*************************************************************************
+【文件名】MeshSimplifier.cpp
+【功能模块和目的】定义MeshSimplifier类的成员函数
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+// MeshSimplifier所属头文件
+#include "MeshSimplifier.hpp"
+// HalfEdgeMesh所属头文件
+#include "HalfEdgeMesh.hpp"
+// IndexedModel3D所属头文件
+#include "IndexedModel3D.hpp"
+// Model3D所属头文件
+#include "Model3D.hpp"
+// priority_queue所属头文件
+#include <queue>
+// vector所属头文件
+#include <vector>
+// sort, max, min所属头文件
+#include <algorithm>
+// back_inserter所属头文件
+#include <iterator>
+// greater所属头文件
+#include <functional>
+// sqrt, fabs所属头文件
+#include <cmath>
+// size_t所属头文件
+#include <cstddef>
+// numeric_limits所属头文件
+#include <limits>
+
+using namespace std;
+
+namespace {
+
+// 边界约束平面的权重，越大边界越不易被移动
+constexpr double BOUNDARY_WEIGHT{1000.0};
+// 折叠后面法向与原法向夹角余弦的下限，低于该值视为翻转
+constexpr double MIN_NORMAL_COSINE{0.2};
+
+/*************************************************************************
+【类名】Quadric
+【功能】对称4x4二次误差矩阵，只存储上三角的10个元素
+【接口说明】
+    由平面ax+by+cz+d=0构造
+    累加另一个二次误差矩阵
+    计算点的误差
+    求误差最小的位置
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+struct Quadric {
+    double A[10]{0, 0, 0, 0, 0, 0, 0, 0, 0, 0};
+    // 由平面构造（Weight为权重）
+    static Quadric FromPlane(double a, double b, double c, double d,
+                             double Weight) {
+        Quadric Result;
+        double Plane[4] = {a, b, c, d};
+        size_t k = 0;
+        for (size_t i = 0; i < 4; i++) {
+            for (size_t j = i; j < 4; j++) {
+                Result.A[k++] = Plane[i] * Plane[j] * Weight;
+            }
+        }
+        return Result;
+    }
+    // 累加
+    void operator+=(const Quadric& AQuadric) {
+        for (size_t i = 0; i < 10; i++) {
+            A[i] += AQuadric.A[i];
+        }
+    }
+    // 计算点(x, y, z)的误差 v^T Q v
+    double Evaluate(double x, double y, double z) const {
+        return A[0] * x * x + 2 * A[1] * x * y + 2 * A[2] * x * z
+            + 2 * A[3] * x + A[4] * y * y + 2 * A[5] * y * z + 2 * A[6] * y
+            + A[7] * z * z + 2 * A[8] * z + A[9];
+    }
+    // 求误差最小的位置，矩阵接近奇异时返回false
+    bool Optimal(double Result[3]) const {
+        // 解 [A0 A1 A2; A1 A4 A5; A2 A5 A7] p = -[A3; A6; A8]
+        double Det = A[0] * (A[4] * A[7] - A[5] * A[5])
+            - A[1] * (A[1] * A[7] - A[5] * A[2])
+            + A[2] * (A[1] * A[5] - A[4] * A[2]);
+        double Scale = fabs(A[0]) + fabs(A[4]) + fabs(A[7]);
+        if (fabs(Det) <= 1e-12 * Scale * Scale * Scale || Scale == 0) {
+            return false;
+        }
+        double b0 = -A[3];
+        double b1 = -A[6];
+        double b2 = -A[8];
+        Result[0] = (b0 * (A[4] * A[7] - A[5] * A[5])
+            - A[1] * (b1 * A[7] - A[5] * b2)
+            + A[2] * (b1 * A[5] - A[4] * b2)) / Det;
+        Result[1] = (A[0] * (b1 * A[7] - b2 * A[5])
+            - b0 * (A[1] * A[7] - A[5] * A[2])
+            + A[2] * (A[1] * b2 - b1 * A[2])) / Det;
+        Result[2] = (A[0] * (A[4] * b2 - A[5] * b1)
+            - A[1] * (A[1] * b2 - b1 * A[2])
+            + b0 * (A[1] * A[5] - A[4] * A[2])) / Det;
+        return true;
+    }
+};
+
+/*************************************************************************
+【类名】Collapse
+【功能】优先队列中的边折叠候选：删除顶点Remove，保留顶点Keep并移到Position，
+       Stamp用于判断候选是否因端点变化而过期
+【接口说明】
+    按代价比较（小顶堆）
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+struct Collapse {
+    double Cost;
+    size_t Remove;
+    size_t Keep;
+    unsigned RemoveStamp;
+    unsigned KeepStamp;
+    double Position[3];
+    bool operator>(const Collapse& ACollapse) const {
+        return Cost > ACollapse.Cost;
+    }
+};
+
+/*************************************************************************
+【类名】Decimator
+【功能】一次简化过程中的全部工作数据及操作
+【接口说明】
+    带参构造函数
+    执行简化
+    输出结果
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+class Decimator {
+public:
+    Decimator(const IndexedModel3D& AModel, bool PreserveBoundary)
+        : m_Mesh(AModel) {
+        const IndexedModel3D& Model = m_Mesh.Model();
+        m_Vertices = Model.Vertices();
+        m_Faces = Model.FaceIndices();
+        size_t VertexCount = Model.GetVertexCount();
+        size_t FaceCount = Model.GetFaceCount();
+        m_AliveFaces = FaceCount;
+        m_FaceAlive.assign(FaceCount, true);
+        m_Locked.assign(VertexCount, false);
+        m_Stamps.assign(VertexCount, 0);
+        m_Quadrics.assign(VertexCount, Quadric());
+        m_VertexFaces.assign(VertexCount, vector<size_t>());
+        // 线的端点作为特征约束被锁定
+        for (size_t Index : Model.LineIndices()) {
+            m_Locked[Index] = true;
+        }
+        // 非流形边的端点被锁定，避免破坏拓扑
+        for (size_t HalfEdge : m_Mesh.NonManifoldEdges()) {
+            m_Locked[m_Mesh.Origin(HalfEdge)] = true;
+            m_Locked[m_Mesh.Target(HalfEdge)] = true;
+        }
+        // 累加每个面所在平面的二次误差
+        for (size_t f = 0; f < FaceCount; f++) {
+            size_t a = m_Faces[f * 3];
+            size_t b = m_Faces[f * 3 + 1];
+            size_t c = m_Faces[f * 3 + 2];
+            // 含重复顶点的面直接丢弃
+            if (a == b || b == c || a == c) {
+                m_FaceAlive[f] = false;
+                m_AliveFaces--;
+                continue;
+            }
+            for (size_t i = 0; i < 3; i++) {
+                m_VertexFaces[m_Faces[f * 3 + i]].push_back(f);
+            }
+            double Normal[3];
+            if (!FaceNormal(f, Normal)) {
+                continue;
+            }
+            const double* p = &m_Vertices[a * 3];
+            double d = -(Normal[0] * p[0] + Normal[1] * p[1]
+                + Normal[2] * p[2]);
+            Quadric Q = Quadric::FromPlane(
+                Normal[0], Normal[1], Normal[2], d, 1.0);
+            for (size_t i = 0; i < 3; i++) {
+                m_Quadrics[m_Faces[f * 3 + i]] += Q;
+            }
+        }
+        // 边界边附加过该边且垂直于所在面的约束平面
+        if (PreserveBoundary) {
+            for (size_t HalfEdge : m_Mesh.BoundaryHalfEdges()) {
+                AddBoundaryConstraint(HalfEdge);
+            }
+        }
+    }
+
+    // 执行简化，返回已执行折叠的最大误差
+    double Run(size_t TargetFaceCount, double MaxError) {
+        for (size_t h = 0; h < m_Mesh.GetHalfEdgeCount(); h++) {
+            size_t u = m_Mesh.Origin(h);
+            size_t v = m_Mesh.Target(h);
+            // 内部边只从较小编号一侧加入一次
+            if (m_Mesh.Twin(h) == HalfEdgeMesh::INVALID || u < v) {
+                PushCandidate(u, v);
+            }
+        }
+        double LastError = 0;
+        while (m_AliveFaces > TargetFaceCount && !m_Queue.empty()) {
+            Collapse Top = m_Queue.top();
+            m_Queue.pop();
+            // 跳过过期的候选
+            if (Top.RemoveStamp != m_Stamps[Top.Remove]
+                || Top.KeepStamp != m_Stamps[Top.Keep]) {
+                continue;
+            }
+            if (Top.Cost > MaxError) {
+                break;
+            }
+            if (!CanCollapse(Top)) {
+                continue;
+            }
+            ApplyCollapse(Top);
+            LastError = max(LastError, Top.Cost);
+        }
+        return LastError;
+    }
+
+    // 输出压缩后的索引模型
+    IndexedModel3D Result(const IndexedModel3D& Source) const {
+        IndexedModel3D Output;
+        Output.Name = Source.Name;
+        Output.Description = Source.Description;
+        size_t VertexCount = m_Stamps.size();
+        const size_t INVALID = HalfEdgeMesh::INVALID;
+        vector<size_t> Remap(VertexCount, INVALID);
+        Output.Reserve(VertexCount, m_AliveFaces,
+            m_Mesh.Model().GetLineCount());
+        for (size_t f = 0; f < m_FaceAlive.size(); f++) {
+            if (!m_FaceAlive[f]) {
+                continue;
+            }
+            size_t Indices[3];
+            for (size_t i = 0; i < 3; i++) {
+                size_t v = m_Faces[f * 3 + i];
+                if (Remap[v] == INVALID) {
+                    Remap[v] = Output.AddVertex(m_Vertices[v * 3],
+                        m_Vertices[v * 3 + 1], m_Vertices[v * 3 + 2]);
+                }
+                Indices[i] = Remap[v];
+            }
+            Output.AddFace(Indices[0], Indices[1], Indices[2]);
+        }
+        const vector<size_t>& Lines = m_Mesh.Model().LineIndices();
+        for (size_t i = 0; i < Lines.size(); i += 2) {
+            size_t Indices[2];
+            for (size_t j = 0; j < 2; j++) {
+                size_t v = Lines[i + j];
+                if (Remap[v] == INVALID) {
+                    Remap[v] = Output.AddVertex(m_Vertices[v * 3],
+                        m_Vertices[v * 3 + 1], m_Vertices[v * 3 + 2]);
+                }
+                Indices[j] = Remap[v];
+            }
+            Output.AddLine(Indices[0], Indices[1]);
+        }
+        return Output;
+    }
+
+private:
+    // 计算面的单位法向，退化面返回false
+    bool FaceNormal(size_t f, double Normal[3]) const {
+        const double* a = &m_Vertices[m_Faces[f * 3] * 3];
+        const double* b = &m_Vertices[m_Faces[f * 3 + 1] * 3];
+        const double* c = &m_Vertices[m_Faces[f * 3 + 2] * 3];
+        return UnitNormal(a, b, c, Normal);
+    }
+    // 计算三点所在平面的单位法向，退化时返回false
+    static bool UnitNormal(const double* a, const double* b, const double* c,
+                           double Normal[3]) {
+        double e1[3] = {b[0] - a[0], b[1] - a[1], b[2] - a[2]};
+        double e2[3] = {c[0] - a[0], c[1] - a[1], c[2] - a[2]};
+        Normal[0] = e1[1] * e2[2] - e1[2] * e2[1];
+        Normal[1] = e1[2] * e2[0] - e1[0] * e2[2];
+        Normal[2] = e1[0] * e2[1] - e1[1] * e2[0];
+        double Length = sqrt(Normal[0] * Normal[0] + Normal[1] * Normal[1]
+            + Normal[2] * Normal[2]);
+        if (Length == 0) {
+            return false;
+        }
+        for (size_t i = 0; i < 3; i++) {
+            Normal[i] /= Length;
+        }
+        return true;
+    }
+    // 为边界半边添加约束平面
+    void AddBoundaryConstraint(size_t HalfEdge) {
+        double Normal[3];
+        if (!FaceNormal(m_Mesh.Face(HalfEdge), Normal)) {
+            return;
+        }
+        size_t u = m_Mesh.Origin(HalfEdge);
+        size_t v = m_Mesh.Target(HalfEdge);
+        const double* p = &m_Vertices[u * 3];
+        const double* q = &m_Vertices[v * 3];
+        double Edge[3] = {q[0] - p[0], q[1] - p[1], q[2] - p[2]};
+        // 约束平面法向 = 边方向 x 面法向
+        double c[3] = {Edge[1] * Normal[2] - Edge[2] * Normal[1],
+                       Edge[2] * Normal[0] - Edge[0] * Normal[2],
+                       Edge[0] * Normal[1] - Edge[1] * Normal[0]};
+        double Length = sqrt(c[0] * c[0] + c[1] * c[1] + c[2] * c[2]);
+        if (Length == 0) {
+            return;
+        }
+        for (size_t i = 0; i < 3; i++) {
+            c[i] /= Length;
+        }
+        double d = -(c[0] * p[0] + c[1] * p[1] + c[2] * p[2]);
+        Quadric Q = Quadric::FromPlane(c[0], c[1], c[2], d, BOUNDARY_WEIGHT);
+        m_Quadrics[u] += Q;
+        m_Quadrics[v] += Q;
+    }
+    // 计算边(u, v)的折叠候选并加入优先队列
+    void PushCandidate(size_t u, size_t v) {
+        // 两端均被锁定的边不能折叠
+        if (m_Locked[u] && m_Locked[v]) {
+            return;
+        }
+        Collapse Candidate;
+        // 约定删除未锁定的端点
+        if (m_Locked[u]) {
+            swap(u, v);
+        }
+        Candidate.Remove = u;
+        Candidate.Keep = v;
+        Candidate.RemoveStamp = m_Stamps[u];
+        Candidate.KeepStamp = m_Stamps[v];
+        Quadric Q = m_Quadrics[u];
+        Q += m_Quadrics[v];
+        const double* p = &m_Vertices[u * 3];
+        const double* q = &m_Vertices[v * 3];
+        // 保留端点被锁定时只能折叠到该端点
+        if (m_Locked[v] || !Q.Optimal(Candidate.Position)) {
+            // 在端点和中点中选取误差最小的位置
+            double Options[3][3] = {
+                {q[0], q[1], q[2]},
+                {p[0], p[1], p[2]},
+                {(p[0] + q[0]) / 2, (p[1] + q[1]) / 2, (p[2] + q[2]) / 2}};
+            size_t OptionCount = m_Locked[v] ? 1 : 3;
+            double Best = numeric_limits<double>::infinity();
+            for (size_t i = 0; i < OptionCount; i++) {
+                double Cost = Q.Evaluate(
+                    Options[i][0], Options[i][1], Options[i][2]);
+                if (Cost < Best) {
+                    Best = Cost;
+                    copy(Options[i], Options[i] + 3, Candidate.Position);
+                }
+            }
+        }
+        // 数值误差可能使代价略小于0
+        Candidate.Cost = max(0.0, Q.Evaluate(Candidate.Position[0],
+            Candidate.Position[1], Candidate.Position[2]));
+        m_Queue.push(Candidate);
+    }
+    // 收集顶点的邻接顶点（升序，无重复）
+    vector<size_t> Neighbors(size_t v) const {
+        vector<size_t> Result;
+        for (size_t f : m_VertexFaces[v]) {
+            if (!m_FaceAlive[f]) {
+                continue;
+            }
+            for (size_t i = 0; i < 3; i++) {
+                if (m_Faces[f * 3 + i] != v) {
+                    Result.push_back(m_Faces[f * 3 + i]);
+                }
+            }
+        }
+        sort(Result.begin(), Result.end());
+        Result.erase(unique(Result.begin(), Result.end()), Result.end());
+        return Result;
+    }
+    // 判断面是否包含顶点
+    bool FaceHas(size_t f, size_t v) const {
+        return m_Faces[f * 3] == v || m_Faces[f * 3 + 1] == v
+            || m_Faces[f * 3 + 2] == v;
+    }
+    // 判断顶点移动到新位置后其邻接面（不含被删除的面）是否发生翻转
+    bool Flips(size_t Moving, size_t Other, const double* Position) const {
+        for (size_t f : m_VertexFaces[Moving]) {
+            if (!m_FaceAlive[f] || FaceHas(f, Other)) {
+                continue;
+            }
+            double Before[3];
+            if (!FaceNormal(f, Before)) {
+                continue;
+            }
+            const double* Corners[3];
+            for (size_t i = 0; i < 3; i++) {
+                size_t v = m_Faces[f * 3 + i];
+                Corners[i] = v == Moving ? Position : &m_Vertices[v * 3];
+            }
+            double After[3];
+            if (!UnitNormal(Corners[0], Corners[1], Corners[2], After)) {
+                return true;
+            }
+            if (Before[0] * After[0] + Before[1] * After[1]
+                + Before[2] * After[2] < MIN_NORMAL_COSINE) {
+                return true;
+            }
+        }
+        return false;
+    }
+    // 判断折叠是否保持拓扑（link condition）且不翻转面
+    bool CanCollapse(const Collapse& ACollapse) const {
+        size_t u = ACollapse.Remove;
+        size_t v = ACollapse.Keep;
+        size_t SharedFaces = 0;
+        for (size_t f : m_VertexFaces[u]) {
+            if (m_FaceAlive[f] && FaceHas(f, v)) {
+                SharedFaces++;
+            }
+        }
+        // 边已不存在
+        if (SharedFaces == 0) {
+            return false;
+        }
+        vector<size_t> NeighborsU = Neighbors(u);
+        vector<size_t> NeighborsV = Neighbors(v);
+        vector<size_t> Common;
+        set_intersection(NeighborsU.begin(), NeighborsU.end(),
+            NeighborsV.begin(), NeighborsV.end(), back_inserter(Common));
+        // 公共邻接顶点只能是共享面的第三个顶点
+        if (Common.size() != SharedFaces) {
+            return false;
+        }
+        return !Flips(u, v, ACollapse.Position)
+            && !Flips(v, u, ACollapse.Position);
+    }
+    // 执行折叠
+    void ApplyCollapse(const Collapse& ACollapse) {
+        size_t u = ACollapse.Remove;
+        size_t v = ACollapse.Keep;
+        vector<size_t> Merged;
+        Merged.reserve(m_VertexFaces[u].size() + m_VertexFaces[v].size());
+        for (size_t f : m_VertexFaces[v]) {
+            // 丢弃已删除的面
+            if (!m_FaceAlive[f]) {
+                continue;
+            }
+            // 删除同时包含u和v的面
+            if (FaceHas(f, u)) {
+                m_FaceAlive[f] = false;
+                m_AliveFaces--;
+                continue;
+            }
+            Merged.push_back(f);
+        }
+        for (size_t f : m_VertexFaces[u]) {
+            if (!m_FaceAlive[f]) {
+                continue;
+            }
+            for (size_t i = 0; i < 3; i++) {
+                if (m_Faces[f * 3 + i] == u) {
+                    m_Faces[f * 3 + i] = v;
+                }
+            }
+            Merged.push_back(f);
+        }
+        m_VertexFaces[v].swap(Merged);
+        m_VertexFaces[u].clear();
+        m_VertexFaces[u].shrink_to_fit();
+        copy(ACollapse.Position, ACollapse.Position + 3, &m_Vertices[v * 3]);
+        m_Quadrics[v] += m_Quadrics[u];
+        m_Stamps[u]++;
+        m_Stamps[v]++;
+        // 更新v的全部邻接顶点的候选
+        for (size_t n : Neighbors(v)) {
+            m_Stamps[n]++;
+        }
+        for (size_t n : Neighbors(v)) {
+            PushCandidate(v, n);
+        }
+    }
+
+    // 邻接结构（建立时使用）
+    HalfEdgeMesh m_Mesh;
+    // 顶点坐标（随折叠更新）
+    vector<double> m_Vertices;
+    // 面索引（随折叠更新）
+    vector<size_t> m_Faces;
+    // 面是否存在
+    vector<bool> m_FaceAlive;
+    // 存在的面数
+    size_t m_AliveFaces;
+    // 顶点是否被锁定
+    vector<bool> m_Locked;
+    // 顶点版本号
+    vector<unsigned> m_Stamps;
+    // 顶点的二次误差矩阵
+    vector<Quadric> m_Quadrics;
+    // 顶点的邻接面
+    vector<vector<size_t>> m_VertexFaces;
+    // 折叠候选优先队列（小顶堆）
+    priority_queue<Collapse, vector<Collapse>, greater<Collapse>> m_Queue;
+};
+
+} // namespace
+
+//-------------------------------------------------------------------------
+// 非静态Setter成员函数
+//-------------------------------------------------------------------------
+
+/*************************************************************************
+【函数名称】SetTargetFaceCount
+【函数功能】设置目标面数，简化在面数不大于该值时停止
+【参数】size_t TargetFaceCount，表示目标面数
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+void MeshSimplifier::SetTargetFaceCount(size_t TargetFaceCount) {
+    m_TargetFaceCount = TargetFaceCount;
+}
+/*************************************************************************
+【函数名称】SetMaxError
+【函数功能】设置误差上限，下一次折叠的二次误差（到相关平面距离的平方和）
+       超过该值时停止
+【参数】double MaxError，表示误差上限
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+void MeshSimplifier::SetMaxError(double MaxError) {
+    m_MaxError = MaxError;
+}
+/*************************************************************************
+【函数名称】SetPreserveBoundary
+【函数功能】设置是否保持边界
+【参数】bool PreserveBoundary，表示是否保持边界
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+void MeshSimplifier::SetPreserveBoundary(bool PreserveBoundary) {
+    m_PreserveBoundary = PreserveBoundary;
+}
+/*************************************************************************
+【函数名称】Simplify
+【函数功能】简化索引模型，复杂度O(F log F)
+【参数】const IndexedModel3D& AModel，表示原模型
+【返回值】IndexedModel3D，简化后的模型（顶点已压缩，线保持不变）
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+IndexedModel3D MeshSimplifier::Simplify(const IndexedModel3D& AModel) {
+    Decimator ADecimator(AModel, m_PreserveBoundary);
+    m_LastError = ADecimator.Run(m_TargetFaceCount, m_MaxError);
+    return ADecimator.Result(AModel);
+}
+/*************************************************************************
+【函数名称】Simplify
+【函数功能】简化Model3D，结果可直接由Model3D_OBJ_Exporter导出
+【参数】const Model3D& AModel，表示原模型
+【返回值】Model3D，简化后的模型
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+Model3D MeshSimplifier::Simplify(const Model3D& AModel) {
+    return Simplify(IndexedModel3D::FromModel(AModel)).ToModel();
+}
+
+//-------------------------------------------------------------------------
+// 非静态Getter成员函数
+//-------------------------------------------------------------------------
+
+/*************************************************************************
+【函数名称】GetTargetFaceCount
+【函数功能】获取目标面数
+【参数】无
+【返回值】size_t，目标面数
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+size_t MeshSimplifier::GetTargetFaceCount() const {
+    return m_TargetFaceCount;
+}
+/*************************************************************************
+【函数名称】GetMaxError
+【函数功能】获取误差上限
+【参数】无
+【返回值】double，误差上限
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+double MeshSimplifier::GetMaxError() const {
+    return m_MaxError;
+}
+/*************************************************************************
+【函数名称】GetPreserveBoundary
+【函数功能】获取是否保持边界
+【参数】无
+【返回值】bool，是否保持边界
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+bool MeshSimplifier::GetPreserveBoundary() const {
+    return m_PreserveBoundary;
+}
+/*************************************************************************
+【函数名称】GetLastError
+【函数功能】获取上一次简化中已执行折叠的最大二次误差
+【参数】无
+【返回值】double，最大二次误差
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+double MeshSimplifier::GetLastError() const {
+    return m_LastError;
+}
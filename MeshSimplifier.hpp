@@ -0,0 +1,93 @@
+/*************************************************************************
+【文件名】MeshSimplifier.hpp
+【功能模块和目的】定义MeshSimplifier类，基于二次误差度量（QEM）的网格简化
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+#ifndef MESHSIMPLIFIER_HPP
+#define MESHSIMPLIFIER_HPP
+
+// IndexedModel3D所属头文件
+#include "IndexedModel3D.hpp"
+// Model3D所属头文件
+#include "Model3D.hpp"
+// size_t所属头文件
+#include <cstddef>
+// numeric_limits所属头文件
+#include <limits>
+
+using namespace std;
+
+/*************************************************************************
+【类名】MeshSimplifier
+【功能】以Garland-Heckbert二次误差度量为代价、用优先队列按代价从小到大执行
+       边折叠的网格简化器。模型中的线作为特征约束：线的端点被锁定，
+       不会被移动或删除；边界边附加垂直约束平面，以保持开口轮廓
+【接口说明】
+    默认构造函数
+    拷贝构造函数
+    赋值运算符
+    虚析构函数
+    设置目标面数
+    设置误差上限
+    设置是否保持边界
+    获取目标面数、误差上限、是否保持边界
+    获取上一次简化实际达到的最大误差
+    简化索引模型
+    简化Model3D
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+class MeshSimplifier {
+public:
+    //-------------------------------------------------------------------------
+    // 必要的构造、析构、拷贝、赋值运算符重载函数
+    //-------------------------------------------------------------------------
+    // 默认构造函数
+    MeshSimplifier() = default;
+    // 拷贝构造函数
+    MeshSimplifier(const MeshSimplifier& Source) = default;
+    // 赋值运算符
+    MeshSimplifier& operator=(const MeshSimplifier& Source) = default;
+    // 虚析构函数
+    virtual ~MeshSimplifier() = default;
+    //-------------------------------------------------------------------------
+    // 非静态Setter成员函数
+    //-------------------------------------------------------------------------
+    // 设置目标面数（面数不大于该值时停止）
+    void SetTargetFaceCount(size_t TargetFaceCount);
+    // 设置误差上限（下一次折叠的二次误差超过该值时停止）
+    void SetMaxError(double MaxError);
+    // 设置是否保持边界
+    void SetPreserveBoundary(bool PreserveBoundary);
+    // 简化索引模型
+    IndexedModel3D Simplify(const IndexedModel3D& AModel);
+    // 简化Model3D
+    Model3D Simplify(const Model3D& AModel);
+    //-------------------------------------------------------------------------
+    // 非静态Getter成员函数
+    //-------------------------------------------------------------------------
+    // 获取目标面数
+    size_t GetTargetFaceCount() const;
+    // 获取误差上限
+    double GetMaxError() const;
+    // 获取是否保持边界
+    bool GetPreserveBoundary() const;
+    // 获取上一次简化中已执行折叠的最大二次误差
+    double GetLastError() const;
+
+private:
+    //-------------------------------------------------------------------------
+    // 私有非静态成员
+    //-------------------------------------------------------------------------
+    // 目标面数，默认为0（仅由误差上限控制）
+    size_t m_TargetFaceCount{0};
+    // 误差上限，默认为无穷大（仅由目标面数控制）
+    double m_MaxError{numeric_limits<double>::infinity()};
+    // 是否保持边界
+    bool m_PreserveBoundary{true};
+    // 上一次简化中已执行折叠的最大二次误差
+    double m_LastError{0};
+};
+
+#endif /* MeshSimplifier.hpp */
@@ -2,7 +2,12 @@
 【文件名】Model3D.cpp
 【功能模块和目的】实现Model3D类的行为
 【开发者及日期】谭雯心 2024/8/8
-【更改记录】
+【更改记录】2026/10/19 谭雯心 为集合运算和查重增加了计时探针
+           2026/10/19 谭雯心 面和线改由CountingAllocator分配，增加获取内存占用
+           2026/10/19 谭雯心 增加了为批量添加预留容量
+           2026/10/19 谭雯心 面积、长度和包围盒改由TaskScheduler并行统计
+           2026/10/19 谭雯心 增加了按位置获取、插入、查找面和线及交换面、线列表
+           2026/10/19 谭雯心 增加了修改区间和文件同步基线，用于增量导出
 *************************************************************************/
 // Model3D头文件
 #include "Model3D.hpp"
@@ -12,6 +17,16 @@
 #include "Line3D.hpp"
 // Point3D头文件
 #include "Point3D.hpp"
+// Instrumentation所属头文件
+#include "Instrumentation.hpp"
+// ScopedTimer所属头文件
+#include "ScopedTimer.hpp"
+// MemoryAccounting所属头文件
+#include "MemoryAccounting.hpp"
+// CountingAllocator所属头文件
+#include "CountingAllocator.hpp"
+// TaskScheduler所属头文件
+#include "TaskScheduler.hpp"
 // vector所属头文件
 #include <vector>
 // vector操作所属头文件
@@ -29,9 +44,147 @@
 #include <limits>
 // 流操作所属头文件
 #include <iostream>
+// forward所属头文件
+#include <utility>
+// uint64_t所属头文件
+#include <cstdint>
 
 using namespace std;
 
+namespace {
+    // 合并的探针，处理量为参与合并的面数与线数之和
+    const size_t PROBE_MERGE
+        = Instrumentation::RegisterProbe("Model3D::Merge");
+    // 删除的探针，处理量为要删除的面数与线数之和
+    const size_t PROBE_SUBTRACT
+        = Instrumentation::RegisterProbe("Model3D::Subtract");
+    // 判断相等的探针
+    const size_t PROBE_EQUAL
+        = Instrumentation::RegisterProbe("Model3D::Equal");
+    // 面查重的探针，处理量为比较的面数
+    const size_t PROBE_CONTAIN_FACE
+        = Instrumentation::RegisterProbe("Model3D::ContainFace");
+    // 线查重的探针，处理量为比较的线数
+    const size_t PROBE_CONTAIN_LINE
+        = Instrumentation::RegisterProbe("Model3D::ContainLine");
+    // 并行统计时每块的元素数，不超过一块的模型在调用线程中直接统计
+    const size_t AGGREGATE_GRAIN = 1 << 14;
+
+    /*********************************************************************
+    【类名】Bounds
+    【功能】坐标范围，初始为空（最小值为正无穷，最大值为负无穷）
+    【开发者及日期】谭雯心 2026/10/19
+    【更改记录】
+    *********************************************************************/
+    struct Bounds {
+        // 各坐标的最小值
+        double Min[3]{numeric_limits<double>::infinity(),
+                      numeric_limits<double>::infinity(),
+                      numeric_limits<double>::infinity()};
+        // 各坐标的最大值
+        double Max[3]{-numeric_limits<double>::infinity(),
+                      -numeric_limits<double>::infinity(),
+                      -numeric_limits<double>::infinity()};
+    };
+    /*********************************************************************
+    【函数名称】Extend
+    【函数功能】扩展坐标范围使其包含点
+    【参数】Bounds& Range, 表示坐标范围
+           const Point3D& APoint, 表示点
+    【返回值】无
+    【开发者及日期】谭雯心 2026/10/19
+    【更改记录】
+    *********************************************************************/
+    void Extend(Bounds& Range, const Point3D& APoint) {
+        const double Coordinates[3]{APoint.X, APoint.Y, APoint.Z};
+        for (size_t k = 0; k < 3; k++) {
+            Range.Min[k] = min(Range.Min[k], Coordinates[k]);
+            Range.Max[k] = max(Range.Max[k], Coordinates[k]);
+        }
+    }
+    /*********************************************************************
+    【函数名称】Unite
+    【函数功能】合并两个坐标范围
+    【参数】const Bounds& First, 表示第一个坐标范围
+           const Bounds& Second, 表示第二个坐标范围
+    【返回值】Bounds，同时包含两者的坐标范围
+    【开发者及日期】谭雯心 2026/10/19
+    【更改记录】
+    *********************************************************************/
+    Bounds Unite(const Bounds& First, const Bounds& Second) {
+        Bounds Result;
+        for (size_t k = 0; k < 3; k++) {
+            Result.Min[k] = min(First.Min[k], Second.Min[k]);
+            Result.Max[k] = max(First.Max[k], Second.Max[k]);
+        }
+        return Result;
+    }
+    /*********************************************************************
+    【函数名称】Sum
+    【函数功能】两数相加，用作并行归约的合并函数
+    【参数】const double& First, const double& Second, 表示两个加数
+    【返回值】double，和
+    【开发者及日期】谭雯心 2026/10/19
+    【更改记录】
+    *********************************************************************/
+    double Sum(const double& First, const double& Second) {
+        return First + Second;
+    }
+
+    /*********************************************************************
+    【函数名称】MakeElement
+    【函数功能】创建元素并返回其shared_ptr。对象与控制块一次分配，
+           对象计入元素类别，控制块计入控制块类别
+    【参数】Args&&... Arguments, 表示元素构造函数的参数
+    【返回值】shared_ptr<T>，新建的元素
+    【开发者及日期】谭雯心 2026/10/19
+    【更改记录】
+    *********************************************************************/
+    template <typename T, typename... Args>
+    shared_ptr<T> MakeElement(Args&&... Arguments) {
+        return allocate_shared<T>(CountingAllocator<T,
+            MemoryAccounting::Category::ELEMENTS, T>(),
+            forward<Args>(Arguments)...);
+    }
+
+    /*********************************************************************
+    【函数名称】ControlBlockBytes
+    【函数功能】测量MakeElement为T类型元素分配的控制块字节数，
+           即当前线程创建一个样本元素前后控制块类别累计分配的差值。
+           每种类型只测量一次
+    【参数】const T& Sample, 表示样本元素
+    【返回值】uint64_t，每个元素的控制块字节数
+    【开发者及日期】谭雯心 2026/10/19
+    【更改记录】
+    *********************************************************************/
+    template <typename T>
+    uint64_t ControlBlockBytes(const T& Sample) {
+        static const uint64_t Bytes = [&Sample]() {
+            uint64_t Before = MemoryAccounting::GetThreadAllocatedBytes(
+                MemoryAccounting::Category::CONTROL_BLOCKS);
+            shared_ptr<T> Probe = MakeElement<T>(Sample);
+            return MemoryAccounting::GetThreadAllocatedBytes(
+                MemoryAccounting::Category::CONTROL_BLOCKS) - Before;
+        }();
+        return Bytes;
+    }
+
+    /*********************************************************************
+    【函数名称】HeapStringBytes
+    【函数功能】估计字符串在堆上占用的字节数，未超出短字符串缓冲区时为0
+    【参数】const string& Text, 表示字符串
+    【返回值】uint64_t，字节数（含结尾的'\0'）
+    【开发者及日期】谭雯心 2026/10/19
+    【更改记录】
+    *********************************************************************/
+    uint64_t HeapStringBytes(const string& Text) {
+        if (Text.capacity() <= string().capacity()) {
+            return 0;
+        }
+        return Text.capacity() + 1;
+    }
+}
+
 //-------------------------------------------------------------------------
 // 内嵌异常类
 //-------------------------------------------------------------------------
@@ -118,12 +271,12 @@ Model3D::Model3D(vector<Line3D> VLines, vector<Face3D> VFaces) {
     m_Lines.clear();
     for (size_t i = 0; i < VFaces.size(); i++) {
         // 将VFaces中的元素转换为shared_ptr<Line3D>类型，并添加到m_Faces中
-        shared_ptr<Face3D> FacePTR = make_shared<Face3D>(VFaces[i]);
+        shared_ptr<Face3D> FacePTR = MakeElement<Face3D>(VFaces[i]);
         m_Faces.push_back(FacePTR);
     }
     for (size_t i = 0; i < VLines.size(); i++) {
         // 将VLines中的元素转换为shared_ptr<Line3D>类型，并添加到m_Lines中
-        shared_ptr<Line3D> LinePTR = make_shared<Line3D>(VLines[i]);
+        shared_ptr<Line3D> LinePTR = MakeElement<Line3D>(VLines[i]);
         m_Lines.push_back(LinePTR);
     }
 }
@@ -134,6 +287,7 @@ Model3D::Model3D(vector<Line3D> VLines, vector<Face3D> VFaces) {
 【返回值】无
 【开发者及日期】谭雯心 2024/8/8
 【更改记录】2024/8/11 谭雯心 将拷贝构造函数改为深拷贝
+           2026/10/19 谭雯心 拷贝修改区间和同步基线
 *************************************************************************/
 Model3D::Model3D(const Model3D& Source) {
     // 清空当前对象的m_Faces和m_Lines
@@ -141,17 +295,21 @@ Model3D::Model3D(const Model3D& Source) {
     m_Lines.clear();
     // 深拷贝Source的m_Faces
     for (const auto& face : Source.m_Faces) {
-        shared_ptr<Face3D> FacePTR = make_shared<Face3D>(*face);
+        shared_ptr<Face3D> FacePTR = MakeElement<Face3D>(*face);
         m_Faces.push_back(FacePTR);
     }
     // 深拷贝Source的m_Lines
     for (const auto& line : Source.m_Lines) {
-        shared_ptr<Line3D> LinePTR = make_shared<Line3D>(*line);
+        shared_ptr<Line3D> LinePTR = MakeElement<Line3D>(*line);
         m_Lines.push_back(LinePTR);
     }
     // 拷贝其他成员变量
     Name = Source.Name;
     Description = Source.Description;
+    m_DirtyFaces = Source.m_DirtyFaces;
+    m_DirtyLines = Source.m_DirtyLines;
+    m_bLayoutChanged = Source.m_bLayoutChanged;
+    m_Baseline = Source.m_Baseline;
 }
 /*************************************************************************
 【函数名称】operator=
@@ -160,6 +318,7 @@ Model3D::Model3D(const Model3D& Source) {
 【返回值】Model3D类的对象的引用
 【开发者及日期】谭雯心 2024/8/8
 【更改记录】2024/8/11 谭雯心 将赋值运算符改为深拷贝
+           2026/10/19 谭雯心 拷贝修改区间和同步基线
 *************************************************************************/
 Model3D& Model3D::operator=(const Model3D& Source) {
     if (this != &Source) {
@@ -168,17 +327,21 @@ Model3D& Model3D::operator=(const Model3D& Source) {
         m_Lines.clear();
         // 深拷贝Source的m_Faces
         for (const auto& face : Source.m_Faces) {
-            shared_ptr<Face3D> FacePTR = make_shared<Face3D>(*face);
+            shared_ptr<Face3D> FacePTR = MakeElement<Face3D>(*face);
             m_Faces.push_back(FacePTR);
         }
         // 深拷贝Source的m_Lines
         for (const auto& line : Source.m_Lines) {
-            shared_ptr<Line3D> LinePTR = make_shared<Line3D>(*line);
+            shared_ptr<Line3D> LinePTR = MakeElement<Line3D>(*line);
             m_Lines.push_back(LinePTR);
         }
         // 拷贝其他成员变量
         Name = Source.Name;
         Description = Source.Description;
+        m_DirtyFaces = Source.m_DirtyFaces;
+        m_DirtyLines = Source.m_DirtyLines;
+        m_bLayoutChanged = Source.m_bLayoutChanged;
+        m_Baseline = Source.m_Baseline;
     }
     return *this;
 }
@@ -193,16 +356,17 @@ Model3D& Model3D::operator=(const Model3D& Source) {
 【参数】const Face3D& AFace, 表示要添加的面
 【返回值】无
 【开发者及日期】谭雯心 2024/8/8
-【更改记录】
+【更改记录】2026/10/19 谭雯心 记录修改区间
 *************************************************************************/
 void Model3D::AddFace(const Face3D& AFace) {
-    shared_ptr<Face3D> FacePTR = make_shared<Face3D>(AFace);
+    shared_ptr<Face3D> FacePTR = MakeElement<Face3D>(AFace);
     // 若已经存在该面，则抛出FACE_ALREADY_EXISTS异常
     if (ContainFace(AFace)) {
         throw FACE_ALREADY_EXISTS();
     }
     // 将面添加到模型面列表的末尾
     m_Faces.push_back(FacePTR);
+    m_DirtyFaces.Mark(m_Faces.size() - 1);
 }
 /*************************************************************************
 【函数名称】AddFace
@@ -212,18 +376,19 @@ void Model3D::AddFace(const Face3D& AFace) {
        const Point3D& Point3，表示要添加的面的三个点
 【返回值】无
 【开发者及日期】谭雯心 2024/8/8
-【更改记录】
+【更改记录】2026/10/19 谭雯心 记录修改区间
 *************************************************************************/
 void Model3D::AddFace(
     const Point3D& Point1, 
     const Point3D& Point2,
     const Point3D& Point3) {
-    shared_ptr<Face3D> FacePTR = make_shared<Face3D>(Point1, Point2, Point3);
+    shared_ptr<Face3D> FacePTR = MakeElement<Face3D>(Point1, Point2, Point3);
     // 若已经存在该面，则抛出FACE_ALREADY_EXISTS异常
     if (ContainFace(*FacePTR)) {
         throw FACE_ALREADY_EXISTS();
     }
     m_Faces.push_back(FacePTR);
+    m_DirtyFaces.Mark(m_Faces.size() - 1);
 }
 /*************************************************************************
 【函数名称】RemoveFace
@@ -231,7 +396,7 @@ void Model3D::AddFace(
 【参数】const Face3D& AFace, 表示要删除的面
 【返回值】无
 【开发者及日期】谭雯心 2024/8/8
-【更改记录】
+【更改记录】2026/10/19 谭雯心 记录修改区间
 *************************************************************************/
 void Model3D::RemoveFace(const Face3D& AFace) {
     // 若找不到对应面，抛出FACE_NOT_FOUND异常
@@ -242,6 +407,7 @@ void Model3D::RemoveFace(const Face3D& AFace) {
         // 若找到对应面，则删除该面
         if (*m_Faces[i] == AFace) {
             m_Faces.erase(m_Faces.begin() + i);
+            InvalidateLayout();
             break;
         }
     }
@@ -254,13 +420,13 @@ void Model3D::RemoveFace(const Face3D& AFace) {
        const Point3D& Point3，表示要删除的面的三个点
 【返回值】无
 【开发者及日期】谭雯心 2024/8/8
-【更改记录】
+【更改记录】2026/10/19 谭雯心 记录修改区间
 *************************************************************************/
 void Model3D::RemoveFace(
     const Point3D& Point1, 
     const Point3D& Point2,
     const Point3D& Point3) {
-    shared_ptr<Face3D> FacePTR = make_shared<Face3D>(Point1, Point2, Point3);
+    shared_ptr<Face3D> FacePTR = MakeElement<Face3D>(Point1, Point2, Point3);
     // 若找不到对应面，抛出FACE_NOT_FOUND异常
     if (!ContainFace(*FacePTR)) {
         throw FACE_NOT_FOUND();
@@ -269,6 +435,7 @@ void Model3D::RemoveFace(
         // 若找到对应面，则删除该面
         if (m_Faces[i] == FacePTR) {
             m_Faces.erase(m_Faces.begin() + i);
+            InvalidateLayout();
             break;
         }
     }
@@ -279,7 +446,7 @@ void Model3D::RemoveFace(
 【参数】size_t Index, 表示要删除的面的位置
 【返回值】无
 【开发者及日期】谭雯心 2024/8/8
-【更改记录】
+【更改记录】2026/10/19 谭雯心 记录修改区间
 *************************************************************************/
 void Model3D::RemoveFace(size_t FaceIndex) {
     // 若找不到对应面，抛出FACE_NOT_FOUND异常
@@ -288,6 +455,7 @@ void Model3D::RemoveFace(size_t FaceIndex) {
     }
     // 删除模型面列表中指定位置的面
     m_Faces.erase(m_Faces.begin() + FaceIndex);
+    InvalidateLayout();
 }
 /*************************************************************************
 【函数名称】ChangeFace
@@ -296,7 +464,7 @@ void Model3D::RemoveFace(size_t FaceIndex) {
        const Face3D& FaceTo, 表示修改后的面
 【返回值】无
 【开发者及日期】谭雯心 2024/8/8
-【更改记录】
+【更改记录】2026/10/19 谭雯心 记录修改区间
 *************************************************************************/
 void Model3D::ChangeFace(const Face3D& FaceFrom, const Face3D& FaceTo) {
     // 若找不到对应面，抛出FACE_NOT_FOUND异常
@@ -306,8 +474,9 @@ void Model3D::ChangeFace(const Face3D& FaceFrom, const Face3D& FaceTo) {
     for (size_t i = 0; i < m_Faces.size(); i++) {
         // 若找到对应面，则尝试修改该面
         if (*m_Faces[i] == FaceFrom) {
-            shared_ptr<Face3D> FacePTR = make_shared<Face3D>(FaceTo);
+            shared_ptr<Face3D> FacePTR = MakeElement<Face3D>(FaceTo);
             m_Faces[i] = FacePTR;
+            m_DirtyFaces.Mark(i);
             break;
         }
     }
@@ -319,7 +488,7 @@ void Model3D::ChangeFace(const Face3D& FaceFrom, const Face3D& FaceTo) {
        const Face3D& AFace, 表示要修改的面
 【返回值】无
 【开发者及日期】谭雯心 2024/8/8
-【更改记录】
+【更改记录】2026/10/19 谭雯心 记录修改区间
 *************************************************************************/
 void Model3D::ChangeFace(size_t FaceIndex, const Face3D& AFace) {
     // 若找不到对应面，抛出FACE_NOT_FOUND异常
@@ -327,8 +496,9 @@ void Model3D::ChangeFace(size_t FaceIndex, const Face3D& AFace) {
         throw FACE_NOT_FOUND();
     }
     // 将AFace转换为shared_ptr<Face3D>类型，并替换模型面列表中指定位置的面
-    shared_ptr<Face3D> FacePTR = make_shared<Face3D>(AFace);
+    shared_ptr<Face3D> FacePTR = MakeElement<Face3D>(AFace);
     m_Faces[FaceIndex] = FacePTR;
+    m_DirtyFaces.Mark(FaceIndex);
 }
 /*************************************************************************
 【函数名称】ChangeFacePoint
@@ -338,7 +508,7 @@ void Model3D::ChangeFace(size_t FaceIndex, const Face3D& AFace) {
        const Point3D& PointTo, 表示修改后的点
 【返回值】无
 【开发者及日期】谭雯心 2024/8/8
-【更改记录】
+【更改记录】2026/10/19 谭雯心 记录修改区间
 *************************************************************************/
 void Model3D::ChangeFacePoint(
     const Face3D& AFace, 
@@ -352,6 +522,7 @@ void Model3D::ChangeFacePoint(
         // 若找到对应面，则尝试修改该面的指定点
         if (*m_Faces[i] == AFace) {
             m_Faces[i]->ChangePoint(PointFrom, PointTo);
+            m_DirtyFaces.Mark(i);
             break;
         }
     }
@@ -364,7 +535,7 @@ void Model3D::ChangeFacePoint(
        const Point3D& PointTo, 表示修改后的点
 【返回值】无
 【开发者及日期】谭雯心 2024/8/8
-【更改记录】
+【更改记录】2026/10/19 谭雯心 记录修改区间
 *************************************************************************/
 void Model3D::ChangeFacePoint(
     size_t FaceIndex, 
@@ -376,6 +547,7 @@ void Model3D::ChangeFacePoint(
     }
     // 尝试修改模型面列表中指定位置的面的指定点
     m_Faces[FaceIndex]->ChangePoint(PointFrom, PointTo);
+    m_DirtyFaces.Mark(FaceIndex);
 }
 /*************************************************************************
 【函数名称】ChangeFacePoint
@@ -386,6 +558,7 @@ void Model3D::ChangeFacePoint(
 【返回值】无
 【开发者及日期】谭雯心 2024/8/8
 【更改记录】2024/8/11 谭雯心 增加POINT_NOT_FOUND异常处理
+           2026/10/19 谭雯心 记录修改区间
 *************************************************************************/
 void Model3D::ChangeFacePoint(
     const Face3D& AFace, 
@@ -403,6 +576,7 @@ void Model3D::ChangeFacePoint(
         // 若找到对应面，则尝试修改该面的指定位置的点
         if (*m_Faces[i] == AFace) {
             m_Faces[i]->ChangePoint(PointTo, Index);
+            m_DirtyFaces.Mark(i);
             break;
         }
     }
@@ -415,7 +589,7 @@ void Model3D::ChangeFacePoint(
        const Point3D& PointTo, 表示修改后的点
 【返回值】无
 【开发者及日期】谭雯心 2024/8/8
-【更改记录】
+【更改记录】2026/10/19 谭雯心 记录修改区间
 *************************************************************************/
 void Model3D::ChangeFacePoint(
     size_t FaceIndex, 
@@ -431,6 +605,7 @@ void Model3D::ChangeFacePoint(
     }
     // 尝试修改模型面列表中指定位置的面的指定位置的点
     m_Faces[FaceIndex]->ChangePoint(PointTo, PointIndex);
+    m_DirtyFaces.Mark(FaceIndex);
 }
 /*************************************************************************
 【函数名称】ClearFaces
@@ -438,10 +613,11 @@ void Model3D::ChangeFacePoint(
 【参数】无
 【返回值】无
 【开发者及日期】谭雯心 2024/8/8
-【更改记录】
+【更改记录】2026/10/19 谭雯心 记录修改区间
 *************************************************************************/
 void Model3D::ClearFaces() { 
-    m_Faces.clear(); 
+    m_Faces.clear();
+    InvalidateLayout();
 }
 /*************************************************************************
 【函数名称】AddLine
@@ -449,15 +625,16 @@ void Model3D::ClearFaces() {
 【参数】const Line3D& ALine, 表示要添加的线
 【返回值】无
 【开发者及日期】谭雯心 2024/8/8
-【更改记录】
+【更改记录】2026/10/19 谭雯心 记录修改区间
 *************************************************************************/
 void Model3D::AddLine(const Line3D& ALine) {
-    shared_ptr<Line3D> LinePTR = make_shared<Line3D>(ALine);
+    shared_ptr<Line3D> LinePTR = MakeElement<Line3D>(ALine);
     // 若已经存在该线，则抛出LINE_ALREADY_EXISTS异常
     if (ContainLine(ALine)) {
         throw LINE_ALREADY_EXISTS();
     }
     m_Lines.push_back(LinePTR);
+    m_DirtyLines.Mark(m_Lines.size() - 1);
 }
 /*************************************************************************
 【函数名称】AddLine
@@ -466,15 +643,16 @@ void Model3D::AddLine(const Line3D& ALine) {
        const Point3D& Point2，表示要添加的线的两个点
 【返回值】无
 【开发者及日期】谭雯心 2024/8/8
-【更改记录】
+【更改记录】2026/10/19 谭雯心 记录修改区间
 *************************************************************************/
 void Model3D::AddLine(const Point3D& Point1, const Point3D& Point2) {
-    shared_ptr<Line3D> LinePTR = make_shared<Line3D>(Point1, Point2);
+    shared_ptr<Line3D> LinePTR = MakeElement<Line3D>(Point1, Point2);
     // 若已经存在该线，则抛出LINE_ALREADY_EXISTS异常
     if (ContainLine(*LinePTR)) {
         throw LINE_ALREADY_EXISTS();
     }
     m_Lines.push_back(LinePTR);
+    m_DirtyLines.Mark(m_Lines.size() - 1);
 }
 /*************************************************************************
 【函数名称】RemoveLine
@@ -482,7 +660,7 @@ void Model3D::AddLine(const Point3D& Point1, const Point3D& Point2) {
 【参数】const Line3D& ALine, 表示要删除的线
 【返回值】无
 【开发者及日期】谭雯心 2024/8/8
-【更改记录】
+【更改记录】2026/10/19 谭雯心 记录修改区间
 *************************************************************************/
 void Model3D::RemoveLine(const Line3D& ALine) {
     // 若找不到对应线，抛出LINE_NOT_FOUND异常
@@ -493,6 +671,7 @@ void Model3D::RemoveLine(const Line3D& ALine) {
         // 若找到对应线，则删除该线
         if (*m_Lines[i] == ALine) {
             m_Lines.erase(m_Lines.begin() + i);
+            InvalidateLayout();
             break;
         }
     }
@@ -503,7 +682,7 @@ void Model3D::RemoveLine(const Line3D& ALine) {
 【参数】size_t Index, 表示要删除的线的位置
 【返回值】无
 【开发者及日期】谭雯心 2024/8/8
-【更改记录】
+【更改记录】2026/10/19 谭雯心 记录修改区间
 *************************************************************************/
 void Model3D::RemoveLine(size_t LineIndex) {
     // 若找不到对应线，抛出LINE_NOT_FOUND异常
@@ -512,6 +691,7 @@ void Model3D::RemoveLine(size_t LineIndex) {
     }
     // 删除模型线列表中指定位置的线
     m_Lines.erase(m_Lines.begin() + LineIndex);
+    InvalidateLayout();
 }
 /*************************************************************************
 【函数名称】RemoveLine
@@ -520,10 +700,10 @@ void Model3D::RemoveLine(size_t LineIndex) {
        const Point3D& Point2，表示要删除的线的两个点
 【返回值】无
 【开发者及日期】谭雯心 2024/8/8
-【更改记录】
+【更改记录】2026/10/19 谭雯心 记录修改区间
 *************************************************************************/
 void Model3D::RemoveLine(const Point3D& Point1, const Point3D& Point2) {
-    shared_ptr<Line3D> LinePTR = make_shared<Line3D>(Point1, Point2);
+    shared_ptr<Line3D> LinePTR = MakeElement<Line3D>(Point1, Point2);
     // 若找不到对应线，抛出LINE_NOT_FOUND异常
     if (!ContainLine(*LinePTR)) {
         throw LINE_NOT_FOUND();
@@ -532,6 +712,7 @@ void Model3D::RemoveLine(const Point3D& Point1, const Point3D& Point2) {
         // 若找到对应线，则删除该线
         if (m_Lines[i] == LinePTR) {
             m_Lines.erase(m_Lines.begin() + i);
+            InvalidateLayout();
             break;
         }
     }
@@ -543,7 +724,7 @@ void Model3D::RemoveLine(const Point3D& Point1, const Point3D& Point2) {
        const Line3D& LineTo, 表示修改后的线
 【返回值】无
 【开发者及日期】谭雯心 2024/8/8
-【更改记录】
+【更改记录】2026/10/19 谭雯心 记录修改区间
 *************************************************************************/
 void Model3D::ChangeLine(const Line3D& LineFrom, const Line3D& LineTo) {
     // 若找不到对应线，抛出LINE_NOT_FOUND异常
@@ -553,8 +734,9 @@ void Model3D::ChangeLine(const Line3D& LineFrom, const Line3D& LineTo) {
     for (size_t i = 0; i < m_Lines.size(); i++) {
         // 若找到对应线，则尝试修改该线
         if (*m_Lines[i] == LineFrom) {
-            shared_ptr<Line3D> LinePTR = make_shared<Line3D>(LineTo);
+            shared_ptr<Line3D> LinePTR = MakeElement<Line3D>(LineTo);
             m_Lines[i] = LinePTR;
+            m_DirtyLines.Mark(i);
             break;
         }
     }
@@ -566,7 +748,7 @@ void Model3D::ChangeLine(const Line3D& LineFrom, const Line3D& LineTo) {
        const Line3D& ALine, 表示要修改的线
 【返回值】无
 【开发者及日期】谭雯心 2024/8/8
-【更改记录】
+【更改记录】2026/10/19 谭雯心 记录修改区间
 *************************************************************************/
 void Model3D::ChangeLine(size_t LineIndex, const Line3D& ALine) {
     // 若找不到对应线，抛出LINE_NOT_FOUND异常
@@ -574,8 +756,9 @@ void Model3D::ChangeLine(size_t LineIndex, const Line3D& ALine) {
         throw LINE_NOT_FOUND();
     }
     // 将ALine转换为shared_ptr<Line3D>类型，并替换模型线列表中指定位置的线
-    shared_ptr<Line3D> LinePTR = make_shared<Line3D>(ALine);
+    shared_ptr<Line3D> LinePTR = MakeElement<Line3D>(ALine);
     m_Lines[LineIndex] = LinePTR;
+    m_DirtyLines.Mark(LineIndex);
 }
 /*************************************************************************
 【函数名称】ChangeLinePoint
@@ -585,7 +768,7 @@ void Model3D::ChangeLine(size_t LineIndex, const Line3D& ALine) {
        const Point3D& PointTo, 表示修改后的点
 【返回值】无
 【开发者及日期】谭雯心 2024/8/8
-【更改记录】
+【更改记录】2026/10/19 谭雯心 记录修改区间
 *************************************************************************/
 void Model3D::ChangeLinePoint(
     const Line3D& ALine, 
@@ -599,6 +782,7 @@ void Model3D::ChangeLinePoint(
         // 若找到对应线，则尝试修改该线的指定点
         if (*m_Lines[i] == ALine) {
             m_Lines[i]->ChangePoint(PointFrom, PointTo);
+            m_DirtyLines.Mark(i);
             break;
         }
     }
@@ -611,7 +795,7 @@ void Model3D::ChangeLinePoint(
        const Point3D& PointTo, 表示修改后的点
 【返回值】无
 【开发者及日期】谭雯心 2024/8/8
-【更改记录】
+【更改记录】2026/10/19 谭雯心 记录修改区间
 *************************************************************************/
 void Model3D::ChangeLinePoint(
     size_t LineIndex, 
@@ -623,6 +807,7 @@ void Model3D::ChangeLinePoint(
     }
     // 尝试修改模型线列表中指定位置的线的指定点
     m_Lines[LineIndex]->ChangePoint(PointFrom, PointTo);
+    m_DirtyLines.Mark(LineIndex);
 }
 /*************************************************************************
 【函数名称】ChangeLinePoint
@@ -633,6 +818,7 @@ void Model3D::ChangeLinePoint(
 【返回值】无
 【开发者及日期】谭雯心 2024/8/8
 【更改记录】2024/8/11 谭雯心 增加POINT_NOT_FOUND异常处理
+           2026/10/19 谭雯心 记录修改区间
 *************************************************************************/
 void Model3D::ChangeLinePoint(
     const Line3D& ALine, 
@@ -650,6 +836,7 @@ void Model3D::ChangeLinePoint(
         // 若找到对应线，则尝试修改该线的指定位置的点
         if (*m_Lines[i] == ALine) {
             m_Lines[i]->ChangePoint(PointTo, Index);
+            m_DirtyLines.Mark(i);
             break;
         }
     }
@@ -662,7 +849,7 @@ void Model3D::ChangeLinePoint(
        const Point3D& PointTo, 表示修改后的点
 【返回值】无
 【开发者及日期】谭雯心 2024/8/8
-【更改记录】
+【更改记录】2026/10/19 谭雯心 记录修改区间
 *************************************************************************/
 void Model3D::ChangeLinePoint(
     size_t LineIndex, 
@@ -678,6 +865,7 @@ void Model3D::ChangeLinePoint(
     }
     // 尝试修改模型线列表中指定位置的线的指定位置的点
     m_Lines[LineIndex]->ChangePoint(PointTo, PointIndex);
+    m_DirtyLines.Mark(LineIndex);
 }
 /*************************************************************************
 【函数名称】ClearLines
@@ -685,10 +873,11 @@ void Model3D::ChangeLinePoint(
 【参数】无
 【返回值】无
 【开发者及日期】谭雯心 2024/8/8
-【更改记录】
+【更改记录】2026/10/19 谭雯心 记录修改区间
 *************************************************************************/
 void Model3D::ClearLines() { 
-    m_Lines.clear(); 
+    m_Lines.clear();
+    InvalidateLayout();
 }
 /*************************************************************************
 【函数名称】Clear
@@ -703,6 +892,121 @@ void Model3D::Clear() {
     ClearLines();
 }
 /*************************************************************************
+【函数名称】ReserveFaces
+【函数功能】为再添加Count个面预留容量。容量不足时至少扩大一倍，
+       使连续多次小批量添加的总开销仍为线性
+【参数】size_t Count, 表示将要添加的面数
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+void Model3D::ReserveFaces(size_t Count) {
+    if (m_Faces.size() + Count > m_Faces.capacity()) {
+        m_Faces.reserve(max(m_Faces.size() + Count, m_Faces.capacity() * 2));
+    }
+}
+/*************************************************************************
+【函数名称】ReserveLines
+【函数功能】为再添加Count条线预留容量，规则与ReserveFaces相同
+【参数】size_t Count, 表示将要添加的线数
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+void Model3D::ReserveLines(size_t Count) {
+    if (m_Lines.size() + Count > m_Lines.capacity()) {
+        m_Lines.reserve(max(m_Lines.size() + Count, m_Lines.capacity() * 2));
+    }
+}
+/*************************************************************************
+【函数名称】InsertFace
+【函数功能】在模型面列表的指定位置插入面，与ChangeFace(size_t)一样
+       不检查是否重复，由调用者保证（用于撤销删除）
+【参数】size_t FaceIndex, 表示插入的位置，可等于面的数量
+       const Face3D& AFace, 表示要插入的面
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】2026/10/19 谭雯心 记录修改区间
+*************************************************************************/
+void Model3D::InsertFace(size_t FaceIndex, const Face3D& AFace) {
+    // 若位置超出范围，抛出FACE_NOT_FOUND异常
+    if (FaceIndex > m_Faces.size()) {
+        throw FACE_NOT_FOUND();
+    }
+    m_Faces.insert(m_Faces.begin() + FaceIndex, MakeElement<Face3D>(AFace));
+    // 插入到末尾等同于追加，插入到中间时之后的面都移动了位置
+    if (FaceIndex + 1 == m_Faces.size()) {
+        m_DirtyFaces.Mark(FaceIndex);
+    }
+    else {
+        InvalidateLayout();
+    }
+}
+/*************************************************************************
+【函数名称】InsertLine
+【函数功能】在模型线列表的指定位置插入线，不检查是否重复
+【参数】size_t LineIndex, 表示插入的位置，可等于线的数量
+       const Line3D& ALine, 表示要插入的线
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】2026/10/19 谭雯心 记录修改区间
+*************************************************************************/
+void Model3D::InsertLine(size_t LineIndex, const Line3D& ALine) {
+    // 若位置超出范围，抛出LINE_NOT_FOUND异常
+    if (LineIndex > m_Lines.size()) {
+        throw LINE_NOT_FOUND();
+    }
+    m_Lines.insert(m_Lines.begin() + LineIndex, MakeElement<Line3D>(ALine));
+    // 插入到末尾等同于追加，插入到中间时之后的线都移动了位置
+    if (LineIndex + 1 == m_Lines.size()) {
+        m_DirtyLines.Mark(LineIndex);
+    }
+    else {
+        InvalidateLayout();
+    }
+}
+/*************************************************************************
+【函数名称】SwapFaces
+【函数功能】与另一模型交换面列表，只交换容器，不复制面
+【参数】Model3D& AModel, 表示另一模型
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】2026/10/19 谭雯心 记录修改区间
+*************************************************************************/
+void Model3D::SwapFaces(Model3D& AModel) {
+    m_Faces.swap(AModel.m_Faces);
+    InvalidateLayout();
+    AModel.InvalidateLayout();
+}
+/*************************************************************************
+【函数名称】SwapLines
+【函数功能】与另一模型交换线列表，只交换容器，不复制线
+【参数】Model3D& AModel, 表示另一模型
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】2026/10/19 谭雯心 记录修改区间
+*************************************************************************/
+void Model3D::SwapLines(Model3D& AModel) {
+    m_Lines.swap(AModel.m_Lines);
+    InvalidateLayout();
+    AModel.InvalidateLayout();
+}
+/*************************************************************************
+【函数名称】MarkSynced
+【函数功能】记录模型已与文件一致（导入或导出之后），清空修改区间，
+       之后的修改从这里开始记录
+【参数】const SyncBaseline& Baseline, 表示文件此时的状态
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+void Model3D::MarkSynced(const SyncBaseline& Baseline) {
+    m_Baseline = Baseline;
+    m_DirtyFaces.Clear();
+    m_DirtyLines.Clear();
+    m_bLayoutChanged = false;
+}
+/*************************************************************************
 【函数名称】operator+=
 【函数功能】+=运算符重载，合并两个模型
 【参数】const Model3D& AModel, 表示另一个Model3D类的对象
@@ -790,9 +1094,10 @@ Model3D& Model3D::operator-=(const vector<Line3D>& VLines) {
 【参数】const Model3D& AModel, 表示另一个Model3D类的对象
 【返回值】bool，表示两个模型是否相等
 【开发者及日期】谭雯心 2024/8/8
-【更改记录】
+【更改记录】2026/10/19 谭雯心 增加了计时探针
 *************************************************************************/
 bool Model3D::operator==(const Model3D& AModel) const {
+    ScopedTimer Timer(PROBE_EQUAL);
     // 若两个模型的面和线数量不相等，则两个模型不相等
     if (m_Faces.size() != AModel.Faces().size()
         || m_Lines.size() != AModel.Lines().size()) {
@@ -829,8 +1134,11 @@ bool Model3D::operator!=(const Model3D& AModel) const {
 【返回值】Model3D类的对象
 【开发者及日期】谭雯心 2024/8/8
 【更改记录】2024/8/11 谭雯心 修改合并模型的逻辑
+           2026/10/19 谭雯心 增加了计时探针
 *************************************************************************/
 Model3D Model3D::operator+(const Model3D& AModel) const {
+    ScopedTimer Timer(PROBE_MERGE);
+    Timer.AddItems(AModel.GetElementCount());
     Model3D result = *this;
     for (auto Face : AModel.Faces()) {
         // 若AModel中的面已经存在于result中，则不添加到result中
@@ -859,8 +1167,11 @@ Model3D Model3D::operator+(const Model3D& AModel) const {
 【返回值】Model3D类的对象
 【开发者及日期】谭雯心 2024/8/8
 【更改记录】2024/8/11 谭雯心 修改合并面的逻辑
+           2026/10/19 谭雯心 增加了计时探针
 *************************************************************************/
 Model3D Model3D::operator+(const vector<Face3D>& VFaces) const {
+    ScopedTimer Timer(PROBE_MERGE);
+    Timer.AddItems(VFaces.size());
     Model3D result = *this;
     for (auto Face : VFaces) {
         // 若VFaces中的面已经存在于result中，则不添加到result中
@@ -880,8 +1191,11 @@ Model3D Model3D::operator+(const vector<Face3D>& VFaces) const {
 【返回值】Model3D类的对象
 【开发者及日期】谭雯心 2024/8/8
 【更改记录】2024/8/11 谭雯心 修改合并线的逻辑
+           2026/10/19 谭雯心 增加了计时探针
 *************************************************************************/
 Model3D Model3D::operator+(const vector<Line3D>& VLines) const {
+    ScopedTimer Timer(PROBE_MERGE);
+    Timer.AddItems(VLines.size());
     Model3D result = *this;
     for (auto Line : VLines) {
         // 若VLines中的线已经存在于result中，则不添加到result中
@@ -900,9 +1214,11 @@ Model3D Model3D::operator+(const vector<Line3D>& VLines) const {
 【参数】const Model3D& AModel, 表示另一个Model3D类的对象
 【返回值】Model3D类的对象
 【开发者及日期】谭雯心 2024/8/8
-【更改记录】
+【更改记录】2026/10/19 谭雯心 增加了计时探针
 *************************************************************************/
 Model3D Model3D::operator-(const Model3D& AModel) const {
+    ScopedTimer Timer(PROBE_SUBTRACT);
+    Timer.AddItems(AModel.GetElementCount());
     Model3D result = *this;
     for (auto Face : AModel.Faces()) {
         result.RemoveFace(*Face);
@@ -918,9 +1234,11 @@ Model3D Model3D::operator-(const Model3D& AModel) const {
 【参数】const vector<Face3D>& VFaces, 表示要删除的面列表
 【返回值】Model3D类的对象
 【开发者及日期】谭雯心 2024/8/8
-【更改记录】
+【更改记录】2026/10/19 谭雯心 增加了计时探针
 *************************************************************************/
 Model3D Model3D::operator-(const vector<Face3D>& VFaces) const {
+    ScopedTimer Timer(PROBE_SUBTRACT);
+    Timer.AddItems(VFaces.size());
     Model3D result = *this;
     for (auto Face : VFaces) {
         result.RemoveFace(Face);
@@ -933,9 +1251,11 @@ Model3D Model3D::operator-(const vector<Face3D>& VFaces) const {
 【参数】const vector<Line3D>& VLines, 表示要删除的线列表
 【返回值】Model3D类的对象
 【开发者及日期】谭雯心 2024/8/8
-【更改记录】
+【更改记录】2026/10/19 谭雯心 增加了计时探针
 *************************************************************************/
 Model3D Model3D::operator-(const vector<Line3D>& VLines) const {
+    ScopedTimer Timer(PROBE_SUBTRACT);
+    Timer.AddItems(VLines.size());
     Model3D result = *this;
     for (auto Line : VLines) {
         result.RemoveLine(Line);
@@ -1004,14 +1324,18 @@ size_t Model3D::GetLineCount() const {
 【参数】无
 【返回值】double，表示模型中面的总面积
 【开发者及日期】谭雯心 2024/8/8
-【更改记录】
+【更改记录】2026/10/19 谭雯心 改为由TaskScheduler分块并行求和
 *************************************************************************/
 double Model3D::Area() const {
-    double sum = 0;
-    for (auto Face : m_Faces) {
-        sum += Face->Area();
-    }
-    return sum;
+    return TaskScheduler::GetInstance()->ParallelReduce<double>(
+        0, m_Faces.size(), AGGREGATE_GRAIN, 0.0,
+        [this](size_t First, size_t Last) {
+            double sum = 0;
+            for (size_t i = First; i < Last; i++) {
+                sum += m_Faces[i]->Area();
+            }
+            return sum;
+        }, Sum);
 }
 /*************************************************************************
 【函数名称】Length
@@ -1019,14 +1343,18 @@ double Model3D::Area() const {
 【参数】无
 【返回值】double，表示模型中线的总长度
 【开发者及日期】谭雯心 2024/8/8
-【更改记录】
+【更改记录】2026/10/19 谭雯心 改为由TaskScheduler分块并行求和
 *************************************************************************/
 double Model3D::Length() const {
-    double sum = 0;
-    for (auto Line : m_Lines) {
-        sum += Line->Length();
-    }
-    return sum;
+    return TaskScheduler::GetInstance()->ParallelReduce<double>(
+        0, m_Lines.size(), AGGREGATE_GRAIN, 0.0,
+        [this](size_t First, size_t Last) {
+            double sum = 0;
+            for (size_t i = First; i < Last; i++) {
+                sum += m_Lines[i]->Length();
+            }
+            return sum;
+        }, Sum);
 }
 /*************************************************************************
 【函数名称】BoundingBoxVolume
@@ -1034,77 +1362,38 @@ double Model3D::Length() const {
 【参数】无
 【返回值】double，表示模型的包围盒体积
 【开发者及日期】谭雯心 2024/8/8
-【更改记录】
+【更改记录】2026/10/19 谭雯心 改为由TaskScheduler分块并行求坐标范围
 *************************************************************************/
 double Model3D::BoundingBoxVolume() const {
-    // 将模型中的所有点的坐标值的最大值和最小值分别赋给
-    // MaxX, MinX, MaxY, MinY, MaxZ, MinZ
-    double MinX = numeric_limits<double>::infinity();
-    double MinY = numeric_limits<double>::infinity();
-    double MinZ = numeric_limits<double>::infinity();
-    double MaxX = -numeric_limits<double>::infinity();
-    double MaxY = -numeric_limits<double>::infinity();
-    double MaxZ = -numeric_limits<double>::infinity();
-    // 遍历模型中的所有面和线，找到所有点的坐标值的最大值和最小值
-    for (auto Face : m_Faces) {
-        for (size_t i = 0; i < 3; i++) {
-            // 若点的坐标值大于MaxX，则将点的坐标值赋给MaxX
-            if (Face->Points[i].X > MaxX) {
-                MaxX = Face->Points[i].X;
-            }
-            // 若点的坐标值小于MinX，则将点的坐标值赋给MinX
-            if (Face->Points[i].X < MinX) {
-                MinX = Face->Points[i].X;
-            }
-            // 若点的坐标值大于MaxY，则将点的坐标值赋给MaxY
-            if (Face->Points[i].Y > MaxY) {
-                MaxY = Face->Points[i].Y;
-            }
-            // 若点的坐标值小于MinY，则将点的坐标值赋给MinY
-            if (Face->Points[i].Y < MinY) {
-                MinY = Face->Points[i].Y;
-            }
-            // 若点的坐标值大于MaxZ，则将点的坐标值赋给MaxZ
-            if (Face->Points[i].Z > MaxZ) {
-                MaxZ = Face->Points[i].Z;
-            }
-            // 若点的坐标值小于MinZ，则将点的坐标值赋给MinZ
-            if (Face->Points[i].Z < MinZ) {
-                MinZ = Face->Points[i].Z;
-            }
-        }
-    }
-    // 遍历模型中的所有线，找到所有点的坐标值的最大值和最小值
-    for (auto Line : m_Lines) {
-        for (size_t i = 0; i < 2; i++) {
-            // 若点的坐标值大于MaxX，则将点的坐标值赋给MaxX
-            if (Line->Points[i].X > MaxX) {
-                MaxX = Line->Points[i].X;
-            }
-            // 若点的坐标值小于MinX，则将点的坐标值赋给MinX
-            if (Line->Points[i].X < MinX) {
-                MinX = Line->Points[i].X;
+    shared_ptr<TaskScheduler> pScheduler = TaskScheduler::GetInstance();
+    // 分块求面的顶点的坐标范围
+    Bounds FaceRange = pScheduler->ParallelReduce<Bounds>(
+        0, m_Faces.size(), AGGREGATE_GRAIN, Bounds(),
+        [this](size_t First, size_t Last) {
+            Bounds Range;
+            for (size_t i = First; i < Last; i++) {
+                for (size_t k = 0; k < 3; k++) {
+                    Extend(Range, m_Faces[i]->Points[k]);
+                }
             }
-            // 若点的坐标值大于MaxY，则将点的坐标值赋给MaxY
-            if (Line->Points[i].Y > MaxY) {
-                MaxY = Line->Points[i].Y;
+            return Range;
+        }, Unite);
+    // 分块求线的端点的坐标范围
+    Bounds LineRange = pScheduler->ParallelReduce<Bounds>(
+        0, m_Lines.size(), AGGREGATE_GRAIN, Bounds(),
+        [this](size_t First, size_t Last) {
+            Bounds Range;
+            for (size_t i = First; i < Last; i++) {
+                for (size_t k = 0; k < 2; k++) {
+                    Extend(Range, m_Lines[i]->Points[k]);
+                }
             }
-            // 若点的坐标值小于MinY，则将点的坐标值赋给MinY
-            if (Line->Points[i].Y < MinY) {
-                MinY = Line->Points[i].Y;
-            }
-            // 若点的坐标值大于MaxZ，则将点的坐标值赋给MaxZ
-            if (Line->Points[i].Z > MaxZ) {
-                MaxZ = Line->Points[i].Z;
-            }
-            // 若点的坐标值小于MinZ，则将点的坐标值赋给MinZ
-            if (Line->Points[i].Z < MinZ) {
-                MinZ = Line->Points[i].Z;
-            }
-        }
-    }
+            return Range;
+        }, Unite);
     // 返回包围盒体积
-    return (MaxX - MinX) * (MaxY - MinY) * (MaxZ - MinZ);
+    Bounds Range = Unite(FaceRange, LineRange);
+    return (Range.Max[0] - Range.Min[0]) * (Range.Max[1] - Range.Min[1])
+        * (Range.Max[2] - Range.Min[2]);
 }
 /*************************************************************************
 【函数名称】ContainFace
@@ -1112,14 +1401,19 @@ double Model3D::BoundingBoxVolume() const {
 【参数】const Face3D& AFace, 表示要查找的面
 【返回值】无
 【开发者及日期】谭雯心 2024/8/8
-【更改记录】
+【更改记录】2026/10/19 谭雯心 增加了计时探针
 *************************************************************************/
 bool Model3D::ContainFace(const Face3D& AFace) const {
+    ScopedTimer Timer(PROBE_CONTAIN_FACE);
+    size_t Compared = 0;
     for (auto Face : m_Faces) {
+        Compared++;
         if (*Face == AFace) {
+            Timer.AddItems(Compared);
             return true;
         }
     }
+    Timer.AddItems(Compared);
     return false;
 }
 /*************************************************************************
@@ -1128,27 +1422,178 @@ bool Model3D::ContainFace(const Face3D& AFace) const {
 【参数】const Face3D& AFace, 表示要查找的线
 【返回值】无
 【开发者及日期】谭雯心 2024/8/8
-【更改记录】
+【更改记录】2026/10/19 谭雯心 增加了计时探针
 *************************************************************************/
 bool Model3D::ContainLine(const Line3D& ALine) const {
+    ScopedTimer Timer(PROBE_CONTAIN_LINE);
+    size_t Compared = 0;
     for (auto Line : m_Lines) {
+        Compared++;
         if (*Line == ALine) {
+            Timer.AddItems(Compared);
             return true;
         }
     }
+    Timer.AddItems(Compared);
     return false;
 }
 /*************************************************************************
+【函数名称】GetFace
+【函数功能】获取指定位置的面，不构造面列表
+【参数】size_t FaceIndex, 表示面的位置
+【返回值】const Face3D&，指定位置的面
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+const Face3D& Model3D::GetFace(size_t FaceIndex) const {
+    // 若找不到对应面，抛出FACE_NOT_FOUND异常
+    if (FaceIndex >= m_Faces.size()) {
+        throw FACE_NOT_FOUND();
+    }
+    return *m_Faces[FaceIndex];
+}
+/*************************************************************************
+【函数名称】GetLine
+【函数功能】获取指定位置的线，不构造线列表
+【参数】size_t LineIndex, 表示线的位置
+【返回值】const Line3D&，指定位置的线
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+const Line3D& Model3D::GetLine(size_t LineIndex) const {
+    // 若找不到对应线，抛出LINE_NOT_FOUND异常
+    if (LineIndex >= m_Lines.size()) {
+        throw LINE_NOT_FOUND();
+    }
+    return *m_Lines[LineIndex];
+}
+/*************************************************************************
+【函数名称】FindFace
+【函数功能】查找与指定面相等的第一个面的位置
+【参数】const Face3D& AFace, 表示要查找的面
+【返回值】size_t，面的位置，找不到时为面的数量
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+size_t Model3D::FindFace(const Face3D& AFace) const {
+    size_t Index = 0;
+    while (Index < m_Faces.size() && *m_Faces[Index] != AFace) {
+        Index++;
+    }
+    return Index;
+}
+/*************************************************************************
+【函数名称】FindLine
+【函数功能】查找与指定线相等的第一条线的位置
+【参数】const Line3D& ALine, 表示要查找的线
+【返回值】size_t，线的位置，找不到时为线的数量
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+size_t Model3D::FindLine(const Line3D& ALine) const {
+    size_t Index = 0;
+    while (Index < m_Lines.size() && *m_Lines[Index] != ALine) {
+        Index++;
+    }
+    return Index;
+}
+/*************************************************************************
+【函数名称】GetMemoryUsage
+【函数功能】获取模型的内存占用明细。按结构计算：元素对象、控制块按个数
+       乘以每个的字节数，顶点存储和容器分别计已用部分和未用的容量，
+       名称和注释只计超出短字符串缓冲区的部分
+【参数】无
+【返回值】MemoryAccounting::Usage，内存占用明细
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+MemoryAccounting::Usage Model3D::GetMemoryUsage() const {
+    MemoryAccounting::Usage Result;
+    for (const auto& Face : m_Faces) {
+        Result.VertexBytes += Face->Points.CountElement() * sizeof(Point3D);
+        Result.SlackBytes += (Face->Points.GetCapacity()
+            - Face->Points.CountElement()) * sizeof(Point3D);
+    }
+    for (const auto& Line : m_Lines) {
+        Result.VertexBytes += Line->Points.CountElement() * sizeof(Point3D);
+        Result.SlackBytes += (Line->Points.GetCapacity()
+            - Line->Points.CountElement()) * sizeof(Point3D);
+    }
+    Result.ElementBytes = m_Faces.size() * sizeof(Face3D)
+        + m_Lines.size() * sizeof(Line3D);
+    if (!m_Faces.empty()) {
+        Result.ControlBlockBytes += m_Faces.size()
+            * ControlBlockBytes(*m_Faces.front());
+    }
+    if (!m_Lines.empty()) {
+        Result.ControlBlockBytes += m_Lines.size()
+            * ControlBlockBytes(*m_Lines.front());
+    }
+    Result.ContainerBytes = m_Faces.size() * sizeof(shared_ptr<Face3D>)
+        + m_Lines.size() * sizeof(shared_ptr<Line3D>);
+    Result.SlackBytes += (m_Faces.capacity() - m_Faces.size())
+        * sizeof(shared_ptr<Face3D>) + (m_Lines.capacity() - m_Lines.size())
+        * sizeof(shared_ptr<Line3D>);
+    Result.OtherBytes = sizeof(Model3D) + HeapStringBytes(Name)
+        + HeapStringBytes(Description);
+    return Result;
+}
+/*************************************************************************
+【函数名称】GetDirtyFaces
+【函数功能】获取自上次导入或导出以来修改或追加过的面的位置
+【参数】无
+【返回值】const DirtyRanges&，面的位置区间
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+const DirtyRanges& Model3D::GetDirtyFaces() const {
+    return m_DirtyFaces;
+}
+/*************************************************************************
+【函数名称】GetDirtyLines
+【函数功能】获取自上次导入或导出以来修改或追加过的线的位置
+【参数】无
+【返回值】const DirtyRanges&，线的位置区间
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+const DirtyRanges& Model3D::GetDirtyLines() const {
+    return m_DirtyLines;
+}
+/*************************************************************************
+【函数名称】IsLayoutChanged
+【函数功能】判断面、线列表的布局是否已改变。删除、在中间插入、交换、
+       清空会移动元素的位置，之后修改区间不再能描述与文件的差异
+【参数】无
+【返回值】bool，布局是否已改变
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+bool Model3D::IsLayoutChanged() const {
+    return m_bLayoutChanged;
+}
+/*************************************************************************
+【函数名称】GetBaseline
+【函数功能】获取与文件同步的基线
+【参数】无
+【返回值】const SyncBaseline&，基线，FileName为空表示没有基线
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+const Model3D::SyncBaseline& Model3D::GetBaseline() const {
+    return m_Baseline;
+}
+/*************************************************************************
 【函数名称】Faces
 【函数功能】获取模型中的面
 【参数】无
 【返回值】vector<shared_ptr<const Face3D>>，外界无法修改的面列表
 【开发者及日期】谭雯心 2024/8/8
-【更改记录】
+【更改记录】2026/10/19 谭雯心 静态变量改为线程局部变量，允许在后台线程中导入模型
 *************************************************************************/
 const vector<shared_ptr<const Face3D>>& Model3D::Faces() const {
-    // 静态变量result, 避免每次调用函数都重新分配内存
-    static vector<shared_ptr<const Face3D>> result;
+    // 线程局部变量result, 避免每次调用函数都重新分配内存
+    thread_local vector<shared_ptr<const Face3D>> result;
     // 清空result之前的内容
     result.clear();
     // 为result预留足够的空间
@@ -1168,11 +1613,11 @@ const vector<shared_ptr<const Face3D>>& Model3D::Faces() const {
 【参数】无
 【返回值】vector<shared_ptr<const Line3D>>，外界无法修改的线列表
 【开发者及日期】谭雯心 2024/8/8
-【更改记录】
+【更改记录】2026/10/19 谭雯心 静态变量改为线程局部变量，允许在后台线程中导入模型
 *************************************************************************/
 const vector<shared_ptr<const Line3D>>& Model3D::Lines() const {
-    // 静态变量result, 避免每次调用函数都重新分配内存
-    static vector<shared_ptr<const Line3D>> result;
+    // 线程局部变量result, 避免每次调用函数都重新分配内存
+    thread_local vector<shared_ptr<const Line3D>> result;
     // 清空result之前的内容
     result.clear();
     // 为result预留足够的空间
@@ -1186,6 +1631,29 @@ const vector<shared_ptr<const Line3D>>& Model3D::Lines() const {
     }
     return result;
 }
+
+//-------------------------------------------------------------------------
+// 私有非静态成员函数
+//-------------------------------------------------------------------------
+
+/*************************************************************************
+【函数名称】InvalidateLayout
+【函数功能】记录面、线列表的布局已改变，修改区间随之失效
+【参数】无
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+void Model3D::InvalidateLayout() {
+    m_bLayoutChanged = true;
+    m_DirtyFaces.Clear();
+    m_DirtyLines.Clear();
+}
+
+//-------------------------------------------------------------------------
+// 友元函数
+//-------------------------------------------------------------------------
+
 /*************************************************************************
 【函数名称】operator<<
 【函数功能】<<运算符重载，输出模型的信息
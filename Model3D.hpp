@@ -5,6 +5,10 @@
 【更改记录】2024/8/10 谭雯心
 修改了向模型中添加面、线，修改面和线中点的函数名称和参数 2024/8/9 谭雯心
 修改了获取模型信息的逻辑
+           2026/10/19 谭雯心 元素和容器改用CountingAllocator计数，增加获取内存占用
+           2026/10/19 谭雯心 增加了为批量添加预留容量
+           2026/10/19 谭雯心 增加了按位置获取、插入、查找面和线及交换面、线列表
+           2026/10/19 谭雯心 增加了修改区间和文件同步基线，用于增量导出
 *************************************************************************/
 #ifndef MODEL3D_HPP
 #define MODEL3D_HPP
@@ -25,6 +29,14 @@
 #include <vector>
 // size_t所属头文件
 #include <cstddef>
+// MemoryAccounting所属头文件
+#include "MemoryAccounting.hpp"
+// CountingAllocator所属头文件
+#include "CountingAllocator.hpp"
+// DirtyRanges所属头文件
+#include "DirtyRanges.hpp"
+// uint64_t所属头文件
+#include <cstdint>
 
 using namespace std;
 
@@ -50,6 +62,9 @@ using namespace std;
     修改模型中线的指定位置的点
     清空线
     清空所有面和线
+    为批量添加面、线预留容量
+    在指定位置插入面、线
+    与另一模型交换面列表、线列表
     +=运算符重载，合并两个模型
     +=运算符重载，合并面到模型
     +=运算符重载，合并线到模型
@@ -74,10 +89,20 @@ using namespace std;
     获取包围盒的体积
     判断模型中是否包含指定面
     判断模型中是否包含指定线
+    获取指定位置的面、线
+    查找面、线的位置
+    获取模型的内存占用明细
+    获取自上次导入或导出以来修改过的面、线位置
+    判断面、线列表的布局是否已改变（删除、中间插入、交换、清空）
+    获取、设置与文件同步的基线
 【开发者及日期】谭雯心 2024/8/8
 【更改记录】2024/8/10 谭雯心
 修改了向模型中添加面、线，修改面和线中点的函数名称和参数 2024/8/9 谭雯心
 修改了获取模型信息的逻辑
+           2026/10/19 谭雯心 元素和容器改用CountingAllocator计数，增加获取内存占用
+           2026/10/19 谭雯心 增加了为批量添加预留容量
+           2026/10/19 谭雯心 增加了按位置获取、插入、查找面和线及交换面、线列表
+           2026/10/19 谭雯心 增加了修改区间和文件同步基线，用于增量导出
 *************************************************************************/
 
 class Model3D {
@@ -116,6 +141,29 @@ public:
         POINT_NOT_FOUND();
     };
     //-------------------------------------------------------------------------
+    // 公有的内嵌类
+    //-------------------------------------------------------------------------
+    // 模型最近一次与M3B文件一致（导入或导出）时文件的状态，增量导出据此
+    // 只写出之后修改过的面和线；FileName为空表示没有基线
+    struct SyncBaseline {
+        // 文件名
+        string FileName{};
+        // 文件的修订号，每次写入都会改变
+        uint64_t Revision{0};
+        // 文件长度
+        uint64_t FileSize{0};
+        // 文件中不含增量部分的长度
+        uint64_t CompactSize{0};
+        // 文件中的面数
+        size_t FaceCount{0};
+        // 文件中的线数
+        size_t LineCount{0};
+        // 文件中的名称
+        string Name{};
+        // 文件中的注释
+        string Description{};
+    };
+    //-------------------------------------------------------------------------
     // 必要的构造、析构、拷贝、赋值运算符重载函数
     //-------------------------------------------------------------------------
     // 默认构造函数
@@ -191,6 +239,20 @@ public:
     void ClearLines();
     // 清空所有面和线
     void Clear();
+    // 为再添加Count个面预留容量
+    void ReserveFaces(size_t Count);
+    // 为再添加Count条线预留容量
+    void ReserveLines(size_t Count);
+    // 在指定位置插入面，不检查是否重复
+    void InsertFace(size_t FaceIndex, const Face3D& AFace);
+    // 在指定位置插入线，不检查是否重复
+    void InsertLine(size_t LineIndex, const Line3D& ALine);
+    // 与另一模型交换面列表
+    void SwapFaces(Model3D& AModel);
+    // 与另一模型交换线列表
+    void SwapLines(Model3D& AModel);
+    // 记录模型已与文件一致，清空修改区间
+    void MarkSynced(const SyncBaseline& Baseline);
     //+=运算符重载，合并两个模型
     Model3D& operator+=(const Model3D& AModel);
     //+=运算符重载，合并面到模型
@@ -246,6 +308,24 @@ public:
     bool ContainFace(const Face3D& AFace) const;
     // 判断模型中是否包含指定线
     bool ContainLine(const Line3D& ALine) const;
+    // 获取指定位置的面
+    const Face3D& GetFace(size_t FaceIndex) const;
+    // 获取指定位置的线
+    const Line3D& GetLine(size_t LineIndex) const;
+    // 查找面的位置，找不到时返回面的数量
+    size_t FindFace(const Face3D& AFace) const;
+    // 查找线的位置，找不到时返回线的数量
+    size_t FindLine(const Line3D& ALine) const;
+    // 获取模型的内存占用明细
+    MemoryAccounting::Usage GetMemoryUsage() const;
+    // 获取自上次导入或导出以来修改或追加过的面的位置
+    const DirtyRanges& GetDirtyFaces() const;
+    // 获取自上次导入或导出以来修改或追加过的线的位置
+    const DirtyRanges& GetDirtyLines() const;
+    // 面、线列表的布局是否已改变，改变后只能整体导出
+    bool IsLayoutChanged() const;
+    // 获取与文件同步的基线
+    const SyncBaseline& GetBaseline() const;
     // ------------------------------------------------------------------------
     // 公有数据成员
     // ------------------------------------------------------------------------
@@ -260,13 +340,28 @@ public:
     friend ostream& operator<<(ostream& out, const Model3D& AModel);
 
 private:
+    //-------------------------------------------------------------------------
+    // 私有非静态成员函数
+    //-------------------------------------------------------------------------
+    // 记录面、线列表的布局已改变
+    void InvalidateLayout();
     //-------------------------------------------------------------------------
     // 私有非静态成员
     //-------------------------------------------------------------------------
     // 私有vector<shared_ptr<Line3D>>类型成员，存储模型中的所有线
-    vector<shared_ptr<Line3D>> m_Lines{};
+    vector<shared_ptr<Line3D>, CountingAllocator<shared_ptr<Line3D>,
+        MemoryAccounting::Category::CONTAINERS>> m_Lines{};
     // 私有vector<shared_ptr<Face3D>>类型成员，存储模型中的所有面
-    vector<shared_ptr<Face3D>> m_Faces{};
+    vector<shared_ptr<Face3D>, CountingAllocator<shared_ptr<Face3D>,
+        MemoryAccounting::Category::CONTAINERS>> m_Faces{};
+    // 自上次导入或导出以来修改或追加过的面的位置
+    DirtyRanges m_DirtyFaces{};
+    // 自上次导入或导出以来修改或追加过的线的位置
+    DirtyRanges m_DirtyLines{};
+    // 面、线列表的布局是否已改变，新建的模型没有对应的文件，视为已改变
+    bool m_bLayoutChanged{true};
+    // 与文件同步的基线
+    SyncBaseline m_Baseline{};
 };
 
 #endif /* Model3D.hpp */
\ No newline at end of file
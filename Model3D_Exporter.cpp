@@ -2,7 +2,11 @@
 【文件名】Model3D_Exporter.cpp
 【功能模块和目的】定义Model3D_Exporter类的成员函数
 【开发者及日期】谭雯心 2024/8/7
-【更改记录】
+【更改记录】2026/10/19 谭雯心 文件改为以二进制方式打开
+           2026/10/19 谭雯心 SaveToFile改为const成员函数
+           2026/10/19 谭雯心 保存时只打开一次文件并使用大缓冲区
+           2026/10/19 谭雯心 改为经临时文件原子保存
+           2026/10/19 谭雯心 文件名以".gz"结尾时压缩保存
 *************************************************************************/
 
 // Model3D_Exporter所属头文件
@@ -13,6 +17,12 @@
 #include <fstream>
 // string所属头文件
 #include <string>
+// vector所属头文件
+#include <vector>
+// streambuf所属头文件
+#include <streambuf>
+// unique_ptr所属头文件
+#include <memory>
 
 using namespace std;
 
@@ -38,16 +48,39 @@ Model3D_Exporter::Model3D_Exporter(const string& FileName)
 
 /*************************************************************************
 【函数名称】SaveToFile
-【函数功能】保存三维模型到文件
+【函数功能】保存三维模型到文件。先经大缓冲区写入同目录的临时文件，
+       同步到磁盘后原子地替换目标文件；导出失败或中途崩溃时目标文件
+       保持原有内容。文件名以".gz"结尾时经GzipStreamBuf压缩后写入
 【参数】const string& FileName, 表示文件名；const Model3D& AModel,
 表示Model3D类的对象 【返回值】无 【开发者及日期】谭雯心 2024/8/7 【更改记录】
+2026/10/19 谭雯心 改为const成员函数，以便多线程共用登记的导出器
+2026/10/19 谭雯心 只打开一次文件并使用大缓冲区
+2026/10/19 谭雯心 改为经临时文件原子保存
+2026/10/19 谭雯心 文件名以".gz"结尾时压缩保存
 *************************************************************************/
 void Model3D_Exporter::SaveToFile(
-    const string& FileName, const Model3D& AModel) {
+    const string& FileName, const Model3D& AModel) const {
     FileValid(FileName);
-    CreateFileNotExists(FileName);
-    FileAvailable(FileName);
-    ofstream File(FileName, ios::trunc);
-    SaveToStream(File, AModel);
-    File.close();
+    string TempName = TempFileName(FileName);
+    // 缓冲区须在File之后析构
+    vector<char> Buffer;
+    ofstream File;
+    // 打开即创建临时文件并测试能否写入，失败时按目标文件名报告
+    try {
+        OpenOutput(TempName, File, Buffer);
+    }
+    catch (const FILE_NOT_AVAILABLE&) {
+        throw FILE_NOT_AVAILABLE(FileName);
+    }
+    // 压缩的流缓冲区须在File之前析构
+    unique_ptr<streambuf> pFilter = AttachCompressor(FileName, File);
+    try {
+        SaveToStream(File, AModel);
+    }
+    catch (...) {
+        DiscardOutput(File, TempName);
+        throw;
+    }
+    // 同步并替换目标文件，失败时删除临时文件并抛出异常
+    CommitOutput(File, TempName, FileName);
 }
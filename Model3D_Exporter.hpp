@@ -2,7 +2,8 @@
 【文件名】Model3D_Exporter.hpp
 【功能模块和目的】定义Model3D_Exporter类，继承自Porter类，表示三维模型的导出器
 【开发者及日期】谭雯心 2024/8/7
-【更改记录】
+【更改记录】2026/10/19 谭雯心 析构函数改为公有
+           2026/10/19 谭雯心 SaveToFile改为const成员函数
 *************************************************************************/
 #ifndef EXPORTER_HPP
 #define EXPORTER_HPP
@@ -28,7 +29,7 @@
     保存三维模型到文件
     保存三维模型到流
 【开发者及日期】谭雯心 2024/8/7
-【更改记录】
+【更改记录】2026/10/19 谭雯心 析构函数改为公有
 *************************************************************************/
 
 class Model3D_Exporter : public Porter {
@@ -44,15 +45,18 @@ protected:
     Model3D_Exporter(const Model3D_Exporter& Source) = delete;
     // 赋值运算符
     Model3D_Exporter& operator=(const Model3D_Exporter& Source) = delete;
-    // 析构函数
-    virtual ~Model3D_Exporter() = default;
 
 public:
+    //-------------------------------------------------------------------------
+    // 必要的析构函数
+    //-------------------------------------------------------------------------
+    // 虚析构函数（公有，以便通过基类指针销毁登记的导出器）
+    virtual ~Model3D_Exporter() = default;
     //-------------------------------------------------------------------------
     // 非静态Getter成员函数
     //-------------------------------------------------------------------------
     // 保存三维模型到文件
-    void SaveToFile(const string& FileName, const Model3D& AModel);
+    void SaveToFile(const string& FileName, const Model3D& AModel) const;
     // 保存三维模型到流（纯虚函数，由派生类具体实现不同文件的导出）
     virtual void SaveToStream(
         ofstream& Stream, const Model3D& AModel) const = 0;
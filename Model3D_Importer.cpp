@@ -2,7 +2,10 @@
 【文件名】Model3D_Importer.cpp
 【功能模块和目的】定义Model3D_Importer类的成员函数
 【开发者及日期】谭雯心 2024/8/7
-【更改记录】
+【更改记录】2026/10/19 谭雯心 增加了流式导入
+           2026/10/19 谭雯心 增加了按文件开头的内容识别格式
+           2026/10/19 谭雯心 导入时只打开一次文件并使用大缓冲区
+           2026/10/19 谭雯心 透明地解压gzip压缩的文件
 *************************************************************************/
 // Model3D_Importer所属头文件
 #include "Model3D_Importer.hpp"
@@ -12,11 +15,66 @@
 #include <fstream>
 // string所属头文件
 #include <string>
+// uint64_t所属头文件
+#include <cstdint>
 // 流操作所属头文件
 #include <iostream>
+// IndexedModel3D所属头文件
+#include "IndexedModel3D.hpp"
+// ModelStreamStage所属头文件
+#include "ModelStreamStage.hpp"
+// ModelBatcher所属头文件
+#include "ModelBatcher.hpp"
+// function所属头文件
+#include <functional>
+// vector所属头文件
+#include <vector>
+// size_t所属头文件
+#include <cstddef>
+// istream所属头文件
+#include <istream>
+// streambuf所属头文件
+#include <streambuf>
+// unique_ptr所属头文件
+#include <memory>
 
 using namespace std;
 
+namespace {
+
+/*************************************************************************
+【类名】CallbackStage
+【功能】把每个批次转交给回调函数的处理阶段
+【接口说明】
+    带参构造函数
+    处理一个批次
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+class CallbackStage : public ModelStreamStage {
+public:
+    explicit CallbackStage(
+        const function<void(const ModelStreamStage::Batch&)>& Callback)
+        : m_Callback(Callback) {
+    }
+    virtual void ProcessBatch(const Batch& ABatch) override {
+        m_Callback(ABatch);
+    }
+
+private:
+    // 回调函数
+    const function<void(const ModelStreamStage::Batch&)>& m_Callback;
+};
+
+} // namespace
+
+//-------------------------------------------------------------------------
+// 静态常量
+//-------------------------------------------------------------------------
+
+// 识别格式时读取的文件开头字节数
+constexpr size_t Model3D_Importer::HEAD_SIZE;
+
 //-------------------------------------------------------------------------
 // 必要的构造、析构、拷贝、赋值运算符重载函数
 //-------------------------------------------------------------------------
@@ -43,14 +101,17 @@ Model3D_Importer::Model3D_Importer(const string& FileName)
 【参数】const string& FileName, 表示文件名
 【返回值】Model3D类的对象
 【开发者及日期】谭雯心 2024/8/7
-【更改记录】
+【更改记录】2026/10/19 谭雯心 文件改为以二进制方式打开
+           2026/10/19 谭雯心 只打开一次文件并使用大缓冲区
+           2026/10/19 谭雯心 透明地解压gzip压缩的文件
 *************************************************************************/
 Model3D Model3D_Importer::LoadFromFile(const string& FileName) const {
-    // 测试文件扩展名是否有效
-    FileValid(FileName);
-    // 测试文件能否打开
-    FileAvailable(FileName);
-    ifstream File(FileName);
+    // 缓冲区须在File之后析构，解压的流缓冲区须在File之前析构
+    vector<char> Buffer;
+    ifstream File;
+    unique_ptr<streambuf> pFilter;
+    // 打开文件并测试是否为本格式
+    OpenValidated(FileName, File, Buffer, pFilter);
     Model3D AModel = LoadFromStream(File);
     File.close();
     return AModel;
@@ -61,15 +122,220 @@ Model3D Model3D_Importer::LoadFromFile(const string& FileName) const {
 【参数】const string& FileName, 表示文件名；Model3D& AModel, 表示Model3D类的对象
 【返回值】无
 【开发者及日期】谭雯心 2024/8/7
-【更改记录】
+【更改记录】2026/10/19 谭雯心 文件改为以二进制方式打开
+           2026/10/19 谭雯心 只打开一次文件并使用大缓冲区
+           2026/10/19 谭雯心 透明地解压gzip压缩的文件
 *************************************************************************/
 void Model3D_Importer::LoadFromFile(
     const string& FileName, Model3D& AModel) const {
-    // 测试文件扩展名是否有效
-    FileValid(FileName);
-    // 测试文件能否打开
-    FileAvailable(FileName);
-    ifstream File(FileName);
+    // 缓冲区须在File之后析构，解压的流缓冲区须在File之前析构
+    vector<char> Buffer;
+    ifstream File;
+    unique_ptr<streambuf> pFilter;
+    // 打开文件并测试是否为本格式
+    OpenValidated(FileName, File, Buffer, pFilter);
     AModel = LoadFromStream(File);
     File.close();
 }
+/*************************************************************************
+【函数名称】StreamFromFile
+【函数功能】从文件流式导入三维模型，把顶点、面和线分批交给处理阶段，
+       不构造完整的Model3D
+【参数】const string& FileName, 表示文件名
+       ModelStreamStage& Stage, 表示处理阶段
+       size_t BatchSize, 表示批次大小
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】2026/10/19 谭雯心 只打开一次文件并使用大缓冲区
+           2026/10/19 谭雯心 透明地解压gzip压缩的文件
+*************************************************************************/
+void Model3D_Importer::StreamFromFile(
+    const string& FileName, ModelStreamStage& Stage,
+    size_t BatchSize) const {
+    // 缓冲区须在File之后析构，解压的流缓冲区须在File之前析构
+    vector<char> Buffer;
+    ifstream File;
+    unique_ptr<streambuf> pFilter;
+    // 打开文件并测试是否为本格式
+    OpenValidated(FileName, File, Buffer, pFilter);
+    ModelBatcher Batcher(Stage, BatchSize);
+    StreamFromStream(File, Batcher);
+    Batcher.Finish();
+    File.close();
+}
+/*************************************************************************
+【函数名称】StreamFromFile
+【函数功能】从文件流式导入三维模型，把每个批次交给回调函数
+【参数】const string& FileName, 表示文件名
+       const function<void(const ModelStreamStage::Batch&)>& Callback,
+       表示回调函数
+       size_t BatchSize, 表示批次大小
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+void Model3D_Importer::StreamFromFile(
+    const string& FileName,
+    const function<void(const ModelStreamStage::Batch&)>& Callback,
+    size_t BatchSize) const {
+    CallbackStage Stage(Callback);
+    StreamFromFile(FileName, Stage, BatchSize);
+}
+/*************************************************************************
+【函数名称】StreamFromStream
+【函数功能】从流流式导入三维模型的默认实现：先用LoadFromStream完整导入，
+       再按顶点、面、线的顺序交给Batcher。不支持逐条读取的格式由此获得
+       流式接口，但内存占用与模型大小有关
+【参数】ifstream& Stream, 表示输入流
+       ModelBatcher& Batcher, 表示批次组装器
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+void Model3D_Importer::StreamFromStream(
+    ifstream& Stream, ModelBatcher& Batcher) const {
+    Model3D AModel = LoadFromStream(Stream);
+    IndexedModel3D Indexed = IndexedModel3D::FromModel(AModel);
+    Batcher.SetName(Indexed.Name);
+    Batcher.SetDescription(Indexed.Description);
+    const vector<double>& Vertices = Indexed.Vertices();
+    for (size_t i = 0; i < Vertices.size(); i += 3) {
+        Batcher.AddVertex(Vertices[i], Vertices[i + 1], Vertices[i + 2]);
+    }
+    const vector<size_t>& Faces = Indexed.FaceIndices();
+    for (size_t i = 0; i < Faces.size(); i += 3) {
+        Batcher.AddFace(Faces[i], Faces[i + 1], Faces[i + 2]);
+    }
+    const vector<size_t>& Lines = Indexed.LineIndices();
+    for (size_t i = 0; i < Lines.size(); i += 2) {
+        Batcher.AddLine(Lines[i], Lines[i + 1]);
+    }
+}
+/*************************************************************************
+【函数名称】FileValid
+【函数功能】测试文件是否为本格式：扩展名一致，或文件开头的内容能被
+       Recognize识别（如扩展名不规范的M3B、PLY文件）
+【参数】const string& FileName, 表示文件名
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+void Model3D_Importer::FileValid(const string& FileName) const {
+    try {
+        Porter::FileValid(FileName);
+        return;
+    }
+    catch (const FILE_NOT_SUPPORTED&) {
+        string Head;
+        uint64_t FileSize;
+        if (!ReadHead(FileName, Head, FileSize) || !Recognize(Head, FileSize)) {
+            throw;
+        }
+    }
+}
+/*************************************************************************
+【函数名称】Recognize
+【函数功能】按文件开头的内容和文件长度识别格式的默认实现：不识别，
+       没有魔数的格式（如OBJ）只按扩展名选择
+【参数】const string& Head, 表示文件开头至多HEAD_SIZE字节
+       uint64_t FileSize, 表示文件长度
+【返回值】bool，是否为本格式
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+bool Model3D_Importer::Recognize(const string& Head, uint64_t FileSize) const {
+    // 显示标记未使用的参数
+    (void)Head;
+    (void)FileSize;
+    return false;
+}
+
+//-------------------------------------------------------------------------
+// 受保护的非静态成员函数
+//-------------------------------------------------------------------------
+
+/*************************************************************************
+【函数名称】OpenValidated
+【函数功能】以Buffer为缓冲区打开文件，内容为gzip数据时接入解压的流缓冲区，
+       再测试是否为本格式：扩展名（压缩文件去掉".gz"）一致时不读取内容；
+       不一致时从同一个流读取解压后的开头交给Recognize，再回到开头。
+       整个导入过程只打开一次文件。返回前令流在badbit时抛出异常，
+       使解压时发现的截断或损坏（GzipFormat::FORMAT_ERROR）穿过流的
+       读函数传给调用者，而不是被当作文件结束
+【参数】const string& FileName, 表示文件名
+       ifstream& File, 表示未打开的输入流，返回时已打开并位于开头
+       vector<char>& Buffer, 表示缓冲区，须在File之后析构
+       unique_ptr<streambuf>& pFilter, 用于存储解压的流缓冲区，
+       须在File之前析构
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】2026/10/19 谭雯心 透明地解压gzip压缩的文件
+           2026/10/19 谭雯心 流在badbit时抛出异常，截断的压缩文件导入失败
+*************************************************************************/
+void Model3D_Importer::OpenValidated(const string& FileName, ifstream& File,
+    vector<char>& Buffer, unique_ptr<streambuf>& pFilter) const {
+    bool bExtensionValid = true;
+    try {
+        Porter::FileValid(FileName);
+    }
+    catch (const FILE_NOT_SUPPORTED&) {
+        bExtensionValid = false;
+    }
+    // 测试文件能否打开
+    OpenInput(FileName, File, Buffer);
+    pFilter = AttachDecompressor(File);
+    if (!bExtensionValid) {
+        string Head;
+        uint64_t FileSize;
+        if (!ReadHead(File, Head, FileSize) || !Recognize(Head, FileSize)) {
+            throw FILE_NOT_SUPPORTED(FileName);
+        }
+    }
+    // 流缓冲区抛出的异常不被流吞掉
+    File.exceptions(ios::badbit);
+}
+
+//-------------------------------------------------------------------------
+// 静态成员函数
+//-------------------------------------------------------------------------
+
+/*************************************************************************
+【函数名称】ReadHead
+【函数功能】读取文件开头至多HEAD_SIZE字节和文件长度
+【参数】const string& FileName, 表示文件名
+       string& Head, 用于存储文件开头的内容
+       uint64_t& FileSize, 用于存储文件长度
+【返回值】bool，文件能否打开
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】2026/10/19 谭雯心 压缩文件读取解压后的开头
+*************************************************************************/
+bool Model3D_Importer::ReadHead(
+    const string& FileName, string& Head, uint64_t& FileSize) {
+    ifstream File(FileName, ios::binary);
+    if (!File.is_open()) {
+        return false;
+    }
+    unique_ptr<streambuf> pFilter = AttachDecompressor(File);
+    return ReadHead(File, Head, FileSize);
+}
+/*************************************************************************
+【函数名称】ReadHead
+【函数功能】读取已打开的流的开头至多HEAD_SIZE字节和流的长度，
+       读完后回到开头，以便同一个流继续用于导入
+【参数】istream& Stream, 表示位于开头的输入流
+       string& Head, 用于存储流开头的内容
+       uint64_t& FileSize, 用于存储流的长度
+【返回值】bool，流能否回到开头
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+bool Model3D_Importer::ReadHead(
+    istream& Stream, string& Head, uint64_t& FileSize) {
+    Head.assign(HEAD_SIZE, '\0');
+    Stream.read(&Head[0], static_cast<streamsize>(HEAD_SIZE));
+    Head.resize(static_cast<size_t>(Stream.gcount()));
+    Stream.clear();
+    streamoff Size = Stream.rdbuf()->pubseekoff(0, ios::end, ios::in);
+    FileSize = Size > 0 ? static_cast<uint64_t>(Size) : 0;
+    return Stream.rdbuf()->pubseekpos(0, ios::in) == streampos(0);
+}
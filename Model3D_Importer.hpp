@@ -2,7 +2,10 @@
 【文件名】Model3D_Importer.hpp
 【功能模块和目的】定义Model3D_Importer类，继承自Porter类，表示三维模型的导入器
 【开发者及日期】谭雯心 2024/8/7
-【更改记录】
+【更改记录】2026/10/19 谭雯心 增加了流式导入，析构函数改为公有
+           2026/10/19 谭雯心 增加了按文件开头的内容识别格式
+           2026/10/19 谭雯心 导入时只打开一次文件并使用大缓冲区
+           2026/10/19 谭雯心 透明地解压gzip压缩的文件
 *************************************************************************/
 #ifndef IMPORTER_HPP
 #define IMPORTER_HPP
@@ -11,8 +14,28 @@
 #include "Model3D.hpp"
 // Porter所属头文件
 #include "Porter.hpp"
+// ModelStreamStage所属头文件
+#include "ModelStreamStage.hpp"
+// ModelBatcher所属头文件
+#include "ModelBatcher.hpp"
 // fstream所属头文件
 #include <fstream>
+// function所属头文件
+#include <functional>
+// string所属头文件
+#include <string>
+// uint64_t所属头文件
+#include <cstdint>
+// size_t所属头文件
+#include <cstddef>
+// istream所属头文件
+#include <istream>
+// vector所属头文件
+#include <vector>
+// streambuf所属头文件
+#include <streambuf>
+// unique_ptr所属头文件
+#include <memory>
 
 using namespace std;
 
@@ -27,8 +50,15 @@ using namespace std;
     虚析构函数
     从文件导入三维模型
     从流导入三维模型
+    从文件流式导入三维模型，分批交给处理阶段或回调函数
+    从流流式导入三维模型
+    测试文件扩展名或文件内容是否为本格式
+    按文件开头的内容和文件长度识别格式
+    静态：读取文件或已打开的流的开头和文件长度
 【开发者及日期】谭雯心 2024/8/7
-【更改记录】
+【更改记录】2026/10/19 谭雯心 增加了流式导入，析构函数改为公有
+           2026/10/19 谭雯心 增加了按文件开头的内容识别格式
+           2026/10/19 谭雯心 导入时只打开一次文件并使用大缓冲区
 *************************************************************************/
 
 class Model3D_Importer : public Porter {
@@ -44,10 +74,18 @@ protected:
     Model3D_Importer(const Model3D_Importer& Source) = delete;
     // 禁止使用赋值运算符
     Model3D_Importer& operator=(const Model3D_Importer& Source) = delete;
-    // 虚析构函数
-    virtual ~Model3D_Importer() = default;
 
 public:
+    //-------------------------------------------------------------------------
+    // 静态常量
+    //-------------------------------------------------------------------------
+    // 识别格式时读取的文件开头字节数
+    static constexpr size_t HEAD_SIZE{512};
+    //-------------------------------------------------------------------------
+    // 必要的析构函数
+    //-------------------------------------------------------------------------
+    // 虚析构函数（公有，以便通过基类指针销毁登记的导入器）
+    virtual ~Model3D_Importer() = default;
     //-------------------------------------------------------------------------
     // 非静态Getter成员函数
     //-------------------------------------------------------------------------
@@ -57,6 +95,39 @@ public:
     void LoadFromFile(const string& FileName, Model3D& AModel) const;
     // 从流导入三维模型（纯虚函数，由派生类具体实现不同文件的导入）
     virtual Model3D LoadFromStream(ifstream& Stream) const = 0;
+    // 从文件流式导入三维模型，分批交给处理阶段
+    void StreamFromFile(
+        const string& FileName, ModelStreamStage& Stage,
+        size_t BatchSize = ModelBatcher::DEFAULT_BATCH_SIZE) const;
+    // 从文件流式导入三维模型，分批交给回调函数
+    void StreamFromFile(
+        const string& FileName,
+        const function<void(const ModelStreamStage::Batch&)>& Callback,
+        size_t BatchSize = ModelBatcher::DEFAULT_BATCH_SIZE) const;
+    // 从流流式导入三维模型（默认先完整导入再分批，派生类可重写为逐条读取）
+    virtual void StreamFromStream(
+        ifstream& Stream, ModelBatcher& Batcher) const;
+    // 测试文件扩展名是否一致，不一致时按文件开头的内容识别
+    virtual void FileValid(const string& FileName) const override;
+    // 按文件开头的内容和文件长度识别格式（默认不识别，只按扩展名选择）
+    virtual bool Recognize(const string& Head, uint64_t FileSize) const;
+    //-------------------------------------------------------------------------
+    // 静态成员函数
+    //-------------------------------------------------------------------------
+    // 读取文件开头至多HEAD_SIZE字节和文件长度，文件无法打开时返回false
+    static bool ReadHead(
+        const string& FileName, string& Head, uint64_t& FileSize);
+    // 读取已打开的流的开头至多HEAD_SIZE字节和流的长度，读完后回到开头
+    static bool ReadHead(istream& Stream, string& Head, uint64_t& FileSize);
+
+protected:
+    //-------------------------------------------------------------------------
+    // 受保护的非静态成员函数
+    //-------------------------------------------------------------------------
+    // 以Buffer为缓冲区打开文件，接入解压的流缓冲区pFilter（未压缩时为空），
+    // 并用同一个流测试是否为本格式
+    void OpenValidated(const string& FileName, ifstream& File,
+        vector<char>& Buffer, unique_ptr<streambuf>& pFilter) const;
 };
 
 #endif /* Importer.hpp */
\ No newline at end of file
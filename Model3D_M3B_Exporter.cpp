@@ -0,0 +1,332 @@
+/*************************************************************************
+【文件名】Model3D_M3B_Exporter.cpp
+【功能模块和目的】定义Model3D_M3B_Exporter类的成员函数
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】2026/10/19 谭雯心 增加了增量导出
+*************************************************************************/
+// Model3D_M3B_Exporter所属头文件
+#include "Model3D_M3B_Exporter.hpp"
+// IndexedModel3D所属头文件
+#include "IndexedModel3D.hpp"
+// M3BFormat所属头文件
+#include "M3BFormat.hpp"
+// Model3D所属头文件
+#include "Model3D.hpp"
+// fstream所属头文件
+#include <fstream>
+// ostringstream所属头文件
+#include <sstream>
+// string所属头文件
+#include <string>
+// vector所属头文件
+#include <vector>
+// pair所属头文件
+#include <utility>
+// uint8_t, uint64_t所属头文件
+#include <cstdint>
+// size_t所属头文件
+#include <cstddef>
+
+using namespace std;
+
+//-------------------------------------------------------------------------
+// 必要的构造、析构、拷贝、赋值运算符重载函数
+//-------------------------------------------------------------------------
+
+/*************************************************************************
+【函数名称】Model3D_M3B_Exporter
+【函数功能】默认构造函数, 将Model3D_Exporter文件扩展名设为".m3b"
+【参数】无
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+Model3D_M3B_Exporter::Model3D_M3B_Exporter() : Model3D_Exporter(".m3b") {
+}
+
+//-------------------------------------------------------------------------
+// 非静态Getter成员函数
+//-------------------------------------------------------------------------
+
+/*************************************************************************
+【函数名称】SaveToStream
+【函数功能】保存三维模型到流的M3B格式实现
+【参数】ofstream& Stream, 表示输出流（以二进制方式打开）
+       const Model3D& AModel, 表示Model3D类的对象
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】2026/10/19 谭雯心 写出移到WriteModel，文件头后写入新的修订号
+*************************************************************************/
+void Model3D_M3B_Exporter::SaveToStream(
+    ofstream& Stream, const Model3D& AModel) const {
+    // 导出到流前先清空流
+    Stream.clear();
+    WriteModel(Stream, AModel, M3BFormat::NewRevision());
+}
+/*************************************************************************
+【函数名称】SaveChangesToFile
+【函数功能】增量保存三维模型到文件。文件名与同步基线一致、文件未被
+       他人改动、面和线只被修改或追加且增量不超过整体部分时，只追加
+       修改过的部分；否则经临时文件整体重写。两种方式都把写出的文件
+       记为模型新的同步基线。压缩文件名总是整体保存，且不记录基线
+【参数】const string& FileName, 表示文件名
+       Model3D& AModel, 表示Model3D类的对象
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+void Model3D_M3B_Exporter::SaveChangesToFile(
+    const string& FileName, Model3D& AModel) const {
+    if (IsCompressedName(FileName)) {
+        SaveToFile(FileName, AModel);
+        return;
+    }
+    if (!AppendChanges(FileName, AModel)) {
+        Rewrite(FileName, AModel);
+    }
+}
+
+//-------------------------------------------------------------------------
+// 私有非静态成员函数
+//-------------------------------------------------------------------------
+
+/*************************************************************************
+【函数名称】WriteModel
+【函数功能】以给定的修订号整体写出三维模型，修订号块紧跟文件头
+【参数】ostream& Stream, 表示输出流（以二进制方式打开）
+       const Model3D& AModel, 表示Model3D类的对象
+       uint64_t Revision, 表示修订号
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+void Model3D_M3B_Exporter::WriteModel(
+    ostream& Stream, const Model3D& AModel, uint64_t Revision) const {
+    IndexedModel3D Indexed = IndexedModel3D::FromModel(AModel);
+    M3BFormat::WriteHeader(Stream);
+    M3BFormat::WriteChunkHeader(Stream, M3BFormat::CHUNK_REVISION, Revision);
+    M3BFormat::WriteStringChunk(Stream, M3BFormat::CHUNK_DESCRIPTION,
+        Indexed.Description);
+    M3BFormat::WriteStringChunk(Stream, M3BFormat::CHUNK_NAME, Indexed.Name);
+    if (Indexed.GetVertexCount() > 0) {
+        M3BFormat::WriteChunkHeader(Stream, M3BFormat::CHUNK_VERTICES,
+            Indexed.GetVertexCount());
+        Stream.write(reinterpret_cast<const char*>(Indexed.Vertices().data()),
+            Indexed.Vertices().size() * sizeof(double));
+    }
+    if (Indexed.GetFaceCount() > 0) {
+        M3BFormat::WriteChunkHeader(Stream, M3BFormat::CHUNK_FACES,
+            Indexed.GetFaceCount());
+        for (size_t Index : Indexed.FaceIndices()) {
+            M3BFormat::WriteValue<uint64_t>(Stream, Index);
+        }
+    }
+    if (Indexed.GetLineCount() > 0) {
+        M3BFormat::WriteChunkHeader(Stream, M3BFormat::CHUNK_LINES,
+            Indexed.GetLineCount());
+        for (size_t Index : Indexed.LineIndices()) {
+            M3BFormat::WriteValue<uint64_t>(Stream, Index);
+        }
+    }
+    M3BFormat::WriteChunkHeader(Stream, M3BFormat::CHUNK_END, 0);
+}
+/*************************************************************************
+【函数名称】AppendChanges
+【函数功能】把同步基线之后的修改作为增量追加到文件末尾。先核对文件
+       长度、修订号和末尾的END块，确认文件仍是基线记录的那一份；
+       依次写入并同步增量、把修订号块改为REVISION_PATCHED并换上新的
+       修订号、把原来的END块改写为DELTA块，任何一步中断时文件仍可按
+       某一完整的版本读取，且之后的核对会失败而转为整体重写
+【参数】const string& FileName, 表示文件名
+       Model3D& AModel, 表示Model3D类的对象
+【返回值】bool，是否已增量保存（没有修改时不写入也返回true）
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+bool Model3D_M3B_Exporter::AppendChanges(
+    const string& FileName, Model3D& AModel) const {
+    Model3D::SyncBaseline Baseline = AModel.GetBaseline();
+    if (Baseline.FileName.empty() || Baseline.FileName != FileName
+        || AModel.IsLayoutChanged()
+        || AModel.GetFaceCount() < Baseline.FaceCount
+        || AModel.GetLineCount() < Baseline.LineCount) {
+        return false;
+    }
+    const DirtyRanges& DirtyFaces = AModel.GetDirtyFaces();
+    const DirtyRanges& DirtyLines = AModel.GetDirtyLines();
+    bool bNameChanged = AModel.Name != Baseline.Name;
+    bool bDescriptionChanged = AModel.Description != Baseline.Description;
+    // 增量的长度：名称、注释块，补丁块，END块
+    uint64_t DeltaSize = M3BFormat::CHUNK_HEADER_SIZE;
+    if (bNameChanged) {
+        DeltaSize += M3BFormat::CHUNK_HEADER_SIZE + AModel.Name.size();
+    }
+    if (bDescriptionChanged) {
+        DeltaSize += M3BFormat::CHUNK_HEADER_SIZE
+            + AModel.Description.size();
+    }
+    if (!DirtyFaces.IsEmpty()) {
+        DeltaSize += M3BFormat::CHUNK_HEADER_SIZE
+            + DirtyFaces.GetCount() * sizeof(uint64_t) * 10;
+    }
+    if (!DirtyLines.IsEmpty()) {
+        DeltaSize += M3BFormat::CHUNK_HEADER_SIZE
+            + DirtyLines.GetCount() * sizeof(uint64_t) * 7;
+    }
+    // 增量累计超过整体部分时整体重写以压实
+    if (Baseline.FileSize + DeltaSize > 2 * Baseline.CompactSize) {
+        return false;
+    }
+    fstream File(FileName, ios::in | ios::out | ios::binary);
+    if (!File.is_open()) {
+        return false;
+    }
+    // 核对文件仍是基线记录的那一份
+    File.seekg(0, ios::end);
+    if (File.tellg() != static_cast<streamoff>(Baseline.FileSize)
+        || Baseline.FileSize
+            < M3BFormat::HEADER_SIZE + 2 * M3BFormat::CHUNK_HEADER_SIZE) {
+        return false;
+    }
+    File.seekg(0);
+    uint8_t Type;
+    uint64_t Count;
+    if (!M3BFormat::ReadHeader(File)
+        || !M3BFormat::ReadChunkHeader(File, Type, Count)
+        || (Type != M3BFormat::CHUNK_REVISION
+            && Type != M3BFormat::CHUNK_REVISION_PATCHED)
+        || Count != Baseline.Revision) {
+        return false;
+    }
+    File.seekg(static_cast<streamoff>(
+        Baseline.FileSize - M3BFormat::CHUNK_HEADER_SIZE));
+    if (!M3BFormat::ReadChunkHeader(File, Type, Count)
+        || Type != M3BFormat::CHUNK_END || Count != 0) {
+        return false;
+    }
+    if (!bNameChanged && !bDescriptionChanged
+        && DirtyFaces.IsEmpty() && DirtyLines.IsEmpty()) {
+        return true;
+    }
+    // 在内存中组装增量
+    ostringstream Delta;
+    if (bNameChanged) {
+        M3BFormat::WriteStringChunk(Delta, M3BFormat::CHUNK_NAME,
+            AModel.Name);
+    }
+    if (bDescriptionChanged) {
+        M3BFormat::WriteStringChunk(Delta, M3BFormat::CHUNK_DESCRIPTION,
+            AModel.Description);
+    }
+    if (!DirtyFaces.IsEmpty()) {
+        M3BFormat::WriteChunkHeader(Delta, M3BFormat::CHUNK_FACE_PATCHES,
+            DirtyFaces.GetCount());
+        for (const pair<size_t, size_t>& Range : DirtyFaces.GetRanges()) {
+            for (size_t i = Range.first; i < Range.second; i++) {
+                M3BFormat::WriteValue<uint64_t>(Delta, i);
+                const Face3D& AFace = AModel.GetFace(i);
+                for (size_t j = 0; j < 3; j++) {
+                    M3BFormat::WriteValue<double>(Delta, AFace.Points[j].X);
+                    M3BFormat::WriteValue<double>(Delta, AFace.Points[j].Y);
+                    M3BFormat::WriteValue<double>(Delta, AFace.Points[j].Z);
+                }
+            }
+        }
+    }
+    if (!DirtyLines.IsEmpty()) {
+        M3BFormat::WriteChunkHeader(Delta, M3BFormat::CHUNK_LINE_PATCHES,
+            DirtyLines.GetCount());
+        for (const pair<size_t, size_t>& Range : DirtyLines.GetRanges()) {
+            for (size_t i = Range.first; i < Range.second; i++) {
+                M3BFormat::WriteValue<uint64_t>(Delta, i);
+                const Line3D& ALine = AModel.GetLine(i);
+                for (size_t j = 0; j < 2; j++) {
+                    M3BFormat::WriteValue<double>(Delta, ALine.Points[j].X);
+                    M3BFormat::WriteValue<double>(Delta, ALine.Points[j].Y);
+                    M3BFormat::WriteValue<double>(Delta, ALine.Points[j].Z);
+                }
+            }
+        }
+    }
+    M3BFormat::WriteChunkHeader(Delta, M3BFormat::CHUNK_END, 0);
+    string Bytes = Delta.str();
+    uint64_t Revision = M3BFormat::NewRevision();
+    // 先写入并同步增量，此时原来的END块仍在，读取者看不到增量
+    File.seekp(static_cast<streamoff>(Baseline.FileSize));
+    File.write(Bytes.data(), static_cast<streamsize>(Bytes.size()));
+    File.flush();
+    if (!File || !SyncToDisk(FileName)) {
+        throw FILE_NOT_AVAILABLE(FileName);
+    }
+    // 再换上新的修订号，流式读取者据此先读完整个文件
+    File.seekp(static_cast<streamoff>(M3BFormat::HEADER_SIZE));
+    M3BFormat::WriteChunkHeader(File, M3BFormat::CHUNK_REVISION_PATCHED,
+        Revision);
+    File.flush();
+    if (!File || !SyncToDisk(FileName)) {
+        throw FILE_NOT_AVAILABLE(FileName);
+    }
+    // 最后把原来的END块改写为DELTA块，使增量生效
+    File.seekp(static_cast<streamoff>(
+        Baseline.FileSize - M3BFormat::CHUNK_HEADER_SIZE));
+    M3BFormat::WriteChunkHeader(File, M3BFormat::CHUNK_DELTA, 0);
+    File.close();
+    if (File.fail() || !SyncToDisk(FileName)) {
+        throw FILE_NOT_AVAILABLE(FileName);
+    }
+    Baseline.Revision = Revision;
+    Baseline.FileSize += Bytes.size();
+    Baseline.FaceCount = AModel.GetFaceCount();
+    Baseline.LineCount = AModel.GetLineCount();
+    Baseline.Name = AModel.Name;
+    Baseline.Description = AModel.Description;
+    AModel.MarkSynced(Baseline);
+    return true;
+}
+/*************************************************************************
+【函数名称】Rewrite
+【函数功能】经临时文件整体重写三维模型，与SaveToFile一样原子地替换
+       目标文件，并以写出的文件为模型新的同步基线
+【参数】const string& FileName, 表示文件名
+       Model3D& AModel, 表示Model3D类的对象
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+void Model3D_M3B_Exporter::Rewrite(
+    const string& FileName, Model3D& AModel) const {
+    FileValid(FileName);
+    string TempName = TempFileName(FileName);
+    // 缓冲区须在File之后析构
+    vector<char> Buffer;
+    ofstream File;
+    // 打开即创建临时文件并测试能否写入，失败时按目标文件名报告
+    try {
+        OpenOutput(TempName, File, Buffer);
+    }
+    catch (const FILE_NOT_AVAILABLE&) {
+        throw FILE_NOT_AVAILABLE(FileName);
+    }
+    uint64_t Revision = M3BFormat::NewRevision();
+    streamoff FileSize;
+    try {
+        WriteModel(File, AModel, Revision);
+        FileSize = File.tellp();
+    }
+    catch (...) {
+        DiscardOutput(File, TempName);
+        throw;
+    }
+    // 同步并替换目标文件，失败时删除临时文件并抛出异常
+    CommitOutput(File, TempName, FileName);
+    Model3D::SyncBaseline Baseline;
+    Baseline.FileName = FileName;
+    Baseline.Revision = Revision;
+    Baseline.FileSize = static_cast<uint64_t>(FileSize);
+    Baseline.CompactSize = Baseline.FileSize;
+    Baseline.FaceCount = AModel.GetFaceCount();
+    Baseline.LineCount = AModel.GetLineCount();
+    Baseline.Name = AModel.Name;
+    Baseline.Description = AModel.Description;
+    AModel.MarkSynced(Baseline);
+}
@@ -0,0 +1,74 @@
+/*************************************************************************
+【文件名】Model3D_M3B_Exporter.hpp
+【功能模块和目的】定义Model3D_M3B_Exporter类，
+    继承自Model3D_Exporter类，表示三维模型的M3B二进制格式导出器
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】2026/10/19 谭雯心 增加了增量导出
+*************************************************************************/
+#ifndef MODEL3D_M3B_EXPORTER_HPP
+#define MODEL3D_M3B_EXPORTER_HPP
+
+// Model3D_Exporter所属头文件
+#include "Model3D_Exporter.hpp"
+// fstream所属头文件
+#include <fstream>
+// string所属头文件
+#include <string>
+// uint64_t所属头文件
+#include <cstdint>
+
+/*************************************************************************
+【类名】Model3D_M3B_Exporter
+【功能】定义Model3D_M3B_Exporter类，
+    继承自Model3D_Exporter类，表示三维模型的M3B二进制格式导出器，
+    点不重复输出，面和线按顶点索引输出。增量导出时若文件仍是模型
+    同步基线所记录的那一份，只把之后修改过的面、线和名称、注释作为
+    增量追加到文件末尾，开销与修改量成正比；增量累计超过整体部分时，
+    或面、线被删除、插入而位置不再对应时，整体重写以压实文件
+【接口说明】
+    默认构造函数
+    禁止拷贝构造函数
+    禁止赋值运算符
+    虚析构函数
+    保存三维模型到流的M3B格式实现
+    增量保存三维模型到文件
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】2026/10/19 谭雯心 增加了增量导出
+*************************************************************************/
+class Model3D_M3B_Exporter : public Model3D_Exporter {
+public:
+    //-------------------------------------------------------------------------
+    // 必要的构造、析构、拷贝、赋值运算符重载函数
+    //-------------------------------------------------------------------------
+    // 默认构造函数
+    Model3D_M3B_Exporter();
+    // 禁止外界调用拷贝构造函数
+    Model3D_M3B_Exporter(const Model3D_M3B_Exporter& Source) = delete;
+    // 禁止外界调用赋值运算符
+    Model3D_M3B_Exporter& operator=(
+        const Model3D_M3B_Exporter& Source) = delete;
+    // 虚析构函数
+    virtual ~Model3D_M3B_Exporter() = default;
+    //-------------------------------------------------------------------------
+    // 非静态Getter成员函数
+    //-------------------------------------------------------------------------
+    // 保存三维模型到流的M3B格式实现
+    virtual void SaveToStream(
+        ofstream& Stream, const Model3D& AModel) const override;
+    // 增量保存三维模型到文件，并更新模型的同步基线
+    void SaveChangesToFile(const string& FileName, Model3D& AModel) const;
+
+private:
+    //-------------------------------------------------------------------------
+    // 私有非静态成员函数
+    //-------------------------------------------------------------------------
+    // 以给定的修订号整体写出三维模型
+    void WriteModel(
+        ostream& Stream, const Model3D& AModel, uint64_t Revision) const;
+    // 把修改追加为增量，文件与基线不符或需要压实时返回false
+    bool AppendChanges(const string& FileName, Model3D& AModel) const;
+    // 经临时文件整体重写，并以写出的文件为同步基线
+    void Rewrite(const string& FileName, Model3D& AModel) const;
+};
+
+#endif /* Model3D_M3B_Exporter.hpp */
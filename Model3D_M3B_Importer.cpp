@@ -0,0 +1,343 @@
+/*************************************************************************
+【文件名】Model3D_M3B_Importer.cpp
+【功能模块和目的】定义Model3D_M3B_Importer类的成员函数
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】2026/10/19 谭雯心 增加了按文件开头的内容识别格式
+           2026/10/19 谭雯心 读取增量块，导入后记录同步基线
+*************************************************************************/
+// Model3D_M3B_Importer所属头文件
+#include "Model3D_M3B_Importer.hpp"
+// IndexedModel3D所属头文件
+#include "IndexedModel3D.hpp"
+// M3BFormat所属头文件
+#include "M3BFormat.hpp"
+// Model3D所属头文件
+#include "Model3D.hpp"
+// ModelBatcher所属头文件
+#include "ModelBatcher.hpp"
+// fstream所属头文件
+#include <fstream>
+// istream, streamoff所属头文件
+#include <istream>
+// invalid_argument所属头文件
+#include <stdexcept>
+// uint8_t, uint64_t所属头文件
+#include <cstdint>
+// memcmp所属头文件
+#include <cstring>
+// string所属头文件
+#include <string>
+// vector所属头文件
+#include <vector>
+// size_t所属头文件
+#include <cstddef>
+
+using namespace std;
+
+//-------------------------------------------------------------------------
+// 内嵌异常类
+//-------------------------------------------------------------------------
+
+/*************************************************************************
+【函数名称】FILE_FORMAT_ERROR
+【函数功能】构造函数
+【参数】无
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+Model3D_M3B_Importer::FILE_FORMAT_ERROR::FILE_FORMAT_ERROR()
+    : invalid_argument("Invalid M3B data") {
+}
+
+//-------------------------------------------------------------------------
+// 必要的构造、析构、拷贝、赋值运算符重载函数
+//-------------------------------------------------------------------------
+
+/*************************************************************************
+【函数名称】Model3D_M3B_Importer
+【函数功能】默认构造函数, 将Model3D_Importer文件扩展名设为".m3b"
+【参数】无
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+Model3D_M3B_Importer::Model3D_M3B_Importer() : Model3D_Importer(".m3b") {
+}
+
+//-------------------------------------------------------------------------
+// 非静态Getter成员函数
+//-------------------------------------------------------------------------
+
+/*************************************************************************
+【函数名称】LoadFromStream
+【函数功能】从流导入三维模型的M3B格式实现，先读入IndexedModel3D再转换。
+       转换没有丢弃退化或重复的面、线时，把文件的状态记为同步基线，
+       基线的文件名由调用者补上
+【参数】ifstream& Stream, 表示输入流（以二进制方式打开）
+【返回值】Model3D类的对象
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】2026/10/19 谭雯心 数据块的读取移到ReadChunks，导入后记录同步基线
+*************************************************************************/
+Model3D Model3D_M3B_Importer::LoadFromStream(ifstream& Stream) const {
+    if (!M3BFormat::ReadHeader(Stream)) {
+        throw FILE_FORMAT_ERROR();
+    }
+    IndexedModel3D Indexed;
+    uint64_t Revision{0};
+    uint64_t CompactSize{0};
+    ReadChunks(Stream, Indexed, Revision, CompactSize);
+    streamoff FileSize = Stream.tellg();
+    Model3D AModel = Indexed.ToModel();
+    // 面、线的位置与文件一一对应时才能增量导出
+    if (Revision != 0 && FileSize > 0
+        && AModel.GetFaceCount() == Indexed.GetFaceCount()
+        && AModel.GetLineCount() == Indexed.GetLineCount()) {
+        Model3D::SyncBaseline Baseline;
+        Baseline.Revision = Revision;
+        Baseline.FileSize = static_cast<uint64_t>(FileSize);
+        Baseline.CompactSize = CompactSize == 0
+            ? Baseline.FileSize : CompactSize;
+        Baseline.FaceCount = Indexed.GetFaceCount();
+        Baseline.LineCount = Indexed.GetLineCount();
+        Baseline.Name = Indexed.Name;
+        Baseline.Description = Indexed.Description;
+        AModel.MarkSynced(Baseline);
+    }
+    return AModel;
+}
+/*************************************************************************
+【函数名称】StreamFromStream
+【函数功能】从流流式导入三维模型的M3B格式实现，逐个元素交给Batcher，
+       只在Batcher中保存顶点，不保存面和线
+【参数】ifstream& Stream, 表示输入流（以二进制方式打开）
+       ModelBatcher& Batcher, 表示批次组装器
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】2026/10/19 谭雯心 追加过增量的文件先读完整个文件再交给Batcher
+*************************************************************************/
+void Model3D_M3B_Importer::StreamFromStream(
+    ifstream& Stream, ModelBatcher& Batcher) const {
+    if (!M3BFormat::ReadHeader(Stream)) {
+        throw FILE_FORMAT_ERROR();
+    }
+    uint8_t Type;
+    uint64_t Count;
+    while (M3BFormat::ReadChunkHeader(Stream, Type, Count)
+        && Type != M3BFormat::CHUNK_END) {
+        switch (Type) {
+            case M3BFormat::CHUNK_REVISION: {
+                break;
+            }
+            case M3BFormat::CHUNK_REVISION_PATCHED: {
+                // 补丁可能替换已交出的面和线，只能先读完整个文件
+                IndexedModel3D Indexed;
+                uint64_t Revision{Count};
+                uint64_t CompactSize{0};
+                ReadChunks(Stream, Indexed, Revision, CompactSize);
+                Batcher.SetName(Indexed.Name);
+                Batcher.SetDescription(Indexed.Description);
+                const vector<double>& Vertices = Indexed.Vertices();
+                for (size_t i = 0; i < Indexed.GetVertexCount(); i++) {
+                    Batcher.AddVertex(Vertices[i * 3], Vertices[i * 3 + 1],
+                        Vertices[i * 3 + 2]);
+                }
+                const vector<size_t>& Faces = Indexed.FaceIndices();
+                for (size_t i = 0; i < Indexed.GetFaceCount(); i++) {
+                    Batcher.AddFace(Faces[i * 3], Faces[i * 3 + 1],
+                        Faces[i * 3 + 2]);
+                }
+                const vector<size_t>& Lines = Indexed.LineIndices();
+                for (size_t i = 0; i < Indexed.GetLineCount(); i++) {
+                    Batcher.AddLine(Lines[i * 2], Lines[i * 2 + 1]);
+                }
+                return;
+            }
+            case M3BFormat::CHUNK_NAME: {
+                Batcher.SetName(M3BFormat::ReadString(Stream, Count));
+                break;
+            }
+            case M3BFormat::CHUNK_DESCRIPTION: {
+                Batcher.SetDescription(M3BFormat::ReadString(Stream, Count));
+                break;
+            }
+            case M3BFormat::CHUNK_VERTICES: {
+                for (uint64_t i = 0; i < Count; i++) {
+                    double x = M3BFormat::ReadValue<double>(Stream);
+                    double y = M3BFormat::ReadValue<double>(Stream);
+                    double z = M3BFormat::ReadValue<double>(Stream);
+                    Batcher.AddVertex(x, y, z);
+                }
+                break;
+            }
+            case M3BFormat::CHUNK_FACES: {
+                for (uint64_t i = 0; i < Count; i++) {
+                    size_t a = M3BFormat::ReadValue<uint64_t>(Stream);
+                    size_t b = M3BFormat::ReadValue<uint64_t>(Stream);
+                    size_t c = M3BFormat::ReadValue<uint64_t>(Stream);
+                    Batcher.AddFace(a, b, c);
+                }
+                break;
+            }
+            case M3BFormat::CHUNK_LINES: {
+                for (uint64_t i = 0; i < Count; i++) {
+                    size_t a = M3BFormat::ReadValue<uint64_t>(Stream);
+                    size_t b = M3BFormat::ReadValue<uint64_t>(Stream);
+                    Batcher.AddLine(a, b);
+                }
+                break;
+            }
+            default: {
+                throw FILE_FORMAT_ERROR();
+            }
+        }
+        if (!Stream) {
+            throw FILE_FORMAT_ERROR();
+        }
+    }
+}
+/*************************************************************************
+【函数名称】Recognize
+【函数功能】按魔数识别M3B格式
+【参数】const string& Head, 表示文件开头至多HEAD_SIZE字节
+       uint64_t FileSize, 表示文件长度
+【返回值】bool，是否为M3B格式
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+bool Model3D_M3B_Importer::Recognize(
+    const string& Head, uint64_t FileSize) const {
+    // 显示标记未使用的参数
+    (void)FileSize;
+    return Head.size() >= sizeof(M3BFormat::MAGIC)
+        && memcmp(Head.data(), M3BFormat::MAGIC, sizeof(M3BFormat::MAGIC)) == 0;
+}
+
+//-------------------------------------------------------------------------
+// 私有非静态成员函数
+//-------------------------------------------------------------------------
+
+/*************************************************************************
+【函数名称】ReadChunks
+【函数功能】读取文件头之后的全部数据块直到END块。DELTA块之后为增量，
+       面、线补丁的位置小于已读的数量时替换该面、线，等于时追加，
+       大于时视为格式错误
+【参数】istream& Stream, 表示位于文件头之后的输入流
+       IndexedModel3D& Indexed, 表示读入的模型
+       uint64_t& Revision, 表示读到的修订号（没有修订号块时不变）
+       uint64_t& CompactSize, 表示到第一个DELTA块（即整体写出时的END块）
+       为止的长度（没有DELTA块时不变）
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+void Model3D_M3B_Importer::ReadChunks(istream& Stream,
+    IndexedModel3D& Indexed, uint64_t& Revision,
+    uint64_t& CompactSize) const {
+    uint8_t Type;
+    uint64_t Count;
+    while (M3BFormat::ReadChunkHeader(Stream, Type, Count)
+        && Type != M3BFormat::CHUNK_END) {
+        switch (Type) {
+            case M3BFormat::CHUNK_NAME: {
+                Indexed.Name = M3BFormat::ReadString(Stream, Count);
+                break;
+            }
+            case M3BFormat::CHUNK_DESCRIPTION: {
+                Indexed.Description = M3BFormat::ReadString(Stream, Count);
+                break;
+            }
+            case M3BFormat::CHUNK_VERTICES: {
+                for (uint64_t i = 0; i < Count; i++) {
+                    double x = M3BFormat::ReadValue<double>(Stream);
+                    double y = M3BFormat::ReadValue<double>(Stream);
+                    double z = M3BFormat::ReadValue<double>(Stream);
+                    Indexed.AddVertex(x, y, z);
+                }
+                break;
+            }
+            case M3BFormat::CHUNK_FACES: {
+                for (uint64_t i = 0; i < Count; i++) {
+                    size_t a = M3BFormat::ReadValue<uint64_t>(Stream);
+                    size_t b = M3BFormat::ReadValue<uint64_t>(Stream);
+                    size_t c = M3BFormat::ReadValue<uint64_t>(Stream);
+                    Indexed.AddFace(a, b, c);
+                }
+                break;
+            }
+            case M3BFormat::CHUNK_LINES: {
+                for (uint64_t i = 0; i < Count; i++) {
+                    size_t a = M3BFormat::ReadValue<uint64_t>(Stream);
+                    size_t b = M3BFormat::ReadValue<uint64_t>(Stream);
+                    Indexed.AddLine(a, b);
+                }
+                break;
+            }
+            case M3BFormat::CHUNK_REVISION:
+            case M3BFormat::CHUNK_REVISION_PATCHED: {
+                Revision = Count;
+                break;
+            }
+            case M3BFormat::CHUNK_DELTA: {
+                if (CompactSize == 0) {
+                    CompactSize = static_cast<uint64_t>(Stream.tellg());
+                }
+                break;
+            }
+            case M3BFormat::CHUNK_FACE_PATCHES: {
+                for (uint64_t i = 0; i < Count; i++) {
+                    size_t Position = M3BFormat::ReadValue<uint64_t>(Stream);
+                    size_t Index[3];
+                    for (size_t j = 0; j < 3; j++) {
+                        double x = M3BFormat::ReadValue<double>(Stream);
+                        double y = M3BFormat::ReadValue<double>(Stream);
+                        double z = M3BFormat::ReadValue<double>(Stream);
+                        Index[j] = Indexed.AddVertex(x, y, z);
+                    }
+                    if (!Stream || Position > Indexed.GetFaceCount()) {
+                        throw FILE_FORMAT_ERROR();
+                    }
+                    if (Position == Indexed.GetFaceCount()) {
+                        Indexed.AddFace(Index[0], Index[1], Index[2]);
+                    }
+                    else {
+                        for (size_t j = 0; j < 3; j++) {
+                            Indexed.SetFaceVertex(Position, j, Index[j]);
+                        }
+                    }
+                }
+                break;
+            }
+            case M3BFormat::CHUNK_LINE_PATCHES: {
+                for (uint64_t i = 0; i < Count; i++) {
+                    size_t Position = M3BFormat::ReadValue<uint64_t>(Stream);
+                    size_t Index[2];
+                    for (size_t j = 0; j < 2; j++) {
+                        double x = M3BFormat::ReadValue<double>(Stream);
+                        double y = M3BFormat::ReadValue<double>(Stream);
+                        double z = M3BFormat::ReadValue<double>(Stream);
+                        Index[j] = Indexed.AddVertex(x, y, z);
+                    }
+                    if (!Stream || Position > Indexed.GetLineCount()) {
+                        throw FILE_FORMAT_ERROR();
+                    }
+                    if (Position == Indexed.GetLineCount()) {
+                        Indexed.AddLine(Index[0], Index[1]);
+                    }
+                    else {
+                        for (size_t j = 0; j < 2; j++) {
+                            Indexed.SetLineVertex(Position, j, Index[j]);
+                        }
+                    }
+                }
+                break;
+            }
+            default: {
+                throw FILE_FORMAT_ERROR();
+            }
+        }
+        if (!Stream) {
+            throw FILE_FORMAT_ERROR();
+        }
+    }
+}
@@ -0,0 +1,93 @@
+/*************************************************************************
+【文件名】Model3D_M3B_Importer.hpp
+【功能模块和目的】定义Model3D_M3B_Importer类，
+    继承自Model3D_Importer类，表示三维模型的M3B二进制格式导入器
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】2026/10/19 谭雯心 增加了按文件开头的内容识别格式
+           2026/10/19 谭雯心 读取增量块，导入后记录同步基线
+*************************************************************************/
+#ifndef MODEL3D_M3B_IMPORTER_HPP
+#define MODEL3D_M3B_IMPORTER_HPP
+
+// Model3D所属头文件
+#include "Model3D.hpp"
+// Model3D_Importer所属头文件
+#include "Model3D_Importer.hpp"
+// ModelBatcher所属头文件
+#include "ModelBatcher.hpp"
+// IndexedModel3D所属头文件
+#include "IndexedModel3D.hpp"
+// fstream所属头文件
+#include <fstream>
+// istream所属头文件
+#include <istream>
+// invalid_argument所属头文件
+#include <stdexcept>
+// string所属头文件
+#include <string>
+// uint64_t所属头文件
+#include <cstdint>
+
+using namespace std;
+
+/*************************************************************************
+【类名】Model3D_M3B_Importer
+【功能】定义Model3D_M3B_Importer类，
+    继承自Model3D_Importer类，表示三维模型的M3B二进制格式导入器
+【接口说明】
+    默认构造函数
+    禁止拷贝构造函数
+    禁止赋值运算符
+    虚析构函数
+    从流导入三维模型的M3B格式实现
+    从流流式导入三维模型的M3B格式实现（逐数据块交给Batcher）
+    按文件开头的内容识别M3B格式
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】2026/10/19 谭雯心 增加了按文件开头的内容识别格式
+           2026/10/19 谭雯心 读取增量块，导入后记录同步基线（文件名由
+           调用者补上）；带增量的文件流式导入时先读完整个文件
+*************************************************************************/
+class Model3D_M3B_Importer : public Model3D_Importer {
+public:
+    //-------------------------------------------------------------------------
+    // 内嵌异常类
+    //-------------------------------------------------------------------------
+    // 若文件头或数据块不符合M3B格式，则抛出该异常
+    class FILE_FORMAT_ERROR : public invalid_argument {
+    public:
+        FILE_FORMAT_ERROR();
+    };
+    //-------------------------------------------------------------------------
+    // 必要的构造、析构、拷贝、赋值运算符重载函数
+    //-------------------------------------------------------------------------
+    // 默认构造函数
+    Model3D_M3B_Importer();
+    // 禁止外界调用拷贝构造函数
+    Model3D_M3B_Importer(const Model3D_M3B_Importer& Source) = delete;
+    // 禁止外界调用重载赋值运算符
+    Model3D_M3B_Importer& operator=(
+        const Model3D_M3B_Importer& Source) = delete;
+    // 虚析构函数
+    virtual ~Model3D_M3B_Importer() = default;
+    //-------------------------------------------------------------------------
+    // 非静态Getter成员函数
+    //-------------------------------------------------------------------------
+    // 从流导入三维模型的M3B格式实现
+    virtual Model3D LoadFromStream(ifstream& Stream) const override;
+    // 从流流式导入三维模型的M3B格式实现
+    virtual void StreamFromStream(
+        ifstream& Stream, ModelBatcher& Batcher) const override;
+    // 按文件开头的内容识别M3B格式
+    virtual bool Recognize(
+        const string& Head, uint64_t FileSize) const override;
+
+private:
+    //-------------------------------------------------------------------------
+    // 私有非静态成员函数
+    //-------------------------------------------------------------------------
+    // 读取文件头之后的全部数据块（含增量），直到END块
+    void ReadChunks(istream& Stream, IndexedModel3D& Indexed,
+        uint64_t& Revision, uint64_t& CompactSize) const;
+};
+
+#endif /* Model3D_M3B_Importer.hpp */
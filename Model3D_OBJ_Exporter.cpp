@@ -3,6 +3,10 @@
 【功能模块和目的】定义Model3D_OBJ_Exporter类的成员函数
 【开发者及日期】谭雯心 2024/8/7
 【更改记录】2024/8/8 谭雯心 将导出模型的逻辑改为点不重复输出
+           2026/10/19 谭雯心 增加了计时探针
+           2026/10/19 谭雯心 行尾改为'\n'，不再逐行刷新流
+           2026/10/19 谭雯心 坐标改由NumberFormatter输出，默认为能精确读回的最短形式
+           2026/10/19 谭雯心 点的编号改由IndexedModel3D生成
 *************************************************************************/
 // Model3D_OBJ_Exporter所属头文件
 #include "Model3D_OBJ_Exporter.hpp"
@@ -14,38 +18,67 @@
 #include "Model3D.hpp"
 // Point3D所属头文件
 #include "Point3D.hpp"
-// Point3DSet所属头文件
-#include "Point3DSet.hpp"
+// IndexedModel3D所属头文件
+#include "IndexedModel3D.hpp"
+// Instrumentation所属头文件
+#include "Instrumentation.hpp"
+// ScopedTimer所属头文件
+#include "ScopedTimer.hpp"
+// NumberFormatter所属头文件
+#include "NumberFormatter.hpp"
 // fstream所属头文件
 #include <fstream>
 // string所属头文件
 #include <string>
+// vector所属头文件
+#include <vector>
 // size_t所属头文件
 #include <cstddef>
+// uint64_t所属头文件
+#include <cstdint>
 // 流输出所属头文件
 #include <iostream>
 
 using namespace std;
 
+namespace {
+    // 导出的探针（含点去重），处理量为导出的面数与线数之和
+    const size_t PROBE_SAVE_TO_STREAM = Instrumentation::RegisterProbe(
+        "Model3D_OBJ_Exporter::SaveToStream");
+}
+
 //-------------------------------------------------------------------------
 // 必要的构造、析构、拷贝、赋值运算符重载函数
 //-------------------------------------------------------------------------
 
 /*************************************************************************
 【函数名称】Model3D_OBJ_Exporter
-【函数功能】默认构造函数, 将Model3D_Exporter文件扩展名设为".obj"
-【参数】无
+【函数功能】带参构造函数, 将Model3D_Exporter文件扩展名设为".obj"
+【参数】int Precision, 表示坐标的小数位数，NumberFormatter::SHORTEST表示
+       输出能精确读回的最短形式
 【返回值】无
 【开发者及日期】谭雯心 2024/8/7
-【更改记录】
+【更改记录】2026/10/19 谭雯心 由默认构造函数改为带参构造函数，增加了小数位数
 *************************************************************************/
-Model3D_OBJ_Exporter::Model3D_OBJ_Exporter() : Model3D_Exporter(".obj") {
+Model3D_OBJ_Exporter::Model3D_OBJ_Exporter(int Precision)
+    : Model3D_Exporter(".obj"), m_Formatter(Precision) {
 }
 
 //-------------------------------------------------------------------------
 // 非静态Getter成员函数
 //-------------------------------------------------------------------------
 
+/*************************************************************************
+【函数名称】GetPrecision
+【函数功能】获取坐标的小数位数
+【参数】无
+【返回值】int，小数位数，最短形式时为NumberFormatter::SHORTEST
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+int Model3D_OBJ_Exporter::GetPrecision() const {
+    return m_Formatter.GetPrecision();
+}
 /*************************************************************************
 【函数名称】SaveToStream
 【函数功能】保存三维模型到流的OBJ格式实现
@@ -53,63 +86,61 @@ Model3D_OBJ_Exporter::Model3D_OBJ_Exporter() : Model3D_Exporter(".obj") {
 【返回值】无
 【开发者及日期】谭雯心 2024/8/7
 【更改记录】2024/8/8 谭雯心 将导出模型的逻辑改为点不重复输出
+           2026/10/19 谭雯心 增加了计时探针
+           2026/10/19 谭雯心 行尾改为'\n'，不再逐行刷新流
+           2026/10/19 谭雯心 坐标改由NumberFormatter输出，默认为能精确读回的最短形式
+           2026/10/19 谭雯心 点的编号改由IndexedModel3D生成，不再逐点线性查找
 *************************************************************************/
 void Model3D_OBJ_Exporter::SaveToStream(
     ofstream& Stream, const Model3D& AModel) const {
+    ScopedTimer Timer(PROBE_SAVE_TO_STREAM);
+    Timer.AddItems(AModel.GetElementCount());
     // 导出到流前先清空流
     Stream.clear();
     // 输出模型的注释和名称
-    Stream << "# " << AModel.Description << endl;
-    Stream << "g " << AModel.Name << endl;
-    // 定义Point3DSet类的对象Points，用于存储模型的点集合
-    Point3DSet Points;
-    // 遍历模型的线集合，将线的两个端点加入到Points中
-    for (auto Line : AModel.Lines()) {
-        for (size_t i = 0; i < 2; i++) {
-            // 如果点已经存在，则跳过
-            try {
-                Points.Add(Line->Points[i]);
-            } 
-            catch (...) {
-                continue;
-            }
-        }
-    }
-    // 遍历模型的面集合，将面的三个顶点加入到Points中
-    for (auto Face : AModel.Faces()) {
-        for (size_t i = 0; i < 3; i++) {
-            // 如果点已经存在，则跳过
-            try {
-                Points.Add(Face->Points[i]);
-            } 
-            catch (...) {
-                continue;
-            }
-        }
-    }
-    // 定义整型变量PointCount，用于存储点的数量，便于后续遍历输出
-    size_t PointCount = Points.CountElement();
-    // 遍历Points，输出每个点的坐标
-    for (size_t i = 0; i < PointCount; i++) {
-        Stream << "v " << Points[i].X << " " 
-            << Points[i].Y << " " << Points[i].Z << endl;
+    Stream << "# " << AModel.Description << '\n';
+    Stream << "g " << AModel.Name << '\n';
+    // 由IndexedModel3D按哈希表合并坐标相同的点并编号，复杂度O(V + F + L)
+    IndexedModel3D Indexed = IndexedModel3D::FromModel(AModel);
+    const vector<double>& Vertices = Indexed.Vertices();
+    const vector<size_t>& LineIndices = Indexed.LineIndices();
+    const vector<size_t>& FaceIndices = Indexed.FaceIndices();
+    // 每行先在Text中拼好再一次写入流
+    char Text[4 * NumberFormatter::MAX_LENGTH];
+    // 遍历顶点，输出每个点的坐标
+    for (size_t i = 0; i < Vertices.size(); i += 3) {
+        char* pEnd = Text;
+        *pEnd++ = 'v';
+        *pEnd++ = ' ';
+        pEnd = m_Formatter.Format(
+            Vertices[i], Vertices[i + 1], Vertices[i + 2], pEnd);
+        *pEnd++ = '\n';
+        Stream.write(Text, pEnd - Text);
     }
-    // 遍历模型的线集合，输出每条线的两个端点
-    for (auto Line : AModel.Lines()) {
-        Stream << "l ";
-        for (size_t i = 0; i < 2; i++) {
-            // 利用Search输出点的索引 + 1，因为索引从1开始
-            Stream << Points.Search(Line->Points[i]) + 1 << " ";
+    // 遍历线的索引，输出每条线的两个端点
+    for (size_t i = 0; i < LineIndices.size(); i += 2) {
+        char* pEnd = Text;
+        *pEnd++ = 'l';
+        for (size_t j = 0; j < 2; j++) {
+            // 输出点的索引 + 1，因为索引从1开始
+            *pEnd++ = ' ';
+            pEnd = NumberFormatter::Format(
+                static_cast<uint64_t>(LineIndices[i + j] + 1), pEnd);
         }
-        Stream << endl;
+        *pEnd++ = '\n';
+        Stream.write(Text, pEnd - Text);
     }
-    // 遍历模型的面集合，输出每个面的三个顶点
-    for (auto Face : AModel.Faces()) {
-        Stream << "f ";
-        for (size_t i = 0; i < 3; i++) {
-            // 利用Search输出点的索引 + 1，因为索引从1开始
-            Stream << Points.Search(Face->Points[i]) + 1 << " ";
+    // 遍历面的索引，输出每个面的三个顶点
+    for (size_t i = 0; i < FaceIndices.size(); i += 3) {
+        char* pEnd = Text;
+        *pEnd++ = 'f';
+        for (size_t j = 0; j < 3; j++) {
+            // 输出点的索引 + 1，因为索引从1开始
+            *pEnd++ = ' ';
+            pEnd = NumberFormatter::Format(
+                static_cast<uint64_t>(FaceIndices[i + j] + 1), pEnd);
         }
-        Stream << endl;
+        *pEnd++ = '\n';
+        Stream.write(Text, pEnd - Text);
     }
 }
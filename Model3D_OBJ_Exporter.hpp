@@ -3,13 +3,15 @@
 【功能模块和目的】定义Model3D_OBJ_Exporter类，
     继承自Model3D_Exporter类，表示三维模型的OBJ格式导出器
 【开发者及日期】谭雯心 2024/8/7
-【更改记录】
+【更改记录】2026/10/19 谭雯心 坐标改由NumberFormatter输出，默认为能精确读回的最短形式
 *************************************************************************/
 #ifndef MODEL3D_OBJ_EXPORTER_HPP
 #define MODEL3D_OBJ_EXPORTER_HPP
 
 // Model3D_Exporter所属头文件
 #include "Model3D_Exporter.hpp"
+// NumberFormatter所属头文件
+#include "NumberFormatter.hpp"
 // fstream所属头文件
 #include <fstream>
 // string所属头文件
@@ -20,14 +22,15 @@
 【功能】定义Model3D_OBJ_Exporter类，
     继承自Model3D_Exporter类，表示三维模型的OBJ格式导出器
 【接口说明】
-    默认构造函数
-    带参构造函数
+    带参构造函数（坐标的小数位数，默认为最短形式）
     拷贝构造函数
     重载赋值运算符
     虚析构函数
+    获取坐标的小数位数
     保存三维模型到流的OBJ格式实现
 【开发者及日期】谭雯心 2024/8/7
 【更改记录】2024/8/8 谭雯心 将导出模型的逻辑改为点不重复输出
+           2026/10/19 谭雯心 坐标改由NumberFormatter输出，默认为能精确读回的最短形式
 *************************************************************************/
 
 class Model3D_OBJ_Exporter : public Model3D_Exporter {
@@ -35,8 +38,8 @@ public:
     //-------------------------------------------------------------------------
     // 必要的构造、析构、拷贝、赋值运算符重载函数
     //-------------------------------------------------------------------------
-    // 默认构造函数
-    Model3D_OBJ_Exporter();
+    // 带参构造函数，Precision为坐标的小数位数，默认为最短形式
+    explicit Model3D_OBJ_Exporter(int Precision = NumberFormatter::SHORTEST);
     // 禁止外界调用拷贝构造函数
     Model3D_OBJ_Exporter(const Model3D_OBJ_Exporter& Source) = delete;
     // 禁止外界调用赋值运算符
@@ -47,9 +50,18 @@ public:
     //-------------------------------------------------------------------------
     // 非静态Getter成员函数
     //-------------------------------------------------------------------------
+    // 获取坐标的小数位数，最短形式时为NumberFormatter::SHORTEST
+    int GetPrecision() const;
     // 保存三维模型到流的OBJ格式实现
     virtual void SaveToStream(
         ofstream& Stream, const Model3D& AModel) const override;
+
+private:
+    //-------------------------------------------------------------------------
+    // 私有非静态成员
+    //-------------------------------------------------------------------------
+    // 坐标的格式化
+    NumberFormatter m_Formatter;
 };
 
 #endif /* Model3D_OBJ_Exporter.hpp */
\ No newline at end of file
@@ -2,7 +2,11 @@
 【文件名】Model3D_OBJ_Importer.cpp
 【功能模块和目的】定义Model3D_OBJ_Importer类的成员函数
 【开发者及日期】谭雯心 2024/8/7
-【更改记录】
+【更改记录】2026/10/19 谭雯心 增加了流式导入
+           2026/10/19 谭雯心 增加了计时探针
+           2026/10/19 谭雯心 改用OBJParser解析
+           2026/10/19 谭雯心 增加了按组导入为多个模型
+           2026/10/19 谭雯心 导入改为先读入IndexedModel3D再转换
 *************************************************************************/
 // Model3D_OBJ_Importer所属头文件
 #include "Model3D_OBJ_Importer.hpp"
@@ -14,15 +18,106 @@
 #include "Point3D.hpp"
 // Model3D所属头文件
 #include "Model3D.hpp"
+// IndexedModel3D所属头文件
+#include "IndexedModel3D.hpp"
+// ModelBatcher所属头文件
+#include "ModelBatcher.hpp"
+// OBJParser所属头文件
+#include "OBJParser.hpp"
+// Instrumentation所属头文件
+#include "Instrumentation.hpp"
+// ScopedTimer所属头文件
+#include "ScopedTimer.hpp"
+// TaskScheduler所属头文件
+#include "TaskScheduler.hpp"
 // fstream所属头文件
 #include <fstream>
 // string所属头文件
 #include <string>   
 // vector所属头文件
 #include <vector>
+// shared_ptr所属头文件
+#include <memory>
+// unordered_map所属头文件
+#include <unordered_map>
+// istream所属头文件
+#include <istream>
 
 using namespace std;
 
+namespace {
+    // 导入的探针，处理量为读到的面数与线数之和
+    const size_t PROBE_LOAD_FROM_STREAM = Instrumentation::RegisterProbe(
+        "Model3D_OBJ_Importer::LoadFromStream");
+    // 按组导入的探针，处理量为全部组的面数与线数之和
+    const size_t PROBE_LOAD_GROUPS = Instrumentation::RegisterProbe(
+        "Model3D_OBJ_Importer::LoadGroupsFromStream");
+
+    // 一个组的名称及其面、线的顶点索引，顶点坐标由全部组共用
+    struct GroupElements {
+        // 组名，第一个g或o之前的元素属于无名组
+        string Name;
+        // 每3个一个三角形
+        vector<size_t> FaceIndices;
+        // 每2个一条线段
+        vector<size_t> LineIndices;
+    };
+
+    /*************************************************************************
+    【函数名称】PointAt
+    【函数功能】从顶点坐标侧数组中取指定索引的顶点
+    【参数】const vector<double>& Positions, 顶点坐标，x, y, z交错存放
+           size_t Index, 顶点索引
+    【返回值】Point3D，顶点
+    【开发者及日期】谭雯心 2026/10/19
+    【更改记录】
+    *************************************************************************/
+    inline Point3D PointAt(const vector<double>& Positions, size_t Index) {
+        return Point3D(Positions[3 * Index], Positions[3 * Index + 1],
+            Positions[3 * Index + 2]);
+    }
+
+    /*************************************************************************
+    【函数名称】BuildGroup
+    【函数功能】按共用的顶点坐标组装一个组的模型。组内元素逐角点添加顶点
+           到IndexedModel3D，由ToModel合并坐标相同的顶点并去除退化和重复
+           的面、线，耗时与组内元素数成线性
+    【参数】const GroupElements& Group, 组
+           const vector<double>& Positions, 全部组共用的顶点坐标
+           Model3D& Model, 表示目标模型
+    【返回值】无
+    【开发者及日期】谭雯心 2026/10/19
+    【更改记录】2026/10/19 谭雯心 改为先组装IndexedModel3D再转换
+    *************************************************************************/
+    void BuildGroup(const GroupElements& Group,
+        const vector<double>& Positions, Model3D& Model) {
+        const vector<size_t>& FaceIndices = Group.FaceIndices;
+        const vector<size_t>& LineIndices = Group.LineIndices;
+        IndexedModel3D Indexed;
+        Indexed.Reserve(FaceIndices.size() + LineIndices.size(),
+            FaceIndices.size() / 3, LineIndices.size() / 2);
+        for (size_t i = 0; i < FaceIndices.size(); i += 3) {
+            size_t First = Indexed.GetVertexCount();
+            for (size_t j = 0; j < 3; j++) {
+                Indexed.AddVertex(PointAt(Positions, FaceIndices[i + j]));
+            }
+            Indexed.AddFace(First, First + 1, First + 2);
+        }
+        for (size_t i = 0; i < LineIndices.size(); i += 2) {
+            size_t First = Indexed.GetVertexCount();
+            for (size_t j = 0; j < 2; j++) {
+                Indexed.AddVertex(PointAt(Positions, LineIndices[i + j]));
+            }
+            Indexed.AddLine(First, First + 1);
+        }
+        // 无名组保留模型的默认名称
+        if (!Group.Name.empty()) {
+            Indexed.Name = Group.Name;
+        }
+        Model = Indexed.ToModel();
+    }
+}
+
 //-------------------------------------------------------------------------
 // 必要的构造、析构、拷贝、赋值运算符重载函数
 //-------------------------------------------------------------------------
@@ -44,64 +139,168 @@ Model3D_OBJ_Importer::Model3D_OBJ_Importer() : Model3D_Importer(".obj") {
 
 /*************************************************************************
 【函数名称】LoadFromStream
-【函数功能】从流导入三维模型的OBJ格式实现
+【函数功能】从流导入三维模型的OBJ格式实现，由OBJParser逐条读取记录，
+       多边形面已拆为三角形，折线已拆为线段；法向量和纹理坐标不属于
+       Model3D，读取后不使用。先读入IndexedModel3D再转换，由哈希表在
+       O(F + L)内去除退化和重复的面、线，而不是逐个面线性查重
 【参数】ifstream& Stream, 表示输入流
 【返回值】Model3D类的对象
 【开发者及日期】谭雯心 2024/8/7
-【更改记录】
+【更改记录】2026/10/19 谭雯心 增加了计时探针
+           2026/10/19 谭雯心 改用OBJParser，支持多边形面、v/vt/vn角点和负索引
+           2026/10/19 谭雯心 改为先读入IndexedModel3D再转换
 *************************************************************************/
 Model3D Model3D_OBJ_Importer::LoadFromStream(ifstream& Stream) const {
-    // 定义Model3D类的对象，以及存储点、面、线的容器
-    Model3D Model;
-    vector<Point3D> Points;
-    vector<Face3D> Faces;
-    vector<Line3D> Lines;
-    // 定义字符类型Tag用于读取文件中的每一行的第一个字符
-    char Tag;
-    // 定义字符串类型Description和Name用于存储模型的注释和名称
-    string Description;
-    string Name;
-    // 读取文件中的每一行的第一个字符
-    while (Stream >> Tag) {
-        // 跳过第一个字符后的空格
-        Stream.get();
-        switch (Tag) {
-            // 读取模型的注释
-            case '#': {
-                getline(Stream, Description);
-                Model.Description = Description;
+    ScopedTimer Timer(PROBE_LOAD_FROM_STREAM);
+    // 每条v记录添加一个顶点，因此解析得到的顶点索引即为Indexed的顶点索引
+    IndexedModel3D Indexed;
+    OBJParser Parser(Stream);
+    OBJParser::Record ARecord;
+    while ((ARecord = Parser.Next()) != OBJParser::Record::END) {
+        const vector<size_t>& Indices = Parser.GetIndices();
+        switch (ARecord) {
+            // 读取模型的点
+            case OBJParser::Record::VERTEX: {
+                const double* Values = Parser.GetValues();
+                Indexed.AddVertex(Values[0], Values[1], Values[2]);
+                break;
+            }
+            // 按照点的索引读取模型的面，每3个索引一个三角形
+            case OBJParser::Record::FACE: {
+                for (size_t i = 0; i < Indices.size(); i += 3) {
+                    Indexed.AddFace(Indices[i], Indices[i + 1], Indices[i + 2]);
+                }
+                break;
+            }
+            // 按照点的索引读取模型的线，每2个索引一条线段
+            case OBJParser::Record::LINE: {
+                for (size_t i = 0; i < Indices.size(); i += 2) {
+                    Indexed.AddLine(Indices[i], Indices[i + 1]);
+                }
+                break;
+            }
+            // 读取模型的名称，以最后一个组或对象名为准
+            case OBJParser::Record::GROUP:
+            case OBJParser::Record::OBJECT: {
+                Indexed.Name = Parser.GetText();
+                break;
+            }
+            // 读取模型的注释，以最后一条为准
+            case OBJParser::Record::COMMENT: {
+                Indexed.Description = Parser.GetText();
+                break;
+            }
+            default: {
+                break;
+            }
+        }
+    }
+    Timer.AddItems(Indexed.GetFaceCount() + Indexed.GetLineCount());
+    return Indexed.ToModel();
+}
+/*************************************************************************
+【函数名称】StreamFromStream
+【函数功能】从流流式导入三维模型的OBJ格式实现，由OBJParser逐条读取记录
+       并交给Batcher，只在Batcher中保存顶点，不保存面和线
+【参数】ifstream& Stream, 表示输入流
+       ModelBatcher& Batcher, 表示批次组装器
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】2026/10/19 谭雯心 改用OBJParser，支持多边形面、v/vt/vn角点和负索引
+*************************************************************************/
+void Model3D_OBJ_Importer::StreamFromStream(
+    ifstream& Stream, ModelBatcher& Batcher) const {
+    OBJParser Parser(Stream);
+    OBJParser::Record ARecord;
+    while ((ARecord = Parser.Next()) != OBJParser::Record::END) {
+        const vector<size_t>& Indices = Parser.GetIndices();
+        switch (ARecord) {
+            // 读取模型的点
+            case OBJParser::Record::VERTEX: {
+                const double* Values = Parser.GetValues();
+                Batcher.AddVertex(Values[0], Values[1], Values[2]);
+                break;
+            }
+            // 按照点的索引读取模型的面
+            case OBJParser::Record::FACE: {
+                for (size_t i = 0; i < Indices.size(); i += 3) {
+                    Batcher.AddFace(Indices[i], Indices[i + 1], Indices[i + 2]);
+                }
+                break;
+            }
+            // 按照点的索引读取模型的线
+            case OBJParser::Record::LINE: {
+                for (size_t i = 0; i < Indices.size(); i += 2) {
+                    Batcher.AddLine(Indices[i], Indices[i + 1]);
+                }
                 break;
             }
             // 读取模型的名称
-            case 'g': {
-                getline(Stream, Name);
-                Model.Name = Name;
+            case OBJParser::Record::GROUP:
+            case OBJParser::Record::OBJECT: {
+                Batcher.SetName(Parser.GetText());
                 break;
             }
-            // 读取模型的点，将点存入Points容器
-            case 'v': {
-                double X, Y, Z;
-                Stream >> X >> Y >> Z;
-                Points.push_back(Point3D(X, Y, Z));
+            // 读取模型的注释
+            case OBJParser::Record::COMMENT: {
+                Batcher.SetDescription(Parser.GetText());
                 break;
             }
-            // 按照点的索引读取模型的面，将面存入Faces容器
-            case 'f': {
-                size_t Index1, Index2, Index3;
-                Stream >> Index1 >> Index2 >> Index3;
-                Faces.push_back(Face3D(
-                    Points[Index1 - 1], 
-                    Points[Index2 - 1], 
-                    Points[Index3 - 1]));
+            default: {
                 break;
             }
-            // 按照点的索引读取模型的线，将线存入Lines容器
-            case 'l': {
-                size_t Index1, Index2;
-                Stream >> Index1 >> Index2;
-                Lines.push_back(Line3D(
-                    Points[Index1 - 1], 
-                    Points[Index2 - 1]));
+        }
+    }
+}
+/*************************************************************************
+【函数名称】LoadGroupsFromStream
+【函数功能】从流导入OBJ文件，每个组或对象导入为一个模型。只解析一遍：
+       顶点坐标读入全部组共用的侧数组，面和线按所在的组只记录顶点索引；
+       解析结束后由TaskScheduler并行地按共用的顶点坐标组装各组的模型。
+       同名的组（OBJ允许回到之前的组）合并为一个模型，没有面和线的组
+       不产生模型；注释以最后一条为准，作为全部模型的注释
+【参数】istream& Stream, 表示输入流
+【返回值】vector<shared_ptr<Model3D>>，按组首次出现的顺序排列的模型，
+       调用者可直接登记而无需拷贝
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+vector<shared_ptr<Model3D>> Model3D_OBJ_Importer::LoadGroupsFromStream(
+    istream& Stream) const {
+    ScopedTimer Timer(PROBE_LOAD_GROUPS);
+    OBJParser Parser(Stream);
+    // 第0个为无名组，组名到组的位置
+    vector<GroupElements> Groups(1);
+    unordered_map<string, size_t> GroupIndices{{string(), 0}};
+    size_t Current = 0;
+    string Description;
+    OBJParser::Record ARecord;
+    while ((ARecord = Parser.Next()) != OBJParser::Record::END) {
+        const vector<size_t>& Indices = Parser.GetIndices();
+        switch (ARecord) {
+            case OBJParser::Record::FACE: {
+                vector<size_t>& Target = Groups[Current].FaceIndices;
+                Target.insert(Target.end(), Indices.begin(), Indices.end());
+                break;
+            }
+            case OBJParser::Record::LINE: {
+                vector<size_t>& Target = Groups[Current].LineIndices;
+                Target.insert(Target.end(), Indices.begin(), Indices.end());
+                break;
+            }
+            // 切换到该名称的组，首次出现时新建
+            case OBJParser::Record::GROUP:
+            case OBJParser::Record::OBJECT: {
+                auto Result = GroupIndices.emplace(
+                    Parser.GetText(), Groups.size());
+                if (Result.second) {
+                    Groups.push_back(GroupElements{Parser.GetText(), {}, {}});
+                }
+                Current = Result.first->second;
+                break;
+            }
+            case OBJParser::Record::COMMENT: {
+                Description = Parser.GetText();
                 break;
             }
             default: {
@@ -109,8 +308,27 @@ Model3D Model3D_OBJ_Importer::LoadFromStream(ifstream& Stream) const {
             }
         }
     }
-    // 利用重载的+=运算符将点、面、线存入Model3D类的对象
-    Model += Faces;
-    Model += Lines;
-    return Model;
-}
\ No newline at end of file
+    // 去掉没有面和线的组
+    vector<const GroupElements*> NonEmpty;
+    size_t ElementCount = 0;
+    for (const GroupElements& Group : Groups) {
+        if (!Group.FaceIndices.empty() || !Group.LineIndices.empty()) {
+            NonEmpty.push_back(&Group);
+            ElementCount += Group.FaceIndices.size() / 3
+                + Group.LineIndices.size() / 2;
+        }
+    }
+    // 各组只读共用的顶点坐标，并行组装
+    const vector<double>& Positions = Parser.GetPositions();
+    vector<shared_ptr<Model3D>> Models(NonEmpty.size());
+    TaskScheduler::GetInstance()->ParallelFor(0, Models.size(), 1,
+        [&](size_t Begin, size_t End) {
+            for (size_t i = Begin; i < End; i++) {
+                Models[i] = make_shared<Model3D>();
+                BuildGroup(*NonEmpty[i], Positions, *Models[i]);
+                Models[i]->Description = Description;
+            }
+        });
+    Timer.AddItems(ElementCount);
+    return Models;
+}
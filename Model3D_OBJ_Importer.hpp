@@ -3,7 +3,8 @@
 【功能模块和目的】定义Model3D_OBJ_Importer类，
     继承自Model3D_Importer类，表示三维模型的OBJ格式导入器
 【开发者及日期】谭雯心 2024/8/7
-【更改记录】
+【更改记录】2026/10/19 谭雯心 增加了流式导入
+           2026/10/19 谭雯心 增加了按组导入为多个模型
 *************************************************************************/
 #ifndef MODEL3D_OBJ_IMPORTER_HPP
 #define MODEL3D_OBJ_IMPORTER_HPP
@@ -12,10 +13,18 @@
 #include "Model3D.hpp"
 // Model3D_Importer所属头文件
 #include "Model3D_Importer.hpp"
+// ModelBatcher所属头文件
+#include "ModelBatcher.hpp"
 // fstream所属头文件
 #include <fstream>
+// istream所属头文件
+#include <istream>
+// shared_ptr所属头文件
+#include <memory>
 // string所属头文件
 #include <string>
+// vector所属头文件
+#include <vector>
 
 using namespace std;
 
@@ -31,8 +40,11 @@ using namespace std;
     重载赋值运算符
     虚析构函数
     从流导入三维模型的OBJ格式实现
+    从流流式导入三维模型的OBJ格式实现
+    从流导入OBJ文件，每个组或对象一个模型
 【开发者及日期】谭雯心 2024/8/7
-【更改记录】
+【更改记录】2026/10/19 谭雯心 增加了流式导入
+           2026/10/19 谭雯心 增加了按组导入为多个模型
 *************************************************************************/
 
 class Model3D_OBJ_Importer : public Model3D_Importer {
@@ -54,6 +66,11 @@ public:
     //-------------------------------------------------------------------------
     // 从流导入三维模型的OBJ格式实现
     virtual Model3D LoadFromStream(ifstream& Stream) const override;
+    // 从流流式导入三维模型的OBJ格式实现
+    virtual void StreamFromStream(
+        ifstream& Stream, ModelBatcher& Batcher) const override;
+    // 从流导入OBJ文件，每个组或对象一个模型，同名的组合并
+    vector<shared_ptr<Model3D>> LoadGroupsFromStream(istream& Stream) const;
 };
 
 #endif /* Model3D_OBJ_Importer.hpp */
\ No newline at end of file
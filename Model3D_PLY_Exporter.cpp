@@ -0,0 +1,200 @@
+/*************************************************************************
+【文件名】Model3D_PLY_Exporter.cpp
+【功能模块和目的】定义Model3D_PLY_Exporter类的成员函数
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】2026/10/19 谭雯心 文本格式的数值改由NumberFormatter输出
+*************************************************************************/
+// Model3D_PLY_Exporter所属头文件
+#include "Model3D_PLY_Exporter.hpp"
+// IndexedModel3D所属头文件
+#include "IndexedModel3D.hpp"
+// PLYFormat所属头文件
+#include "PLYFormat.hpp"
+// Model3D所属头文件
+#include "Model3D.hpp"
+// Instrumentation所属头文件
+#include "Instrumentation.hpp"
+// ScopedTimer所属头文件
+#include "ScopedTimer.hpp"
+// NumberFormatter所属头文件
+#include "NumberFormatter.hpp"
+// fstream所属头文件
+#include <fstream>
+// string所属头文件
+#include <string>
+// vector所属头文件
+#include <vector>
+// memcpy所属头文件
+#include <cstring>
+// uint8_t, uint32_t所属头文件
+#include <cstdint>
+// size_t所属头文件
+#include <cstddef>
+
+using namespace std;
+
+namespace {
+    // 导出的探针，处理量为导出的面数与线数之和
+    const size_t PROBE_SAVE_TO_STREAM = Instrumentation::RegisterProbe(
+        "Model3D_PLY_Exporter::SaveToStream");
+
+    /*********************************************************************
+    【函数名称】PackIndices
+    【函数功能】把顶点索引打包为二进制记录，每条记录为可选的uchar长度
+           和Width个uint索引
+    【参数】const vector<size_t>& Indices, 表示顶点索引
+           size_t Width, 表示每条记录的索引数
+           bool bCount, 表示记录是否以uchar长度开头
+    【返回值】string，打包后的数据
+    【开发者及日期】谭雯心 2026/10/19
+    【更改记录】
+    *********************************************************************/
+    string PackIndices(const vector<size_t>& Indices, size_t Width,
+        bool bCount) {
+        size_t RecordSize = (bCount ? 1 : 0) + Width * sizeof(uint32_t);
+        string Buffer(Indices.size() / Width * RecordSize, '\0');
+        char* pRecord = &Buffer[0];
+        for (size_t i = 0; i < Indices.size(); i += Width) {
+            if (bCount) {
+                *pRecord++ = static_cast<char>(Width);
+            }
+            for (size_t j = 0; j < Width; j++) {
+                uint32_t Index = static_cast<uint32_t>(Indices[i + j]);
+                memcpy(pRecord, &Index, sizeof(Index));
+                pRecord += sizeof(Index);
+            }
+        }
+        return Buffer;
+    }
+}
+
+//-------------------------------------------------------------------------
+// 必要的构造、析构、拷贝、赋值运算符重载函数
+//-------------------------------------------------------------------------
+
+/*************************************************************************
+【函数名称】Model3D_PLY_Exporter
+【函数功能】带参构造函数, 将Model3D_Exporter文件扩展名设为".ply"
+【参数】bool bBinary, 表示是否导出binary_little_endian格式（否则导出ascii）
+       int Precision, 表示文本格式的小数位数，NumberFormatter::SHORTEST
+       表示输出能精确读回的最短形式
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】2026/10/19 谭雯心 增加了文本格式的小数位数
+*************************************************************************/
+Model3D_PLY_Exporter::Model3D_PLY_Exporter(bool bBinary, int Precision)
+    : Model3D_Exporter(".ply"), m_bBinary(bBinary), m_Formatter(Precision) {
+}
+
+//-------------------------------------------------------------------------
+// 非静态Getter成员函数
+//-------------------------------------------------------------------------
+
+/*************************************************************************
+【函数名称】IsBinary
+【函数功能】获取是否导出二进制格式
+【参数】无
+【返回值】bool，是否导出二进制格式
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+bool Model3D_PLY_Exporter::IsBinary() const {
+    return m_bBinary;
+}
+/*************************************************************************
+【函数名称】GetPrecision
+【函数功能】获取文本格式的小数位数
+【参数】无
+【返回值】int，小数位数，最短形式时为NumberFormatter::SHORTEST
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+int Model3D_PLY_Exporter::GetPrecision() const {
+    return m_Formatter.GetPrecision();
+}
+/*************************************************************************
+【函数名称】SaveToStream
+【函数功能】保存三维模型到流的PLY格式实现，先转换为IndexedModel3D，
+       再写出文件头和vertex、face、edge元素（没有线时省略edge元素）
+【参数】ofstream& Stream, 表示输出流（以二进制方式打开）
+       const Model3D& AModel, 表示Model3D类的对象
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】2026/10/19 谭雯心 文本格式的数值改由NumberFormatter输出
+*************************************************************************/
+void Model3D_PLY_Exporter::SaveToStream(
+    ofstream& Stream, const Model3D& AModel) const {
+    ScopedTimer Timer(PROBE_SAVE_TO_STREAM);
+    Timer.AddItems(AModel.GetElementCount());
+    // 导出到流前先清空流
+    Stream.clear();
+    IndexedModel3D Indexed = IndexedModel3D::FromModel(AModel);
+    PLYFormat::Header AHeader;
+    AHeader.Format = m_bBinary ? PLYFormat::Encoding::BINARY_LITTLE_ENDIAN
+        : PLYFormat::Encoding::ASCII;
+    if (!Indexed.Description.empty()) {
+        AHeader.Comments.push_back(Indexed.Description);
+    }
+    if (!Indexed.Name.empty()) {
+        AHeader.ObjectInfo.push_back(Indexed.Name);
+    }
+    PLYFormat::Element Vertex{"vertex", Indexed.GetVertexCount(), {}};
+    for (const char* Name : {"x", "y", "z"}) {
+        Vertex.Properties.push_back(
+            {Name, PLYFormat::ScalarType::FLOAT64, false, {}});
+    }
+    PLYFormat::Element Face{"face", Indexed.GetFaceCount(), {}};
+    Face.Properties.push_back({"vertex_indices",
+        PLYFormat::ScalarType::UINT32, true, PLYFormat::ScalarType::UINT8});
+    PLYFormat::Element Edge{"edge", Indexed.GetLineCount(), {}};
+    for (const char* Name : {"vertex1", "vertex2"}) {
+        Edge.Properties.push_back(
+            {Name, PLYFormat::ScalarType::UINT32, false, {}});
+    }
+    AHeader.Elements = {Vertex, Face};
+    if (Indexed.GetLineCount() > 0) {
+        AHeader.Elements.push_back(Edge);
+    }
+    PLYFormat::WriteHeader(Stream, AHeader);
+    const vector<double>& Vertices = Indexed.Vertices();
+    const vector<size_t>& Faces = Indexed.FaceIndices();
+    const vector<size_t>& Lines = Indexed.LineIndices();
+    if (m_bBinary) {
+        // 顶点数组与x、y、z三个double属性的记录布局相同，一次写出
+        Stream.write(reinterpret_cast<const char*>(Vertices.data()),
+            static_cast<streamsize>(Vertices.size() * sizeof(double)));
+        string Buffer = PackIndices(Faces, 3, true);
+        Stream.write(Buffer.data(), static_cast<streamsize>(Buffer.size()));
+        Buffer = PackIndices(Lines, 2, false);
+        Stream.write(Buffer.data(), static_cast<streamsize>(Buffer.size()));
+        return;
+    }
+    // 每行先在Text中拼好再一次写入流
+    char Text[4 * NumberFormatter::MAX_LENGTH];
+    for (size_t i = 0; i < Vertices.size(); i += 3) {
+        char* pEnd = m_Formatter.Format(
+            Vertices[i], Vertices[i + 1], Vertices[i + 2], Text);
+        *pEnd++ = '\n';
+        Stream.write(Text, pEnd - Text);
+    }
+    for (size_t i = 0; i < Faces.size(); i += 3) {
+        char* pEnd = Text;
+        *pEnd++ = '3';
+        for (size_t j = 0; j < 3; j++) {
+            *pEnd++ = ' ';
+            pEnd = NumberFormatter::Format(
+                static_cast<uint64_t>(Faces[i + j]), pEnd);
+        }
+        *pEnd++ = '\n';
+        Stream.write(Text, pEnd - Text);
+    }
+    for (size_t i = 0; i < Lines.size(); i += 2) {
+        char* pEnd = NumberFormatter::Format(
+            static_cast<uint64_t>(Lines[i]), Text);
+        *pEnd++ = ' ';
+        pEnd = NumberFormatter::Format(
+            static_cast<uint64_t>(Lines[i + 1]), pEnd);
+        *pEnd++ = '\n';
+        Stream.write(Text, pEnd - Text);
+    }
+}
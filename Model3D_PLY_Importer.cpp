@@ -0,0 +1,385 @@
+/*************************************************************************
+【文件名】Model3D_PLY_Importer.cpp
+【功能模块和目的】定义Model3D_PLY_Importer类的成员函数
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】2026/10/19 谭雯心 增加了按文件开头的内容识别格式
+*************************************************************************/
+// Model3D_PLY_Importer所属头文件
+#include "Model3D_PLY_Importer.hpp"
+// IndexedModel3D所属头文件
+#include "IndexedModel3D.hpp"
+// PLYFormat所属头文件
+#include "PLYFormat.hpp"
+// Model3D所属头文件
+#include "Model3D.hpp"
+// ModelBatcher所属头文件
+#include "ModelBatcher.hpp"
+// Instrumentation所属头文件
+#include "Instrumentation.hpp"
+// ScopedTimer所属头文件
+#include "ScopedTimer.hpp"
+// fstream所属头文件
+#include <fstream>
+// string所属头文件
+#include <string>
+// vector所属头文件
+#include <vector>
+// function所属头文件
+#include <functional>
+// invalid_argument所属头文件
+#include <stdexcept>
+// uint64_t所属头文件
+#include <cstdint>
+// min所属头文件
+#include <algorithm>
+// size_t所属头文件
+#include <cstddef>
+
+using namespace std;
+
+namespace {
+    // 导入的探针，处理量为读到的面数与线数之和
+    const size_t PROBE_LOAD_FROM_STREAM = Instrumentation::RegisterProbe(
+        "Model3D_PLY_Importer::LoadFromStream");
+    // 每块解析的最多记录数
+    const size_t BLOCK_RECORDS = 65536;
+    // 属性不存在时的位置
+    const size_t NO_PROPERTY = static_cast<size_t>(-1);
+
+    /*********************************************************************
+    【函数名称】FindProperty
+    【函数功能】按名称查找元素的属性
+    【参数】const PLYFormat::Element& AElement, 表示元素
+           const string& Name, 表示属性名
+           bool bList, 表示要找的是否为列表属性
+    【返回值】size_t，属性的位置，找不到时为NO_PROPERTY
+    【开发者及日期】谭雯心 2026/10/19
+    【更改记录】
+    *********************************************************************/
+    size_t FindProperty(const PLYFormat::Element& AElement,
+        const string& Name, bool bList) {
+        for (size_t i = 0; i < AElement.Properties.size(); i++) {
+            if (AElement.Properties[i].Name == Name
+                && AElement.Properties[i].bList == bList) {
+                return i;
+            }
+        }
+        return NO_PROPERTY;
+    }
+}
+
+//-------------------------------------------------------------------------
+// 内嵌异常类
+//-------------------------------------------------------------------------
+
+/*************************************************************************
+【函数名称】FILE_FORMAT_ERROR
+【函数功能】构造函数
+【参数】无
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+Model3D_PLY_Importer::FILE_FORMAT_ERROR::FILE_FORMAT_ERROR()
+    : invalid_argument("Invalid PLY data") {
+}
+
+//-------------------------------------------------------------------------
+// 必要的构造、析构、拷贝、赋值运算符重载函数
+//-------------------------------------------------------------------------
+
+/*************************************************************************
+【函数名称】Model3D_PLY_Importer
+【函数功能】默认构造函数, 将Model3D_Importer文件扩展名设为".ply"
+【参数】无
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+Model3D_PLY_Importer::Model3D_PLY_Importer() : Model3D_Importer(".ply") {
+}
+
+//-------------------------------------------------------------------------
+// 非静态Getter成员函数
+//-------------------------------------------------------------------------
+
+/*************************************************************************
+【函数名称】LoadFromStream
+【函数功能】从流导入三维模型的PLY格式实现。按文件头声明的数量预留
+       IndexedModel3D的存储，各块数据直接追加到其连续数组，再转换
+【参数】ifstream& Stream, 表示输入流（以二进制方式打开）
+【返回值】Model3D类的对象
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+Model3D Model3D_PLY_Importer::LoadFromStream(ifstream& Stream) const {
+    ScopedTimer Timer(PROBE_LOAD_FROM_STREAM);
+    PLYFormat::Header AHeader;
+    if (!PLYFormat::ReadHeader(Stream, AHeader)) {
+        throw FILE_FORMAT_ERROR();
+    }
+    IndexedModel3D Indexed;
+    if (!AHeader.ObjectInfo.empty()) {
+        Indexed.Name = AHeader.ObjectInfo.front();
+    }
+    if (!AHeader.Comments.empty()) {
+        Indexed.Description = AHeader.Comments.front();
+    }
+    size_t Counts[3] = {0, 0, 0};
+    for (const PLYFormat::Element& AElement : AHeader.Elements) {
+        if (AElement.Name == "vertex") {
+            Counts[0] += AElement.Count;
+        }
+        else if (AElement.Name == "face") {
+            Counts[1] += AElement.Count;
+        }
+        else if (AElement.Name == "edge") {
+            Counts[2] += AElement.Count;
+        }
+    }
+    Indexed.Reserve(Counts[0], Counts[1], Counts[2]);
+    ReadBody(Stream, AHeader,
+        [&Indexed](const vector<double>& Vertices) {
+            for (size_t i = 0; i < Vertices.size(); i += 3) {
+                Indexed.AddVertex(Vertices[i], Vertices[i + 1], Vertices[i + 2]);
+            }
+        },
+        [&Indexed](const vector<size_t>& Faces) {
+            for (size_t i = 0; i < Faces.size(); i += 3) {
+                Indexed.AddFace(Faces[i], Faces[i + 1], Faces[i + 2]);
+            }
+        },
+        [&Indexed](const vector<size_t>& Lines) {
+            for (size_t i = 0; i < Lines.size(); i += 2) {
+                Indexed.AddLine(Lines[i], Lines[i + 1]);
+            }
+        });
+    Timer.AddItems(Indexed.GetFaceCount() + Indexed.GetLineCount());
+    return Indexed.ToModel();
+}
+/*************************************************************************
+【函数名称】StreamFromStream
+【函数功能】从流流式导入三维模型的PLY格式实现，每块数据解析后即交给Batcher，
+       不保存整个模型
+【参数】ifstream& Stream, 表示输入流（以二进制方式打开）
+       ModelBatcher& Batcher, 表示批次组装器
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+void Model3D_PLY_Importer::StreamFromStream(
+    ifstream& Stream, ModelBatcher& Batcher) const {
+    PLYFormat::Header AHeader;
+    if (!PLYFormat::ReadHeader(Stream, AHeader)) {
+        throw FILE_FORMAT_ERROR();
+    }
+    if (!AHeader.ObjectInfo.empty()) {
+        Batcher.SetName(AHeader.ObjectInfo.front());
+    }
+    if (!AHeader.Comments.empty()) {
+        Batcher.SetDescription(AHeader.Comments.front());
+    }
+    ReadBody(Stream, AHeader,
+        [&Batcher](const vector<double>& Vertices) {
+            for (size_t i = 0; i < Vertices.size(); i += 3) {
+                Batcher.AddVertex(Vertices[i], Vertices[i + 1], Vertices[i + 2]);
+            }
+        },
+        [&Batcher](const vector<size_t>& Faces) {
+            for (size_t i = 0; i < Faces.size(); i += 3) {
+                Batcher.AddFace(Faces[i], Faces[i + 1], Faces[i + 2]);
+            }
+        },
+        [&Batcher](const vector<size_t>& Lines) {
+            for (size_t i = 0; i < Lines.size(); i += 2) {
+                Batcher.AddLine(Lines[i], Lines[i + 1]);
+            }
+        });
+}
+
+//-------------------------------------------------------------------------
+// 私有静态成员函数
+//-------------------------------------------------------------------------
+
+/*************************************************************************
+【函数名称】ReadBody
+【函数功能】按块读取文件头之后的数据。每块至多BLOCK_RECORDS条记录：
+       二进制且全为标量属性的元素整块取出，按各属性的偏移解码；
+       其余情况逐条记录读取属性值。vertex块交出x、y、z，face块交出
+       扇形拆分后的三角形，edge块交出vertex1、vertex2，其余元素跳过
+【参数】ifstream& Stream, 表示输入流，位于文件头之后
+       const PLYFormat::Header& AHeader, 表示文件头
+       const function<void(const vector<double>&)>& OnVertices,
+           接收一块顶点坐标（x, y, z交错存放）
+       const function<void(const vector<size_t>&)>& OnFaces,
+           接收一块面的顶点索引（每3个索引一个面）
+       const function<void(const vector<size_t>&)>& OnLines,
+           接收一块线的顶点索引（每2个索引一条线）
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+void Model3D_PLY_Importer::ReadBody(ifstream& Stream,
+    const PLYFormat::Header& AHeader,
+    const function<void(const vector<double>&)>& OnVertices,
+    const function<void(const vector<size_t>&)>& OnFaces,
+    const function<void(const vector<size_t>&)>& OnLines) {
+    bool bBinary = AHeader.Format == PLYFormat::Encoding::BINARY_LITTLE_ENDIAN;
+    PLYFormat::BlockReader Reader(Stream);
+    size_t VertexCount = 0;
+    vector<double> Vertices;
+    vector<size_t> Indices;
+    // 当前记录的标量属性值，以及列表属性的值（只保留要用的一个列表）
+    vector<double> Scalars;
+    vector<double> List;
+    // 检查并转换顶点索引
+    auto ToIndex = [&VertexCount](double Value) {
+        if (!(Value >= 0 && Value < static_cast<double>(VertexCount))) {
+            throw FILE_FORMAT_ERROR();
+        }
+        return static_cast<size_t>(Value);
+    };
+    // 读取一个标量值
+    auto ReadValue = [&](PLYFormat::ScalarType Type) {
+        if (bBinary) {
+            const char* pData = Reader.Take(PLYFormat::SizeOf(Type));
+            if (pData == nullptr) {
+                throw FILE_FORMAT_ERROR();
+            }
+            return PLYFormat::Decode(pData, Type);
+        }
+        double Value;
+        if (!(Stream >> Value)) {
+            throw FILE_FORMAT_ERROR();
+        }
+        return Value;
+    };
+    for (const PLYFormat::Element& AElement : AHeader.Elements) {
+        const vector<PLYFormat::Property>& Properties = AElement.Properties;
+        // 要用的属性：vertex为x、y、z，face为顶点索引列表，edge为两个端点
+        size_t Used[3] = {NO_PROPERTY, NO_PROPERTY, NO_PROPERTY};
+        size_t UsedCount = 0;
+        if (AElement.Name == "vertex") {
+            Used[0] = FindProperty(AElement, "x", false);
+            Used[1] = FindProperty(AElement, "y", false);
+            Used[2] = FindProperty(AElement, "z", false);
+            UsedCount = 3;
+        }
+        else if (AElement.Name == "face") {
+            Used[0] = FindProperty(AElement, "vertex_indices", true);
+            if (Used[0] == NO_PROPERTY) {
+                Used[0] = FindProperty(AElement, "vertex_index", true);
+            }
+            UsedCount = 1;
+        }
+        else if (AElement.Name == "edge") {
+            Used[0] = FindProperty(AElement, "vertex1", false);
+            Used[1] = FindProperty(AElement, "vertex2", false);
+            UsedCount = 2;
+        }
+        for (size_t i = 0; i < UsedCount; i++) {
+            if (Used[i] == NO_PROPERTY) {
+                throw FILE_FORMAT_ERROR();
+            }
+        }
+        // 全为标量属性时记录定长，计算各属性的偏移
+        bool bFixed = true;
+        size_t Stride = 0;
+        vector<size_t> Offsets;
+        for (const PLYFormat::Property& AProperty : Properties) {
+            bFixed = bFixed && !AProperty.bList;
+            Offsets.push_back(Stride);
+            Stride += PLYFormat::SizeOf(AProperty.Type);
+        }
+        Scalars.assign(Properties.size(), 0);
+        for (uint64_t Done = 0; Done < AElement.Count; ) {
+            size_t Block = static_cast<size_t>(
+                min<uint64_t>(BLOCK_RECORDS, AElement.Count - Done));
+            Vertices.clear();
+            Indices.clear();
+            const char* pBlock = nullptr;
+            if (bBinary && bFixed) {
+                pBlock = Reader.Take(Block * Stride);
+                if (pBlock == nullptr) {
+                    throw FILE_FORMAT_ERROR();
+                }
+            }
+            for (size_t Record = 0; Record < Block; Record++) {
+                if (pBlock != nullptr) {
+                    // 定长记录只解码要用的属性
+                    const char* pRecord = pBlock + Record * Stride;
+                    for (size_t i = 0; i < UsedCount; i++) {
+                        Scalars[Used[i]] = PLYFormat::Decode(
+                            pRecord + Offsets[Used[i]], Properties[Used[i]].Type);
+                    }
+                }
+                else {
+                    for (size_t k = 0; k < Properties.size(); k++) {
+                        if (!Properties[k].bList) {
+                            Scalars[k] = ReadValue(Properties[k].Type);
+                            continue;
+                        }
+                        double Length = ReadValue(Properties[k].CountType);
+                        if (!(Length >= 0)) {
+                            throw FILE_FORMAT_ERROR();
+                        }
+                        bool bKeep = UsedCount == 1 && k == Used[0];
+                        if (bKeep) {
+                            List.clear();
+                        }
+                        for (size_t j = 0; j < static_cast<size_t>(Length); j++) {
+                            double Value = ReadValue(Properties[k].Type);
+                            if (bKeep) {
+                                List.push_back(Value);
+                            }
+                        }
+                    }
+                }
+                if (AElement.Name == "vertex") {
+                    Vertices.push_back(Scalars[Used[0]]);
+                    Vertices.push_back(Scalars[Used[1]]);
+                    Vertices.push_back(Scalars[Used[2]]);
+                }
+                else if (AElement.Name == "face") {
+                    // 多边形按扇形拆为三角形，不足3个顶点的面跳过
+                    for (size_t j = 2; j < List.size(); j++) {
+                        Indices.push_back(ToIndex(List[0]));
+                        Indices.push_back(ToIndex(List[j - 1]));
+                        Indices.push_back(ToIndex(List[j]));
+                    }
+                }
+                else if (AElement.Name == "edge") {
+                    Indices.push_back(ToIndex(Scalars[Used[0]]));
+                    Indices.push_back(ToIndex(Scalars[Used[1]]));
+                }
+            }
+            Done += Block;
+            if (AElement.Name == "vertex") {
+                VertexCount += Block;
+                OnVertices(Vertices);
+            }
+            else if (AElement.Name == "face") {
+                OnFaces(Indices);
+            }
+            else if (AElement.Name == "edge") {
+                OnLines(Indices);
+            }
+        }
+    }
+}
+/*************************************************************************
+【函数名称】Recognize
+【函数功能】按首行"ply"识别PLY格式
+【参数】const string& Head, 表示文件开头至多HEAD_SIZE字节
+       uint64_t FileSize, 表示文件长度
+【返回值】bool，是否为PLY格式
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+bool Model3D_PLY_Importer::Recognize(
+    const string& Head, uint64_t FileSize) const {
+    // 显示标记未使用的参数
+    (void)FileSize;
+    return Head.compare(0, 4, "ply\n") == 0
+        || Head.compare(0, 5, "ply\r\n") == 0;
+}
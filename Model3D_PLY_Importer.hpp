@@ -0,0 +1,100 @@
+/*************************************************************************
+【文件名】Model3D_PLY_Importer.hpp
+【功能模块和目的】定义Model3D_PLY_Importer类，
+    继承自Model3D_Importer类，表示三维模型的PLY格式（二进制和文本）导入器
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】2026/10/19 谭雯心 增加了按文件开头的内容识别格式
+*************************************************************************/
+#ifndef MODEL3D_PLY_IMPORTER_HPP
+#define MODEL3D_PLY_IMPORTER_HPP
+
+// Model3D所属头文件
+#include "Model3D.hpp"
+// Model3D_Importer所属头文件
+#include "Model3D_Importer.hpp"
+// ModelBatcher所属头文件
+#include "ModelBatcher.hpp"
+// PLYFormat所属头文件
+#include "PLYFormat.hpp"
+// fstream所属头文件
+#include <fstream>
+// function所属头文件
+#include <functional>
+// vector所属头文件
+#include <vector>
+// size_t所属头文件
+#include <cstddef>
+// invalid_argument所属头文件
+#include <stdexcept>
+// string所属头文件
+#include <string>
+// uint64_t所属头文件
+#include <cstdint>
+
+using namespace std;
+
+/*************************************************************************
+【类名】Model3D_PLY_Importer
+【功能】定义Model3D_PLY_Importer类，
+    继承自Model3D_Importer类，表示三维模型的PLY格式导入器。
+    支持ascii和binary_little_endian编码，读取vertex、face、edge元素，
+    多边形面按扇形拆为三角形，其余元素和属性跳过。各元素的记录按块解析，
+    每块的顶点坐标和顶点索引存入连续数组后一次交出，二进制的定长记录
+    整块取出后按属性偏移解码。名称取自首个obj_info行，注释取自首个comment行
+【接口说明】
+    默认构造函数
+    禁止拷贝构造函数
+    禁止赋值运算符
+    虚析构函数
+    从流导入三维模型的PLY格式实现
+    从流流式导入三维模型的PLY格式实现（逐块交给Batcher）
+    按文件开头的内容识别PLY格式
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】2026/10/19 谭雯心 增加了按文件开头的内容识别格式
+*************************************************************************/
+class Model3D_PLY_Importer : public Model3D_Importer {
+public:
+    //-------------------------------------------------------------------------
+    // 内嵌异常类
+    //-------------------------------------------------------------------------
+    // 若文件头或数据不符合PLY格式，或顶点索引超出范围，则抛出该异常
+    class FILE_FORMAT_ERROR : public invalid_argument {
+    public:
+        FILE_FORMAT_ERROR();
+    };
+    //-------------------------------------------------------------------------
+    // 必要的构造、析构、拷贝、赋值运算符重载函数
+    //-------------------------------------------------------------------------
+    // 默认构造函数
+    Model3D_PLY_Importer();
+    // 禁止外界调用拷贝构造函数
+    Model3D_PLY_Importer(const Model3D_PLY_Importer& Source) = delete;
+    // 禁止外界调用重载赋值运算符
+    Model3D_PLY_Importer& operator=(
+        const Model3D_PLY_Importer& Source) = delete;
+    // 虚析构函数
+    virtual ~Model3D_PLY_Importer() = default;
+    //-------------------------------------------------------------------------
+    // 非静态Getter成员函数
+    //-------------------------------------------------------------------------
+    // 从流导入三维模型的PLY格式实现
+    virtual Model3D LoadFromStream(ifstream& Stream) const override;
+    // 从流流式导入三维模型的PLY格式实现
+    virtual void StreamFromStream(
+        ifstream& Stream, ModelBatcher& Batcher) const override;
+    // 按文件开头的内容识别PLY格式
+    virtual bool Recognize(
+        const string& Head, uint64_t FileSize) const override;
+
+private:
+    //-------------------------------------------------------------------------
+    // 私有静态成员函数
+    //-------------------------------------------------------------------------
+    // 按块读取文件头之后的数据，依次把每块顶点坐标、面和线的顶点索引交出
+    static void ReadBody(ifstream& Stream, const PLYFormat::Header& AHeader,
+        const function<void(const vector<double>&)>& OnVertices,
+        const function<void(const vector<size_t>&)>& OnFaces,
+        const function<void(const vector<size_t>&)>& OnLines);
+};
+
+#endif /* Model3D_PLY_Importer.hpp */
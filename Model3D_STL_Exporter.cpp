@@ -0,0 +1,183 @@
+/*************************************************************************
+【文件名】Model3D_STL_Exporter.cpp
+【功能模块和目的】定义Model3D_STL_Exporter类的成员函数
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】2026/10/19 谭雯心 文本格式的数值改由NumberFormatter输出
+*************************************************************************/
+// Model3D_STL_Exporter所属头文件
+#include "Model3D_STL_Exporter.hpp"
+// Model3D所属头文件
+#include "Model3D.hpp"
+// Face3D所属头文件
+#include "Face3D.hpp"
+// Vector3D所属头文件
+#include "Vector3D.hpp"
+// TaskScheduler所属头文件
+#include "TaskScheduler.hpp"
+// Instrumentation所属头文件
+#include "Instrumentation.hpp"
+// ScopedTimer所属头文件
+#include "ScopedTimer.hpp"
+// NumberFormatter所属头文件
+#include "NumberFormatter.hpp"
+// fstream所属头文件
+#include <fstream>
+// string所属头文件
+#include <string>
+// vector所属头文件
+#include <vector>
+// memcpy所属头文件
+#include <cstring>
+// uint32_t所属头文件
+#include <cstdint>
+// size_t所属头文件
+#include <cstddef>
+
+using namespace std;
+
+namespace {
+    // 导出的探针，处理量为导出的面数
+    const size_t PROBE_SAVE_TO_STREAM = Instrumentation::RegisterProbe(
+        "Model3D_STL_Exporter::SaveToStream");
+    // 二进制文件头的长度
+    const size_t HEADER_SIZE = 80;
+    // 二进制文件中每个三角形记录的长度：法向量、三个顶点、属性字
+    const size_t RECORD_SIZE = 50;
+    // 并行填充记录时每块的面数
+    const size_t RECORD_GRAIN = 4096;
+
+    /*********************************************************************
+    【函数名称】FaceNormal
+    【函数功能】求面的单位法向量：两条边的外积除以其模，退化面为零向量
+    【参数】const Face3D& AFace, 表示面
+           double Normal[3], 表示输出的法向量
+    【返回值】无
+    【开发者及日期】谭雯心 2026/10/19
+    【更改记录】
+    *********************************************************************/
+    void FaceNormal(const Face3D& AFace, double Normal[3]) {
+        const Point3D& A = AFace.Points[0];
+        const Point3D& B = AFace.Points[1];
+        const Point3D& C = AFace.Points[2];
+        Vector3D<double> Edge1{B.X - A.X, B.Y - A.Y, B.Z - A.Z};
+        Vector3D<double> Edge2{C.X - A.X, C.Y - A.Y, C.Z - A.Z};
+        Vector<double, 3> Cross = Edge1.CrossProduct(Edge2);
+        double Length = Cross.Module();
+        for (size_t i = 0; i < 3; i++) {
+            Normal[i] = Length > 0 ? Cross[i] / Length : 0;
+        }
+    }
+}
+
+//-------------------------------------------------------------------------
+// 必要的构造、析构、拷贝、赋值运算符重载函数
+//-------------------------------------------------------------------------
+
+/*************************************************************************
+【函数名称】Model3D_STL_Exporter
+【函数功能】带参构造函数, 将Model3D_Exporter文件扩展名设为".stl"
+【参数】bool bBinary, 表示是否导出二进制格式（否则导出文本格式）
+       int Precision, 表示文本格式的小数位数，NumberFormatter::SHORTEST
+       表示输出能精确读回的最短形式
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】2026/10/19 谭雯心 增加了文本格式的小数位数
+*************************************************************************/
+Model3D_STL_Exporter::Model3D_STL_Exporter(bool bBinary, int Precision)
+    : Model3D_Exporter(".stl"), m_bBinary(bBinary), m_Formatter(Precision) {
+}
+
+//-------------------------------------------------------------------------
+// 非静态Getter成员函数
+//-------------------------------------------------------------------------
+
+/*************************************************************************
+【函数名称】IsBinary
+【函数功能】获取是否导出二进制格式
+【参数】无
+【返回值】bool，是否导出二进制格式
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+bool Model3D_STL_Exporter::IsBinary() const {
+    return m_bBinary;
+}
+/*************************************************************************
+【函数名称】GetPrecision
+【函数功能】获取文本格式的小数位数
+【参数】无
+【返回值】int，小数位数，最短形式时为NumberFormatter::SHORTEST
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+int Model3D_STL_Exporter::GetPrecision() const {
+    return m_Formatter.GetPrecision();
+}
+/*************************************************************************
+【函数名称】SaveToStream
+【函数功能】保存三维模型到流的STL格式实现。二进制格式先并行算出
+       每个面的50字节记录，再连同文件头一次写出；文本格式逐面输出
+【参数】ofstream& Stream, 表示输出流（以二进制方式打开）
+       const Model3D& AModel, 表示Model3D类的对象
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】2026/10/19 谭雯心 文本格式的数值改由NumberFormatter输出
+*************************************************************************/
+void Model3D_STL_Exporter::SaveToStream(
+    ofstream& Stream, const Model3D& AModel) const {
+    ScopedTimer Timer(PROBE_SAVE_TO_STREAM);
+    const vector<shared_ptr<const Face3D>>& Faces = AModel.Faces();
+    Timer.AddItems(Faces.size());
+    // 导出到流前先清空流
+    Stream.clear();
+    if (m_bBinary) {
+        uint32_t Count = static_cast<uint32_t>(Faces.size());
+        string Buffer(HEADER_SIZE + sizeof(Count) + Faces.size() * RECORD_SIZE,
+            '\0');
+        // 名称写入文件头，超长时截断
+        AModel.Name.copy(&Buffer[0], HEADER_SIZE);
+        memcpy(&Buffer[HEADER_SIZE], &Count, sizeof(Count));
+        char* pRecords = &Buffer[HEADER_SIZE + sizeof(Count)];
+        TaskScheduler::GetInstance()->ParallelFor(0, Faces.size(),
+            RECORD_GRAIN, [&](size_t First, size_t Last) {
+            for (size_t i = First; i < Last; i++) {
+                const Face3D& AFace = *Faces[i];
+                double Normal[3];
+                FaceNormal(AFace, Normal);
+                float Values[12];
+                for (size_t j = 0; j < 3; j++) {
+                    Values[j] = static_cast<float>(Normal[j]);
+                    Values[3 + 3 * j] = static_cast<float>(AFace.Points[j].X);
+                    Values[4 + 3 * j] = static_cast<float>(AFace.Points[j].Y);
+                    Values[5 + 3 * j] = static_cast<float>(AFace.Points[j].Z);
+                }
+                // 每条记录末尾的2字节属性字保持为0
+                memcpy(pRecords + i * RECORD_SIZE, Values, sizeof(Values));
+            }
+        });
+        Stream.write(Buffer.data(), static_cast<streamsize>(Buffer.size()));
+        return;
+    }
+    Stream << "solid " << AModel.Name << '\n';
+    // 每个面先在Text中拼好再一次写入流
+    string Text;
+    for (const auto& pFace : Faces) {
+        double Normal[3];
+        FaceNormal(*pFace, Normal);
+        char Values[3 * NumberFormatter::MAX_LENGTH];
+        Text = "facet normal ";
+        Text.append(Values,
+            m_Formatter.Format(Normal[0], Normal[1], Normal[2], Values));
+        Text += "\n  outer loop\n";
+        for (size_t j = 0; j < 3; j++) {
+            Point3D APoint = pFace->Points[j];
+            Text += "    vertex ";
+            Text.append(Values,
+                m_Formatter.Format(APoint.X, APoint.Y, APoint.Z, Values));
+            Text += '\n';
+        }
+        Text += "  endloop\nendfacet\n";
+        Stream.write(Text.data(), static_cast<streamsize>(Text.size()));
+    }
+    Stream << "endsolid " << AModel.Name << '\n';
+}
@@ -0,0 +1,71 @@
+/*************************************************************************
+【文件名】Model3D_STL_Exporter.hpp
+【功能模块和目的】定义Model3D_STL_Exporter类，
+    继承自Model3D_Exporter类，表示三维模型的STL格式（二进制和文本）导出器
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】2026/10/19 谭雯心 文本格式的数值改由NumberFormatter输出
+*************************************************************************/
+#ifndef MODEL3D_STL_EXPORTER_HPP
+#define MODEL3D_STL_EXPORTER_HPP
+
+// Model3D_Exporter所属头文件
+#include "Model3D_Exporter.hpp"
+// NumberFormatter所属头文件
+#include "NumberFormatter.hpp"
+// fstream所属头文件
+#include <fstream>
+
+/*************************************************************************
+【类名】Model3D_STL_Exporter
+【功能】定义Model3D_STL_Exporter类，
+    继承自Model3D_Exporter类，表示三维模型的STL格式导出器。
+    每个面输出一个三角形，法向量由两条边的外积（Vector3D）求得并单位化；
+    二进制格式由TaskScheduler并行填充记录后一次写出。
+    STL格式不能保存线和注释，导出时忽略，名称写入文件头
+【接口说明】
+    带参构造函数（是否导出二进制格式，文本格式的小数位数）
+    禁止拷贝构造函数
+    禁止赋值运算符
+    虚析构函数
+    获取是否导出二进制格式，文本格式的小数位数
+    保存三维模型到流的STL格式实现
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】2026/10/19 谭雯心 文本格式的数值改由NumberFormatter输出
+*************************************************************************/
+class Model3D_STL_Exporter : public Model3D_Exporter {
+public:
+    //-------------------------------------------------------------------------
+    // 必要的构造、析构、拷贝、赋值运算符重载函数
+    //-------------------------------------------------------------------------
+    // 带参构造函数，默认导出二进制格式
+    explicit Model3D_STL_Exporter(bool bBinary = true,
+        int Precision = NumberFormatter::SHORTEST);
+    // 禁止外界调用拷贝构造函数
+    Model3D_STL_Exporter(const Model3D_STL_Exporter& Source) = delete;
+    // 禁止外界调用赋值运算符
+    Model3D_STL_Exporter& operator=(
+        const Model3D_STL_Exporter& Source) = delete;
+    // 虚析构函数
+    virtual ~Model3D_STL_Exporter() = default;
+    //-------------------------------------------------------------------------
+    // 非静态Getter成员函数
+    //-------------------------------------------------------------------------
+    // 获取是否导出二进制格式
+    bool IsBinary() const;
+    // 获取文本格式的小数位数，最短形式时为NumberFormatter::SHORTEST
+    int GetPrecision() const;
+    // 保存三维模型到流的STL格式实现
+    virtual void SaveToStream(
+        ofstream& Stream, const Model3D& AModel) const override;
+
+private:
+    //-------------------------------------------------------------------------
+    // 私有非静态成员
+    //-------------------------------------------------------------------------
+    // 是否导出二进制格式
+    bool m_bBinary;
+    // 文本格式的数值格式化
+    NumberFormatter m_Formatter;
+};
+
+#endif /* Model3D_STL_Exporter.hpp */
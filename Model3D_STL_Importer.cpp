@@ -0,0 +1,325 @@
+/*************************************************************************
+【文件名】Model3D_STL_Importer.cpp
+【功能模块和目的】定义Model3D_STL_Importer类的成员函数
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】2026/10/19 谭雯心 增加了按文件开头的内容识别格式
+*************************************************************************/
+// Model3D_STL_Importer所属头文件
+#include "Model3D_STL_Importer.hpp"
+// IndexedModel3D所属头文件
+#include "IndexedModel3D.hpp"
+// Model3D所属头文件
+#include "Model3D.hpp"
+// ModelBatcher所属头文件
+#include "ModelBatcher.hpp"
+// Instrumentation所属头文件
+#include "Instrumentation.hpp"
+// ScopedTimer所属头文件
+#include "ScopedTimer.hpp"
+// fstream所属头文件
+#include <fstream>
+// string所属头文件
+#include <string>
+// vector所属头文件
+#include <vector>
+// invalid_argument所属头文件
+#include <stdexcept>
+// memcpy、strncmp所属头文件
+#include <cstring>
+// strtod所属头文件
+#include <cstdlib>
+// isspace所属头文件
+#include <cctype>
+// uint32_t所属头文件
+#include <cstdint>
+// size_t所属头文件
+#include <cstddef>
+
+using namespace std;
+
+namespace {
+    // 导入的探针，处理量为读到的面数
+    const size_t PROBE_LOAD_FROM_STREAM = Instrumentation::RegisterProbe(
+        "Model3D_STL_Importer::LoadFromStream");
+    // 二进制文件头的长度
+    const size_t HEADER_SIZE = 80;
+    // 二进制文件中每个三角形记录的长度：法向量、三个顶点、属性字
+    const size_t RECORD_SIZE = 50;
+    // 无法取得流的长度时每次读取的字节数
+    const size_t READ_CHUNK = size_t(1) << 20;
+
+    /*********************************************************************
+    【函数名称】ReadAll
+    【函数功能】读入流的剩余内容。能取得长度时一次读入，否则分块读到末尾
+    【参数】istream& Stream, 表示输入流
+    【返回值】string，流的剩余内容
+    【开发者及日期】谭雯心 2026/10/19
+    【更改记录】
+    *********************************************************************/
+    string ReadAll(istream& Stream) {
+        string Data;
+        streampos Begin = Stream.tellg();
+        if (Begin != streampos(-1) && Stream.seekg(0, ios::end)) {
+            streampos End = Stream.tellg();
+            Stream.seekg(Begin);
+            if (End != streampos(-1) && Stream) {
+                Data.resize(static_cast<size_t>(End - Begin));
+                Stream.read(&Data[0], static_cast<streamsize>(Data.size()));
+                Data.resize(static_cast<size_t>(Stream.gcount()));
+                return Data;
+            }
+        }
+        // 流不支持定位（如带进度的包装流）时分块读取
+        Stream.clear();
+        size_t Used = 0;
+        while (Stream) {
+            Data.resize(Used + READ_CHUNK);
+            Stream.read(&Data[Used], static_cast<streamsize>(READ_CHUNK));
+            Used += static_cast<size_t>(Stream.gcount());
+        }
+        Data.resize(Used);
+        return Data;
+    }
+    /*********************************************************************
+    【函数名称】Trim
+    【函数功能】去掉字符串首尾的空白和空字符
+    【参数】const string& Text, 表示原字符串
+    【返回值】string，去掉首尾空白后的字符串
+    【开发者及日期】谭雯心 2026/10/19
+    【更改记录】
+    *********************************************************************/
+    string Trim(const string& Text) {
+        const char* Blank = " \t\r\n\v\f";
+        size_t First = Text.find_first_not_of(Blank);
+        if (First == string::npos || Text[First] == '\0') {
+            return string();
+        }
+        size_t Last = Text.find('\0', First);
+        Last = Text.find_last_not_of(Blank,
+            Last == string::npos ? string::npos : Last - 1);
+        return Text.substr(First, Last - First + 1);
+    }
+    /*********************************************************************
+    【函数名称】IsBinary
+    【函数功能】判断数据是否为二进制STL：长度恰为84 + 50 * 面数时为二进制；
+           不以"solid"开头且长度足够时也按二进制处理（容忍尾部多余字节）
+    【参数】const string& Data, 表示文件内容
+    【返回值】bool，是否为二进制STL
+    【开发者及日期】谭雯心 2026/10/19
+    【更改记录】
+    *********************************************************************/
+    bool IsBinary(const string& Data) {
+        if (Data.size() < HEADER_SIZE + sizeof(uint32_t)) {
+            return false;
+        }
+        uint32_t Count;
+        memcpy(&Count, Data.data() + HEADER_SIZE, sizeof(Count));
+        size_t Expected = HEADER_SIZE + sizeof(uint32_t)
+            + static_cast<size_t>(Count) * RECORD_SIZE;
+        if (Data.size() == Expected) {
+            return true;
+        }
+        return Data.compare(0, 5, "solid") != 0 && Data.size() > Expected;
+    }
+    /*********************************************************************
+    【函数名称】ParseBinary
+    【函数功能】解析二进制STL，逐条记录解包三个顶点（跳过法向量和属性字）
+    【参数】const string& Data, 表示文件内容
+           IndexedModel3D& Indexed, 表示输出的索引模型
+    【返回值】无
+    【开发者及日期】谭雯心 2026/10/19
+    【更改记录】
+    *********************************************************************/
+    void ParseBinary(const string& Data, IndexedModel3D& Indexed) {
+        Indexed.Name = Trim(Data.substr(0, HEADER_SIZE));
+        uint32_t Count;
+        memcpy(&Count, Data.data() + HEADER_SIZE, sizeof(Count));
+        Indexed.Reserve(size_t(Count) * 3, Count, 0);
+        const char* pRecord = Data.data() + HEADER_SIZE + sizeof(uint32_t);
+        for (size_t i = 0; i < Count; i++, pRecord += RECORD_SIZE) {
+            float Coordinates[9];
+            memcpy(Coordinates, pRecord + 3 * sizeof(float),
+                sizeof(Coordinates));
+            size_t First = Indexed.AddVertex(
+                Coordinates[0], Coordinates[1], Coordinates[2]);
+            Indexed.AddVertex(Coordinates[3], Coordinates[4], Coordinates[5]);
+            Indexed.AddVertex(Coordinates[6], Coordinates[7], Coordinates[8]);
+            Indexed.AddFace(First, First + 1, First + 2);
+        }
+    }
+    /*********************************************************************
+    【函数名称】ParseAscii
+    【函数功能】解析文本STL：名称取自首个solid行，只读取vertex后的三个数，
+           其余关键字（facet normal、outer loop等）跳过，遇到endsolid结束
+    【参数】const string& Data, 表示文件内容
+           IndexedModel3D& Indexed, 表示输出的索引模型
+    【返回值】bool，格式是否正确（顶点数为3的倍数且坐标可解析）
+    【开发者及日期】谭雯心 2026/10/19
+    【更改记录】
+    *********************************************************************/
+    bool ParseAscii(const string& Data, IndexedModel3D& Indexed) {
+        size_t LineEnd = Data.find('\n');
+        Indexed.Name = Trim(Data.substr(5,
+            LineEnd == string::npos ? string::npos : LineEnd - 5));
+        // string的内容以空字符结尾，strtod不会越界
+        const char* pText = Data.c_str()
+            + (LineEnd == string::npos ? Data.size() : LineEnd);
+        const char* pEnd = Data.c_str() + Data.size();
+        size_t Corner = 0;
+        while (pText < pEnd) {
+            while (pText < pEnd && isspace(static_cast<unsigned char>(*pText))) {
+                pText++;
+            }
+            const char* pWord = pText;
+            while (pText < pEnd && !isspace(static_cast<unsigned char>(*pText))) {
+                pText++;
+            }
+            size_t Length = static_cast<size_t>(pText - pWord);
+            if (Length == 8 && strncmp(pWord, "endsolid", 8) == 0) {
+                break;
+            }
+            if (Length != 6 || strncmp(pWord, "vertex", 6) != 0) {
+                continue;
+            }
+            double Coordinates[3];
+            for (double& Value : Coordinates) {
+                char* pNumberEnd;
+                Value = strtod(pText, &pNumberEnd);
+                if (pNumberEnd == pText) {
+                    return false;
+                }
+                pText = pNumberEnd;
+            }
+            size_t Index = Indexed.AddVertex(
+                Coordinates[0], Coordinates[1], Coordinates[2]);
+            if (++Corner == 3) {
+                Indexed.AddFace(Index - 2, Index - 1, Index);
+                Corner = 0;
+            }
+        }
+        return Corner == 0;
+    }
+}
+
+//-------------------------------------------------------------------------
+// 内嵌异常类
+//-------------------------------------------------------------------------
+
+/*************************************************************************
+【函数名称】FILE_FORMAT_ERROR
+【函数功能】构造函数
+【参数】无
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+Model3D_STL_Importer::FILE_FORMAT_ERROR::FILE_FORMAT_ERROR()
+    : invalid_argument("Invalid STL data") {
+}
+
+//-------------------------------------------------------------------------
+// 必要的构造、析构、拷贝、赋值运算符重载函数
+//-------------------------------------------------------------------------
+
+/*************************************************************************
+【函数名称】Model3D_STL_Importer
+【函数功能】默认构造函数, 将Model3D_Importer文件扩展名设为".stl"
+【参数】无
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+Model3D_STL_Importer::Model3D_STL_Importer() : Model3D_Importer(".stl") {
+}
+
+//-------------------------------------------------------------------------
+// 非静态Getter成员函数
+//-------------------------------------------------------------------------
+
+/*************************************************************************
+【函数名称】LoadFromStream
+【函数功能】从流导入三维模型的STL格式实现，先读入IndexedModel3D再转换
+【参数】ifstream& Stream, 表示输入流（以二进制方式打开）
+【返回值】Model3D类的对象
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+Model3D Model3D_STL_Importer::LoadFromStream(ifstream& Stream) const {
+    ScopedTimer Timer(PROBE_LOAD_FROM_STREAM);
+    IndexedModel3D Indexed = ReadIndexed(Stream);
+    Timer.AddItems(Indexed.GetFaceCount());
+    return Indexed.ToModel();
+}
+/*************************************************************************
+【函数名称】StreamFromStream
+【函数功能】从流流式导入三维模型的STL格式实现。STL的顶点不共享，
+       须读完整个文件合并顶点后才能给出索引，因此先读入索引模型，
+       再把合并后的顶点和面依次交给Batcher
+【参数】ifstream& Stream, 表示输入流（以二进制方式打开）
+       ModelBatcher& Batcher, 表示批次组装器
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+void Model3D_STL_Importer::StreamFromStream(
+    ifstream& Stream, ModelBatcher& Batcher) const {
+    IndexedModel3D Indexed = ReadIndexed(Stream);
+    Batcher.SetName(Indexed.Name);
+    const vector<double>& Vertices = Indexed.Vertices();
+    for (size_t i = 0; i < Vertices.size(); i += 3) {
+        Batcher.AddVertex(Vertices[i], Vertices[i + 1], Vertices[i + 2]);
+    }
+    const vector<size_t>& Faces = Indexed.FaceIndices();
+    for (size_t i = 0; i < Faces.size(); i += 3) {
+        Batcher.AddFace(Faces[i], Faces[i + 1], Faces[i + 2]);
+    }
+}
+
+//-------------------------------------------------------------------------
+// 私有静态成员函数
+//-------------------------------------------------------------------------
+
+/*************************************************************************
+【函数名称】ReadIndexed
+【函数功能】读入整个流，判断二进制或文本格式并解析，再按坐标哈希合并顶点
+【参数】ifstream& Stream, 表示输入流（以二进制方式打开）
+【返回值】IndexedModel3D，顶点已合并的索引模型
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+IndexedModel3D Model3D_STL_Importer::ReadIndexed(ifstream& Stream) {
+    string Data = ReadAll(Stream);
+    IndexedModel3D Indexed;
+    if (IsBinary(Data)) {
+        ParseBinary(Data, Indexed);
+    }
+    else if (Data.compare(0, 5, "solid") != 0
+        || !ParseAscii(Data, Indexed)) {
+        throw FILE_FORMAT_ERROR();
+    }
+    Indexed.WeldVertices();
+    return Indexed;
+}
+/*************************************************************************
+【函数名称】Recognize
+【函数功能】以"solid"开头时识别为文本STL，文件长度恰为84 + 50 * 面数时
+       识别为二进制STL
+【参数】const string& Head, 表示文件开头至多HEAD_SIZE字节
+       uint64_t FileSize, 表示文件长度
+【返回值】bool，是否为STL格式
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+bool Model3D_STL_Importer::Recognize(
+    const string& Head, uint64_t FileSize) const {
+    if (Head.compare(0, 5, "solid") == 0) {
+        return true;
+    }
+    if (Head.size() < HEADER_SIZE + sizeof(uint32_t)) {
+        return false;
+    }
+    uint32_t Count;
+    memcpy(&Count, Head.data() + HEADER_SIZE, sizeof(Count));
+    return FileSize == HEADER_SIZE + sizeof(uint32_t)
+        + static_cast<uint64_t>(Count) * RECORD_SIZE;
+}
@@ -0,0 +1,90 @@
+/*************************************************************************
+【文件名】Model3D_STL_Importer.hpp
+【功能模块和目的】定义Model3D_STL_Importer类，
+    继承自Model3D_Importer类，表示三维模型的STL格式（二进制和文本）导入器
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】2026/10/19 谭雯心 增加了按文件开头的内容识别格式
+*************************************************************************/
+#ifndef MODEL3D_STL_IMPORTER_HPP
+#define MODEL3D_STL_IMPORTER_HPP
+
+// Model3D所属头文件
+#include "Model3D.hpp"
+// Model3D_Importer所属头文件
+#include "Model3D_Importer.hpp"
+// IndexedModel3D所属头文件
+#include "IndexedModel3D.hpp"
+// ModelBatcher所属头文件
+#include "ModelBatcher.hpp"
+// fstream所属头文件
+#include <fstream>
+// invalid_argument所属头文件
+#include <stdexcept>
+// string所属头文件
+#include <string>
+// uint64_t所属头文件
+#include <cstdint>
+
+using namespace std;
+
+/*************************************************************************
+【类名】Model3D_STL_Importer
+【功能】定义Model3D_STL_Importer类，
+    继承自Model3D_Importer类，表示三维模型的STL格式导入器。
+    文件长度恰为84 + 50 * 面数时按二进制格式读取（整块读入后解包顶点），
+    否则以"solid"开头时按文本格式读取；每个三角形的顶点各自独立，
+    读入后按坐标哈希合并为索引模型。STL格式没有线，名称取自文件头
+【接口说明】
+    默认构造函数
+    禁止拷贝构造函数
+    禁止赋值运算符
+    虚析构函数
+    从流导入三维模型的STL格式实现
+    从流流式导入三维模型的STL格式实现（合并顶点后交给Batcher）
+    按文件开头的内容识别STL格式
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】2026/10/19 谭雯心 增加了按文件开头的内容识别格式
+*************************************************************************/
+class Model3D_STL_Importer : public Model3D_Importer {
+public:
+    //-------------------------------------------------------------------------
+    // 内嵌异常类
+    //-------------------------------------------------------------------------
+    // 若数据既不是二进制STL也不是文本STL，则抛出该异常
+    class FILE_FORMAT_ERROR : public invalid_argument {
+    public:
+        FILE_FORMAT_ERROR();
+    };
+    //-------------------------------------------------------------------------
+    // 必要的构造、析构、拷贝、赋值运算符重载函数
+    //-------------------------------------------------------------------------
+    // 默认构造函数
+    Model3D_STL_Importer();
+    // 禁止外界调用拷贝构造函数
+    Model3D_STL_Importer(const Model3D_STL_Importer& Source) = delete;
+    // 禁止外界调用重载赋值运算符
+    Model3D_STL_Importer& operator=(
+        const Model3D_STL_Importer& Source) = delete;
+    // 虚析构函数
+    virtual ~Model3D_STL_Importer() = default;
+    //-------------------------------------------------------------------------
+    // 非静态Getter成员函数
+    //-------------------------------------------------------------------------
+    // 从流导入三维模型的STL格式实现
+    virtual Model3D LoadFromStream(ifstream& Stream) const override;
+    // 从流流式导入三维模型的STL格式实现
+    virtual void StreamFromStream(
+        ifstream& Stream, ModelBatcher& Batcher) const override;
+    // 按文件开头的内容识别STL格式
+    virtual bool Recognize(
+        const string& Head, uint64_t FileSize) const override;
+
+private:
+    //-------------------------------------------------------------------------
+    // 私有静态成员函数
+    //-------------------------------------------------------------------------
+    // 读入整个流并解析为顶点已合并的索引模型
+    static IndexedModel3D ReadIndexed(ifstream& Stream);
+};
+
+#endif /* Model3D_STL_Importer.hpp */
@@ -0,0 +1,187 @@
+/*************************************************************************
+【文件名】ModelBatcher.cpp
+【功能模块和目的】定义ModelBatcher类的成员函数
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+// ModelBatcher所属头文件
+#include "ModelBatcher.hpp"
+// ModelStreamStage所属头文件
+#include "ModelStreamStage.hpp"
+// VertexStore所属头文件
+#include "VertexStore.hpp"
+// max所属头文件
+#include <algorithm>
+// string所属头文件
+#include <string>
+// vector所属头文件
+#include <vector>
+// size_t所属头文件
+#include <cstddef>
+
+using namespace std;
+
+//-------------------------------------------------------------------------
+// 必要的构造、析构、拷贝、赋值运算符重载函数
+//-------------------------------------------------------------------------
+
+/*************************************************************************
+【函数名称】ModelBatcher
+【函数功能】带参构造函数
+【参数】ModelStreamStage& Stage, 表示处理阶段
+       size_t BatchSize, 表示批次大小（至少为1）
+       size_t ResidentPages, 表示顶点在内存中最多保留的页数
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+ModelBatcher::ModelBatcher(ModelStreamStage& Stage, size_t BatchSize,
+                           size_t ResidentPages)
+    : m_Stage(Stage), m_BatchSize(max<size_t>(BatchSize, 1)),
+      m_Vertices(ResidentPages) {
+}
+
+//-------------------------------------------------------------------------
+// 非静态Setter成员函数
+//-------------------------------------------------------------------------
+
+/*************************************************************************
+【函数名称】SetName
+【函数功能】设置模型名称，随之后的批次交给处理阶段
+【参数】const string& Name, 表示模型名称
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+void ModelBatcher::SetName(const string& Name) {
+    m_Batch.Name = Name;
+}
+/*************************************************************************
+【函数名称】SetDescription
+【函数功能】设置模型注释，随之后的批次交给处理阶段
+【参数】const string& Description, 表示模型注释
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+void ModelBatcher::SetDescription(const string& Description) {
+    m_Batch.Description = Description;
+}
+/*************************************************************************
+【函数名称】AddVertex
+【函数功能】添加顶点，全局编号为已添加的顶点数
+【参数】double x, double y, double z, 表示顶点坐标
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+void ModelBatcher::AddVertex(double x, double y, double z) {
+    m_Vertices.Add(x, y, z);
+    m_Batch.Vertices.push_back(x);
+    m_Batch.Vertices.push_back(y);
+    m_Batch.Vertices.push_back(z);
+    FlushIfFull();
+}
+/*************************************************************************
+【函数名称】AddFace
+【函数功能】添加面，顶点索引超出范围时抛出VertexStore::VERTEX_NOT_FOUND
+【参数】size_t Index1, size_t Index2, size_t Index3, 表示全局顶点索引
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+void ModelBatcher::AddFace(size_t Index1, size_t Index2, size_t Index3) {
+    AppendCoordinates(Index1, m_Batch.FaceCoordinates);
+    AppendCoordinates(Index2, m_Batch.FaceCoordinates);
+    AppendCoordinates(Index3, m_Batch.FaceCoordinates);
+    m_Batch.FaceIndices.push_back(Index1);
+    m_Batch.FaceIndices.push_back(Index2);
+    m_Batch.FaceIndices.push_back(Index3);
+    FlushIfFull();
+}
+/*************************************************************************
+【函数名称】AddLine
+【函数功能】添加线，顶点索引超出范围时抛出VertexStore::VERTEX_NOT_FOUND
+【参数】size_t Index1, size_t Index2, 表示全局顶点索引
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+void ModelBatcher::AddLine(size_t Index1, size_t Index2) {
+    AppendCoordinates(Index1, m_Batch.LineCoordinates);
+    AppendCoordinates(Index2, m_Batch.LineCoordinates);
+    m_Batch.LineIndices.push_back(Index1);
+    m_Batch.LineIndices.push_back(Index2);
+    FlushIfFull();
+}
+/*************************************************************************
+【函数名称】Finish
+【函数功能】交出剩余数据并通知处理阶段全部批次处理完毕
+【参数】无
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+void ModelBatcher::Finish() {
+    if (!m_Batch.Vertices.empty() || !m_Batch.FaceIndices.empty()
+        || !m_Batch.LineIndices.empty()) {
+        Flush();
+    }
+    m_Stage.Finish();
+}
+
+//-------------------------------------------------------------------------
+// 私有非静态成员函数
+//-------------------------------------------------------------------------
+
+/*************************************************************************
+【函数名称】FlushIfFull
+【函数功能】若当前批次的面数与线数之和或新增顶点数达到批次大小，
+       则交给处理阶段
+【参数】无
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+void ModelBatcher::FlushIfFull() {
+    size_t ElementCount = m_Batch.FaceIndices.size() / 3
+        + m_Batch.LineIndices.size() / 2;
+    if (ElementCount >= m_BatchSize
+        || m_Batch.Vertices.size() / 3 >= m_BatchSize) {
+        Flush();
+    }
+}
+/*************************************************************************
+【函数名称】Flush
+【函数功能】把当前批次交给处理阶段，然后清空数据（保留容量）并更新起始编号
+【参数】无
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+void ModelBatcher::Flush() {
+    m_Stage.ProcessBatch(m_Batch);
+    m_Batch.FirstVertex += m_Batch.Vertices.size() / 3;
+    m_Batch.FirstFace += m_Batch.FaceIndices.size() / 3;
+    m_Batch.FirstLine += m_Batch.LineIndices.size() / 2;
+    m_Batch.Vertices.clear();
+    m_Batch.FaceIndices.clear();
+    m_Batch.FaceCoordinates.clear();
+    m_Batch.LineIndices.clear();
+    m_Batch.LineCoordinates.clear();
+}
+/*************************************************************************
+【函数名称】AppendCoordinates
+【函数功能】追加指定顶点的坐标到数组
+【参数】size_t VertexIndex, 表示全局顶点索引
+       vector<double>& Target, 表示目标数组
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+void ModelBatcher::AppendCoordinates(size_t VertexIndex,
+                                     vector<double>& Target) {
+    double Coordinates[3];
+    m_Vertices.Get(VertexIndex, Coordinates);
+    Target.insert(Target.end(), Coordinates, Coordinates + 3);
+}
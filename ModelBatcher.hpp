@@ -0,0 +1,96 @@
+/*************************************************************************
+【文件名】ModelBatcher.hpp
+【功能模块和目的】定义ModelBatcher类，把逐条读入的顶点、面、线组装成批次
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+#ifndef MODELBATCHER_HPP
+#define MODELBATCHER_HPP
+
+// ModelStreamStage所属头文件
+#include "ModelStreamStage.hpp"
+// VertexStore所属头文件
+#include "VertexStore.hpp"
+// string所属头文件
+#include <string>
+// size_t所属头文件
+#include <cstddef>
+
+using namespace std;
+
+/*************************************************************************
+【类名】ModelBatcher
+【功能】供流式导入器使用：逐条接收顶点、面和线，用VertexStore解析面和线的
+       坐标，每累积一批（面数与线数之和或新增顶点数达到批次大小）就交给
+       处理阶段，结束时交出剩余数据并通知处理阶段
+【接口说明】
+    带参构造函数（处理阶段、批次大小、顶点在内存中最多保留的页数）
+    禁止拷贝构造函数
+    禁止赋值运算符
+    虚析构函数
+    设置模型名称、注释
+    添加顶点、面、线（全局顶点索引从0开始）
+    结束（交出剩余数据并通知处理阶段）
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+class ModelBatcher {
+public:
+    //-------------------------------------------------------------------------
+    // 静态常量
+    //-------------------------------------------------------------------------
+    // 默认批次大小
+    static constexpr size_t DEFAULT_BATCH_SIZE{1 << 16};
+    //-------------------------------------------------------------------------
+    // 必要的构造、析构、拷贝、赋值运算符重载函数
+    //-------------------------------------------------------------------------
+    // 带参构造函数
+    ModelBatcher(ModelStreamStage& Stage,
+                 size_t BatchSize = DEFAULT_BATCH_SIZE,
+                 size_t ResidentPages = VertexStore::DEFAULT_RESIDENT_PAGES);
+    // 禁止拷贝构造函数
+    ModelBatcher(const ModelBatcher& Source) = delete;
+    // 禁止赋值运算符
+    ModelBatcher& operator=(const ModelBatcher& Source) = delete;
+    // 虚析构函数
+    virtual ~ModelBatcher() = default;
+    //-------------------------------------------------------------------------
+    // 非静态Setter成员函数
+    //-------------------------------------------------------------------------
+    // 设置模型名称
+    void SetName(const string& Name);
+    // 设置模型注释
+    void SetDescription(const string& Description);
+    // 添加顶点
+    void AddVertex(double x, double y, double z);
+    // 添加面
+    void AddFace(size_t Index1, size_t Index2, size_t Index3);
+    // 添加线
+    void AddLine(size_t Index1, size_t Index2);
+    // 结束
+    void Finish();
+
+private:
+    //-------------------------------------------------------------------------
+    // 私有非静态成员函数
+    //-------------------------------------------------------------------------
+    // 若当前批次已满则交给处理阶段
+    void FlushIfFull();
+    // 把当前批次交给处理阶段并开始新批次
+    void Flush();
+    // 追加指定顶点的坐标到数组
+    void AppendCoordinates(size_t VertexIndex, vector<double>& Target);
+    //-------------------------------------------------------------------------
+    // 私有非静态成员
+    //-------------------------------------------------------------------------
+    // 处理阶段
+    ModelStreamStage& m_Stage;
+    // 批次大小
+    size_t m_BatchSize;
+    // 全部顶点
+    VertexStore m_Vertices;
+    // 当前批次
+    ModelStreamStage::Batch m_Batch{};
+};
+
+#endif /* ModelBatcher.hpp */
@@ -0,0 +1,75 @@
+/*************************************************************************
+【文件名】ModelBuilderStage.cpp
+【功能模块和目的】定义ModelBuilderStage类的成员函数
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+// ModelBuilderStage所属头文件
+#include "ModelBuilderStage.hpp"
+// Point3D所属头文件
+#include "Point3D.hpp"
+// vector所属头文件
+#include <vector>
+// size_t所属头文件
+#include <cstddef>
+
+using namespace std;
+
+//-------------------------------------------------------------------------
+// 必要的构造、析构、拷贝、赋值运算符重载函数
+//-------------------------------------------------------------------------
+
+/*************************************************************************
+【函数名称】ModelBuilderStage
+【函数功能】带参构造函数
+【参数】Model3D& Target, 表示目标模型，须在Finish之前保持有效
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+ModelBuilderStage::ModelBuilderStage(Model3D& Target) : m_Model(Target) {
+}
+
+//-------------------------------------------------------------------------
+// 非静态Setter成员函数
+//-------------------------------------------------------------------------
+
+/*************************************************************************
+【函数名称】ProcessBatch
+【函数功能】按坐标收集一个批次的面和线，记录名称和注释
+【参数】const Batch& ABatch, 表示批次
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+void ModelBuilderStage::ProcessBatch(const Batch& ABatch) {
+    m_Model.Name = ABatch.Name;
+    m_Model.Description = ABatch.Description;
+    const vector<double>& Faces = ABatch.FaceCoordinates;
+    for (size_t i = 0; i + 9 <= Faces.size(); i += 9) {
+        m_Faces.push_back(Face3D(
+            Point3D(Faces[i], Faces[i + 1], Faces[i + 2]),
+            Point3D(Faces[i + 3], Faces[i + 4], Faces[i + 5]),
+            Point3D(Faces[i + 6], Faces[i + 7], Faces[i + 8])));
+    }
+    const vector<double>& Lines = ABatch.LineCoordinates;
+    for (size_t i = 0; i + 6 <= Lines.size(); i += 6) {
+        m_Lines.push_back(Line3D(
+            Point3D(Lines[i], Lines[i + 1], Lines[i + 2]),
+            Point3D(Lines[i + 3], Lines[i + 4], Lines[i + 5])));
+    }
+}
+/*************************************************************************
+【函数名称】Finish
+【函数功能】利用重载的+=运算符把收集的面和线加入模型，并释放收集的数据
+【参数】无
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+void ModelBuilderStage::Finish() {
+    m_Model += m_Faces;
+    m_Model += m_Lines;
+    vector<Face3D>().swap(m_Faces);
+    vector<Line3D>().swap(m_Lines);
+}
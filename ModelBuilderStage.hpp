@@ -0,0 +1,72 @@
+/*************************************************************************
+【文件名】ModelBuilderStage.hpp
+【功能模块和目的】定义ModelBuilderStage类，把流式导入的批次组装为Model3D
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+#ifndef MODELBUILDERSTAGE_HPP
+#define MODELBUILDERSTAGE_HPP
+
+// ModelStreamStage所属头文件
+#include "ModelStreamStage.hpp"
+// Model3D所属头文件
+#include "Model3D.hpp"
+// Face3D所属头文件
+#include "Face3D.hpp"
+// Line3D所属头文件
+#include "Line3D.hpp"
+// string所属头文件
+#include <string>
+// vector所属头文件
+#include <vector>
+
+using namespace std;
+
+/*************************************************************************
+【类名】ModelBuilderStage
+【功能】流式处理阶段：按批次收集面和线，全部批次处理完毕后一次性加入
+       构造时给定的目标模型（与Model3D_Importer::LoadFromStream相同，重复的面和线被去除）。
+       可以在读取文件的同时逐批获得处理进度，内存占用与模型大小有关
+【接口说明】
+    带参构造函数（目标模型）
+    禁止拷贝构造和赋值
+    虚析构函数
+    处理一个批次
+    全部批次处理完毕（组装模型）
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+class ModelBuilderStage : public ModelStreamStage {
+public:
+    //-------------------------------------------------------------------------
+    // 必要的构造、析构、拷贝、赋值运算符重载函数
+    //-------------------------------------------------------------------------
+    // 带参构造函数，面和线被加入Target
+    explicit ModelBuilderStage(Model3D& Target);
+    // 禁止拷贝构造
+    ModelBuilderStage(const ModelBuilderStage& Source) = delete;
+    // 禁止赋值
+    ModelBuilderStage& operator=(const ModelBuilderStage& Source) = delete;
+    // 虚析构函数
+    virtual ~ModelBuilderStage() = default;
+    //-------------------------------------------------------------------------
+    // 非静态Setter成员函数
+    //-------------------------------------------------------------------------
+    // 处理一个批次
+    virtual void ProcessBatch(const Batch& ABatch) override;
+    // 全部批次处理完毕，把收集的面和线加入模型
+    virtual void Finish() override;
+
+private:
+    //-------------------------------------------------------------------------
+    // 私有非静态成员
+    //-------------------------------------------------------------------------
+    // 目标模型
+    Model3D& m_Model;
+    // 收集的面
+    vector<Face3D> m_Faces{};
+    // 收集的线
+    vector<Line3D> m_Lines{};
+};
+
+#endif /* ModelBuilderStage.hpp */
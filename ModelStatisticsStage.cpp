@@ -0,0 +1,206 @@
+/*************************************************************************
+【文件名】ModelStatisticsStage.cpp
+【功能模块和目的】定义ModelStatisticsStage类的成员函数
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+// ModelStatisticsStage所属头文件
+#include "ModelStatisticsStage.hpp"
+// ModelStreamStage所属头文件
+#include "ModelStreamStage.hpp"
+// sqrt所属头文件
+#include <cmath>
+// string所属头文件
+#include <string>
+// vector所属头文件
+#include <vector>
+// size_t所属头文件
+#include <cstddef>
+
+using namespace std;
+
+//-------------------------------------------------------------------------
+// 非静态Setter成员函数
+//-------------------------------------------------------------------------
+
+/*************************************************************************
+【函数名称】ProcessBatch
+【函数功能】累加一个批次的统计量
+【参数】const Batch& ABatch, 表示批次
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+void ModelStatisticsStage::ProcessBatch(const Batch& ABatch) {
+    m_Name = ABatch.Name;
+    m_Description = ABatch.Description;
+    m_VertexCount += ABatch.Vertices.size() / 3;
+    const vector<double>& Faces = ABatch.FaceCoordinates;
+    for (size_t i = 0; i + 9 <= Faces.size(); i += 9) {
+        const double* a = &Faces[i];
+        const double* b = &Faces[i + 3];
+        const double* c = &Faces[i + 6];
+        double e1[3] = {b[0] - a[0], b[1] - a[1], b[2] - a[2]};
+        double e2[3] = {c[0] - a[0], c[1] - a[1], c[2] - a[2]};
+        double n[3] = {e1[1] * e2[2] - e1[2] * e2[1],
+                       e1[2] * e2[0] - e1[0] * e2[2],
+                       e1[0] * e2[1] - e1[1] * e2[0]};
+        m_Area += sqrt(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]) / 2;
+        Extend(a);
+        Extend(b);
+        Extend(c);
+        m_FaceCount++;
+    }
+    const vector<double>& Lines = ABatch.LineCoordinates;
+    for (size_t i = 0; i + 6 <= Lines.size(); i += 6) {
+        const double* a = &Lines[i];
+        const double* b = &Lines[i + 3];
+        double d[3] = {b[0] - a[0], b[1] - a[1], b[2] - a[2]};
+        m_Length += sqrt(d[0] * d[0] + d[1] * d[1] + d[2] * d[2]);
+        Extend(a);
+        Extend(b);
+        m_LineCount++;
+    }
+}
+
+//-------------------------------------------------------------------------
+// 非静态Getter成员函数
+//-------------------------------------------------------------------------
+
+/*************************************************************************
+【函数名称】GetName
+【函数功能】获取名称
+【参数】无
+【返回值】const string&，名称
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+const string& ModelStatisticsStage::GetName() const {
+    return m_Name;
+}
+/*************************************************************************
+【函数名称】GetDescription
+【函数功能】获取注释
+【参数】无
+【返回值】const string&，注释
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+const string& ModelStatisticsStage::GetDescription() const {
+    return m_Description;
+}
+/*************************************************************************
+【函数名称】GetVertexCount
+【函数功能】获取顶点数
+【参数】无
+【返回值】size_t，顶点数
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+size_t ModelStatisticsStage::GetVertexCount() const {
+    return m_VertexCount;
+}
+/*************************************************************************
+【函数名称】GetFaceCount
+【函数功能】获取面数
+【参数】无
+【返回值】size_t，面数
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+size_t ModelStatisticsStage::GetFaceCount() const {
+    return m_FaceCount;
+}
+/*************************************************************************
+【函数名称】GetLineCount
+【函数功能】获取线数
+【参数】无
+【返回值】size_t，线数
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+size_t ModelStatisticsStage::GetLineCount() const {
+    return m_LineCount;
+}
+/*************************************************************************
+【函数名称】GetPointCount
+【函数功能】获取点数
+【参数】无
+【返回值】size_t，点数（面数*3+线数*2）
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+size_t ModelStatisticsStage::GetPointCount() const {
+    return m_FaceCount * 3 + m_LineCount * 2;
+}
+/*************************************************************************
+【函数名称】GetElementCount
+【函数功能】获取元素数
+【参数】无
+【返回值】size_t，元素数（面数+线数）
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+size_t ModelStatisticsStage::GetElementCount() const {
+    return m_FaceCount + m_LineCount;
+}
+/*************************************************************************
+【函数名称】GetArea
+【函数功能】获取面的总面积
+【参数】无
+【返回值】double，面的总面积
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+double ModelStatisticsStage::GetArea() const {
+    return m_Area;
+}
+/*************************************************************************
+【函数名称】GetLength
+【函数功能】获取线的总长度
+【参数】无
+【返回值】double，线的总长度
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+double ModelStatisticsStage::GetLength() const {
+    return m_Length;
+}
+/*************************************************************************
+【函数名称】GetBoundingBoxVolume
+【函数功能】获取面和线的全部点的包围盒体积
+【参数】无
+【返回值】double，包围盒体积，没有面和线时为0
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+double ModelStatisticsStage::GetBoundingBoxVolume() const {
+    if (m_FaceCount + m_LineCount == 0) {
+        return 0;
+    }
+    return (m_Max[0] - m_Min[0]) * (m_Max[1] - m_Min[1])
+        * (m_Max[2] - m_Min[2]);
+}
+
+//-------------------------------------------------------------------------
+// 私有非静态成员函数
+//-------------------------------------------------------------------------
+
+/*************************************************************************
+【函数名称】Extend
+【函数功能】用一个点扩展包围盒
+【参数】const double* Point, 表示点的三个坐标
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+void ModelStatisticsStage::Extend(const double* Point) {
+    for (size_t i = 0; i < 3; i++) {
+        if (Point[i] < m_Min[i]) {
+            m_Min[i] = Point[i];
+        }
+        if (Point[i] > m_Max[i]) {
+            m_Max[i] = Point[i];
+        }
+    }
+}
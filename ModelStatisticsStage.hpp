@@ -0,0 +1,114 @@
+/*************************************************************************
+【文件名】ModelStatisticsStage.hpp
+【功能模块和目的】定义ModelStatisticsStage类，流式统计模型的数量、面积、长度和包围盒
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+#ifndef MODELSTATISTICSSTAGE_HPP
+#define MODELSTATISTICSSTAGE_HPP
+
+// ModelStreamStage所属头文件
+#include "ModelStreamStage.hpp"
+// string所属头文件
+#include <string>
+// size_t所属头文件
+#include <cstddef>
+// numeric_limits所属头文件
+#include <limits>
+
+using namespace std;
+
+/*************************************************************************
+【类名】ModelStatisticsStage
+【功能】流式处理阶段：逐批累加面数、线数、面积、线长和包围盒，
+       只占用常数内存。统计口径与Model3D的对应函数一致，
+       但不去除文件中重复的面和线
+【接口说明】
+    默认构造函数
+    拷贝构造函数
+    赋值运算符
+    虚析构函数
+    处理一个批次
+    获取名称、注释
+    获取顶点数、面数、线数、点数、元素数
+    获取面的总面积、线的总长度、包围盒体积
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+class ModelStatisticsStage : public ModelStreamStage {
+public:
+    //-------------------------------------------------------------------------
+    // 必要的构造、析构、拷贝、赋值运算符重载函数
+    //-------------------------------------------------------------------------
+    // 默认构造函数
+    ModelStatisticsStage() = default;
+    // 拷贝构造函数
+    ModelStatisticsStage(const ModelStatisticsStage& Source) = default;
+    // 赋值运算符
+    ModelStatisticsStage& operator=(
+        const ModelStatisticsStage& Source) = default;
+    // 虚析构函数
+    virtual ~ModelStatisticsStage() = default;
+    //-------------------------------------------------------------------------
+    // 非静态Setter成员函数
+    //-------------------------------------------------------------------------
+    // 处理一个批次
+    virtual void ProcessBatch(const Batch& ABatch) override;
+    //-------------------------------------------------------------------------
+    // 非静态Getter成员函数
+    //-------------------------------------------------------------------------
+    // 获取名称
+    const string& GetName() const;
+    // 获取注释
+    const string& GetDescription() const;
+    // 获取顶点数
+    size_t GetVertexCount() const;
+    // 获取面数
+    size_t GetFaceCount() const;
+    // 获取线数
+    size_t GetLineCount() const;
+    // 获取点数（与Model3D::GetPointCount一致，为面数*3+线数*2）
+    size_t GetPointCount() const;
+    // 获取元素数（面数+线数）
+    size_t GetElementCount() const;
+    // 获取面的总面积
+    double GetArea() const;
+    // 获取线的总长度
+    double GetLength() const;
+    // 获取包围盒体积（没有面和线时为0）
+    double GetBoundingBoxVolume() const;
+
+private:
+    //-------------------------------------------------------------------------
+    // 私有非静态成员函数
+    //-------------------------------------------------------------------------
+    // 用一个点扩展包围盒
+    void Extend(const double* Point);
+    //-------------------------------------------------------------------------
+    // 私有非静态成员
+    //-------------------------------------------------------------------------
+    // 名称
+    string m_Name{};
+    // 注释
+    string m_Description{};
+    // 顶点数
+    size_t m_VertexCount{0};
+    // 面数
+    size_t m_FaceCount{0};
+    // 线数
+    size_t m_LineCount{0};
+    // 面的总面积
+    double m_Area{0};
+    // 线的总长度
+    double m_Length{0};
+    // 包围盒的最小坐标
+    double m_Min[3]{numeric_limits<double>::infinity(),
+                    numeric_limits<double>::infinity(),
+                    numeric_limits<double>::infinity()};
+    // 包围盒的最大坐标
+    double m_Max[3]{-numeric_limits<double>::infinity(),
+                    -numeric_limits<double>::infinity(),
+                    -numeric_limits<double>::infinity()};
+};
+
+#endif /* ModelStatisticsStage.hpp */
@@ -0,0 +1,26 @@
+/*************************************************************************
+【文件名】ModelStreamStage.cpp
+【功能模块和目的】定义ModelStreamStage类的成员函数
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+// ModelStreamStage所属头文件
+#include "ModelStreamStage.hpp"
+
+using namespace std;
+
+//-------------------------------------------------------------------------
+// 非静态Setter成员函数
+//-------------------------------------------------------------------------
+
+/*************************************************************************
+【函数名称】Finish
+【函数功能】全部批次处理完毕时被调用，默认不做任何事，
+       派生类可重写以输出结尾数据
+【参数】无
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+void ModelStreamStage::Finish() {
+}
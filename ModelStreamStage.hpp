@@ -0,0 +1,84 @@
+/*************************************************************************
+【文件名】ModelStreamStage.hpp
+【功能模块和目的】定义ModelStreamStage类，流式处理模型时接收分批数据的处理阶段
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+#ifndef MODELSTREAMSTAGE_HPP
+#define MODELSTREAMSTAGE_HPP
+
+// string所属头文件
+#include <string>
+// vector所属头文件
+#include <vector>
+// size_t所属头文件
+#include <cstddef>
+
+using namespace std;
+
+/*************************************************************************
+【类名】ModelStreamStage
+【功能】流式导入的处理阶段抽象类。导入器按文件顺序把顶点、面和线分成固定大小
+       的批次依次交给处理阶段，处理阶段只持有当前批次，因此内存占用与模型大小
+       无关；派生类实现统计、格式转换等具体处理
+【接口说明】
+    内嵌结构体Batch，表示一个批次
+    默认构造函数
+    拷贝构造函数
+    赋值运算符
+    虚析构函数
+    处理一个批次（纯虚函数）
+    全部批次处理完毕（默认不做任何事）
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+class ModelStreamStage {
+public:
+    //-------------------------------------------------------------------------
+    // 公有的内嵌类，用于存储数据
+    //-------------------------------------------------------------------------
+    // 一个批次的数据。顶点按出现顺序从0开始全局编号，面和线同时给出
+    // 全局顶点索引和已解析的坐标，处理阶段可按需使用其一
+    struct Batch {
+        // 模型名称（到本批次为止读到的值）
+        string Name;
+        // 模型注释（到本批次为止读到的值）
+        string Description;
+        // 本批次第一个顶点的全局编号
+        size_t FirstVertex{0};
+        // 本批次新增的顶点坐标（x, y, z交错存放）
+        vector<double> Vertices;
+        // 本批次第一个面的全局编号
+        size_t FirstFace{0};
+        // 本批次面的全局顶点索引（每个面3个）
+        vector<size_t> FaceIndices;
+        // 本批次面的坐标（每个面9个）
+        vector<double> FaceCoordinates;
+        // 本批次第一条线的全局编号
+        size_t FirstLine{0};
+        // 本批次线的全局顶点索引（每条线2个）
+        vector<size_t> LineIndices;
+        // 本批次线的坐标（每条线6个）
+        vector<double> LineCoordinates;
+    };
+    //-------------------------------------------------------------------------
+    // 必要的构造、析构、拷贝、赋值运算符重载函数
+    //-------------------------------------------------------------------------
+    // 默认构造函数
+    ModelStreamStage() = default;
+    // 拷贝构造函数
+    ModelStreamStage(const ModelStreamStage& Source) = default;
+    // 赋值运算符
+    ModelStreamStage& operator=(const ModelStreamStage& Source) = default;
+    // 虚析构函数
+    virtual ~ModelStreamStage() = default;
+    //-------------------------------------------------------------------------
+    // 非静态Setter成员函数
+    //-------------------------------------------------------------------------
+    // 处理一个批次（纯虚函数，由派生类实现具体处理）
+    virtual void ProcessBatch(const Batch& ABatch) = 0;
+    // 全部批次处理完毕
+    virtual void Finish();
+};
+
+#endif /* ModelStreamStage.hpp */
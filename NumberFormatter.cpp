@@ -0,0 +1,160 @@
+/*************************************************************************
+【文件名】NumberFormatter.cpp
+【功能模块和目的】定义NumberFormatter类的成员函数
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+// NumberFormatter所属头文件
+#include "NumberFormatter.hpp"
+// to_chars、chars_format所属头文件
+#include <charconv>
+// numeric_limits所属头文件
+#include <limits>
+// errc所属头文件
+#include <system_error>
+// string所属头文件
+#include <string>
+// uint64_t所属头文件
+#include <cstdint>
+// size_t所属头文件
+#include <cstddef>
+
+using namespace std;
+
+//-------------------------------------------------------------------------
+// 静态常量
+//-------------------------------------------------------------------------
+
+// 小数位数取此值时输出能精确读回的最短形式
+constexpr int NumberFormatter::SHORTEST;
+// 一个数值的最大字符数
+constexpr size_t NumberFormatter::MAX_LENGTH;
+
+//-------------------------------------------------------------------------
+// 必要的构造、析构、拷贝、赋值运算符重载函数
+//-------------------------------------------------------------------------
+
+/*************************************************************************
+【函数名称】NumberFormatter
+【函数功能】带参构造函数。负数按SHORTEST处理；超过double有效位数的
+       小数位数没有意义，限制为max_digits10，使输出不超过MAX_LENGTH
+【参数】int Precision, 表示定点形式的小数位数或SHORTEST
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+NumberFormatter::NumberFormatter(int Precision)
+    : m_Precision(Precision < 0 ? SHORTEST
+        : Precision > numeric_limits<double>::max_digits10
+        ? numeric_limits<double>::max_digits10 : Precision) {
+}
+
+//-------------------------------------------------------------------------
+// 非静态Getter成员函数
+//-------------------------------------------------------------------------
+
+/*************************************************************************
+【函数名称】GetPrecision
+【函数功能】获取定点形式的小数位数
+【参数】无
+【返回值】int，小数位数，最短形式时为SHORTEST
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+int NumberFormatter::GetPrecision() const {
+    return m_Precision;
+}
+/*************************************************************************
+【函数名称】IsShortest
+【函数功能】是否输出能精确读回的最短形式
+【参数】无
+【返回值】bool，是否为最短形式
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+bool NumberFormatter::IsShortest() const {
+    return m_Precision == SHORTEST;
+}
+/*************************************************************************
+【函数名称】Format
+【函数功能】把浮点数写入字符数组。最短形式由to_chars选择定点或科学
+       计数法中较短的一种；定点形式的数值过大而超出MAX_LENGTH时，
+       改用同样位数的科学计数法
+【参数】double Value, 表示数值
+       char* pOut, 表示至少MAX_LENGTH个字符的数组
+【返回值】char*，写入的末尾
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+char* NumberFormatter::Format(double Value, char* pOut) const {
+    char* pLast = pOut + MAX_LENGTH;
+    if (IsShortest()) {
+        return to_chars(pOut, pLast, Value).ptr;
+    }
+    to_chars_result Result
+        = to_chars(pOut, pLast, Value, chars_format::fixed, m_Precision);
+    if (Result.ec != errc()) {
+        Result = to_chars(
+            pOut, pLast, Value, chars_format::scientific, m_Precision);
+    }
+    return Result.ptr;
+}
+/*************************************************************************
+【函数名称】Format
+【函数功能】把以空格分隔的三个浮点数写入字符数组，用于顶点和法向量
+【参数】double X, double Y, double Z, 表示三个数值
+       char* pOut, 表示至少3 * MAX_LENGTH个字符的数组
+【返回值】char*，写入的末尾
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+char* NumberFormatter::Format(double X, double Y, double Z, char* pOut) const {
+    pOut = Format(X, pOut);
+    *pOut++ = ' ';
+    pOut = Format(Y, pOut);
+    *pOut++ = ' ';
+    return Format(Z, pOut);
+}
+/*************************************************************************
+【函数名称】Append
+【函数功能】把浮点数追加到字符串
+【参数】string& Text, 表示字符串
+       double Value, 表示数值
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+void NumberFormatter::Append(string& Text, double Value) const {
+    char Buffer[MAX_LENGTH];
+    Text.append(Buffer, Format(Value, Buffer));
+}
+
+//-------------------------------------------------------------------------
+// 静态成员函数
+//-------------------------------------------------------------------------
+
+/*************************************************************************
+【函数名称】Format
+【函数功能】把整数写入字符数组
+【参数】uint64_t Value, 表示数值
+       char* pOut, 表示至少MAX_LENGTH个字符的数组
+【返回值】char*，写入的末尾
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+char* NumberFormatter::Format(uint64_t Value, char* pOut) {
+    return to_chars(pOut, pOut + MAX_LENGTH, Value).ptr;
+}
+/*************************************************************************
+【函数名称】Append
+【函数功能】把整数追加到字符串
+【参数】string& Text, 表示字符串
+       uint64_t Value, 表示数值
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+void NumberFormatter::Append(string& Text, uint64_t Value) {
+    char Buffer[MAX_LENGTH];
+    Text.append(Buffer, Format(Value, Buffer));
+}
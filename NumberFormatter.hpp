@@ -0,0 +1,85 @@
+/*************************************************************************
+【文件名】NumberFormatter.hpp
+【功能模块和目的】定义NumberFormatter类，为文本格式的导出器把数值转换为
+       字符，默认输出能精确读回的最短形式
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+#ifndef NUMBERFORMATTER_HPP
+#define NUMBERFORMATTER_HPP
+
+// string所属头文件
+#include <string>
+// uint64_t所属头文件
+#include <cstdint>
+// size_t所属头文件
+#include <cstddef>
+
+using namespace std;
+
+/*************************************************************************
+【类名】NumberFormatter
+【功能】基于to_chars的数值格式化，与locale无关，不经过流的格式化状态。
+       默认（SHORTEST）输出按double读回后与原值完全相同的最短字符串；
+       指定小数位数时输出定点形式，数值过大时改用同样位数的科学计数法，
+       保证输出不超过MAX_LENGTH个字符。写入调用者提供的字符数组，
+       导出器把整行拼好后一次写入流
+【接口说明】
+    静态常量：最短形式、一个数值的最大字符数
+    带参构造函数（小数位数）
+    获取小数位数，是否为最短形式
+    把浮点数、三个浮点数、整数写入字符数组
+    把浮点数、整数追加到字符串
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+class NumberFormatter {
+public:
+    //-------------------------------------------------------------------------
+    // 静态常量
+    //-------------------------------------------------------------------------
+    // 小数位数取此值时输出能精确读回的最短形式
+    static constexpr int SHORTEST{-1};
+    // 一个数值的最大字符数
+    static constexpr size_t MAX_LENGTH{32};
+    //-------------------------------------------------------------------------
+    // 必要的构造、析构、拷贝、赋值运算符重载函数
+    //-------------------------------------------------------------------------
+    // 带参构造函数，Precision为定点形式的小数位数或SHORTEST
+    explicit NumberFormatter(int Precision = SHORTEST);
+    // 拷贝构造函数
+    NumberFormatter(const NumberFormatter& Source) = default;
+    // 赋值运算符
+    NumberFormatter& operator=(const NumberFormatter& Source) = default;
+    // 虚析构函数
+    virtual ~NumberFormatter() = default;
+    //-------------------------------------------------------------------------
+    // 非静态Getter成员函数
+    //-------------------------------------------------------------------------
+    // 获取小数位数，最短形式时为SHORTEST
+    int GetPrecision() const;
+    // 是否为最短形式
+    bool IsShortest() const;
+    // 把Value写入pOut开始的至少MAX_LENGTH个字符，返回写入的末尾
+    char* Format(double Value, char* pOut) const;
+    // 把以空格分隔的X、Y、Z写入pOut开始的至少3 * MAX_LENGTH个字符
+    char* Format(double X, double Y, double Z, char* pOut) const;
+    // 把Value追加到Text
+    void Append(string& Text, double Value) const;
+    //-------------------------------------------------------------------------
+    // 静态成员函数
+    //-------------------------------------------------------------------------
+    // 把整数Value写入pOut开始的至少MAX_LENGTH个字符，返回写入的末尾
+    static char* Format(uint64_t Value, char* pOut);
+    // 把整数Value追加到Text
+    static void Append(string& Text, uint64_t Value);
+
+private:
+    //-------------------------------------------------------------------------
+    // 私有非静态成员
+    //-------------------------------------------------------------------------
+    // 定点形式的小数位数，最短形式时为SHORTEST
+    int m_Precision;
+};
+
+#endif /* NumberFormatter.hpp */
@@ -0,0 +1,546 @@
+/*************************************************************************
+【文件名】OBJParser.cpp
+【功能模块和目的】定义OBJParser类的成员函数
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+// OBJParser所属头文件
+#include "OBJParser.hpp"
+// from_chars所属头文件
+#include <charconv>
+// errc所属头文件
+#include <system_error>
+// istream、getline所属头文件
+#include <istream>
+// invalid_argument所属头文件
+#include <stdexcept>
+// string所属头文件
+#include <string>
+// vector所属头文件
+#include <vector>
+// fabs所属头文件
+#include <cmath>
+// size_t所属头文件
+#include <cstddef>
+
+using namespace std;
+
+namespace {
+    /*************************************************************************
+    【函数名称】SkipSpace
+    【函数功能】跳过空格和制表符
+    【参数】const char* p, 当前位置
+           const char* pEnd, 行尾
+    【返回值】const char*，第一个非空白字符或行尾
+    【开发者及日期】谭雯心 2026/10/19
+    【更改记录】
+    *************************************************************************/
+    inline const char* SkipSpace(const char* p, const char* pEnd) {
+        while (p < pEnd && (*p == ' ' || *p == '\t')) {
+            p++;
+        }
+        return p;
+    }
+
+    /*************************************************************************
+    【函数名称】IsSeparator
+    【函数功能】位置p是否为记录标识之后的分隔（空白或行尾）
+    【参数】const char* p, 当前位置
+           const char* pEnd, 行尾
+    【返回值】bool，是否为分隔
+    【开发者及日期】谭雯心 2026/10/19
+    【更改记录】
+    *************************************************************************/
+    inline bool IsSeparator(const char* p, const char* pEnd) {
+        return p == pEnd || *p == ' ' || *p == '\t';
+    }
+}
+
+//-------------------------------------------------------------------------
+// 静态常量
+//-------------------------------------------------------------------------
+
+// 角点没有法向量或纹理坐标时的索引
+constexpr size_t OBJParser::NO_INDEX;
+
+//-------------------------------------------------------------------------
+// 内嵌异常类
+//-------------------------------------------------------------------------
+
+/*************************************************************************
+【函数名称】FORMAT_ERROR
+【函数功能】构造函数
+【参数】无
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+OBJParser::FORMAT_ERROR::FORMAT_ERROR()
+    : invalid_argument("Invalid OBJ data") {
+}
+
+//-------------------------------------------------------------------------
+// 必要的构造、析构、拷贝、赋值运算符重载函数
+//-------------------------------------------------------------------------
+
+/*************************************************************************
+【函数名称】OBJParser
+【函数功能】带参构造函数
+【参数】istream& Stream, 表示输入流，须在解析器之后析构
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+OBJParser::OBJParser(istream& Stream) : m_Stream(Stream) {
+}
+
+//-------------------------------------------------------------------------
+// 非静态成员函数
+//-------------------------------------------------------------------------
+
+/*************************************************************************
+【函数名称】Next
+【函数功能】读取下一条有意义的记录。按行首的一两个字符分派，v和f是最常见
+       的记录，放在最前面判断；未知的记录和空行跳过
+【参数】无
+【返回值】Record，记录的种类，输入结束时为END
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+OBJParser::Record OBJParser::Next() {
+    while (ReadLine()) {
+        const char* p = m_Line.data();
+        const char* pEnd = p + m_Line.size();
+        p = SkipSpace(p, pEnd);
+        if (p == pEnd) {
+            continue;
+        }
+        char Tag = *p++;
+        bool bSeparated = IsSeparator(p, pEnd);
+        switch (Tag) {
+            case 'v':
+                if (bSeparated) {
+                    ParseValues(p, pEnd, 3, 3);
+                    m_Positions.insert(m_Positions.end(), m_Values, m_Values + 3);
+                    return Record::VERTEX;
+                }
+                if (*p == 'n' && IsSeparator(p + 1, pEnd)) {
+                    ParseValues(p + 1, pEnd, 3, 3);
+                    m_Normals.insert(m_Normals.end(), m_Values, m_Values + 3);
+                    return Record::NORMAL;
+                }
+                if (*p == 't' && IsSeparator(p + 1, pEnd)) {
+                    ParseValues(p + 1, pEnd, 1, 3);
+                    m_TexCoords.insert(m_TexCoords.end(), m_Values, m_Values + 3);
+                    return Record::TEXCOORD;
+                }
+                break;
+            case 'f':
+                if (bSeparated) {
+                    ParseFace(p, pEnd);
+                    return Record::FACE;
+                }
+                break;
+            case 'l':
+                if (bSeparated) {
+                    ParseLine(p, pEnd);
+                    return Record::LINE;
+                }
+                break;
+            case 'g':
+            case 'o':
+                if (bSeparated) {
+                    p = SkipSpace(p, pEnd);
+                    while (pEnd > p && (pEnd[-1] == ' ' || pEnd[-1] == '\t')) {
+                        pEnd--;
+                    }
+                    m_Text.assign(p, pEnd);
+                    return Tag == 'g' ? Record::GROUP : Record::OBJECT;
+                }
+                break;
+            case '#':
+                // 与导出器一致，只跳过#后的一个空白
+                if (p < pEnd && (*p == ' ' || *p == '\t')) {
+                    p++;
+                }
+                m_Text.assign(p, pEnd);
+                return Record::COMMENT;
+            default:
+                break;
+        }
+    }
+    return Record::END;
+}
+
+//-------------------------------------------------------------------------
+// 非静态Getter成员函数
+//-------------------------------------------------------------------------
+
+/*************************************************************************
+【函数名称】GetValues
+【函数功能】获取VERTEX、NORMAL、TEXCOORD记录的三个数值
+【参数】无
+【返回值】const double*，三个数值
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+const double* OBJParser::GetValues() const {
+    return m_Values;
+}
+/*************************************************************************
+【函数名称】GetIndices
+【函数功能】获取FACE记录的三角形或LINE记录的线段的顶点索引（从0开始）
+【参数】无
+【返回值】const vector<size_t>&，顶点索引
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+const vector<size_t>& OBJParser::GetIndices() const {
+    return m_Indices;
+}
+/*************************************************************************
+【函数名称】GetNormalIndices
+【函数功能】获取FACE记录各角点的法向量索引
+【参数】无
+【返回值】const vector<size_t>&，法向量索引，没有时为NO_INDEX
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+const vector<size_t>& OBJParser::GetNormalIndices() const {
+    return m_NormalIndices;
+}
+/*************************************************************************
+【函数名称】GetTexCoordIndices
+【函数功能】获取FACE记录各角点的纹理坐标索引
+【参数】无
+【返回值】const vector<size_t>&，纹理坐标索引，没有时为NO_INDEX
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+const vector<size_t>& OBJParser::GetTexCoordIndices() const {
+    return m_TexCoordIndices;
+}
+/*************************************************************************
+【函数名称】GetText
+【函数功能】获取GROUP、OBJECT、COMMENT记录的文本
+【参数】无
+【返回值】const string&，文本
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+const string& OBJParser::GetText() const {
+    return m_Text;
+}
+/*************************************************************************
+【函数名称】GetPositions
+【函数功能】获取已读的顶点坐标
+【参数】无
+【返回值】const vector<double>&，顶点坐标，x, y, z交错存放
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+const vector<double>& OBJParser::GetPositions() const {
+    return m_Positions;
+}
+/*************************************************************************
+【函数名称】GetNormals
+【函数功能】获取已读的法向量
+【参数】无
+【返回值】const vector<double>&，法向量，x, y, z交错存放
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+const vector<double>& OBJParser::GetNormals() const {
+    return m_Normals;
+}
+/*************************************************************************
+【函数名称】GetTexCoords
+【函数功能】获取已读的纹理坐标
+【参数】无
+【返回值】const vector<double>&，纹理坐标，u, v, w交错存放
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+const vector<double>& OBJParser::GetTexCoords() const {
+    return m_TexCoords;
+}
+/*************************************************************************
+【函数名称】GetLineNumber
+【函数功能】获取当前记录所在的行号，用于报告错误位置
+【参数】无
+【返回值】size_t，行号，从1开始
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+size_t OBJParser::GetLineNumber() const {
+    return m_LineNumber;
+}
+
+//-------------------------------------------------------------------------
+// 私有非静态成员函数
+//-------------------------------------------------------------------------
+
+/*************************************************************************
+【函数名称】ReadLine
+【函数功能】读取下一个非空行到m_Line，去掉行尾的\r；以\结尾的行与下一行
+       合并为一行
+【参数】无
+【返回值】bool，是否读到，输入结束时为false
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+bool OBJParser::ReadLine() {
+    while (getline(m_Stream, m_Line)) {
+        m_LineNumber++;
+        if (!m_Line.empty() && m_Line.back() == '\r') {
+            m_Line.pop_back();
+        }
+        while (!m_Line.empty() && m_Line.back() == '\\'
+            && getline(m_Stream, m_Continuation)) {
+            m_LineNumber++;
+            if (!m_Continuation.empty() && m_Continuation.back() == '\r') {
+                m_Continuation.pop_back();
+            }
+            m_Line.back() = ' ';
+            m_Line += m_Continuation;
+        }
+        if (!m_Line.empty()) {
+            return true;
+        }
+    }
+    return false;
+}
+/*************************************************************************
+【函数名称】ParseValues
+【函数功能】用from_chars读取至多Count个数值到m_Values，缺少的分量为0，
+       多余的分量（如v的w或顶点颜色）忽略
+【参数】const char* p, 记录标识之后的位置
+       const char* pEnd, 行尾
+       size_t MinCount, 至少需要的数值个数
+       size_t Count, 至多读取的数值个数，不超过3
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+void OBJParser::ParseValues(const char* p, const char* pEnd,
+    size_t MinCount, size_t Count) {
+    for (size_t i = 0; i < Count; i++) {
+        p = SkipSpace(p, pEnd);
+        if (p == pEnd) {
+            if (i < MinCount) {
+                throw FORMAT_ERROR();
+            }
+            m_Values[i] = 0.0;
+            continue;
+        }
+        // from_chars不接受正号
+        if (*p == '+') {
+            p++;
+        }
+        from_chars_result Result = from_chars(p, pEnd, m_Values[i]);
+        if (Result.ec != errc() || !IsSeparator(Result.ptr, pEnd)) {
+            throw FORMAT_ERROR();
+        }
+        p = Result.ptr;
+    }
+}
+/*************************************************************************
+【函数名称】ParseFace
+【函数功能】读取面的角点（i、i/j、i//k、i/j/k），三角形直接写出，
+       多于三个角点时交给Triangulate
+【参数】const char* p, 记录标识之后的位置
+       const char* pEnd, 行尾
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+void OBJParser::ParseFace(const char* p, const char* pEnd) {
+    m_Indices.clear();
+    m_NormalIndices.clear();
+    m_TexCoordIndices.clear();
+    m_Polygon.clear();
+    size_t VertexCount = m_Positions.size() / 3;
+    size_t NormalCount = m_Normals.size() / 3;
+    size_t TexCoordCount = m_TexCoords.size() / 3;
+    while ((p = SkipSpace(p, pEnd)) != pEnd) {
+        Corner ACorner{ParseIndex(p, pEnd, VertexCount), NO_INDEX, NO_INDEX};
+        if (p < pEnd && *p == '/') {
+            p++;
+            if (p < pEnd && *p != '/' && !IsSeparator(p, pEnd)) {
+                ACorner.TexCoord = ParseIndex(p, pEnd, TexCoordCount);
+            }
+            if (p < pEnd && *p == '/') {
+                p++;
+                ACorner.Normal = ParseIndex(p, pEnd, NormalCount);
+            }
+        }
+        if (!IsSeparator(p, pEnd)) {
+            throw FORMAT_ERROR();
+        }
+        m_Polygon.push_back(ACorner);
+    }
+    if (m_Polygon.size() < 3) {
+        throw FORMAT_ERROR();
+    }
+    if (m_Polygon.size() == 3) {
+        AddTriangle(0, 1, 2);
+    }
+    else {
+        Triangulate();
+    }
+}
+/*************************************************************************
+【函数名称】ParseLine
+【函数功能】读取折线的顶点（纹理坐标索引忽略），相邻两点组成一条线段
+【参数】const char* p, 记录标识之后的位置
+       const char* pEnd, 行尾
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+void OBJParser::ParseLine(const char* p, const char* pEnd) {
+    m_Indices.clear();
+    size_t VertexCount = m_Positions.size() / 3;
+    size_t Previous = NO_INDEX;
+    size_t Count = 0;
+    while ((p = SkipSpace(p, pEnd)) != pEnd) {
+        size_t Index = ParseIndex(p, pEnd, VertexCount);
+        while (!IsSeparator(p, pEnd)) {
+            p++;
+        }
+        if (Previous != NO_INDEX) {
+            m_Indices.push_back(Previous);
+            m_Indices.push_back(Index);
+        }
+        Previous = Index;
+        Count++;
+    }
+    if (Count < 2) {
+        throw FORMAT_ERROR();
+    }
+}
+/*************************************************************************
+【函数名称】ParseIndex
+【函数功能】读取一个索引：正数从1开始，负数相对于已读的数量（-1为最近的
+       一个），转为从0开始的绝对索引
+【参数】const char*& p, 当前位置，返回时位于索引之后
+       const char* pEnd, 行尾
+       size_t Count, 已读的顶点、法向量或纹理坐标的数量
+【返回值】size_t，从0开始的绝对索引
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+size_t OBJParser::ParseIndex(
+    const char*& p, const char* pEnd, size_t Count) const {
+    bool bNegative = p < pEnd && *p == '-';
+    if (bNegative || (p < pEnd && *p == '+')) {
+        p++;
+    }
+    const char* pStart = p;
+    size_t Value = 0;
+    while (p < pEnd && static_cast<unsigned>(*p - '0') < 10) {
+        Value = Value * 10 + static_cast<size_t>(*p - '0');
+        if (Value > Count) {
+            throw FORMAT_ERROR();
+        }
+        p++;
+    }
+    if (p == pStart || Value == 0) {
+        throw FORMAT_ERROR();
+    }
+    return bNegative ? Count - Value : Value - 1;
+}
+/*************************************************************************
+【函数名称】Triangulate
+【函数功能】按耳切法把m_Polygon拆为三角形：先用Newell法求多边形法向量，
+       投影到法向量分量最大的坐标平面，再反复切去凸的、不含其他角点的
+       顶点。凹多边形也能正确拆分；找不到耳（退化或自交）时，剩余部分
+       按扇形拆分
+【参数】无
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+void OBJParser::Triangulate() {
+    size_t Count = m_Polygon.size();
+    double Normal[3] = {0.0, 0.0, 0.0};
+    for (size_t i = 0; i < Count; i++) {
+        const double* a = &m_Positions[3 * m_Polygon[i].Vertex];
+        const double* b = &m_Positions[3 * m_Polygon[(i + 1) % Count].Vertex];
+        Normal[0] += (a[1] - b[1]) * (a[2] + b[2]);
+        Normal[1] += (a[2] - b[2]) * (a[0] + b[0]);
+        Normal[2] += (a[0] - b[0]) * (a[1] + b[1]);
+    }
+    // 去掉法向量分量最大的坐标轴，按轮换顺序取另外两个，投影后的有向
+    // 面积与该分量同号
+    size_t Axis = 0;
+    for (size_t k = 1; k < 3; k++) {
+        if (fabs(Normal[k]) > fabs(Normal[Axis])) {
+            Axis = k;
+        }
+    }
+    double Orientation = Normal[Axis] < 0.0 ? -1.0 : 1.0;
+    vector<double> U(Count);
+    vector<double> V(Count);
+    for (size_t i = 0; i < Count; i++) {
+        const double* a = &m_Positions[3 * m_Polygon[i].Vertex];
+        U[i] = a[(Axis + 1) % 3];
+        V[i] = a[(Axis + 2) % 3];
+    }
+    // 三点的有向面积（两倍），按多边形的方向取正
+    auto Area = [&](size_t a, size_t b, size_t c) {
+        return ((U[b] - U[a]) * (V[c] - V[a])
+            - (V[b] - V[a]) * (U[c] - U[a])) * Orientation;
+    };
+    vector<size_t> Remaining(Count);
+    for (size_t i = 0; i < Count; i++) {
+        Remaining[i] = i;
+    }
+    while (Normal[Axis] != 0.0 && Remaining.size() > 3) {
+        size_t Size = Remaining.size();
+        bool bClipped = false;
+        for (size_t i = 0; i < Size && !bClipped; i++) {
+            size_t a = Remaining[(i + Size - 1) % Size];
+            size_t b = Remaining[i];
+            size_t c = Remaining[(i + 1) % Size];
+            if (Area(a, b, c) <= 0.0) {
+                continue;
+            }
+            bool bEar = true;
+            for (size_t k : Remaining) {
+                if (k != a && k != b && k != c && Area(a, b, k) >= 0.0
+                    && Area(b, c, k) >= 0.0 && Area(c, a, k) >= 0.0) {
+                    bEar = false;
+                    break;
+                }
+            }
+            if (bEar) {
+                AddTriangle(a, b, c);
+                Remaining.erase(Remaining.begin() + static_cast<ptrdiff_t>(i));
+                bClipped = true;
+            }
+        }
+        if (!bClipped) {
+            break;
+        }
+    }
+    for (size_t i = 1; i + 1 < Remaining.size(); i++) {
+        AddTriangle(Remaining[0], Remaining[i], Remaining[i + 1]);
+    }
+}
+/*************************************************************************
+【函数名称】AddTriangle
+【函数功能】追加由m_Polygon中三个角点组成的三角形的顶点、法向量和
+       纹理坐标索引
+【参数】size_t A, size_t B, size_t C, 角点在m_Polygon中的位置
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+void OBJParser::AddTriangle(size_t A, size_t B, size_t C) {
+    for (size_t i : {A, B, C}) {
+        m_Indices.push_back(m_Polygon[i].Vertex);
+        m_NormalIndices.push_back(m_Polygon[i].Normal);
+        m_TexCoordIndices.push_back(m_Polygon[i].TexCoord);
+    }
+}
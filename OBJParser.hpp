@@ -0,0 +1,186 @@
+/*************************************************************************
+【文件名】OBJParser.hpp
+【功能模块和目的】定义OBJParser类，逐条读取OBJ文件的记录
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+#ifndef OBJPARSER_HPP
+#define OBJPARSER_HPP
+
+// istream所属头文件
+#include <istream>
+// invalid_argument所属头文件
+#include <stdexcept>
+// string所属头文件
+#include <string>
+// vector所属头文件
+#include <vector>
+// size_t所属头文件
+#include <cstddef>
+
+using namespace std;
+
+/*************************************************************************
+【类名】OBJParser
+【功能】OBJ文件的拉取式解析器，每次调用Next读取一条有意义的记录。
+       支持v、vn、vt、f、l、g、o和#，其余记录（mtllib、usemtl、s等）跳过。
+       面的角点可写为i、i/j、i//k、i/j/k，索引可为负（相对于已读的数量），
+       解析后统一为从0开始的绝对索引；多于三个角点的面按耳切法拆为三角形
+       （退化或自交时退回扇形），折线拆为线段。顶点坐标、法向量和纹理坐标
+       存入各自的侧数组，面的每个角点记录法向量和纹理坐标的索引（没有时为
+       NO_INDEX）。逐行读取后用from_chars解析数值，常见的v和三角形f记录
+       不经过流的格式化输入，行缓冲和索引数组在记录之间复用
+【接口说明】
+    内嵌异常类FORMAT_ERROR
+    内嵌枚举Record：记录的种类
+    静态常量：没有法向量或纹理坐标时的索引
+    带参构造函数（输入流）
+    禁止拷贝构造和赋值
+    虚析构函数
+    读取下一条记录
+    获取记录的数值、索引、法向量索引、纹理坐标索引、文本
+    获取顶点坐标、法向量、纹理坐标的侧数组
+    获取当前行号
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+class OBJParser {
+public:
+    //-------------------------------------------------------------------------
+    // 内嵌异常类
+    //-------------------------------------------------------------------------
+    // 若数值无法解析，或索引为0、超出已读的数量，则抛出该异常
+    class FORMAT_ERROR : public invalid_argument {
+    public:
+        FORMAT_ERROR();
+    };
+    //-------------------------------------------------------------------------
+    // 内嵌枚举
+    //-------------------------------------------------------------------------
+    // 记录的种类
+    enum class Record {
+        // v：顶点
+        VERTEX,
+        // vn：法向量
+        NORMAL,
+        // vt：纹理坐标
+        TEXCOORD,
+        // f：面，已拆为三角形
+        FACE,
+        // l：折线，已拆为线段
+        LINE,
+        // g：组
+        GROUP,
+        // o：对象
+        OBJECT,
+        // #：注释
+        COMMENT,
+        // 输入结束
+        END
+    };
+    //-------------------------------------------------------------------------
+    // 静态常量
+    //-------------------------------------------------------------------------
+    // 角点没有法向量或纹理坐标时的索引
+    static constexpr size_t NO_INDEX{~size_t(0)};
+    //-------------------------------------------------------------------------
+    // 必要的构造、析构、拷贝、赋值运算符重载函数
+    //-------------------------------------------------------------------------
+    // 带参构造函数
+    explicit OBJParser(istream& Stream);
+    // 禁止拷贝构造
+    OBJParser(const OBJParser& Source) = delete;
+    // 禁止赋值
+    OBJParser& operator=(const OBJParser& Source) = delete;
+    // 虚析构函数
+    virtual ~OBJParser() = default;
+    //-------------------------------------------------------------------------
+    // 非静态成员函数
+    //-------------------------------------------------------------------------
+    // 读取下一条记录，输入结束时返回END
+    Record Next();
+    //-------------------------------------------------------------------------
+    // 非静态Getter成员函数
+    //-------------------------------------------------------------------------
+    // VERTEX、NORMAL、TEXCOORD记录的三个数值（纹理坐标缺少的分量为0）
+    const double* GetValues() const;
+    // FACE记录每3个一个三角形、LINE记录每2个一条线段的顶点索引
+    const vector<size_t>& GetIndices() const;
+    // FACE记录各角点的法向量索引，与GetIndices一一对应
+    const vector<size_t>& GetNormalIndices() const;
+    // FACE记录各角点的纹理坐标索引，与GetIndices一一对应
+    const vector<size_t>& GetTexCoordIndices() const;
+    // GROUP、OBJECT、COMMENT记录的文本
+    const string& GetText() const;
+    // 已读的顶点坐标（x, y, z交错存放）
+    const vector<double>& GetPositions() const;
+    // 已读的法向量（x, y, z交错存放）
+    const vector<double>& GetNormals() const;
+    // 已读的纹理坐标（u, v, w交错存放）
+    const vector<double>& GetTexCoords() const;
+    // 当前记录所在的行号（从1开始）
+    size_t GetLineNumber() const;
+
+private:
+    //-------------------------------------------------------------------------
+    // 私有的内嵌类
+    //-------------------------------------------------------------------------
+    // 面的一个角点
+    struct Corner {
+        // 顶点索引
+        size_t Vertex;
+        // 纹理坐标索引
+        size_t TexCoord;
+        // 法向量索引
+        size_t Normal;
+    };
+    //-------------------------------------------------------------------------
+    // 私有非静态成员函数
+    //-------------------------------------------------------------------------
+    // 读取下一个非空行，续行（以\结尾）与下一行合并
+    bool ReadLine();
+    // 读取至多Count个数值到m_Values，至少需要MinCount个
+    void ParseValues(const char* p, const char* pEnd, size_t MinCount,
+        size_t Count);
+    // 读取面的角点，拆为三角形
+    void ParseFace(const char* p, const char* pEnd);
+    // 读取折线的顶点，拆为线段
+    void ParseLine(const char* p, const char* pEnd);
+    // 读取一个索引并转为从0开始的绝对索引
+    size_t ParseIndex(const char*& p, const char* pEnd, size_t Count) const;
+    // 按耳切法把m_Polygon拆为三角形
+    void Triangulate();
+    // 追加由m_Polygon中三个角点组成的三角形
+    void AddTriangle(size_t A, size_t B, size_t C);
+    //-------------------------------------------------------------------------
+    // 私有非静态成员
+    //-------------------------------------------------------------------------
+    // 输入流
+    istream& m_Stream;
+    // 当前行
+    string m_Line{};
+    // 续行的下一行
+    string m_Continuation{};
+    // 当前行号
+    size_t m_LineNumber{0};
+    // 数值记录的数值
+    double m_Values[3]{0.0, 0.0, 0.0};
+    // 顶点索引
+    vector<size_t> m_Indices{};
+    // 法向量索引
+    vector<size_t> m_NormalIndices{};
+    // 纹理坐标索引
+    vector<size_t> m_TexCoordIndices{};
+    // 文本
+    string m_Text{};
+    // 顶点坐标侧数组
+    vector<double> m_Positions{};
+    // 法向量侧数组
+    vector<double> m_Normals{};
+    // 纹理坐标侧数组
+    vector<double> m_TexCoords{};
+    // 正在拆分的多边形的角点
+    vector<Corner> m_Polygon{};
+};
+
+#endif /* OBJParser.hpp */
@@ -0,0 +1,109 @@
+/*************************************************************************
+【文件名】OBJStreamWriter.cpp
+【功能模块和目的】定义OBJStreamWriter类的成员函数
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】2026/10/19 谭雯心 数值改由NumberFormatter输出，每个批次一次写入流
+*************************************************************************/
+// OBJStreamWriter所属头文件
+#include "OBJStreamWriter.hpp"
+// ModelStreamStage所属头文件
+#include "ModelStreamStage.hpp"
+// NumberFormatter所属头文件
+#include "NumberFormatter.hpp"
+// ostream所属头文件
+#include <iostream>
+// vector所属头文件
+#include <vector>
+// string所属头文件
+#include <string>
+// size_t所属头文件
+#include <cstddef>
+// uint64_t所属头文件
+#include <cstdint>
+
+using namespace std;
+
+//-------------------------------------------------------------------------
+// 必要的构造、析构、拷贝、赋值运算符重载函数
+//-------------------------------------------------------------------------
+
+/*************************************************************************
+【函数名称】OBJStreamWriter
+【函数功能】带参构造函数
+【参数】ostream& Stream, 表示输出流
+       int Precision, 表示坐标的小数位数，NumberFormatter::SHORTEST表示
+       输出能精确读回的最短形式
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】2026/10/19 谭雯心 增加了坐标的小数位数
+*************************************************************************/
+OBJStreamWriter::OBJStreamWriter(ostream& Stream, int Precision)
+    : m_Stream(Stream), m_Formatter(Precision) {
+}
+
+//-------------------------------------------------------------------------
+// 非静态Setter成员函数
+//-------------------------------------------------------------------------
+
+/*************************************************************************
+【函数名称】ProcessBatch
+【函数功能】将一个批次写成OBJ文本行
+【参数】const Batch& ABatch, 表示批次
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】2026/10/19 谭雯心 数值改由NumberFormatter输出，每个批次一次写入流
+*************************************************************************/
+void OBJStreamWriter::ProcessBatch(const Batch& ABatch) {
+    // 与Model3D_OBJ_Exporter一致，先写注释再写名称
+    if (!m_HeaderWritten || ABatch.Description != m_Description) {
+        m_Description = ABatch.Description;
+        m_Stream << "# " << m_Description << '\n';
+    }
+    if (!m_HeaderWritten || ABatch.Name != m_Name) {
+        m_Name = ABatch.Name;
+        m_Stream << "g " << m_Name << '\n';
+    }
+    m_HeaderWritten = true;
+    // 整个批次先在Text中拼好再一次写入流
+    string Text;
+    char Values[3 * NumberFormatter::MAX_LENGTH];
+    const vector<double>& Vertices = ABatch.Vertices;
+    for (size_t i = 0; i + 3 <= Vertices.size(); i += 3) {
+        Text += "v ";
+        Text.append(Values, m_Formatter.Format(
+            Vertices[i], Vertices[i + 1], Vertices[i + 2], Values));
+        Text += '\n';
+    }
+    const vector<size_t>& Faces = ABatch.FaceIndices;
+    for (size_t i = 0; i + 3 <= Faces.size(); i += 3) {
+        Text += 'f';
+        for (size_t j = 0; j < 3; j++) {
+            Text += ' ';
+            NumberFormatter::Append(
+                Text, static_cast<uint64_t>(Faces[i + j] + 1));
+        }
+        Text += '\n';
+    }
+    const vector<size_t>& Lines = ABatch.LineIndices;
+    for (size_t i = 0; i + 2 <= Lines.size(); i += 2) {
+        Text += 'l';
+        for (size_t j = 0; j < 2; j++) {
+            Text += ' ';
+            NumberFormatter::Append(
+                Text, static_cast<uint64_t>(Lines[i + j] + 1));
+        }
+        Text += '\n';
+    }
+    m_Stream.write(Text.data(), static_cast<streamsize>(Text.size()));
+}
+/*************************************************************************
+【函数名称】Finish
+【函数功能】刷新输出流
+【参数】无
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+void OBJStreamWriter::Finish() {
+    m_Stream.flush();
+}
@@ -0,0 +1,75 @@
+/*************************************************************************
+【文件名】OBJStreamWriter.hpp
+【功能模块和目的】定义OBJStreamWriter类，把流式批次写成OBJ文本文件
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】2026/10/19 谭雯心 数值改由NumberFormatter输出，每个批次一次写入流
+*************************************************************************/
+#ifndef OBJSTREAMWRITER_HPP
+#define OBJSTREAMWRITER_HPP
+
+// ModelStreamStage所属头文件
+#include "ModelStreamStage.hpp"
+// NumberFormatter所属头文件
+#include "NumberFormatter.hpp"
+// ostream所属头文件
+#include <iostream>
+// string所属头文件
+#include <string>
+
+using namespace std;
+
+/*************************************************************************
+【类名】OBJStreamWriter
+【功能】流式处理阶段：注释、名称变化时写入“# ”行和“g ”行，每个批次的顶点
+       写成“v ”行，面和线按全局顶点索引（从1开始）写成“f ”行和“l ”行。
+       与Model3D_OBJ_Exporter不同，顶点按批次原样输出而不去重，
+       因此内存占用与模型大小无关
+【接口说明】
+    带参构造函数（输出流，坐标的小数位数）
+    禁止拷贝构造函数
+    禁止赋值运算符
+    虚析构函数
+    处理一个批次
+    全部批次处理完毕
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】2026/10/19 谭雯心 数值改由NumberFormatter输出，每个批次一次写入流
+*************************************************************************/
+class OBJStreamWriter : public ModelStreamStage {
+public:
+    //-------------------------------------------------------------------------
+    // 必要的构造、析构、拷贝、赋值运算符重载函数
+    //-------------------------------------------------------------------------
+    // 带参构造函数
+    explicit OBJStreamWriter(
+        ostream& Stream, int Precision = NumberFormatter::SHORTEST);
+    // 禁止拷贝构造函数
+    OBJStreamWriter(const OBJStreamWriter& Source) = delete;
+    // 禁止赋值运算符
+    OBJStreamWriter& operator=(const OBJStreamWriter& Source) = delete;
+    // 虚析构函数
+    virtual ~OBJStreamWriter() = default;
+    //-------------------------------------------------------------------------
+    // 非静态Setter成员函数
+    //-------------------------------------------------------------------------
+    // 处理一个批次
+    virtual void ProcessBatch(const Batch& ABatch) override;
+    // 全部批次处理完毕
+    virtual void Finish() override;
+
+private:
+    //-------------------------------------------------------------------------
+    // 私有非静态成员
+    //-------------------------------------------------------------------------
+    // 输出流
+    ostream& m_Stream;
+    // 坐标的格式化
+    NumberFormatter m_Formatter;
+    // 是否已写入名称和注释
+    bool m_HeaderWritten{false};
+    // 已写入的名称
+    string m_Name{};
+    // 已写入的注释
+    string m_Description{};
+};
+
+#endif /* OBJStreamWriter.hpp */
@@ -0,0 +1,377 @@
+/*************************************************************************
+【文件名】PLYFormat.cpp
+【功能模块和目的】定义PLYFormat类的成员函数
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+// PLYFormat所属头文件
+#include "PLYFormat.hpp"
+// istream, ostream所属头文件
+#include <iostream>
+// istringstream所属头文件
+#include <sstream>
+// string所属头文件
+#include <string>
+// vector所属头文件
+#include <vector>
+// memcpy, memmove所属头文件
+#include <cstring>
+// int8_t等定长整数所属头文件
+#include <cstdint>
+// size_t所属头文件
+#include <cstddef>
+
+using namespace std;
+
+namespace {
+    /*********************************************************************
+    【函数名称】ParseType
+    【函数功能】把文件头中的类型名（含int8、float32等别名）转换为标量类型
+    【参数】const string& Name, 表示类型名
+           PLYFormat::ScalarType& Type, 用于存储标量类型
+    【返回值】bool，类型名是否有效
+    【开发者及日期】谭雯心 2026/10/19
+    【更改记录】
+    *********************************************************************/
+    bool ParseType(const string& Name, PLYFormat::ScalarType& Type) {
+        static const struct {
+            const char* Name;
+            PLYFormat::ScalarType Type;
+        } Table[] = {
+            {"char", PLYFormat::ScalarType::INT8},
+            {"int8", PLYFormat::ScalarType::INT8},
+            {"uchar", PLYFormat::ScalarType::UINT8},
+            {"uint8", PLYFormat::ScalarType::UINT8},
+            {"short", PLYFormat::ScalarType::INT16},
+            {"int16", PLYFormat::ScalarType::INT16},
+            {"ushort", PLYFormat::ScalarType::UINT16},
+            {"uint16", PLYFormat::ScalarType::UINT16},
+            {"int", PLYFormat::ScalarType::INT32},
+            {"int32", PLYFormat::ScalarType::INT32},
+            {"uint", PLYFormat::ScalarType::UINT32},
+            {"uint32", PLYFormat::ScalarType::UINT32},
+            {"float", PLYFormat::ScalarType::FLOAT32},
+            {"float32", PLYFormat::ScalarType::FLOAT32},
+            {"double", PLYFormat::ScalarType::FLOAT64},
+            {"float64", PLYFormat::ScalarType::FLOAT64}
+        };
+        for (const auto& Entry : Table) {
+            if (Name == Entry.Name) {
+                Type = Entry.Type;
+                return true;
+            }
+        }
+        return false;
+    }
+    /*********************************************************************
+    【函数名称】RestOfLine
+    【函数功能】取出行中关键字之后的文本（去掉关键字后的一个空格）
+    【参数】const string& Line, 表示一行
+           size_t KeywordLength, 表示关键字的长度
+    【返回值】string，关键字之后的文本
+    【开发者及日期】谭雯心 2026/10/19
+    【更改记录】
+    *********************************************************************/
+    string RestOfLine(const string& Line, size_t KeywordLength) {
+        if (Line.size() <= KeywordLength + 1) {
+            return string();
+        }
+        return Line.substr(KeywordLength + 1);
+    }
+    /*********************************************************************
+    【函数名称】OneLine
+    【函数功能】把文本中的换行替换为空格，使其可以写入文件头的一行
+    【参数】const string& Text, 表示文本
+    【返回值】string，不含换行的文本
+    【开发者及日期】谭雯心 2026/10/19
+    【更改记录】
+    *********************************************************************/
+    string OneLine(const string& Text) {
+        string Result = Text;
+        for (char& Character : Result) {
+            if (Character == '\n' || Character == '\r') {
+                Character = ' ';
+            }
+        }
+        return Result;
+    }
+}
+
+//-------------------------------------------------------------------------
+// 静态常量
+//-------------------------------------------------------------------------
+
+// BlockReader每次从流读取的最少字节数
+constexpr size_t PLYFormat::READ_CHUNK;
+
+//-------------------------------------------------------------------------
+// 内嵌类
+//-------------------------------------------------------------------------
+
+/*************************************************************************
+【函数名称】BlockReader
+【函数功能】带参构造函数
+【参数】istream& Stream, 表示输入流，须在BlockReader之后析构
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+PLYFormat::BlockReader::BlockReader(istream& Stream) : m_Stream(Stream) {
+}
+/*************************************************************************
+【函数名称】Take
+【函数功能】取出Bytes字节。缓冲区中的数据足够时只移动起点；不足时把
+       剩余数据移到缓冲区开头，再从流读取至少READ_CHUNK字节补足
+【参数】size_t Bytes, 表示字节数
+【返回值】const char*，数据的起点，在下次调用Take前有效；
+       流中的数据不足时返回nullptr
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+const char* PLYFormat::BlockReader::Take(size_t Bytes) {
+    if (m_End - m_Begin < Bytes) {
+        size_t Left = m_End - m_Begin;
+        if (Left > 0 && m_Begin > 0) {
+            memmove(m_Buffer.data(), m_Buffer.data() + m_Begin, Left);
+        }
+        m_Begin = 0;
+        m_End = Left;
+        size_t Want = Bytes - Left > READ_CHUNK ? Bytes - Left : READ_CHUNK;
+        if (m_Buffer.size() < Left + Want) {
+            m_Buffer.resize(Left + Want);
+        }
+        m_Stream.read(m_Buffer.data() + m_End, static_cast<streamsize>(Want));
+        m_End += static_cast<size_t>(m_Stream.gcount());
+        if (m_End < Bytes) {
+            return nullptr;
+        }
+    }
+    const char* pData = m_Buffer.data() + m_Begin;
+    m_Begin += Bytes;
+    return pData;
+}
+
+//-------------------------------------------------------------------------
+// 静态成员函数
+//-------------------------------------------------------------------------
+
+/*************************************************************************
+【函数名称】ReadHeader
+【函数功能】读取文件头，直到end_header行。只接受ascii和
+       binary_little_endian编码；属性须声明在元素之后
+【参数】istream& Stream, 表示输入流
+       Header& AHeader, 用于存储文件头
+【返回值】bool，文件头格式是否正确
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+bool PLYFormat::ReadHeader(istream& Stream, Header& AHeader) {
+    AHeader = Header();
+    string Line;
+    bool bFormat = false;
+    for (size_t LineNumber = 0; getline(Stream, Line); LineNumber++) {
+        if (!Line.empty() && Line.back() == '\r') {
+            Line.pop_back();
+        }
+        istringstream Words(Line);
+        string Keyword;
+        Words >> Keyword;
+        if (LineNumber == 0) {
+            if (Keyword != "ply") {
+                return false;
+            }
+            continue;
+        }
+        if (Keyword == "format") {
+            string Name;
+            Words >> Name;
+            if (Name == "ascii") {
+                AHeader.Format = Encoding::ASCII;
+            }
+            else if (Name == "binary_little_endian") {
+                AHeader.Format = Encoding::BINARY_LITTLE_ENDIAN;
+            }
+            else {
+                return false;
+            }
+            bFormat = true;
+        }
+        else if (Keyword == "comment") {
+            AHeader.Comments.push_back(RestOfLine(Line, Keyword.size()));
+        }
+        else if (Keyword == "obj_info") {
+            AHeader.ObjectInfo.push_back(RestOfLine(Line, Keyword.size()));
+        }
+        else if (Keyword == "element") {
+            Element AElement;
+            if (!(Words >> AElement.Name >> AElement.Count)) {
+                return false;
+            }
+            AHeader.Elements.push_back(AElement);
+        }
+        else if (Keyword == "property") {
+            if (AHeader.Elements.empty()) {
+                return false;
+            }
+            Property AProperty;
+            string TypeName;
+            Words >> TypeName;
+            if (TypeName == "list") {
+                string CountName;
+                AProperty.bList = true;
+                Words >> CountName >> TypeName;
+                if (!ParseType(CountName, AProperty.CountType)) {
+                    return false;
+                }
+            }
+            if (!ParseType(TypeName, AProperty.Type)
+                || !(Words >> AProperty.Name)) {
+                return false;
+            }
+            AHeader.Elements.back().Properties.push_back(AProperty);
+        }
+        else if (Keyword == "end_header") {
+            return bFormat;
+        }
+        else if (!Keyword.empty()) {
+            return false;
+        }
+    }
+    return false;
+}
+/*************************************************************************
+【函数名称】WriteHeader
+【函数功能】写入文件头。comment和obj_info中的换行替换为空格
+【参数】ostream& Stream, 表示输出流
+       const Header& AHeader, 表示文件头
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+void PLYFormat::WriteHeader(ostream& Stream, const Header& AHeader) {
+    Stream << "ply\nformat "
+        << (AHeader.Format == Encoding::ASCII ? "ascii" : "binary_little_endian")
+        << " 1.0\n";
+    for (const string& Comment : AHeader.Comments) {
+        Stream << "comment " << OneLine(Comment) << '\n';
+    }
+    for (const string& Info : AHeader.ObjectInfo) {
+        Stream << "obj_info " << OneLine(Info) << '\n';
+    }
+    for (const Element& AElement : AHeader.Elements) {
+        Stream << "element " << AElement.Name << ' ' << AElement.Count << '\n';
+        for (const Property& AProperty : AElement.Properties) {
+            Stream << "property ";
+            if (AProperty.bList) {
+                Stream << "list " << NameOf(AProperty.CountType) << ' ';
+            }
+            Stream << NameOf(AProperty.Type) << ' ' << AProperty.Name << '\n';
+        }
+    }
+    Stream << "end_header\n";
+}
+/*************************************************************************
+【函数名称】SizeOf
+【函数功能】获取标量类型的字节数
+【参数】ScalarType Type, 表示标量类型
+【返回值】size_t，字节数
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+size_t PLYFormat::SizeOf(ScalarType Type) {
+    switch (Type) {
+        case ScalarType::INT8:
+        case ScalarType::UINT8:
+            return 1;
+        case ScalarType::INT16:
+        case ScalarType::UINT16:
+            return 2;
+        case ScalarType::INT32:
+        case ScalarType::UINT32:
+        case ScalarType::FLOAT32:
+            return 4;
+        default:
+            return 8;
+    }
+}
+/*************************************************************************
+【函数名称】NameOf
+【函数功能】获取标量类型在文件头中的名称
+【参数】ScalarType Type, 表示标量类型
+【返回值】const char*，类型名
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+const char* PLYFormat::NameOf(ScalarType Type) {
+    switch (Type) {
+        case ScalarType::INT8:
+            return "char";
+        case ScalarType::UINT8:
+            return "uchar";
+        case ScalarType::INT16:
+            return "short";
+        case ScalarType::UINT16:
+            return "ushort";
+        case ScalarType::INT32:
+            return "int";
+        case ScalarType::UINT32:
+            return "uint";
+        case ScalarType::FLOAT32:
+            return "float";
+        default:
+            return "double";
+    }
+}
+/*************************************************************************
+【函数名称】Decode
+【函数功能】按标量类型解码小端序数据（本项目只在小端序平台上运行）
+【参数】const char* pData, 表示数据的起点
+       ScalarType Type, 表示标量类型
+【返回值】double，数值
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+double PLYFormat::Decode(const char* pData, ScalarType Type) {
+    switch (Type) {
+        case ScalarType::INT8: {
+            int8_t Value;
+            memcpy(&Value, pData, sizeof(Value));
+            return Value;
+        }
+        case ScalarType::UINT8: {
+            uint8_t Value;
+            memcpy(&Value, pData, sizeof(Value));
+            return Value;
+        }
+        case ScalarType::INT16: {
+            int16_t Value;
+            memcpy(&Value, pData, sizeof(Value));
+            return Value;
+        }
+        case ScalarType::UINT16: {
+            uint16_t Value;
+            memcpy(&Value, pData, sizeof(Value));
+            return Value;
+        }
+        case ScalarType::INT32: {
+            int32_t Value;
+            memcpy(&Value, pData, sizeof(Value));
+            return Value;
+        }
+        case ScalarType::UINT32: {
+            uint32_t Value;
+            memcpy(&Value, pData, sizeof(Value));
+            return Value;
+        }
+        case ScalarType::FLOAT32: {
+            float Value;
+            memcpy(&Value, pData, sizeof(Value));
+            return Value;
+        }
+        default: {
+            double Value;
+            memcpy(&Value, pData, sizeof(Value));
+            return Value;
+        }
+    }
+}
@@ -0,0 +1,140 @@
+/*************************************************************************
+【文件名】PLYFormat.hpp
+【功能模块和目的】定义PLYFormat类，描述PLY模型格式的文件头和数据的基本读写
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+#ifndef PLYFORMAT_HPP
+#define PLYFORMAT_HPP
+
+// istream, ostream所属头文件
+#include <iostream>
+// string所属头文件
+#include <string>
+// vector所属头文件
+#include <vector>
+// uint64_t所属头文件
+#include <cstdint>
+// size_t所属头文件
+#include <cstddef>
+
+using namespace std;
+
+/*************************************************************************
+【类名】PLYFormat
+【功能】PLY模型格式。文件以文本文件头开始，依次声明各元素（名称、数量）
+       及其属性（标量或列表），以end_header行结束；之后按声明顺序
+       存放各元素的全部记录，数据为文本或小端序二进制。
+       本项目使用vertex元素的x、y、z属性，face元素的vertex_indices
+       （或vertex_index）列表属性，edge元素的vertex1、vertex2属性，
+       其余元素和属性读取时跳过。二进制数据经BlockReader按块读取，
+       定长记录的整块数据一次取出
+【接口说明】
+    内嵌枚举：数据编码、标量类型
+    内嵌类：属性、元素、文件头、按块读取器
+    静态：读取、写入文件头
+    静态：标量类型的字节数、名称
+    静态：按标量类型解码小端序数据
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+class PLYFormat {
+public:
+    //-------------------------------------------------------------------------
+    // 内嵌枚举
+    //-------------------------------------------------------------------------
+    // 数据编码
+    enum class Encoding {
+        ASCII,
+        BINARY_LITTLE_ENDIAN
+    };
+    // 标量类型
+    enum class ScalarType {
+        INT8,
+        UINT8,
+        INT16,
+        UINT16,
+        INT32,
+        UINT32,
+        FLOAT32,
+        FLOAT64
+    };
+    //-------------------------------------------------------------------------
+    // 内嵌类
+    //-------------------------------------------------------------------------
+    // 属性
+    struct Property {
+        // 名称
+        string Name{};
+        // 标量属性的类型，或列表属性的元素类型
+        ScalarType Type{ScalarType::FLOAT32};
+        // 是否为列表属性
+        bool bList{false};
+        // 列表属性的长度的类型
+        ScalarType CountType{ScalarType::UINT8};
+    };
+    // 元素
+    struct Element {
+        // 名称
+        string Name{};
+        // 记录数
+        uint64_t Count{0};
+        // 属性
+        vector<Property> Properties{};
+    };
+    // 文件头
+    struct Header {
+        // 数据编码
+        Encoding Format{Encoding::BINARY_LITTLE_ENDIAN};
+        // comment行
+        vector<string> Comments{};
+        // obj_info行
+        vector<string> ObjectInfo{};
+        // 元素，按数据的存放顺序
+        vector<Element> Elements{};
+    };
+    // 按块读取器：缓冲区中的数据不足时从流补足，返回连续的指针
+    class BlockReader {
+    public:
+        // 带参构造函数
+        explicit BlockReader(istream& Stream);
+        // 禁止拷贝构造函数
+        BlockReader(const BlockReader& Source) = delete;
+        // 禁止赋值运算符
+        BlockReader& operator=(const BlockReader& Source) = delete;
+        // 虚析构函数
+        virtual ~BlockReader() = default;
+        // 取出Bytes字节，数据不足时返回nullptr
+        const char* Take(size_t Bytes);
+
+    private:
+        // 输入流
+        istream& m_Stream;
+        // 缓冲区
+        vector<char> m_Buffer{};
+        // 缓冲区中未取出数据的起点
+        size_t m_Begin{0};
+        // 缓冲区中数据的终点
+        size_t m_End{0};
+    };
+    //-------------------------------------------------------------------------
+    // 静态常量
+    //-------------------------------------------------------------------------
+    // BlockReader每次从流读取的最少字节数
+    static constexpr size_t READ_CHUNK{size_t(1) << 20};
+    //-------------------------------------------------------------------------
+    // 静态成员函数
+    //-------------------------------------------------------------------------
+    // 读取文件头，格式错误时返回false
+    static bool ReadHeader(istream& Stream, Header& AHeader);
+    // 写入文件头
+    static void WriteHeader(ostream& Stream, const Header& AHeader);
+    // 获取标量类型的字节数
+    static size_t SizeOf(ScalarType Type);
+    // 获取标量类型在文件头中的名称
+    static const char* NameOf(ScalarType Type);
+    // 按标量类型解码小端序数据
+    static double Decode(const char* pData, ScalarType Type);
+};
+
+#endif /* PLYFormat.hpp */
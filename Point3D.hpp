@@ -2,7 +2,7 @@
 【文件名】Point3D.hpp
 【功能模块和目的】定义Point3D类，继承自Vector3D类，表示三维空间中的点
 【开发者及日期】谭雯心 2024/8/5
-【更改记录】
+【更改记录】2026/10/19 谭雯心 特化MemoryCategoryOf，点的存储计入顶点类别
 *************************************************************************/
 #ifndef POINT3D_HPP
 #define POINT3D_HPP
@@ -13,6 +13,8 @@
 #include <cstddef>
 // pow所属头文件
 #include <cmath>
+// MemoryCategoryOf所属头文件
+#include "CountingAllocator.hpp"
 
 using namespace std;
 
@@ -109,4 +111,16 @@ public:
     Vector3D<double> CrossProduct(const Point3D& APoint) const = delete;
 };
 
+/*************************************************************************
+【类名】MemoryCategoryOf<Point3D>
+【功能】Point3D的内存类别为顶点存储
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+template <>
+struct MemoryCategoryOf<Point3D> {
+    static constexpr MemoryAccounting::Category VALUE{
+        MemoryAccounting::Category::VERTICES};
+};
+
 #endif /* Point3D.hpp */
\ No newline at end of file
@@ -2,11 +2,18 @@
 【文件名】Porter.cpp
 【功能模块和目的】定义Porter类，定义文件操作的基本功能
 【开发者及日期】谭雯心 2024/8/7
-【更改记录】
+【更改记录】2026/10/19 谭雯心 增加了以大缓冲区一次打开文件
+           2026/10/19 谭雯心 增加了经临时文件的原子保存
+           2026/10/19 谭雯心 增加了透明的gzip压缩读写
+           2026/10/19 谭雯心 增加了把文件同步到磁盘
 *************************************************************************/
 
 // Porter类头文件
 #include "Porter.hpp"
+// GzipFormat所属头文件
+#include "GzipFormat.hpp"
+// GzipStreamBuf所属头文件
+#include "GzipStreamBuf.hpp"
 // ifstream, ofstream所属头文件
 #include <fstream>
 // invalid_argument所属头文件
@@ -15,9 +22,110 @@
 #include <string>
 // sstream所属头文件
 #include <sstream>
+// vector所属头文件
+#include <vector>
+// unique_ptr所属头文件
+#include <memory>
+// strlen所属头文件
+#include <cstring>
+// rename、remove所属头文件
+#include <cstdio>
+// atomic所属头文件
+#include <atomic>
+#ifdef _WIN32
+// _open、_commit、_close所属头文件
+#include <io.h>
+// _O_WRONLY、_O_BINARY所属头文件
+#include <fcntl.h>
+// _getpid所属头文件
+#include <process.h>
+// MoveFileExA所属头文件
+#include <windows.h>
+#else
+// open、O_WRONLY、O_DIRECTORY所属头文件
+#include <fcntl.h>
+// fsync、close、getpid所属头文件
+#include <unistd.h>
+#endif
 
 using namespace std;
 
+namespace {
+    // 本进程已生成的临时文件数，用于区分并发保存的临时文件
+    atomic<unsigned long> TempCounter{0};
+
+    /*************************************************************************
+    【函数名称】SyncFile
+    【函数功能】把已关闭文件的内容同步到磁盘。ofstream不提供所用的文件
+           描述符，保存接口又都以ofstream传递输出流，因此关闭后按文件名
+           重新打开再同步；fsync、_commit作用于文件而非某个描述符，经新
+           描述符同步的就是流写入的数据。临时文件名在进程内唯一，关闭与
+           重新打开之间不会被他人替换
+    【参数】const string& FileName，文件名
+    【返回值】bool，是否同步成功
+    【开发者及日期】谭雯心 2026/10/19
+    【更改记录】2026/10/19 谭雯心 说明了须重新打开文件的原因
+    *************************************************************************/
+    bool SyncFile(const string& FileName) {
+#ifdef _WIN32
+        int Handle = _open(FileName.c_str(), _O_WRONLY | _O_BINARY);
+        if (Handle < 0) {
+            return false;
+        }
+        bool bSynced = _commit(Handle) == 0;
+        _close(Handle);
+#else
+        int Handle = open(FileName.c_str(), O_WRONLY);
+        if (Handle < 0) {
+            return false;
+        }
+        bool bSynced = fsync(Handle) == 0;
+        close(Handle);
+#endif
+        return bSynced;
+    }
+
+    /*************************************************************************
+    【函数名称】ReplaceFile
+    【函数功能】用TempName原子地替换FileName，替换后同步所在目录，
+           使改名本身在断电后也不丢失；目录同步失败（部分文件系统
+           不支持）不影响结果
+    【参数】const string& TempName，临时文件名
+           const string& FileName，目标文件名
+    【返回值】bool，是否替换成功
+    【开发者及日期】谭雯心 2026/10/19
+    【更改记录】
+    *************************************************************************/
+    bool ReplaceFile(const string& TempName, const string& FileName) {
+#ifdef _WIN32
+        return MoveFileExA(TempName.c_str(), FileName.c_str(),
+            MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH) != 0;
+#else
+        if (rename(TempName.c_str(), FileName.c_str()) != 0) {
+            return false;
+        }
+        size_t Slash = FileName.find_last_of('/');
+        string Directory = Slash == string::npos ? string(".")
+            : Slash == 0 ? string("/") : FileName.substr(0, Slash);
+        int Handle = open(Directory.c_str(), O_RDONLY | O_DIRECTORY);
+        if (Handle >= 0) {
+            fsync(Handle);
+            close(Handle);
+        }
+        return true;
+#endif
+    }
+}
+
+//-------------------------------------------------------------------------
+// 静态常量
+//-------------------------------------------------------------------------
+
+// 打开文件时使用的缓冲区字节数
+constexpr size_t Porter::IO_BUFFER_SIZE;
+// 压缩文件名的后缀
+constexpr const char* Porter::COMPRESSED_SUFFIX;
+
 //-------------------------------------------------------------------------
 // 受保护的内嵌异常类
 //-------------------------------------------------------------------------
@@ -153,20 +261,191 @@ void Porter::FileClosed(const string& FileName) {
 }
 /*************************************************************************
 【函数名称】GetExtension
-【函数功能】获取文件扩展名
+【函数功能】获取文件扩展名，压缩文件（如model.obj.gz）取去掉".gz"后的
+       扩展名，使导入器和导出器按压缩前的格式选择
 【参数】const string& FileName，文件名
 【返回值】无
 【开发者及日期】谭雯心 2024/8/7
-【更改记录】
+【更改记录】2026/10/19 谭雯心 压缩文件取去掉".gz"后的扩展名
 *************************************************************************/
 string Porter::GetExtension(const string& FileName) {
     string result;
-    size_t Pos = FileName.find_last_of('.');
+    size_t End = IsCompressedName(FileName)
+        ? FileName.size() - strlen(COMPRESSED_SUFFIX) : FileName.size();
+    size_t Pos = End == 0 ? string::npos : FileName.find_last_of('.', End - 1);
     // 若文件名中不包含'.'，则抛出异常
     if (Pos == string::npos) {
         throw FILE_NOT_SUPPORTED(FileName);
     }
     // 获取文件扩展名
-    result = FileName.substr(Pos + 1);
+    result = FileName.substr(Pos + 1, End - Pos - 1);
     return result;
-}
\ No newline at end of file
+}
+/*************************************************************************
+【函数名称】IsCompressedName
+【函数功能】文件名是否以".gz"结尾，保存时据此决定是否压缩
+【参数】const string& FileName，文件名
+【返回值】bool，是否为压缩文件名
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+bool Porter::IsCompressedName(const string& FileName) {
+    size_t Length = strlen(COMPRESSED_SUFFIX);
+    return FileName.size() > Length && FileName.compare(
+        FileName.size() - Length, Length, COMPRESSED_SUFFIX) == 0;
+}
+/*************************************************************************
+【函数名称】OpenInput
+【函数功能】以Buffer为缓冲区按二进制方式打开输入文件。打开即验证文件
+       可读，不再另行打开测试；缓冲区须在打开前设置才对filebuf生效，
+       较大的缓冲区减少网络文件系统上的读请求次数
+【参数】const string& FileName，文件名
+       ifstream& Stream，未打开的输入流
+       vector<char>& Buffer，缓冲区，须在Stream之后析构
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+void Porter::OpenInput(const string& FileName, ifstream& Stream,
+    vector<char>& Buffer) {
+    Buffer.resize(IO_BUFFER_SIZE);
+    Stream.rdbuf()->pubsetbuf(Buffer.data(),
+        static_cast<streamsize>(Buffer.size()));
+    Stream.open(FileName, ios::binary);
+    if (!Stream.is_open()) {
+        throw FILE_NOT_AVAILABLE(FileName);
+    }
+}
+/*************************************************************************
+【函数名称】OpenOutput
+【函数功能】以Buffer为缓冲区按二进制方式截断打开输出文件，文件不存在时
+       由打开创建，不再另行测试和创建
+【参数】const string& FileName，文件名
+       ofstream& Stream，未打开的输出流
+       vector<char>& Buffer，缓冲区，须在Stream之后析构
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+void Porter::OpenOutput(const string& FileName, ofstream& Stream,
+    vector<char>& Buffer) {
+    Buffer.resize(IO_BUFFER_SIZE);
+    Stream.rdbuf()->pubsetbuf(Buffer.data(),
+        static_cast<streamsize>(Buffer.size()));
+    Stream.open(FileName, ios::trunc | ios::binary);
+    if (!Stream.is_open()) {
+        throw FILE_NOT_AVAILABLE(FileName);
+    }
+}
+/*************************************************************************
+【函数名称】TempFileName
+【函数功能】生成与FileName同目录的临时文件名。临时文件与目标在同一
+       文件系统上，改名才是原子的；文件名含进程号和计数，
+       同时保存同一文件的多个线程、进程互不覆盖
+【参数】const string& FileName，目标文件名
+【返回值】string，临时文件名
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+string Porter::TempFileName(const string& FileName) {
+#ifdef _WIN32
+    long ProcessId = static_cast<long>(_getpid());
+#else
+    long ProcessId = static_cast<long>(getpid());
+#endif
+    ostringstream Name;
+    Name << FileName << ".tmp." << ProcessId << '.' << TempCounter++;
+    return Name.str();
+}
+/*************************************************************************
+【函数名称】CommitOutput
+【函数功能】关闭写入临时文件的流，把内容同步到磁盘（每次保存只同步
+       一次），再原子地替换目标文件。任何一步失败都删除临时文件，
+       目标文件保持保存前的内容，不会出现写了一半的文件
+【参数】ofstream& Stream，写入TempName的流
+       const string& TempName，临时文件名
+       const string& FileName，目标文件名
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】2026/10/19 谭雯心 关闭前先写出接入的压缩流缓冲区中的数据
+*************************************************************************/
+void Porter::CommitOutput(ofstream& Stream, const string& TempName,
+    const string& FileName) {
+    // 接入了压缩的流缓冲区时，先把其中的数据写入文件
+    Stream.flush();
+    Stream.close();
+    // ofstream不提供描述符，关闭后由SyncFile重新打开临时文件同步
+    if (Stream.fail() || !SyncFile(TempName)
+        || !ReplaceFile(TempName, FileName)) {
+        remove(TempName.c_str());
+        throw FILE_NOT_AVAILABLE(FileName);
+    }
+}
+/*************************************************************************
+【函数名称】DiscardOutput
+【函数功能】关闭写入临时文件的流并删除临时文件，用于导出失败或取消
+【参数】ofstream& Stream，写入TempName的流
+       const string& TempName，临时文件名
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+void Porter::DiscardOutput(ofstream& Stream, const string& TempName) {
+    Stream.close();
+    remove(TempName.c_str());
+}
+/*************************************************************************
+【函数名称】SyncToDisk
+【函数功能】把文件已写出的内容同步到磁盘，用于原地修改文件时确定
+       各次写入落盘的先后。仍打开着的流须先flush
+【参数】const string& FileName，文件名
+【返回值】bool，是否同步成功
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+bool Porter::SyncToDisk(const string& FileName) {
+    return SyncFile(FileName);
+}
+/*************************************************************************
+【函数名称】AttachDecompressor
+【函数功能】按内容而非文件名判断：流开头为gzip魔数时，在流当前的流缓冲区
+       之上接入解压的GzipStreamBuf，之后从Stream读到的是解压后的数据；
+       否则流保持不变。判断后流回到开头
+【参数】istream& Stream，位于开头的输入流
+【返回值】unique_ptr<streambuf>，接入的流缓冲区，未压缩时为空
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+unique_ptr<streambuf> Porter::AttachDecompressor(istream& Stream) {
+    streambuf* pSource = Stream.rdbuf();
+    char Magic[3] = {0};
+    streamsize Count = pSource->sgetn(Magic, 3);
+    pSource->pubseekpos(0, ios::in);
+    if (!GzipFormat::IsGzip(Magic, static_cast<size_t>(Count))) {
+        return nullptr;
+    }
+    unique_ptr<streambuf> pFilter(
+        new GzipStreamBuf(*pSource, GzipStreamBuf::Mode::DECOMPRESS));
+    Stream.rdbuf(pFilter.get());
+    return pFilter;
+}
+/*************************************************************************
+【函数名称】AttachCompressor
+【函数功能】FileName以".gz"结尾时，在流当前的流缓冲区之上接入压缩的
+       GzipStreamBuf，之后写入Stream的数据压缩后写入文件；否则流保持不变
+【参数】const string& FileName，目标文件名
+       ostream& Stream，输出流
+【返回值】unique_ptr<streambuf>，接入的流缓冲区，不压缩时为空
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+unique_ptr<streambuf> Porter::AttachCompressor(const string& FileName,
+    ostream& Stream) {
+    if (!IsCompressedName(FileName)) {
+        return nullptr;
+    }
+    unique_ptr<streambuf> pFilter(
+        new GzipStreamBuf(*Stream.rdbuf(), GzipStreamBuf::Mode::COMPRESS));
+    Stream.rdbuf(pFilter.get());
+    return pFilter;
+}
@@ -2,17 +2,31 @@
 【文件名】Porter.hpp
 【功能模块和目的】定义Porter类，声明文件操作的基本功能
 【开发者及日期】谭雯心 2024/8/7
-【更改记录】
+【更改记录】2026/10/19 谭雯心 FileValid改为虚函数，导入器可按文件内容识别
+           2026/10/19 谭雯心 增加了以大缓冲区一次打开文件
+           2026/10/19 谭雯心 增加了经临时文件的原子保存
+           2026/10/19 谭雯心 增加了透明的gzip压缩读写
+           2026/10/19 谭雯心 增加了把文件同步到磁盘，供原地修改使用
 *************************************************************************/
 #ifndef PORTER_HPP
 #define PORTER_HPP
 
 // fstream所属头文件
 #include <fstream>
+// istream、ostream所属头文件
+#include <iostream>
+// streambuf所属头文件
+#include <streambuf>
+// unique_ptr所属头文件
+#include <memory>
 // invalid_argument所属头文件
 #include <stdexcept>
 // string所属头文件
 #include <string>
+// vector所属头文件
+#include <vector>
+// size_t所属头文件
+#include <cstddef>
 
 using namespace std;
 
@@ -24,13 +38,21 @@ using namespace std;
     拷贝构造函数
     赋值运算符
     虚析构函数
-    静态：测试文件扩展名是否一致
+    测试文件扩展名是否一致（虚函数）
     静态：测试文件是否存在，若不存在则创建文件
     静态：测试文件是否打开
     静态：测试文件是否关闭
     静态：获取文件扩展名
+    静态：以大缓冲区打开输入、输出文件
+    静态：生成临时文件名，提交或丢弃写入临时文件的输出
+    静态：把文件同步到磁盘
+    静态：测试文件名是否表示压缩文件，为流接入解压、压缩的流缓冲区
 【开发者及日期】谭雯心 2024/8/7
-【更改记录】
+【更改记录】2026/10/19 谭雯心 FileValid改为虚函数，导入器可按文件内容识别
+           2026/10/19 谭雯心 增加了以大缓冲区一次打开文件
+           2026/10/19 谭雯心 增加了经临时文件的原子保存
+           2026/10/19 谭雯心 增加了透明的gzip压缩读写，扩展名忽略".gz"
+           2026/10/19 谭雯心 增加了把文件同步到磁盘
 *************************************************************************/
 class Porter {
 protected:
@@ -74,11 +96,18 @@ protected:
     virtual ~Porter() = default;
 
 public:
+    //-------------------------------------------------------------------------
+    // 静态常量
+    //-------------------------------------------------------------------------
+    // 打开文件时使用的缓冲区字节数
+    static constexpr size_t IO_BUFFER_SIZE{size_t(1) << 20};
+    // 压缩文件名的后缀
+    static constexpr const char* COMPRESSED_SUFFIX{".gz"};
     //-------------------------------------------------------------------------
     // 公有非静态成员函数
     //-------------------------------------------------------------------------
-    // 测试文件扩展名是否一致
-    void FileValid(const string& FileName) const;
+    // 测试文件扩展名是否一致，派生类可放宽为按文件内容识别
+    virtual void FileValid(const string& FileName) const;
     //-------------------------------------------------------------------------
     // 公有静态成员函数
     //-------------------------------------------------------------------------
@@ -88,8 +117,32 @@ public:
     static void FileAvailable(const string& FileName);
     // 测试文件是否关闭
     static void FileClosed(const string& FileName);
-    // 获取文件扩展名
+    // 获取文件扩展名，压缩文件取去掉".gz"后的扩展名
     static string GetExtension(const string& FileName);
+    // 文件名是否以".gz"结尾
+    static bool IsCompressedName(const string& FileName);
+    // 以Buffer为缓冲区按二进制方式打开输入文件，失败时抛出异常
+    static void OpenInput(const string& FileName, ifstream& Stream,
+        vector<char>& Buffer);
+    // 以Buffer为缓冲区按二进制方式截断打开输出文件，失败时抛出异常
+    static void OpenOutput(const string& FileName, ofstream& Stream,
+        vector<char>& Buffer);
+    // 生成与FileName同目录、进程内唯一的临时文件名
+    static string TempFileName(const string& FileName);
+    // 关闭写入TempName的流，同步到磁盘后原子地替换FileName，失败时抛出异常
+    static void CommitOutput(ofstream& Stream, const string& TempName,
+        const string& FileName);
+    // 关闭写入TempName的流并删除临时文件，目标文件保持不变
+    static void DiscardOutput(ofstream& Stream, const string& TempName);
+    // 把文件已写出的内容同步到磁盘，返回是否成功
+    static bool SyncToDisk(const string& FileName);
+    // 流的内容为gzip数据时接入解压的流缓冲区，返回它
+    // 返回的流缓冲区须在Stream之后声明，使它先于Stream析构
+    static unique_ptr<streambuf> AttachDecompressor(istream& Stream);
+    // FileName为压缩文件名时为Stream接入压缩的流缓冲区，返回它
+    // 返回的流缓冲区须在Stream之后声明，使它先于Stream析构
+    static unique_ptr<streambuf> AttachCompressor(const string& FileName,
+        ostream& Stream);
     //-------------------------------------------------------------------------
     // 非静态Getter成员
     //-------------------------------------------------------------------------
@@ -0,0 +1,377 @@
+/*************************************************************************
+【文件名】PorterRegistry.cpp
+【功能模块和目的】定义PorterRegistry类的成员函数
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】2026/10/19 谭雯心 增加了按已打开的流选择导入器
+*************************************************************************/
+// PorterRegistry所属头文件
+#include "PorterRegistry.hpp"
+// Porter所属头文件
+#include "Porter.hpp"
+// Model3D_OBJ_Importer所属头文件
+#include "Model3D_OBJ_Importer.hpp"
+// Model3D_OBJ_Exporter所属头文件
+#include "Model3D_OBJ_Exporter.hpp"
+// Model3D_M3B_Importer所属头文件
+#include "Model3D_M3B_Importer.hpp"
+// Model3D_M3B_Exporter所属头文件
+#include "Model3D_M3B_Exporter.hpp"
+// Model3D_STL_Importer所属头文件
+#include "Model3D_STL_Importer.hpp"
+// Model3D_STL_Exporter所属头文件
+#include "Model3D_STL_Exporter.hpp"
+// Model3D_PLY_Importer所属头文件
+#include "Model3D_PLY_Importer.hpp"
+// Model3D_PLY_Exporter所属头文件
+#include "Model3D_PLY_Exporter.hpp"
+// OBJStreamWriter所属头文件
+#include "OBJStreamWriter.hpp"
+// M3BStreamWriter所属头文件
+#include "M3BStreamWriter.hpp"
+// ostream所属头文件
+#include <iostream>
+// shared_ptr、unique_ptr所属头文件
+#include <memory>
+// mutex、lock_guard所属头文件
+#include <mutex>
+// string所属头文件
+#include <string>
+// vector所属头文件
+#include <vector>
+// uint64_t所属头文件
+#include <cstdint>
+
+using namespace std;
+
+//-------------------------------------------------------------------------
+// 静态常量
+//-------------------------------------------------------------------------
+
+// OBJ文本格式的读取速度等级
+constexpr unsigned PorterRegistry::SPEED_OBJ;
+// STL格式的读取速度等级
+constexpr unsigned PorterRegistry::SPEED_STL;
+// PLY格式的读取速度等级
+constexpr unsigned PorterRegistry::SPEED_PLY;
+// M3B二进制格式的读取速度等级
+constexpr unsigned PorterRegistry::SPEED_M3B;
+
+//-------------------------------------------------------------------------
+// 私有静态成员
+//-------------------------------------------------------------------------
+
+// m_pInstance初始化为nullptr
+shared_ptr<PorterRegistry> PorterRegistry::m_pInstance = nullptr;
+// m_InstanceFlag保证m_pInstance只创建一次
+once_flag PorterRegistry::m_InstanceFlag;
+
+//-------------------------------------------------------------------------
+// 私有构造函数
+//-------------------------------------------------------------------------
+
+/*************************************************************************
+【函数名称】PorterRegistry
+【函数功能】默认构造函数，登记内置的OBJ、M3B、STL、PLY导入器和导出器，
+       以及OBJ、M3B流式写出器
+【参数】无
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+PorterRegistry::PorterRegistry() {
+    RegisterImporter(make_shared<const Model3D_OBJ_Importer>(), SPEED_OBJ);
+    RegisterImporter(make_shared<const Model3D_M3B_Importer>(), SPEED_M3B);
+    RegisterImporter(make_shared<const Model3D_STL_Importer>(), SPEED_STL);
+    RegisterImporter(make_shared<const Model3D_PLY_Importer>(), SPEED_PLY);
+    RegisterExporter(make_shared<const Model3D_OBJ_Exporter>());
+    RegisterExporter(make_shared<const Model3D_M3B_Exporter>());
+    RegisterExporter(make_shared<const Model3D_STL_Exporter>());
+    RegisterExporter(make_shared<const Model3D_PLY_Exporter>());
+    RegisterStreamWriter("obj", [](ostream& Stream) {
+        return unique_ptr<ModelStreamStage>(new OBJStreamWriter(Stream));
+    });
+    RegisterStreamWriter("m3b", [](ostream& Stream) {
+        return unique_ptr<ModelStreamStage>(new M3BStreamWriter(Stream));
+    });
+}
+
+//-------------------------------------------------------------------------
+// 静态成员函数
+//-------------------------------------------------------------------------
+
+/*************************************************************************
+【函数名称】GetInstance
+【函数功能】获取唯一实例，第一次调用时登记内置格式
+【参数】无
+【返回值】shared_ptr<PorterRegistry>，唯一实例
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+shared_ptr<PorterRegistry> PorterRegistry::GetInstance() {
+    call_once(m_InstanceFlag, []() {
+        m_pInstance = shared_ptr<PorterRegistry>(new PorterRegistry());
+    });
+    return m_pInstance;
+}
+
+//-------------------------------------------------------------------------
+// 非静态Setter成员函数
+//-------------------------------------------------------------------------
+
+/*************************************************************************
+【函数名称】RegisterImporter
+【函数功能】登记导入器。同一格式可登记多个导入器，选择时取等级最高的
+【参数】const shared_ptr<const Model3D_Importer>& pImporter, 表示导入器
+       unsigned Speed, 表示读取速度等级，越大越快
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+void PorterRegistry::RegisterImporter(
+    const shared_ptr<const Model3D_Importer>& pImporter, unsigned Speed) {
+    if (pImporter == nullptr) {
+        return;
+    }
+    lock_guard<mutex> Lock(m_Mutex);
+    m_Importers.push_back({pImporter, Speed});
+}
+/*************************************************************************
+【函数名称】RegisterExporter
+【函数功能】登记导出器，替换同一扩展名的导出器
+【参数】const shared_ptr<const Model3D_Exporter>& pExporter, 表示导出器
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+void PorterRegistry::RegisterExporter(
+    const shared_ptr<const Model3D_Exporter>& pExporter) {
+    if (pExporter == nullptr) {
+        return;
+    }
+    lock_guard<mutex> Lock(m_Mutex);
+    for (auto& pRegistered : m_Exporters) {
+        if (pRegistered->Extension == pExporter->Extension) {
+            pRegistered = pExporter;
+            return;
+        }
+    }
+    m_Exporters.push_back(pExporter);
+}
+/*************************************************************************
+【函数名称】RegisterStreamWriter
+【函数功能】登记流式写出器的创建函数，替换同一扩展名的流式写出器
+【参数】const string& Extension, 表示扩展名（不含'.'）
+       const function<unique_ptr<ModelStreamStage>(ostream&)>& Create,
+       表示创建函数
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+void PorterRegistry::RegisterStreamWriter(const string& Extension,
+    const function<unique_ptr<ModelStreamStage>(ostream&)>& Create) {
+    lock_guard<mutex> Lock(m_Mutex);
+    for (auto& Entry : m_Writers) {
+        if (Entry.Extension == Extension) {
+            Entry.Create = Create;
+            return;
+        }
+    }
+    m_Writers.push_back({Extension, Create});
+}
+
+//-------------------------------------------------------------------------
+// 非静态Getter成员函数
+//-------------------------------------------------------------------------
+
+/*************************************************************************
+【函数名称】FindImporter
+【函数功能】选择能读取文件的最快导入器：文件存在时读取其开头，在能按内容
+       识别的导入器中取等级最高的；都不能识别或文件不存在时，在扩展名
+       一致的导入器中取等级最高的
+【参数】const string& FileName, 表示文件名
+【返回值】shared_ptr<const Model3D_Importer>，导入器，没有时为nullptr
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+shared_ptr<const Model3D_Importer> PorterRegistry::FindImporter(
+    const string& FileName) const {
+    string Head;
+    uint64_t FileSize = 0;
+    bool bHead = Model3D_Importer::ReadHead(FileName, Head, FileSize);
+    return SelectImporter(ExtensionOf(FileName), bHead, Head, FileSize);
+}
+/*************************************************************************
+【函数名称】FindImporter
+【函数功能】按已打开的流的开头选择能读取文件的最快导入器，选择后流回到
+       开头，调用者可直接用同一个流导入而不必再次打开文件
+【参数】const string& FileName, 表示文件名，用于取扩展名
+       istream& Stream, 表示位于开头的输入流
+【返回值】shared_ptr<const Model3D_Importer>，导入器，没有时为nullptr
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+shared_ptr<const Model3D_Importer> PorterRegistry::FindImporter(
+    const string& FileName, istream& Stream) const {
+    string Head;
+    uint64_t FileSize = 0;
+    bool bHead = Model3D_Importer::ReadHead(Stream, Head, FileSize);
+    return SelectImporter(ExtensionOf(FileName), bHead, Head, FileSize);
+}
+/*************************************************************************
+【函数名称】FindExporter
+【函数功能】按扩展名选择导出器
+【参数】const string& FileName, 表示文件名
+【返回值】shared_ptr<const Model3D_Exporter>，导出器，没有时为nullptr
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+shared_ptr<const Model3D_Exporter> PorterRegistry::FindExporter(
+    const string& FileName) const {
+    string Extension = ExtensionOf(FileName);
+    lock_guard<mutex> Lock(m_Mutex);
+    for (const auto& pExporter : m_Exporters) {
+        if (pExporter->Extension == Extension) {
+            return pExporter;
+        }
+    }
+    return nullptr;
+}
+/*************************************************************************
+【函数名称】CreateStreamWriter
+【函数功能】按扩展名创建写入Stream的流式写出器
+【参数】const string& FileName, 表示文件名
+       ostream& Stream, 表示输出流，须在写出器之后析构
+【返回值】unique_ptr<ModelStreamStage>，流式写出器，没有时为nullptr
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+unique_ptr<ModelStreamStage> PorterRegistry::CreateStreamWriter(
+    const string& FileName, ostream& Stream) const {
+    string Extension = ExtensionOf(FileName);
+    function<unique_ptr<ModelStreamStage>(ostream&)> Create;
+    {
+        lock_guard<mutex> Lock(m_Mutex);
+        for (const WriterEntry& Entry : m_Writers) {
+            if (Entry.Extension == Extension) {
+                Create = Entry.Create;
+                break;
+            }
+        }
+    }
+    return Create ? Create(Stream) : nullptr;
+}
+/*************************************************************************
+【函数名称】CanStreamWrite
+【函数功能】是否有扩展名对应的流式写出器
+【参数】const string& FileName, 表示文件名
+【返回值】bool，是否有对应的流式写出器
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+bool PorterRegistry::CanStreamWrite(const string& FileName) const {
+    string Extension = ExtensionOf(FileName);
+    lock_guard<mutex> Lock(m_Mutex);
+    for (const WriterEntry& Entry : m_Writers) {
+        if (Entry.Extension == Extension) {
+            return true;
+        }
+    }
+    return false;
+}
+/*************************************************************************
+【函数名称】GetImportExtensions
+【函数功能】获取全部可导入的扩展名，按登记顺序，不重复
+【参数】无
+【返回值】vector<string>，扩展名（不含'.'）
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+vector<string> PorterRegistry::GetImportExtensions() const {
+    lock_guard<mutex> Lock(m_Mutex);
+    vector<string> Extensions;
+    for (const ImporterEntry& Entry : m_Importers) {
+        bool bFound = false;
+        for (const string& Extension : Extensions) {
+            bFound = bFound || Extension == Entry.pImporter->Extension;
+        }
+        if (!bFound) {
+            Extensions.push_back(Entry.pImporter->Extension);
+        }
+    }
+    return Extensions;
+}
+/*************************************************************************
+【函数名称】GetExportExtensions
+【函数功能】获取全部可导出的扩展名，按登记顺序
+【参数】无
+【返回值】vector<string>，扩展名（不含'.'）
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+vector<string> PorterRegistry::GetExportExtensions() const {
+    lock_guard<mutex> Lock(m_Mutex);
+    vector<string> Extensions;
+    for (const auto& pExporter : m_Exporters) {
+        Extensions.push_back(pExporter->Extension);
+    }
+    return Extensions;
+}
+
+//-------------------------------------------------------------------------
+// 私有静态成员函数
+//-------------------------------------------------------------------------
+
+/*************************************************************************
+【函数名称】ExtensionOf
+【函数功能】获取文件扩展名，没有扩展名时返回空字符串
+【参数】const string& FileName, 表示文件名
+【返回值】string，扩展名（不含'.'）
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+string PorterRegistry::ExtensionOf(const string& FileName) {
+    try {
+        return Porter::GetExtension(FileName);
+    }
+    catch (...) {
+        return string();
+    }
+}
+
+//-------------------------------------------------------------------------
+// 私有非静态成员函数
+//-------------------------------------------------------------------------
+
+/*************************************************************************
+【函数名称】SelectImporter
+【函数功能】在能按内容识别文件开头的导入器中取等级最高的；都不能识别或
+       没有文件开头时，在扩展名一致的导入器中取等级最高的
+【参数】const string& Extension, 表示扩展名
+       bool bHead, 表示是否读到了文件开头
+       const string& Head, 表示文件开头
+       uint64_t FileSize, 表示文件长度
+【返回值】shared_ptr<const Model3D_Importer>，导入器，没有时为nullptr
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+shared_ptr<const Model3D_Importer> PorterRegistry::SelectImporter(
+    const string& Extension, bool bHead, const string& Head,
+    uint64_t FileSize) const {
+    lock_guard<mutex> Lock(m_Mutex);
+    const ImporterEntry* pByContent = nullptr;
+    const ImporterEntry* pByExtension = nullptr;
+    for (const ImporterEntry& Entry : m_Importers) {
+        if (bHead && Entry.pImporter->Recognize(Head, FileSize)
+            && (pByContent == nullptr || Entry.Speed > pByContent->Speed)) {
+            pByContent = &Entry;
+        }
+        if (Entry.pImporter->Extension == Extension
+            && (pByExtension == nullptr || Entry.Speed > pByExtension->Speed)) {
+            pByExtension = &Entry;
+        }
+    }
+    if (pByContent != nullptr) {
+        return pByContent->pImporter;
+    }
+    return pByExtension != nullptr ? pByExtension->pImporter : nullptr;
+}
@@ -0,0 +1,168 @@
+/*************************************************************************
+【文件名】PorterRegistry.hpp
+【功能模块和目的】定义PorterRegistry类，登记全部模型导入器、导出器和
+       流式写出器，按文件内容和扩展名选择
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】2026/10/19 谭雯心 增加了按已打开的流选择导入器
+*************************************************************************/
+#ifndef PORTERREGISTRY_HPP
+#define PORTERREGISTRY_HPP
+
+// Model3D_Importer所属头文件
+#include "Model3D_Importer.hpp"
+// Model3D_Exporter所属头文件
+#include "Model3D_Exporter.hpp"
+// ModelStreamStage所属头文件
+#include "ModelStreamStage.hpp"
+// ostream所属头文件
+#include <iostream>
+// function所属头文件
+#include <functional>
+// shared_ptr、unique_ptr所属头文件
+#include <memory>
+// mutex、once_flag所属头文件
+#include <mutex>
+// string所属头文件
+#include <string>
+// vector所属头文件
+#include <vector>
+// uint64_t所属头文件
+#include <cstdint>
+
+using namespace std;
+
+/*************************************************************************
+【类名】PorterRegistry
+【功能】模型文件格式的登记表，单例。导入器连同读取速度的等级登记，
+       选择时先读取文件开头，在能按内容（魔数等）识别该文件的导入器中
+       取等级最高的；都不能识别时，在扩展名一致的导入器中取等级最高的。
+       导出器和流式写出器按扩展名选择，同一扩展名后登记的替换先登记的。
+       内置OBJ、M3B、STL、PLY格式；新格式登记后即可被Controller等使用，
+       无需修改调用者。导入器和导出器的成员函数均为const且无状态，
+       登记表保存唯一实例供多线程共用
+【接口说明】
+    静态常量：内置格式的读取速度等级
+    禁止拷贝构造和赋值
+    虚析构函数
+    获取唯一实例
+    登记导入器、导出器、流式写出器
+    按文件或已打开的流选择导入器，按扩展名选择导出器、创建流式写出器
+    获取全部可导入、可导出的扩展名
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】2026/10/19 谭雯心 增加了按已打开的流选择导入器
+*************************************************************************/
+class PorterRegistry {
+public:
+    //-------------------------------------------------------------------------
+    // 静态常量
+    //-------------------------------------------------------------------------
+    // OBJ文本格式的读取速度等级
+    static constexpr unsigned SPEED_OBJ{10};
+    // STL格式的读取速度等级
+    static constexpr unsigned SPEED_STL{20};
+    // PLY格式的读取速度等级
+    static constexpr unsigned SPEED_PLY{30};
+    // M3B二进制格式的读取速度等级
+    static constexpr unsigned SPEED_M3B{40};
+    //-------------------------------------------------------------------------
+    // 必要的构造、析构、拷贝、赋值运算符重载函数
+    //-------------------------------------------------------------------------
+    // 禁止拷贝构造
+    PorterRegistry(const PorterRegistry& Source) = delete;
+    // 禁止赋值
+    PorterRegistry& operator=(const PorterRegistry& Source) = delete;
+    // 虚析构函数
+    virtual ~PorterRegistry() = default;
+    //-------------------------------------------------------------------------
+    // 静态成员函数
+    //-------------------------------------------------------------------------
+    // 获取唯一实例，第一次调用时登记内置格式
+    static shared_ptr<PorterRegistry> GetInstance();
+    //-------------------------------------------------------------------------
+    // 非静态Setter成员函数
+    //-------------------------------------------------------------------------
+    // 登记导入器，Speed越大表示读取越快
+    void RegisterImporter(
+        const shared_ptr<const Model3D_Importer>& pImporter, unsigned Speed);
+    // 登记导出器，替换同一扩展名的导出器
+    void RegisterExporter(const shared_ptr<const Model3D_Exporter>& pExporter);
+    // 登记扩展名为Extension（不含'.'）的流式写出器的创建函数
+    void RegisterStreamWriter(const string& Extension,
+        const function<unique_ptr<ModelStreamStage>(ostream&)>& Create);
+    //-------------------------------------------------------------------------
+    // 非静态Getter成员函数
+    //-------------------------------------------------------------------------
+    // 选择能读取文件的最快导入器，没有时返回nullptr
+    shared_ptr<const Model3D_Importer> FindImporter(
+        const string& FileName) const;
+    // 按已打开的流的开头选择最快导入器，选择后流回到开头
+    shared_ptr<const Model3D_Importer> FindImporter(
+        const string& FileName, istream& Stream) const;
+    // 按扩展名选择导出器，没有时返回nullptr
+    shared_ptr<const Model3D_Exporter> FindExporter(
+        const string& FileName) const;
+    // 按扩展名创建写入Stream的流式写出器，没有时返回nullptr
+    unique_ptr<ModelStreamStage> CreateStreamWriter(
+        const string& FileName, ostream& Stream) const;
+    // 是否有扩展名对应的流式写出器
+    bool CanStreamWrite(const string& FileName) const;
+    // 获取全部可导入的扩展名
+    vector<string> GetImportExtensions() const;
+    // 获取全部可导出的扩展名
+    vector<string> GetExportExtensions() const;
+
+private:
+    //-------------------------------------------------------------------------
+    // 私有的内嵌类
+    //-------------------------------------------------------------------------
+    // 登记的导入器
+    struct ImporterEntry {
+        // 导入器
+        shared_ptr<const Model3D_Importer> pImporter;
+        // 读取速度等级
+        unsigned Speed;
+    };
+    // 登记的流式写出器
+    struct WriterEntry {
+        // 扩展名
+        string Extension;
+        // 创建函数
+        function<unique_ptr<ModelStreamStage>(ostream&)> Create;
+    };
+    //-------------------------------------------------------------------------
+    // 私有构造函数
+    //-------------------------------------------------------------------------
+    // 默认构造函数，登记内置格式
+    PorterRegistry();
+    //-------------------------------------------------------------------------
+    // 私有静态成员函数
+    //-------------------------------------------------------------------------
+    // 获取文件扩展名，没有扩展名时返回空字符串
+    static string ExtensionOf(const string& FileName);
+    //-------------------------------------------------------------------------
+    // 私有非静态成员函数
+    //-------------------------------------------------------------------------
+    // 按文件开头（bHead为false时没有）和扩展名选择最快导入器
+    shared_ptr<const Model3D_Importer> SelectImporter(const string& Extension,
+        bool bHead, const string& Head, uint64_t FileSize) const;
+    //-------------------------------------------------------------------------
+    // 私有静态成员
+    //-------------------------------------------------------------------------
+    // 唯一实例
+    static shared_ptr<PorterRegistry> m_pInstance;
+    // 保证唯一实例只创建一次
+    static once_flag m_InstanceFlag;
+    //-------------------------------------------------------------------------
+    // 私有非静态成员
+    //-------------------------------------------------------------------------
+    // 保护以下登记表
+    mutable mutex m_Mutex{};
+    // 导入器
+    vector<ImporterEntry> m_Importers{};
+    // 导出器
+    vector<shared_ptr<const Model3D_Exporter>> m_Exporters{};
+    // 流式写出器
+    vector<WriterEntry> m_Writers{};
+};
+
+#endif /* PorterRegistry.hpp */
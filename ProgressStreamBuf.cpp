@@ -0,0 +1,140 @@
+/*************************************************************************
+【文件名】ProgressStreamBuf.cpp
+【功能模块和目的】定义ProgressStreamBuf类的成员函数
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+// ProgressStreamBuf所属头文件
+#include "ProgressStreamBuf.hpp"
+// IOTask所属头文件
+#include "IOTask.hpp"
+// streambuf所属头文件
+#include <streambuf>
+// size_t所属头文件
+#include <cstddef>
+
+using namespace std;
+
+//-------------------------------------------------------------------------
+// 静态常量
+//-------------------------------------------------------------------------
+
+// 缓冲区大小
+constexpr size_t ProgressStreamBuf::BUFFER_SIZE;
+
+//-------------------------------------------------------------------------
+// 必要的构造、析构、拷贝、赋值运算符重载函数
+//-------------------------------------------------------------------------
+
+/*************************************************************************
+【函数名称】ProgressStreamBuf
+【函数功能】带参构造函数，缓冲区在第一次读或写时分配
+【参数】streambuf& Target, 表示被包装的流缓冲区
+       IOTask& Task, 表示记录进度的任务
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+ProgressStreamBuf::ProgressStreamBuf(streambuf& Target, IOTask& Task)
+    : m_Target(Target), m_Task(Task) {
+}
+/*************************************************************************
+【函数名称】~ProgressStreamBuf
+【函数功能】析构函数，写出写缓冲区中剩余的数据
+【参数】无
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+ProgressStreamBuf::~ProgressStreamBuf() {
+    FlushOutput();
+}
+
+//-------------------------------------------------------------------------
+// 受保护的成员函数
+//-------------------------------------------------------------------------
+
+/*************************************************************************
+【函数名称】underflow
+【函数功能】读缓冲区为空时从被包装的流缓冲区读取至多BUFFER_SIZE字节
+【参数】无
+【返回值】int_type，下一个字符，没有更多数据时返回eof
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+ProgressStreamBuf::int_type ProgressStreamBuf::underflow() {
+    m_Task.ThrowIfCancelled();
+    if (m_Input.empty()) {
+        m_Input.resize(BUFFER_SIZE);
+    }
+    streamsize Count = m_Target.sgetn(m_Input.data(), BUFFER_SIZE);
+    if (Count <= 0) {
+        return traits_type::eof();
+    }
+    setg(m_Input.data(), m_Input.data(), m_Input.data() + Count);
+    m_Task.AddBytes(static_cast<uint64_t>(Count));
+    return traits_type::to_int_type(m_Input[0]);
+}
+/*************************************************************************
+【函数名称】overflow
+【函数功能】写缓冲区已满时写出到被包装的流缓冲区，再放入Char
+【参数】int_type Char, 表示要写入的字符，可为eof
+【返回值】int_type，成功时返回非eof的值，失败时返回eof
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+ProgressStreamBuf::int_type ProgressStreamBuf::overflow(int_type Char) {
+    m_Task.ThrowIfCancelled();
+    if (m_Output.empty()) {
+        m_Output.resize(BUFFER_SIZE);
+    }
+    else if (!FlushOutput()) {
+        return traits_type::eof();
+    }
+    setp(m_Output.data(), m_Output.data() + m_Output.size());
+    if (!traits_type::eq_int_type(Char, traits_type::eof())) {
+        *pptr() = traits_type::to_char_type(Char);
+        pbump(1);
+    }
+    return traits_type::not_eof(Char);
+}
+/*************************************************************************
+【函数名称】sync
+【函数功能】写出写缓冲区中的数据并同步被包装的流缓冲区
+【参数】无
+【返回值】int，成功返回0，失败返回-1
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+int ProgressStreamBuf::sync() {
+    m_Task.ThrowIfCancelled();
+    if (!FlushOutput()) {
+        return -1;
+    }
+    return m_Target.pubsync();
+}
+
+//-------------------------------------------------------------------------
+// 私有非静态成员函数
+//-------------------------------------------------------------------------
+
+/*************************************************************************
+【函数名称】FlushOutput
+【函数功能】把写缓冲区中的数据写出到被包装的流缓冲区并记入进度
+【参数】无
+【返回值】bool，是否全部写出
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+bool ProgressStreamBuf::FlushOutput() {
+    streamsize Count = pptr() - pbase();
+    if (Count <= 0) {
+        return true;
+    }
+    streamsize Written = m_Target.sputn(pbase(), Count);
+    setp(m_Output.data(), m_Output.data() + m_Output.size());
+    if (Written > 0) {
+        m_Task.AddBytes(static_cast<uint64_t>(Written));
+    }
+    return Written == Count;
+}
@@ -0,0 +1,86 @@
+/*************************************************************************
+【文件名】ProgressStreamBuf.hpp
+【功能模块和目的】定义ProgressStreamBuf类，统计读写字节数并响应取消的
+       流缓冲区
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+#ifndef PROGRESSSTREAMBUF_HPP
+#define PROGRESSSTREAMBUF_HPP
+
+// IOTask所属头文件
+#include "IOTask.hpp"
+// streambuf所属头文件
+#include <streambuf>
+// vector所属头文件
+#include <vector>
+// size_t所属头文件
+#include <cstddef>
+
+using namespace std;
+
+/*************************************************************************
+【类名】ProgressStreamBuf
+【功能】包装另一个流缓冲区（通常是ifstream或ofstream自带的filebuf），
+       以BUFFER_SIZE字节为单位从中读取或向其写入，每次读写后把字节数
+       记入IOTask；IOTask已请求取消时抛出IOTask::CANCELLED。流的异常
+       掩码需包含badbit，异常才能穿过流的读写函数到达调用者。
+       只支持顺序读或顺序写，不支持定位
+【接口说明】
+    静态常量：缓冲区大小
+    带参构造函数（被包装的流缓冲区、IOTask）
+    禁止拷贝构造和赋值
+    析构函数（写出剩余数据）
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+class ProgressStreamBuf : public streambuf {
+public:
+    //-------------------------------------------------------------------------
+    // 静态常量
+    //-------------------------------------------------------------------------
+    // 缓冲区大小
+    static constexpr size_t BUFFER_SIZE{1 << 16};
+    //-------------------------------------------------------------------------
+    // 必要的构造、析构、拷贝、赋值运算符重载函数
+    //-------------------------------------------------------------------------
+    // 带参构造函数
+    ProgressStreamBuf(streambuf& Target, IOTask& Task);
+    // 禁止拷贝构造
+    ProgressStreamBuf(const ProgressStreamBuf& Source) = delete;
+    // 禁止赋值
+    ProgressStreamBuf& operator=(const ProgressStreamBuf& Source) = delete;
+    // 析构函数
+    virtual ~ProgressStreamBuf();
+
+protected:
+    //-------------------------------------------------------------------------
+    // 受保护的成员函数
+    //-------------------------------------------------------------------------
+    // 读缓冲区为空时从被包装的流缓冲区读取
+    virtual int_type underflow() override;
+    // 写缓冲区已满时写出到被包装的流缓冲区
+    virtual int_type overflow(int_type Char) override;
+    // 写出写缓冲区中的数据
+    virtual int sync() override;
+
+private:
+    //-------------------------------------------------------------------------
+    // 私有非静态成员函数
+    //-------------------------------------------------------------------------
+    // 写出写缓冲区中的数据，失败时返回false
+    bool FlushOutput();
+    //-------------------------------------------------------------------------
+    // 私有非静态成员
+    //-------------------------------------------------------------------------
+    // 被包装的流缓冲区
+    streambuf& m_Target;
+    // 记录进度的任务
+    IOTask& m_Task;
+    // 读缓冲区
+    vector<char> m_Input{};
+    // 写缓冲区
+    vector<char> m_Output{};
+};
+
+#endif /* ProgressStreamBuf.hpp */
@@ -0,0 +1,71 @@
+/*************************************************************************
+【文件名】ScopedTimer.cpp
+【功能模块和目的】定义ScopedTimer类的成员函数
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+// ScopedTimer所属头文件
+#include "ScopedTimer.hpp"
+// Instrumentation所属头文件
+#include "Instrumentation.hpp"
+// steady_clock所属头文件
+#include <chrono>
+// uint64_t所属头文件
+#include <cstdint>
+// size_t所属头文件
+#include <cstddef>
+
+using namespace std;
+
+//-------------------------------------------------------------------------
+// 必要的构造、析构、拷贝、赋值运算符重载函数
+//-------------------------------------------------------------------------
+
+/*************************************************************************
+【函数名称】ScopedTimer
+【函数功能】带参构造函数，Instrumentation开启时记录开始时刻
+【参数】size_t Probe, 表示探针编号
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+ScopedTimer::ScopedTimer(size_t Probe)
+    : m_Probe(Probe), m_Active(Instrumentation::IsEnabled()) {
+    if (m_Active) {
+        m_Start = chrono::steady_clock::now();
+    }
+}
+/*************************************************************************
+【函数名称】~ScopedTimer
+【函数功能】析构函数，把耗时和处理量记入探针
+【参数】无
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+ScopedTimer::~ScopedTimer() {
+    if (m_Active) {
+        auto Elapsed = chrono::steady_clock::now() - m_Start;
+        Instrumentation::AddSample(m_Probe, static_cast<uint64_t>(
+            chrono::duration_cast<chrono::nanoseconds>(Elapsed).count()));
+        if (m_Items > 0) {
+            Instrumentation::Count(m_Probe, m_Items);
+        }
+    }
+}
+
+//-------------------------------------------------------------------------
+// 非静态Setter成员函数
+//-------------------------------------------------------------------------
+
+/*************************************************************************
+【函数名称】AddItems
+【函数功能】累加本次的处理量，析构时一并记入探针
+【参数】uint64_t Items, 表示处理量
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+void ScopedTimer::AddItems(uint64_t Items) {
+    m_Items += Items;
+}
@@ -0,0 +1,66 @@
+/*************************************************************************
+【文件名】ScopedTimer.hpp
+【功能模块和目的】定义ScopedTimer类，在作用域内为一个探针计时
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+#ifndef SCOPEDTIMER_HPP
+#define SCOPEDTIMER_HPP
+
+// steady_clock所属头文件
+#include <chrono>
+// uint64_t所属头文件
+#include <cstdint>
+// size_t所属头文件
+#include <cstddef>
+
+using namespace std;
+
+/*************************************************************************
+【类名】ScopedTimer
+【功能】构造时若Instrumentation已开启则开始计时，析构时把耗时和处理量记入
+       探针，提前返回或抛出异常时同样记录。构造时未开启则整个作用域不做
+       任何记录
+【接口说明】
+    带参构造函数（探针编号）
+    禁止拷贝构造函数
+    禁止赋值运算符
+    析构函数
+    累加本次的处理量
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+class ScopedTimer {
+public:
+    //-------------------------------------------------------------------------
+    // 必要的构造、析构、拷贝、赋值运算符重载函数
+    //-------------------------------------------------------------------------
+    // 带参构造函数
+    explicit ScopedTimer(size_t Probe);
+    // 禁止拷贝构造函数
+    ScopedTimer(const ScopedTimer& Source) = delete;
+    // 禁止赋值运算符
+    ScopedTimer& operator=(const ScopedTimer& Source) = delete;
+    // 析构函数
+    ~ScopedTimer();
+    //-------------------------------------------------------------------------
+    // 非静态Setter成员函数
+    //-------------------------------------------------------------------------
+    // 累加本次的处理量
+    void AddItems(uint64_t Items);
+
+private:
+    //-------------------------------------------------------------------------
+    // 私有非静态成员
+    //-------------------------------------------------------------------------
+    // 探针编号
+    size_t m_Probe;
+    // 是否在计时
+    bool m_Active;
+    // 本次的处理量
+    uint64_t m_Items{0};
+    // 开始时刻
+    chrono::steady_clock::time_point m_Start{};
+};
+
+#endif /* ScopedTimer.hpp */
@@ -0,0 +1,315 @@
+/*************************************************************************
+【文件名】ScriptExecutor.cpp
+【功能模块和目的】定义ScriptExecutor类的成员函数
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】2026/10/19 谭雯心 增加了undo、redo命令
+*************************************************************************/
+// ScriptExecutor所属头文件
+#include "ScriptExecutor.hpp"
+// EditScript所属头文件
+#include "EditScript.hpp"
+// Controller所属头文件
+#include "Controller.hpp"
+// Face3D所属头文件
+#include "Face3D.hpp"
+// Line3D所属头文件
+#include "Line3D.hpp"
+// Point3D所属头文件
+#include "Point3D.hpp"
+// steady_clock所属头文件
+#include <chrono>
+// vector所属头文件
+#include <vector>
+// uint64_t所属头文件
+#include <cstdint>
+// size_t所属头文件
+#include <cstddef>
+
+using namespace std;
+
+namespace {
+    /*********************************************************************
+    【函数名称】ElapsedNanoseconds
+    【函数功能】计算从Start到现在经过的纳秒数
+    【参数】chrono::steady_clock::time_point Start, 表示开始时刻
+    【返回值】uint64_t，纳秒数
+    【开发者及日期】谭雯心 2026/10/19
+    【更改记录】
+    *********************************************************************/
+    uint64_t ElapsedNanoseconds(chrono::steady_clock::time_point Start) {
+        return static_cast<uint64_t>(
+            chrono::duration_cast<chrono::nanoseconds>(
+            chrono::steady_clock::now() - Start).count());
+    }
+    /*********************************************************************
+    【函数名称】PointAt
+    【函数功能】取坐标参数中从Offset开始的三个值构成点
+    【参数】const vector<double>& Values, 表示坐标参数
+           size_t Offset, 表示起始位置
+    【返回值】Point3D，点
+    【开发者及日期】谭雯心 2026/10/19
+    【更改记录】
+    *********************************************************************/
+    Point3D PointAt(const vector<double>& Values, size_t Offset) {
+        return Point3D(Values[Offset], Values[Offset + 1], Values[Offset + 2]);
+    }
+}
+
+//-------------------------------------------------------------------------
+// 必要的构造、析构、拷贝、赋值运算符重载函数
+//-------------------------------------------------------------------------
+
+/*************************************************************************
+【函数名称】ScriptExecutor
+【函数功能】默认构造函数
+【参数】无
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+ScriptExecutor::ScriptExecutor() : m_pController(Controller::GetInstance()) {
+}
+
+//-------------------------------------------------------------------------
+// 非静态成员函数
+//-------------------------------------------------------------------------
+
+/*************************************************************************
+【函数名称】Execute
+【函数功能】按顺序执行脚本，遇到第一个失败的命令时停止。
+       之前的执行记录被清空
+【参数】const EditScript& Script, 表示脚本
+【返回值】Controller::Res，第一个失败的命令的结果，全部成功时为OK
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+Controller::Res ScriptExecutor::Execute(const EditScript& Script) {
+    m_Steps.clear();
+    const EditScript::CommandList& Commands = Script.Commands();
+    size_t i = 0;
+    while (i < Commands.size()) {
+        if (Commands[i].Code == EditScript::Opcode::ADD_FACE) {
+            i = ExecuteFaces(Commands, i);
+        }
+        else if (Commands[i].Code == EditScript::Opcode::ADD_LINE) {
+            i = ExecuteLines(Commands, i);
+        }
+        else {
+            auto Start = chrono::steady_clock::now();
+            Controller::Res Result = ExecuteOne(Commands[i]);
+            m_Steps.push_back({Commands[i].Code, Commands[i].LineNumber,
+                Commands[i].LineNumber, 1, Result, ElapsedNanoseconds(Start)});
+            i++;
+        }
+        if (m_Steps.back().Result != Controller::Res::OK) {
+            return m_Steps.back().Result;
+        }
+    }
+    return Controller::Res::OK;
+}
+/*************************************************************************
+【函数名称】Steps
+【函数功能】获取各步的执行记录
+【参数】无
+【返回值】const StepList&，执行记录
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+const ScriptExecutor::StepList& ScriptExecutor::Steps() const {
+    return m_Steps;
+}
+/*************************************************************************
+【函数名称】GetTotalNanoseconds
+【函数功能】获取各步耗时之和
+【参数】无
+【返回值】uint64_t，纳秒数
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+uint64_t ScriptExecutor::GetTotalNanoseconds() const {
+    uint64_t Total = 0;
+    for (const auto& AStep : m_Steps) {
+        Total += AStep.Nanoseconds;
+    }
+    return Total;
+}
+/*************************************************************************
+【函数名称】WriteReport
+【函数功能】以制表符分隔的文本输出各步的执行记录，每步一行：
+       起止行号、命令名、命令数、结果、耗时（微秒）和每条命令的平均耗时
+【参数】ostream& Stream, 表示输出流
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+void ScriptExecutor::WriteReport(ostream& Stream) const {
+    Stream << "line\tcommand\tcount\tresult\tmicroseconds"
+        << "\tmicroseconds_per_command\n";
+    for (const auto& AStep : m_Steps) {
+        double Microseconds = AStep.Nanoseconds / 1000.0;
+        Stream << AStep.FirstLine;
+        if (AStep.LastLine != AStep.FirstLine) {
+            Stream << '-' << AStep.LastLine;
+        }
+        Stream << '\t' << EditScript::GetOpcodeName(AStep.Code) << '\t'
+            << AStep.CommandCount << '\t'
+            << m_pController->ControllerResStr(AStep.Result) << '\t'
+            << Microseconds << '\t' << Microseconds / AStep.CommandCount
+            << '\n';
+    }
+}
+
+//-------------------------------------------------------------------------
+// 私有非静态成员函数
+//-------------------------------------------------------------------------
+
+/*************************************************************************
+【函数名称】ExecuteFaces
+【函数功能】把从First开始连续的add_face命令作为一批添加到当前模型，
+       记录为一步。某条命令的点重复时，批次在其之前截止，
+       该命令单独记录为失败的一步
+【参数】const EditScript::CommandList& Commands, 表示命令列表
+       size_t First, 表示第一条add_face命令的位置
+【返回值】size_t，下一条要执行的命令的位置
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+size_t ScriptExecutor::ExecuteFaces(
+    const EditScript::CommandList& Commands, size_t First) {
+    auto Start = chrono::steady_clock::now();
+    vector<Face3D> Faces;
+    size_t Last = First;
+    bool Duplicated = false;
+    while (Last < Commands.size()
+           && Commands[Last].Code == EditScript::Opcode::ADD_FACE) {
+        Point3D Point1 = PointAt(Commands[Last].Values, 0);
+        Point3D Point2 = PointAt(Commands[Last].Values, 3);
+        Point3D Point3 = PointAt(Commands[Last].Values, 6);
+        if (Point1 == Point2 || Point1 == Point3 || Point2 == Point3) {
+            Duplicated = true;
+            break;
+        }
+        Faces.push_back(Face3D(Point1, Point2, Point3));
+        Last++;
+    }
+    size_t Added = 0;
+    Controller::Res Result = Controller::Res::OK;
+    if (!Faces.empty()) {
+        Result = m_pController->AddFaces(
+            Faces, m_pController->CurrentModelIndex, Added);
+    }
+    // 批量添加失败时，最后执行的命令即失败的命令
+    size_t Executed = (Result == Controller::Res::OK) ? Added : Added + 1;
+    if (Executed > 0) {
+        m_Steps.push_back({EditScript::Opcode::ADD_FACE,
+            Commands[First].LineNumber,
+            Commands[First + Executed - 1].LineNumber, Executed, Result,
+            ElapsedNanoseconds(Start)});
+    }
+    if (Result == Controller::Res::OK && Duplicated) {
+        m_Steps.push_back({EditScript::Opcode::ADD_FACE,
+            Commands[Last].LineNumber, Commands[Last].LineNumber, 1,
+            Controller::Res::POINT_DUPLICATED, 0});
+    }
+    return First + Executed;
+}
+/*************************************************************************
+【函数名称】ExecuteLines
+【函数功能】把从First开始连续的add_line命令作为一批添加到当前模型，
+       规则与ExecuteFaces相同
+【参数】const EditScript::CommandList& Commands, 表示命令列表
+       size_t First, 表示第一条add_line命令的位置
+【返回值】size_t，下一条要执行的命令的位置
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+size_t ScriptExecutor::ExecuteLines(
+    const EditScript::CommandList& Commands, size_t First) {
+    auto Start = chrono::steady_clock::now();
+    vector<Line3D> Lines;
+    size_t Last = First;
+    bool Duplicated = false;
+    while (Last < Commands.size()
+           && Commands[Last].Code == EditScript::Opcode::ADD_LINE) {
+        Point3D Point1 = PointAt(Commands[Last].Values, 0);
+        Point3D Point2 = PointAt(Commands[Last].Values, 3);
+        if (Point1 == Point2) {
+            Duplicated = true;
+            break;
+        }
+        Lines.push_back(Line3D(Point1, Point2));
+        Last++;
+    }
+    size_t Added = 0;
+    Controller::Res Result = Controller::Res::OK;
+    if (!Lines.empty()) {
+        Result = m_pController->AddLines(
+            Lines, m_pController->CurrentModelIndex, Added);
+    }
+    // 批量添加失败时，最后执行的命令即失败的命令
+    size_t Executed = (Result == Controller::Res::OK) ? Added : Added + 1;
+    if (Executed > 0) {
+        m_Steps.push_back({EditScript::Opcode::ADD_LINE,
+            Commands[First].LineNumber,
+            Commands[First + Executed - 1].LineNumber, Executed, Result,
+            ElapsedNanoseconds(Start)});
+    }
+    if (Result == Controller::Res::OK && Duplicated) {
+        m_Steps.push_back({EditScript::Opcode::ADD_LINE,
+            Commands[Last].LineNumber, Commands[Last].LineNumber, 1,
+            Controller::Res::POINT_DUPLICATED, 0});
+    }
+    return First + Executed;
+}
+/*************************************************************************
+【函数名称】ExecuteOne
+【函数功能】执行一条除add_face、add_line以外的命令，
+       作用于Controller的当前模型
+【参数】const EditScript::Command& ACommand, 表示命令
+【返回值】Controller::Res，命令的结果
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】2026/10/19 谭雯心 增加了undo、redo命令
+*************************************************************************/
+Controller::Res ScriptExecutor::ExecuteOne(const EditScript::Command& ACommand) {
+    size_t Model = m_pController->CurrentModelIndex;
+    const vector<size_t>& Indices = ACommand.Indices;
+    const vector<double>& Values = ACommand.Values;
+    switch (ACommand.Code) {
+        case EditScript::Opcode::CREATE:
+            return m_pController->CreateModel();
+        case EditScript::Opcode::SELECT:
+            return m_pController->SetCurrentModel(Indices[0]);
+        case EditScript::Opcode::REMOVE_MODEL:
+            return m_pController->RemoveModel(Indices[0]);
+        case EditScript::Opcode::LOAD:
+            return m_pController->LoadModelFromFile(ACommand.Text, Model);
+        case EditScript::Opcode::SAVE:
+            return m_pController->SaveModelToFile(ACommand.Text, Model);
+        case EditScript::Opcode::REMOVE_FACE:
+            return m_pController->RemoveFace(Model, Indices[0]);
+        case EditScript::Opcode::CHANGE_FACE_POINT:
+            return m_pController->ChangeFacePoint(Model, Indices[0],
+                Indices[1], Values[0], Values[1], Values[2]);
+        case EditScript::Opcode::REMOVE_LINE:
+            return m_pController->RemoveLine(Model, Indices[0]);
+        case EditScript::Opcode::CHANGE_LINE_POINT:
+            return m_pController->ChangeLinePoint(Model, Indices[0],
+                Indices[1], Values[0], Values[1], Values[2]);
+        case EditScript::Opcode::CLEAR_FACES:
+            return m_pController->ClearFaces(Model);
+        case EditScript::Opcode::CLEAR_LINES:
+            return m_pController->ClearLines(Model);
+        case EditScript::Opcode::CLEAR:
+            return m_pController->Clear(Model);
+        case EditScript::Opcode::RENAME:
+            return m_pController->ChangeName(Model, ACommand.Text);
+        case EditScript::Opcode::DESCRIBE:
+            return m_pController->ChangeDescription(Model, ACommand.Text);
+        case EditScript::Opcode::UNDO:
+            return m_pController->Undo(Model);
+        case EditScript::Opcode::REDO:
+            return m_pController->Redo(Model);
+        default:
+            return Controller::Res::UNKNOWN_TYPE;
+    }
+}
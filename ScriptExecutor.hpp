@@ -0,0 +1,108 @@
+/*************************************************************************
+【文件名】ScriptExecutor.hpp
+【功能模块和目的】定义ScriptExecutor类，对Controller执行命令脚本并计时
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+#ifndef SCRIPTEXECUTOR_HPP
+#define SCRIPTEXECUTOR_HPP
+
+// EditScript所属头文件
+#include "EditScript.hpp"
+// Controller所属头文件
+#include "Controller.hpp"
+// 流操作所属头文件
+#include <iostream>
+// vector所属头文件
+#include <vector>
+// shared_ptr所属头文件
+#include <memory>
+// uint64_t所属头文件
+#include <cstdint>
+// size_t所属头文件
+#include <cstddef>
+
+using namespace std;
+
+/*************************************************************************
+【类名】ScriptExecutor
+【功能】按顺序把EditScript中的命令映射到Controller的成员函数上执行，
+       遇到第一个失败的命令时停止。连续的add_face（或add_line）命令作为
+       一批，通过Controller::AddFaces（AddLines）一次添加到当前模型。
+       每一步（单条命令或一批命令）记录耗时和结果
+【接口说明】
+    内嵌结构体Step，表示一步的执行记录
+    默认构造函数
+    禁止拷贝构造和赋值
+    虚析构函数
+    执行脚本
+    获取各步的执行记录、总耗时
+    以制表符分隔的文本输出各步的执行记录
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+class ScriptExecutor {
+public:
+    //-------------------------------------------------------------------------
+    // 公有的内嵌类，用于存储数据
+    //-------------------------------------------------------------------------
+    // 一步的执行记录
+    struct Step {
+        // 操作码
+        EditScript::Opcode Code;
+        // 第一条命令的行号
+        size_t FirstLine;
+        // 最后一条执行的命令的行号，失败时为失败的命令
+        size_t LastLine;
+        // 执行的命令数
+        size_t CommandCount;
+        // 结果
+        Controller::Res Result;
+        // 耗时（纳秒）
+        uint64_t Nanoseconds;
+    };
+    // 执行记录列表
+    using StepList = vector<Step>;
+    //-------------------------------------------------------------------------
+    // 必要的构造、析构、拷贝、赋值运算符重载函数
+    //-------------------------------------------------------------------------
+    // 默认构造函数
+    ScriptExecutor();
+    // 禁止拷贝构造
+    ScriptExecutor(const ScriptExecutor& Source) = delete;
+    // 禁止赋值
+    ScriptExecutor& operator=(const ScriptExecutor& Source) = delete;
+    // 虚析构函数
+    virtual ~ScriptExecutor() = default;
+    //-------------------------------------------------------------------------
+    // 非静态成员函数
+    //-------------------------------------------------------------------------
+    // 执行脚本，返回第一个失败的命令的结果，全部成功时返回OK
+    Controller::Res Execute(const EditScript& Script);
+    // 获取各步的执行记录
+    const StepList& Steps() const;
+    // 获取总耗时（纳秒）
+    uint64_t GetTotalNanoseconds() const;
+    // 以制表符分隔的文本输出各步的执行记录
+    void WriteReport(ostream& Stream) const;
+
+private:
+    //-------------------------------------------------------------------------
+    // 私有非静态成员函数
+    //-------------------------------------------------------------------------
+    // 从First开始批量执行连续的add_face命令，返回下一条命令的位置
+    size_t ExecuteFaces(const EditScript::CommandList& Commands, size_t First);
+    // 从First开始批量执行连续的add_line命令，返回下一条命令的位置
+    size_t ExecuteLines(const EditScript::CommandList& Commands, size_t First);
+    // 执行一条其他命令
+    Controller::Res ExecuteOne(const EditScript::Command& ACommand);
+    //-------------------------------------------------------------------------
+    // 私有非静态成员
+    //-------------------------------------------------------------------------
+    // 控制器
+    shared_ptr<Controller> m_pController;
+    // 各步的执行记录
+    StepList m_Steps{};
+};
+
+#endif /* ScriptExecutor.hpp */
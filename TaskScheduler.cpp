@@ -0,0 +1,351 @@
+/*************************************************************************
+【文件名】TaskScheduler.cpp
+【功能模块和目的】定义TaskScheduler类的成员函数
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+// TaskScheduler所属头文件
+#include "TaskScheduler.hpp"
+// exception_ptr、rethrow_exception所属头文件
+#include <exception>
+// microseconds所属头文件
+#include <chrono>
+// numeric_limits所属头文件
+#include <limits>
+// max所属头文件
+#include <algorithm>
+// move所属头文件
+#include <utility>
+
+using namespace std;
+
+namespace {
+    // 非工作线程的队列编号
+    const size_t NOT_A_WORKER = numeric_limits<size_t>::max();
+    // 当前线程的队列编号，非工作线程为NOT_A_WORKER
+    thread_local size_t t_QueueIndex = NOT_A_WORKER;
+}
+
+/*************************************************************************
+【类名】TaskScheduler::TaskGroup
+【功能】一次ParallelFor的共享状态，由其全部任务共同持有
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+struct TaskScheduler::TaskGroup {
+    // 循环体
+    const function<void(size_t, size_t)>* pBody{nullptr};
+    // 区间起点
+    size_t Begin{0};
+    // 区间终点（不含）
+    size_t End{0};
+    // 每块的大小
+    size_t Grain{1};
+    // 尚未完成的块数
+    atomic<size_t> Pending{0};
+    // 是否已有块抛出异常，之后的块不再执行
+    atomic<bool> bFailed{false};
+    // 保护pError，与Done配合使用
+    mutex Mutex{};
+    // 全部块完成时通知
+    condition_variable Done{};
+    // 第一个异常
+    exception_ptr pError{};
+};
+
+//-------------------------------------------------------------------------
+// 静态常量
+//-------------------------------------------------------------------------
+
+// 等待时重新检查可窃取任务的间隔（微秒）
+constexpr long TaskScheduler::WAIT_INTERVAL_US;
+
+//-------------------------------------------------------------------------
+// 私有静态成员
+//-------------------------------------------------------------------------
+
+// m_pInstance初始化为nullptr
+shared_ptr<TaskScheduler> TaskScheduler::m_pInstance = nullptr;
+// m_InstanceFlag保证m_pInstance只创建一次
+once_flag TaskScheduler::m_InstanceFlag;
+// 默认使用硬件线程数
+atomic<size_t> TaskScheduler::m_ConfiguredCount{0};
+// 实例尚未创建
+atomic<bool> TaskScheduler::m_bCreated{false};
+
+//-------------------------------------------------------------------------
+// 必要的构造、析构、拷贝、赋值运算符重载函数
+//-------------------------------------------------------------------------
+
+/*************************************************************************
+【函数名称】TaskScheduler
+【函数功能】带参构造函数，调用线程算作一个工作者，另外创建
+       WorkerCount - 1个工作线程
+【参数】size_t WorkerCount, 表示工作者数，0表示使用硬件线程数
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+TaskScheduler::TaskScheduler(size_t WorkerCount)
+    : m_WorkerCount(WorkerCount) {
+    if (m_WorkerCount == 0) {
+        m_WorkerCount = thread::hardware_concurrency();
+    }
+    m_WorkerCount = max<size_t>(m_WorkerCount, 1);
+    for (size_t i = 0; i < m_WorkerCount; i++) {
+        m_Queues.push_back(unique_ptr<WorkQueue>(new WorkQueue()));
+    }
+    for (size_t i = 0; i + 1 < m_WorkerCount; i++) {
+        m_Threads.emplace_back(&TaskScheduler::WorkerLoop, this, i);
+    }
+}
+/*************************************************************************
+【函数名称】~TaskScheduler
+【函数功能】析构函数，唤醒并等待全部工作线程结束
+【参数】无
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+TaskScheduler::~TaskScheduler() {
+    {
+        lock_guard<mutex> Lock(m_SleepMutex);
+        m_bStopping = true;
+    }
+    m_Wakeup.notify_all();
+    for (auto& Worker : m_Threads) {
+        Worker.join();
+    }
+}
+
+//-------------------------------------------------------------------------
+// 静态成员函数
+//-------------------------------------------------------------------------
+
+/*************************************************************************
+【函数名称】GetInstance
+【函数功能】获取唯一实例，第一次调用时按设置的工作者数创建
+【参数】无
+【返回值】shared_ptr<TaskScheduler>，唯一实例
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+shared_ptr<TaskScheduler> TaskScheduler::GetInstance() {
+    call_once(m_InstanceFlag, []() {
+        m_bCreated = true;
+        m_pInstance = shared_ptr<TaskScheduler>(
+            new TaskScheduler(m_ConfiguredCount));
+    });
+    return m_pInstance;
+}
+/*************************************************************************
+【函数名称】SetWorkerCount
+【函数功能】设置创建实例时使用的工作者数
+【参数】size_t WorkerCount, 表示工作者数（含调用线程），0表示使用
+       硬件线程数
+【返回值】bool，实例尚未创建时返回true；已创建时设置无效，返回false
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+bool TaskScheduler::SetWorkerCount(size_t WorkerCount) {
+    if (m_bCreated) {
+        return false;
+    }
+    m_ConfiguredCount = WorkerCount;
+    return true;
+}
+
+//-------------------------------------------------------------------------
+// 非静态成员函数
+//-------------------------------------------------------------------------
+
+/*************************************************************************
+【函数名称】GetWorkerCount
+【函数功能】获取工作者数
+【参数】无
+【返回值】size_t，工作者数（含调用线程）
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+size_t TaskScheduler::GetWorkerCount() const {
+    return m_WorkerCount;
+}
+/*************************************************************************
+【函数名称】ParallelFor
+【函数功能】并行循环。区间按Grain分块，每块调用一次Body；调用线程执行
+       第一块并在等待期间执行其他任务，全部块完成后返回。任一块抛出的
+       异常在全部已开始的块结束后由本函数重新抛出
+【参数】size_t Begin, 区间起点
+       size_t End, 区间终点（不含）
+       size_t Grain, 每块的大小，为0时按1处理
+       const function<void(size_t, size_t)>& Body, 以块首、块尾为参数
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+void TaskScheduler::ParallelFor(size_t Begin, size_t End, size_t Grain,
+    const function<void(size_t, size_t)>& Body) {
+    if (Begin >= End) {
+        return;
+    }
+    if (Grain == 0) {
+        Grain = 1;
+    }
+    size_t ChunkCount = (End - Begin + Grain - 1) / Grain;
+    // 只有一块或只有一个工作者时在调用线程中依次执行
+    if (ChunkCount == 1 || m_WorkerCount == 1) {
+        for (size_t i = Begin; i < End; i += Grain) {
+            Body(i, End - i > Grain ? i + Grain : End);
+        }
+        return;
+    }
+    shared_ptr<TaskGroup> pGroup = make_shared<TaskGroup>();
+    pGroup->pBody = &Body;
+    pGroup->Begin = Begin;
+    pGroup->End = End;
+    pGroup->Grain = Grain;
+    pGroup->Pending = ChunkCount;
+    RunRange(pGroup, 0, ChunkCount);
+    // 等待期间帮助执行任务，没有任务时短暂等待后重新检查
+    while (pGroup->Pending > 0) {
+        if (!RunOne()) {
+            unique_lock<mutex> Lock(pGroup->Mutex);
+            pGroup->Done.wait_for(Lock, chrono::microseconds(WAIT_INTERVAL_US),
+                [&]() { return pGroup->Pending == 0; });
+        }
+    }
+    if (pGroup->pError != nullptr) {
+        rethrow_exception(pGroup->pError);
+    }
+}
+
+//-------------------------------------------------------------------------
+// 私有非静态成员函数
+//-------------------------------------------------------------------------
+
+/*************************************************************************
+【函数名称】Push
+【函数功能】把任务放入当前线程的队列尾，非工作线程放入公共队列，
+       有休眠的工作线程时唤醒一个
+【参数】function<void()>&& Task, 表示任务
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+void TaskScheduler::Push(function<void()>&& Task) {
+    size_t Index = t_QueueIndex == NOT_A_WORKER
+        ? m_Queues.size() - 1 : t_QueueIndex;
+    {
+        lock_guard<mutex> Lock(m_Queues[Index]->Mutex);
+        m_Queues[Index]->Tasks.push_back(move(Task));
+    }
+    m_Queued++;
+    if (m_Sleeping > 0) {
+        // 加锁保证休眠线程要么已在等待，要么会看到新的任务数
+        unique_lock<mutex> Lock(m_SleepMutex);
+        Lock.unlock();
+        m_Wakeup.notify_one();
+    }
+}
+/*************************************************************************
+【函数名称】RunOne
+【函数功能】先从当前线程队列尾取任务，没有时依次从其他队列头窃取，
+       取到则执行
+【参数】无
+【返回值】bool，是否执行了任务
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+bool TaskScheduler::RunOne() {
+    if (m_Queued == 0) {
+        return false;
+    }
+    size_t Count = m_Queues.size();
+    size_t Own = t_QueueIndex == NOT_A_WORKER ? Count - 1 : t_QueueIndex;
+    function<void()> Task;
+    for (size_t k = 0; k < Count && !Task; k++) {
+        WorkQueue& Queue = *m_Queues[(Own + k) % Count];
+        lock_guard<mutex> Lock(Queue.Mutex);
+        if (Queue.Tasks.empty()) {
+            continue;
+        }
+        // 自己的任务后进先出，窃取的任务先进先出（较大的区间）
+        if (k == 0) {
+            Task = move(Queue.Tasks.back());
+            Queue.Tasks.pop_back();
+        }
+        else {
+            Task = move(Queue.Tasks.front());
+            Queue.Tasks.pop_front();
+        }
+    }
+    if (!Task) {
+        return false;
+    }
+    m_Queued--;
+    Task();
+    return true;
+}
+/*************************************************************************
+【函数名称】RunRange
+【函数功能】反复把块区间的后一半拆为任务放入队列，然后执行剩下的第一块。
+       已有块抛出异常时跳过循环体，只记为完成
+【参数】const shared_ptr<TaskGroup>& pGroup, 表示共享状态
+       size_t First, 第一个块编号
+       size_t Last, 最后一个块编号（不含）
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+void TaskScheduler::RunRange(const shared_ptr<TaskGroup>& pGroup,
+    size_t First, size_t Last) {
+    while (Last - First > 1) {
+        size_t Mid = First + (Last - First) / 2;
+        Push([this, pGroup, Mid, Last]() {
+            RunRange(pGroup, Mid, Last);
+        });
+        Last = Mid;
+    }
+    if (!pGroup->bFailed) {
+        size_t ChunkBegin = pGroup->Begin + First * pGroup->Grain;
+        size_t ChunkEnd = pGroup->End - ChunkBegin > pGroup->Grain
+            ? ChunkBegin + pGroup->Grain : pGroup->End;
+        try {
+            (*pGroup->pBody)(ChunkBegin, ChunkEnd);
+        }
+        catch (...) {
+            lock_guard<mutex> Lock(pGroup->Mutex);
+            if (pGroup->pError == nullptr) {
+                pGroup->pError = current_exception();
+            }
+            pGroup->bFailed = true;
+        }
+    }
+    if (--pGroup->Pending == 0) {
+        lock_guard<mutex> Lock(pGroup->Mutex);
+        pGroup->Done.notify_all();
+    }
+}
+/*************************************************************************
+【函数名称】WorkerLoop
+【函数功能】工作线程主循环：执行或窃取任务，没有任务时休眠，
+       正在析构时返回
+【参数】size_t Index, 表示本线程的队列编号
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+void TaskScheduler::WorkerLoop(size_t Index) {
+    t_QueueIndex = Index;
+    while (!m_bStopping) {
+        if (RunOne()) {
+            continue;
+        }
+        unique_lock<mutex> Lock(m_SleepMutex);
+        m_Sleeping++;
+        m_Wakeup.wait(Lock, [this]() {
+            return m_Queued > 0 || m_bStopping;
+        });
+        m_Sleeping--;
+    }
+}
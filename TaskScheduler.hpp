@@ -0,0 +1,192 @@
+/*************************************************************************
+【文件名】TaskScheduler.hpp
+【功能模块和目的】定义TaskScheduler类，全项目共用的工作窃取线程池，
+       提供并行循环和并行归约
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+#ifndef TASKSCHEDULER_HPP
+#define TASKSCHEDULER_HPP
+
+// function所属头文件
+#include <functional>
+// shared_ptr、unique_ptr所属头文件
+#include <memory>
+// thread所属头文件
+#include <thread>
+// mutex、once_flag所属头文件
+#include <mutex>
+// condition_variable所属头文件
+#include <condition_variable>
+// atomic所属头文件
+#include <atomic>
+// deque所属头文件
+#include <deque>
+// vector所属头文件
+#include <vector>
+// size_t所属头文件
+#include <cstddef>
+
+using namespace std;
+
+/*************************************************************************
+【类名】TaskScheduler
+【功能】全项目共用的计算线程池，单例。每个工作线程有自己的任务双端队列，
+       从队尾取自己的任务，空闲时从其他队列的队头窃取；非工作线程提交的
+       任务放入公共队列。ParallelFor把区间按Grain分块后二分拆成任务，
+       调用线程在等待期间也执行任务，因此可以在任务中嵌套调用而不会死锁。
+       工作者数（含调用线程）须在第一次使用前设置，默认等于硬件线程数。
+       文件读写任务不在此执行，由IOThreadPool负责
+【接口说明】
+    静态常量：等待时重新检查可窃取任务的间隔（微秒）
+    禁止拷贝构造和赋值
+    虚析构函数
+    获取唯一实例
+    在第一次使用前设置工作者数
+    获取工作者数
+    并行循环
+    并行归约（结果与工作者数无关）
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+class TaskScheduler {
+public:
+    //-------------------------------------------------------------------------
+    // 静态常量
+    //-------------------------------------------------------------------------
+    // 等待时重新检查可窃取任务的间隔（微秒）
+    static constexpr long WAIT_INTERVAL_US{200};
+    //-------------------------------------------------------------------------
+    // 必要的构造、析构、拷贝、赋值运算符重载函数
+    //-------------------------------------------------------------------------
+    // 禁止拷贝构造
+    TaskScheduler(const TaskScheduler& Source) = delete;
+    // 禁止赋值
+    TaskScheduler& operator=(const TaskScheduler& Source) = delete;
+    // 虚析构函数，结束全部工作线程
+    virtual ~TaskScheduler();
+    //-------------------------------------------------------------------------
+    // 静态成员函数
+    //-------------------------------------------------------------------------
+    // 获取唯一实例
+    static shared_ptr<TaskScheduler> GetInstance();
+    // 设置工作者数（0表示使用硬件线程数），实例已创建时返回false
+    static bool SetWorkerCount(size_t WorkerCount);
+    //-------------------------------------------------------------------------
+    // 非静态成员函数
+    //-------------------------------------------------------------------------
+    // 获取工作者数（含调用线程）
+    size_t GetWorkerCount() const;
+    // 并行循环：对[Begin, End)按Grain分块，每块调用一次Body(块首, 块尾)
+    void ParallelFor(size_t Begin, size_t End, size_t Grain,
+        const function<void(size_t, size_t)>& Body);
+    // 并行归约：每块调用Map得到部分结果，再按块的顺序用Combine合并
+    template<class Value>
+    Value ParallelReduce(size_t Begin, size_t End, size_t Grain,
+        const Value& Identity, const function<Value(size_t, size_t)>& Map,
+        const function<Value(const Value&, const Value&)>& Combine);
+
+private:
+    //-------------------------------------------------------------------------
+    // 私有的内嵌类
+    //-------------------------------------------------------------------------
+    // 一个任务双端队列
+    struct WorkQueue {
+        // 保护Tasks
+        mutex Mutex{};
+        // 任务
+        deque<function<void()>> Tasks{};
+    };
+    // 一次ParallelFor的共享状态
+    struct TaskGroup;
+    //-------------------------------------------------------------------------
+    // 私有构造函数
+    //-------------------------------------------------------------------------
+    // 带参构造函数，创建WorkerCount - 1个工作线程
+    explicit TaskScheduler(size_t WorkerCount);
+    //-------------------------------------------------------------------------
+    // 私有非静态成员函数
+    //-------------------------------------------------------------------------
+    // 把任务放入当前线程的队列（非工作线程放入公共队列）并唤醒空闲线程
+    void Push(function<void()>&& Task);
+    // 取出并执行一个任务，没有任务时返回false
+    bool RunOne();
+    // 执行编号为[First, Last)的块，把后一半拆为任务供其他线程窃取
+    void RunRange(const shared_ptr<TaskGroup>& pGroup,
+        size_t First, size_t Last);
+    // 工作线程主循环
+    void WorkerLoop(size_t Index);
+    //-------------------------------------------------------------------------
+    // 私有静态成员
+    //-------------------------------------------------------------------------
+    // 唯一实例
+    static shared_ptr<TaskScheduler> m_pInstance;
+    // 保证唯一实例只创建一次
+    static once_flag m_InstanceFlag;
+    // 创建实例时使用的工作者数
+    static atomic<size_t> m_ConfiguredCount;
+    // 实例是否已创建
+    static atomic<bool> m_bCreated;
+    //-------------------------------------------------------------------------
+    // 私有非静态成员
+    //-------------------------------------------------------------------------
+    // 工作者数（含调用线程）
+    size_t m_WorkerCount;
+    // 各工作线程的队列，最后一个为非工作线程共用的公共队列
+    vector<unique_ptr<WorkQueue>> m_Queues{};
+    // 工作线程
+    vector<thread> m_Threads{};
+    // 全部队列中的任务数
+    atomic<size_t> m_Queued{0};
+    // 正在休眠的工作线程数
+    atomic<size_t> m_Sleeping{0};
+    // 与m_Wakeup配合使用
+    mutex m_SleepMutex{};
+    // 有新任务或需要结束时唤醒工作线程
+    condition_variable m_Wakeup{};
+    // 是否正在析构
+    atomic<bool> m_bStopping{false};
+};
+
+/*************************************************************************
+【函数名称】ParallelReduce
+【函数功能】并行归约。块的划分只取决于区间和Grain，部分结果按块的顺序
+       合并，因此浮点数的结果与工作者数无关
+【参数】size_t Begin, 区间起点
+       size_t End, 区间终点（不含）
+       size_t Grain, 每块的大小，为0时按1处理
+       const Value& Identity, 空区间的结果
+       const function<Value(size_t, size_t)>& Map, 计算一块的部分结果
+       const function<Value(const Value&, const Value&)>& Combine, 合并
+【返回值】Value，归约结果
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+template<class Value>
+Value TaskScheduler::ParallelReduce(size_t Begin, size_t End, size_t Grain,
+    const Value& Identity, const function<Value(size_t, size_t)>& Map,
+    const function<Value(const Value&, const Value&)>& Combine) {
+    if (Begin >= End) {
+        return Identity;
+    }
+    if (Grain == 0) {
+        Grain = 1;
+    }
+    size_t ChunkCount = (End - Begin + Grain - 1) / Grain;
+    vector<Value> Partial(ChunkCount, Identity);
+    ParallelFor(0, ChunkCount, 1, [&](size_t First, size_t Last) {
+        for (size_t i = First; i < Last; i++) {
+            size_t ChunkBegin = Begin + i * Grain;
+            size_t ChunkEnd = End - ChunkBegin > Grain
+                ? ChunkBegin + Grain : End;
+            Partial[i] = Map(ChunkBegin, ChunkEnd);
+        }
+    });
+    Value Result = Identity;
+    for (const Value& Part : Partial) {
+        Result = Combine(Result, Part);
+    }
+    return Result;
+}
+
+#endif /* TaskScheduler.hpp */
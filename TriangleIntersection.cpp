@@ -0,0 +1,386 @@
+/*************************************************************************
+【文件名】TriangleIntersection.cpp
+【功能模块和目的】定义TriangleIntersection类的成员函数
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+// TriangleIntersection所属头文件
+#include "TriangleIntersection.hpp"
+// fabs, sqrt所属头文件
+#include <cmath>
+// swap所属头文件
+#include <utility>
+
+using namespace std;
+
+namespace {
+    /*************************************************************************
+    【函数名称】Sub
+    【函数功能】向量相减
+    【参数】const double* a, const double* b, 表示两个向量
+           double* Result, 用于存储a-b
+    【返回值】无
+    【开发者及日期】谭雯心 2026/10/19
+    【更改记录】
+    *************************************************************************/
+    void Sub(const double* a, const double* b, double* Result) {
+        Result[0] = a[0] - b[0];
+        Result[1] = a[1] - b[1];
+        Result[2] = a[2] - b[2];
+    }
+    /*************************************************************************
+    【函数名称】Cross
+    【函数功能】向量叉乘
+    【参数】const double* a, const double* b, 表示两个向量
+           double* Result, 用于存储a×b
+    【返回值】无
+    【开发者及日期】谭雯心 2026/10/19
+    【更改记录】
+    *************************************************************************/
+    void Cross(const double* a, const double* b, double* Result) {
+        Result[0] = a[1] * b[2] - a[2] * b[1];
+        Result[1] = a[2] * b[0] - a[0] * b[2];
+        Result[2] = a[0] * b[1] - a[1] * b[0];
+    }
+    /*************************************************************************
+    【函数名称】Dot
+    【函数功能】向量点乘
+    【参数】const double* a, const double* b, 表示两个向量
+    【返回值】double，a·b
+    【开发者及日期】谭雯心 2026/10/19
+    【更改记录】
+    *************************************************************************/
+    double Dot(const double* a, const double* b) {
+        return a[0] * b[0] + a[1] * b[1] + a[2] * b[2];
+    }
+    /*************************************************************************
+    【函数名称】UnitNormal
+    【函数功能】计算三角形的单位法向量
+    【参数】const double* V0, const double* V1, const double* V2, 表示顶点
+           double* Normal, 用于存储单位法向量
+    【返回值】bool，三角形是否非退化
+    【开发者及日期】谭雯心 2026/10/19
+    【更改记录】
+    *************************************************************************/
+    bool UnitNormal(const double* V0, const double* V1, const double* V2,
+                    double* Normal) {
+        double E1[3];
+        double E2[3];
+        Sub(V1, V0, E1);
+        Sub(V2, V0, E2);
+        Cross(E1, E2, Normal);
+        double Norm = sqrt(Dot(Normal, Normal));
+        if (Norm == 0) {
+            return false;
+        }
+        Normal[0] /= Norm;
+        Normal[1] /= Norm;
+        Normal[2] /= Norm;
+        return true;
+    }
+    /*************************************************************************
+    【函数名称】EdgeEdge
+    【函数功能】二维投影下，线段V0V1与线段U0U1是否相交
+    【参数】const double* V0, const double* V1, const double* U0,
+           const double* U1, 表示端点；int i0, int i1, 表示投影坐标轴
+    【返回值】bool，是否相交
+    【开发者及日期】谭雯心 2026/10/19
+    【更改记录】
+    *************************************************************************/
+    bool EdgeEdge(const double* V0, const double* V1,
+                  const double* U0, const double* U1, int i0, int i1) {
+        double Ax = V1[i0] - V0[i0];
+        double Ay = V1[i1] - V0[i1];
+        double Bx = U0[i0] - U1[i0];
+        double By = U0[i1] - U1[i1];
+        double Cx = V0[i0] - U0[i0];
+        double Cy = V0[i1] - U0[i1];
+        double f = Ay * Bx - Ax * By;
+        double d = By * Cx - Bx * Cy;
+        if ((f > 0 && d >= 0 && d <= f) || (f < 0 && d <= 0 && d >= f)) {
+            double e = Ax * Cy - Ay * Cx;
+            if (f > 0) {
+                return e >= 0 && e <= f;
+            }
+            return e <= 0 && e >= f;
+        }
+        return false;
+    }
+    /*************************************************************************
+    【函数名称】PointInTriangle
+    【函数功能】二维投影下，点P是否在三角形U0U1U2内（含边界）
+    【参数】const double* P, 表示点；const double* U0, const double* U1,
+           const double* U2, 表示三角形顶点；int i0, int i1, 表示投影坐标轴
+    【返回值】bool，是否在三角形内
+    【开发者及日期】谭雯心 2026/10/19
+    【更改记录】
+    *************************************************************************/
+    bool PointInTriangle(const double* P, const double* U0,
+                         const double* U1, const double* U2, int i0, int i1) {
+        const double* U[3] = {U0, U1, U2};
+        double Side[3];
+        for (int i = 0; i < 3; i++) {
+            const double* a = U[i];
+            const double* b = U[(i + 1) % 3];
+            Side[i] = (b[i0] - a[i0]) * (P[i1] - a[i1])
+                - (b[i1] - a[i1]) * (P[i0] - a[i0]);
+        }
+        bool HasNegative = Side[0] < 0 || Side[1] < 0 || Side[2] < 0;
+        bool HasPositive = Side[0] > 0 || Side[1] > 0 || Side[2] > 0;
+        return !(HasNegative && HasPositive);
+    }
+    /*************************************************************************
+    【函数名称】CoplanarTriangles
+    【函数功能】共面三角形的相交测试：投影到法向量最大分量以外的两个坐标轴，
+           测试边与边是否相交，以及一个三角形是否包含另一个
+    【参数】const double* N, 表示公共平面的法向量；其余为两个三角形的顶点
+    【返回值】bool，是否相交
+    【开发者及日期】谭雯心 2026/10/19
+    【更改记录】
+    *************************************************************************/
+    bool CoplanarTriangles(const double* N,
+                           const double* V0, const double* V1,
+                           const double* V2, const double* U0,
+                           const double* U1, const double* U2) {
+        double A[3] = {fabs(N[0]), fabs(N[1]), fabs(N[2])};
+        int i0;
+        int i1;
+        if (A[0] > A[1]) {
+            if (A[0] > A[2]) {
+                i0 = 1;
+                i1 = 2;
+            }
+            else {
+                i0 = 0;
+                i1 = 1;
+            }
+        }
+        else {
+            if (A[2] > A[1]) {
+                i0 = 0;
+                i1 = 1;
+            }
+            else {
+                i0 = 0;
+                i1 = 2;
+            }
+        }
+        const double* V[3] = {V0, V1, V2};
+        const double* U[3] = {U0, U1, U2};
+        for (int i = 0; i < 3; i++) {
+            for (int j = 0; j < 3; j++) {
+                if (EdgeEdge(V[i], V[(i + 1) % 3],
+                             U[j], U[(j + 1) % 3], i0, i1)) {
+                    return true;
+                }
+            }
+        }
+        return PointInTriangle(V0, U0, U1, U2, i0, i1)
+            || PointInTriangle(U0, V0, V1, V2, i0, i1);
+    }
+    /*************************************************************************
+    【函数名称】ComputeInterval
+    【函数功能】计算三角形与两平面交线上的区间（Möller无除法形式），
+           三个有向距离均为0时表示两三角形共面
+    【参数】const double* P, 表示顶点在交线方向上的投影
+           const double* D, 表示顶点到另一平面的有向距离
+           double& A, double& B, double& C, double& X0, double& X1,
+           用于存储区间端点的分子分母
+    【返回值】bool，是否共面
+    【开发者及日期】谭雯心 2026/10/19
+    【更改记录】
+    *************************************************************************/
+    bool ComputeInterval(const double* P, const double* D,
+                         double& A, double& B, double& C,
+                         double& X0, double& X1) {
+        // 选出单独位于平面一侧的顶点k，另两个顶点为k1, k2
+        int k;
+        if (D[0] * D[1] > 0) {
+            k = 2;
+        }
+        else if (D[0] * D[2] > 0) {
+            k = 1;
+        }
+        else if (D[1] * D[2] > 0 || D[0] != 0) {
+            k = 0;
+        }
+        else if (D[1] != 0) {
+            k = 1;
+        }
+        else if (D[2] != 0) {
+            k = 2;
+        }
+        else {
+            return true;
+        }
+        int k1 = (k == 0) ? 1 : 0;
+        int k2 = (k == 2) ? 1 : 2;
+        A = P[k];
+        B = (P[k1] - P[k]) * D[k];
+        C = (P[k2] - P[k]) * D[k];
+        X0 = D[k] - D[k1];
+        X1 = D[k] - D[k2];
+        return false;
+    }
+    /*************************************************************************
+    【函数名称】PlaneDistances
+    【函数功能】计算三个点到平面的有向距离，绝对值不超过容差的按0处理
+    【参数】const double* N, 表示单位法向量；const double* Origin, 表示平面上一点
+           const double* P0, const double* P1, const double* P2, 表示三个点
+           double Tolerance, 表示容差；double* D, 用于存储三个距离
+    【返回值】bool，三个点是否严格位于平面同侧
+    【开发者及日期】谭雯心 2026/10/19
+    【更改记录】
+    *************************************************************************/
+    bool PlaneDistances(const double* N, const double* Origin,
+                        const double* P0, const double* P1, const double* P2,
+                        double Tolerance, double* D) {
+        const double* P[3] = {P0, P1, P2};
+        double Offset = Dot(N, Origin);
+        for (int i = 0; i < 3; i++) {
+            D[i] = Dot(N, P[i]) - Offset;
+            if (fabs(D[i]) <= Tolerance) {
+                D[i] = 0;
+            }
+        }
+        return D[0] * D[1] > 0 && D[0] * D[2] > 0;
+    }
+}
+
+//-------------------------------------------------------------------------
+// 静态成员函数
+//-------------------------------------------------------------------------
+
+/*************************************************************************
+【函数名称】TriangleTriangle
+【函数功能】三角形V0V1V2与三角形U0U1U2是否相交（含接触）
+【参数】const double* V0, const double* V1, const double* V2, 表示第一个三角形
+       const double* U0, const double* U1, const double* U2, 表示第二个三角形
+       double Tolerance, 表示点到平面距离的容差
+【返回值】bool，是否相交
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+bool TriangleIntersection::TriangleTriangle(
+    const double* V0, const double* V1, const double* V2,
+    const double* U0, const double* U1, const double* U2,
+    double Tolerance) {
+    double N1[3];
+    double N2[3];
+    if (!UnitNormal(V0, V1, V2, N1) || !UnitNormal(U0, U1, U2, N2)) {
+        return false;
+    }
+    // U的三个顶点都在V所在平面同侧时不相交
+    double DU[3];
+    if (PlaneDistances(N1, V0, U0, U1, U2, Tolerance, DU)) {
+        return false;
+    }
+    // V的三个顶点都在U所在平面同侧时不相交
+    double DV[3];
+    if (PlaneDistances(N2, U0, V0, V1, V2, Tolerance, DV)) {
+        return false;
+    }
+    // 交线方向，取其绝对值最大的分量作为投影坐标
+    double D[3];
+    Cross(N1, N2, D);
+    int Axis = 0;
+    double Max = fabs(D[0]);
+    if (fabs(D[1]) > Max) {
+        Max = fabs(D[1]);
+        Axis = 1;
+    }
+    if (fabs(D[2]) > Max) {
+        Axis = 2;
+    }
+    double VP[3] = {V0[Axis], V1[Axis], V2[Axis]};
+    double UP[3] = {U0[Axis], U1[Axis], U2[Axis]};
+    double a, b, c, x0, x1;
+    if (ComputeInterval(VP, DV, a, b, c, x0, x1)) {
+        return CoplanarTriangles(N1, V0, V1, V2, U0, U1, U2);
+    }
+    double d, e, f, y0, y1;
+    if (ComputeInterval(UP, DU, d, e, f, y0, y1)) {
+        return CoplanarTriangles(N1, V0, V1, V2, U0, U1, U2);
+    }
+    // 比较两个区间是否重叠
+    double xx = x0 * x1;
+    double yy = y0 * y1;
+    double xxyy = xx * yy;
+    double Temp = a * xxyy;
+    double I1[2] = {Temp + b * x1 * yy, Temp + c * x0 * yy};
+    Temp = d * xxyy;
+    double I2[2] = {Temp + e * xx * y1, Temp + f * xx * y0};
+    if (I1[0] > I1[1]) {
+        swap(I1[0], I1[1]);
+    }
+    if (I2[0] > I2[1]) {
+        swap(I2[0], I2[1]);
+    }
+    if (I1[1] < I2[0] || I2[1] < I1[0]) {
+        return false;
+    }
+    // 两平面接近平行时交线的位置是病态的，区间重叠可能是误判。
+    // 不共面的两个三角形相交时，交线段的端点必在某个三角形的边上，
+    // 因此用六条边与另一三角形的相交测试加以确认
+    const double* V[3] = {V0, V1, V2};
+    const double* U[3] = {U0, U1, U2};
+    for (int i = 0; i < 3; i++) {
+        if (SegmentTriangle(V[i], V[(i + 1) % 3], U0, U1, U2, Tolerance)
+            || SegmentTriangle(U[i], U[(i + 1) % 3], V0, V1, V2, Tolerance)) {
+            return true;
+        }
+    }
+    return false;
+}
+/*************************************************************************
+【函数名称】SegmentTriangle
+【函数功能】线段P0P1与三角形V0V1V2是否相交（含端点接触），
+       线段与三角形平行时视为不相交
+【参数】const double* P0, const double* P1, 表示线段端点
+       const double* V0, const double* V1, const double* V2, 表示三角形
+       double Tolerance, 表示点到平面距离的容差
+【返回值】bool，是否相交
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+bool TriangleIntersection::SegmentTriangle(
+    const double* P0, const double* P1,
+    const double* V0, const double* V1, const double* V2,
+    double Tolerance) {
+    double N[3];
+    if (!UnitNormal(V0, V1, V2, N)) {
+        return false;
+    }
+    double Offset = Dot(N, V0);
+    double D0 = Dot(N, P0) - Offset;
+    double D1 = Dot(N, P1) - Offset;
+    if (fabs(D0) <= Tolerance) {
+        D0 = 0;
+    }
+    if (fabs(D1) <= Tolerance) {
+        D1 = 0;
+    }
+    if (D0 * D1 > 0 || D0 == D1) {
+        return false;
+    }
+    // 线段与平面的交点
+    double t = D0 / (D0 - D1);
+    double Hit[3] = {P0[0] + (P1[0] - P0[0]) * t,
+                     P0[1] + (P1[1] - P0[1]) * t,
+                     P0[2] + (P1[2] - P0[2]) * t};
+    // 交点是否在三角形内：与三条边构成的子三角形法向量同向
+    const double* V[3] = {V0, V1, V2};
+    for (int i = 0; i < 3; i++) {
+        double Edge[3];
+        double ToHit[3];
+        double Normal[3];
+        Sub(V[(i + 1) % 3], V[i], Edge);
+        Sub(Hit, V[i], ToHit);
+        Cross(Edge, ToHit, Normal);
+        // 交点到该边所在直线的有向距离乘以边长
+        if (Dot(Normal, N) < -Tolerance * sqrt(Dot(Edge, Edge))) {
+            return false;
+        }
+    }
+    return true;
+}
@@ -0,0 +1,44 @@
+/*************************************************************************
+【文件名】TriangleIntersection.hpp
+【功能模块和目的】定义TriangleIntersection类，提供三角形与三角形、
+    线段与三角形的相交测试
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+#ifndef TRIANGLEINTERSECTION_HPP
+#define TRIANGLEINTERSECTION_HPP
+
+using namespace std;
+
+/*************************************************************************
+【类名】TriangleIntersection
+【功能】相交测试的静态函数集合。三角形与三角形采用Möller的区间重叠算法
+       （无除法版本）筛选，区间重叠时再用边与三角形的相交测试确认，
+       以避免两平面接近平行时的误判；共面时退化为二维边-边相交和
+       点在三角形内测试；
+       点到平面的有向距离在Tolerance以内视为0，以稳定处理接触和共面情形。
+       坐标以double[3]给出，退化三角形（法向量为0）不与任何三角形相交
+【接口说明】
+    三角形与三角形是否相交（含接触）
+    线段与三角形是否相交（含端点接触）
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+class TriangleIntersection {
+public:
+    //-------------------------------------------------------------------------
+    // 静态成员函数
+    //-------------------------------------------------------------------------
+    // 三角形V0V1V2与三角形U0U1U2是否相交
+    static bool TriangleTriangle(
+        const double* V0, const double* V1, const double* V2,
+        const double* U0, const double* U1, const double* U2,
+        double Tolerance);
+    // 线段P0P1与三角形V0V1V2是否相交
+    static bool SegmentTriangle(
+        const double* P0, const double* P1,
+        const double* V0, const double* V1, const double* V2,
+        double Tolerance);
+};
+
+#endif /* TriangleIntersection.hpp */
@@ -0,0 +1,229 @@
+/*************************************************************************
+【文件名】VertexStore.cpp
+【功能模块和目的】定义VertexStore类的成员函数
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+// VertexStore所属头文件
+#include "VertexStore.hpp"
+// tmpfile, fseek, fread, fwrite, fclose所属头文件
+#include <cstdio>
+// numeric_limits所属头文件
+#include <limits>
+// max所属头文件
+#include <algorithm>
+// vector所属头文件
+#include <vector>
+// size_t所属头文件
+#include <cstddef>
+
+using namespace std;
+
+namespace {
+
+// 不在内存中的页的位置
+constexpr size_t NOT_RESIDENT{numeric_limits<size_t>::max()};
+
+} // namespace
+
+//-------------------------------------------------------------------------
+// 内嵌异常类
+//-------------------------------------------------------------------------
+
+/*************************************************************************
+【函数名称】VERTEX_NOT_FOUND
+【函数功能】构造函数，用于初始化VERTEX_NOT_FOUND异常类
+【参数】无
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+VertexStore::VERTEX_NOT_FOUND::VERTEX_NOT_FOUND()
+    : out_of_range("Vertex index out of range") {
+}
+/*************************************************************************
+【函数名称】SPILL_FAILED
+【函数功能】构造函数，用于初始化SPILL_FAILED异常类
+【参数】无
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+VertexStore::SPILL_FAILED::SPILL_FAILED()
+    : runtime_error("Vertex spill file not available") {
+}
+
+//-------------------------------------------------------------------------
+// 必要的构造、析构、拷贝、赋值运算符重载函数
+//-------------------------------------------------------------------------
+
+/*************************************************************************
+【函数名称】VertexStore
+【函数功能】带参构造函数
+【参数】size_t ResidentPages, 表示内存中最多保留的页数（至少为1）
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+VertexStore::VertexStore(size_t ResidentPages)
+    : m_ResidentPages(max<size_t>(ResidentPages, 1)) {
+}
+/*************************************************************************
+【函数名称】~VertexStore
+【函数功能】虚析构函数，关闭临时文件（tmpfile创建的文件关闭时自动删除）
+【参数】无
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+VertexStore::~VertexStore() {
+    if (m_pSpillFile != nullptr) {
+        fclose(m_pSpillFile);
+    }
+}
+
+//-------------------------------------------------------------------------
+// 非静态Setter成员函数
+//-------------------------------------------------------------------------
+
+/*************************************************************************
+【函数名称】Add
+【函数功能】追加顶点
+【参数】double x, double y, double z, 表示顶点坐标
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+void VertexStore::Add(double x, double y, double z) {
+    size_t PageNumber = m_Count / PAGE_VERTEX_COUNT;
+    if (PageNumber == m_PageSlots.size()) {
+        m_PageSlots.push_back(NOT_RESIDENT);
+        m_PageOnDisk.push_back(false);
+    }
+    Page& APage = Fetch(PageNumber);
+    APage.Data.push_back(x);
+    APage.Data.push_back(y);
+    APage.Data.push_back(z);
+    APage.Dirty = true;
+    m_Count++;
+}
+/*************************************************************************
+【函数名称】Get
+【函数功能】获取指定顶点的坐标
+【参数】size_t VertexIndex, 表示顶点索引
+       double Coordinates[3], 用于存储坐标
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+void VertexStore::Get(size_t VertexIndex, double Coordinates[3]) {
+    if (VertexIndex >= m_Count) {
+        throw VERTEX_NOT_FOUND();
+    }
+    const Page& APage = Fetch(VertexIndex / PAGE_VERTEX_COUNT);
+    const double* Source = &APage.Data[(VertexIndex % PAGE_VERTEX_COUNT) * 3];
+    Coordinates[0] = Source[0];
+    Coordinates[1] = Source[1];
+    Coordinates[2] = Source[2];
+}
+
+//-------------------------------------------------------------------------
+// 非静态Getter成员函数
+//-------------------------------------------------------------------------
+
+/*************************************************************************
+【函数名称】GetCount
+【函数功能】获取顶点数量
+【参数】无
+【返回值】size_t，顶点数量
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+size_t VertexStore::GetCount() const {
+    return m_Count;
+}
+
+//-------------------------------------------------------------------------
+// 私有非静态成员函数
+//-------------------------------------------------------------------------
+
+/*************************************************************************
+【函数名称】Fetch
+【函数功能】获取指定页。页不在内存中时，若内存中的页数已达上限，
+       换出最久未使用的页，再从临时文件读入（新页则为空）
+【参数】size_t PageNumber, 表示页号
+【返回值】Page&，该页
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+VertexStore::Page& VertexStore::Fetch(size_t PageNumber) {
+    size_t Slot = m_PageSlots[PageNumber];
+    if (Slot != NOT_RESIDENT) {
+        m_Pages[Slot].LastUse = ++m_Clock;
+        return m_Pages[Slot];
+    }
+    if (m_Pages.size() < m_ResidentPages) {
+        Slot = m_Pages.size();
+        m_Pages.push_back(Page{PageNumber, vector<double>(), false, 0});
+        m_Pages[Slot].Data.reserve(PAGE_VERTEX_COUNT * 3);
+    }
+    else {
+        // 换出最久未使用的页
+        Slot = 0;
+        for (size_t i = 1; i < m_Pages.size(); i++) {
+            if (m_Pages[i].LastUse < m_Pages[Slot].LastUse) {
+                Slot = i;
+            }
+        }
+        WriteBack(m_Pages[Slot]);
+        m_PageSlots[m_Pages[Slot].Number] = NOT_RESIDENT;
+        m_Pages[Slot].Number = PageNumber;
+        m_Pages[Slot].Data.clear();
+        m_Pages[Slot].Dirty = false;
+    }
+    Page& APage = m_Pages[Slot];
+    m_PageSlots[PageNumber] = Slot;
+    APage.LastUse = ++m_Clock;
+    if (m_PageOnDisk[PageNumber]) {
+        // 页中的顶点数由顶点总数推出，只有最后一页可能不满
+        size_t VertexCount = min(PAGE_VERTEX_COUNT,
+            m_Count - PageNumber * PAGE_VERTEX_COUNT);
+        APage.Data.resize(VertexCount * 3);
+        long Offset = static_cast<long>(
+            PageNumber * PAGE_VERTEX_COUNT * 3 * sizeof(double));
+        if (fseek(m_pSpillFile, Offset, SEEK_SET) != 0
+            || fread(APage.Data.data(), sizeof(double), APage.Data.size(),
+                m_pSpillFile) != APage.Data.size()) {
+            throw SPILL_FAILED();
+        }
+    }
+    return APage;
+}
+/*************************************************************************
+【函数名称】WriteBack
+【函数功能】将被修改过的页写回临时文件
+【参数】Page& APage, 表示要写回的页
+【返回值】无
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+void VertexStore::WriteBack(Page& APage) {
+    if (!APage.Dirty) {
+        return;
+    }
+    if (m_pSpillFile == nullptr) {
+        m_pSpillFile = tmpfile();
+        if (m_pSpillFile == nullptr) {
+            throw SPILL_FAILED();
+        }
+    }
+    long Offset = static_cast<long>(
+        APage.Number * PAGE_VERTEX_COUNT * 3 * sizeof(double));
+    if (fseek(m_pSpillFile, Offset, SEEK_SET) != 0
+        || fwrite(APage.Data.data(), sizeof(double), APage.Data.size(),
+            m_pSpillFile) != APage.Data.size()) {
+        throw SPILL_FAILED();
+    }
+    m_PageOnDisk[APage.Number] = true;
+    APage.Dirty = false;
+}
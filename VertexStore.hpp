@@ -0,0 +1,124 @@
+/*************************************************************************
+【文件名】VertexStore.hpp
+【功能模块和目的】定义VertexStore类，内存占用有上限的顶点坐标数组
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+#ifndef VERTEXSTORE_HPP
+#define VERTEXSTORE_HPP
+
+// FILE所属头文件
+#include <cstdio>
+// out_of_range, runtime_error所属头文件
+#include <stdexcept>
+// vector所属头文件
+#include <vector>
+// size_t所属头文件
+#include <cstddef>
+
+using namespace std;
+
+/*************************************************************************
+【类名】VertexStore
+【功能】按页存放顶点坐标，内存中最多保留指定数量的页，其余页换出到临时文件，
+       按最近最少使用原则换入换出。流式导入时面所引用的顶点通常集中在附近，
+       因此绝大多数访问命中内存中的页
+【接口说明】
+    带参构造函数（内存中最多保留的页数）
+    禁止拷贝构造函数
+    禁止赋值运算符
+    虚析构函数（关闭并删除临时文件）
+    追加顶点
+    获取指定顶点的坐标
+    获取顶点数量
+【开发者及日期】谭雯心 2026/10/19
+【更改记录】
+*************************************************************************/
+class VertexStore {
+public:
+    //-------------------------------------------------------------------------
+    // 内嵌异常类
+    //-------------------------------------------------------------------------
+    // 顶点索引超出范围类异常
+    class VERTEX_NOT_FOUND : public out_of_range {
+    public:
+        VERTEX_NOT_FOUND();
+    };
+    // 临时文件读写失败类异常
+    class SPILL_FAILED : public runtime_error {
+    public:
+        SPILL_FAILED();
+    };
+    //-------------------------------------------------------------------------
+    // 静态常量
+    //-------------------------------------------------------------------------
+    // 每页的顶点数
+    static constexpr size_t PAGE_VERTEX_COUNT{1 << 16};
+    // 默认在内存中最多保留的页数（约96MB）
+    static constexpr size_t DEFAULT_RESIDENT_PAGES{64};
+    //-------------------------------------------------------------------------
+    // 必要的构造、析构、拷贝、赋值运算符重载函数
+    //-------------------------------------------------------------------------
+    // 带参构造函数
+    explicit VertexStore(size_t ResidentPages = DEFAULT_RESIDENT_PAGES);
+    // 禁止拷贝构造函数
+    VertexStore(const VertexStore& Source) = delete;
+    // 禁止赋值运算符
+    VertexStore& operator=(const VertexStore& Source) = delete;
+    // 虚析构函数
+    virtual ~VertexStore();
+    //-------------------------------------------------------------------------
+    // 非静态Setter成员函数
+    //-------------------------------------------------------------------------
+    // 追加顶点
+    void Add(double x, double y, double z);
+    // 获取指定顶点的坐标（可能换入页，因此不是const）
+    void Get(size_t VertexIndex, double Coordinates[3]);
+    //-------------------------------------------------------------------------
+    // 非静态Getter成员函数
+    //-------------------------------------------------------------------------
+    // 获取顶点数量
+    size_t GetCount() const;
+
+private:
+    //-------------------------------------------------------------------------
+    // 私有内嵌类型
+    //-------------------------------------------------------------------------
+    // 内存中的一页
+    struct Page {
+        // 页号
+        size_t Number;
+        // 坐标
+        vector<double> Data;
+        // 是否被修改过（需要写回临时文件）
+        bool Dirty;
+        // 最近一次使用的时刻
+        size_t LastUse;
+    };
+    //-------------------------------------------------------------------------
+    // 私有非静态成员函数
+    //-------------------------------------------------------------------------
+    // 获取指定页，必要时换出最久未使用的页并从临时文件读入
+    Page& Fetch(size_t PageNumber);
+    // 将页写回临时文件
+    void WriteBack(Page& APage);
+    //-------------------------------------------------------------------------
+    // 私有非静态成员
+    //-------------------------------------------------------------------------
+    // 内存中最多保留的页数
+    size_t m_ResidentPages;
+    // 内存中的页
+    vector<Page> m_Pages{};
+    // 页号到m_Pages中位置的映射，不在内存中时为无效值
+    vector<size_t> m_PageSlots{};
+    // 页是否已写入临时文件
+    vector<bool> m_PageOnDisk{};
+    // 临时文件，首次换出时创建
+    FILE* m_pSpillFile{nullptr};
+    // 顶点数量
+    size_t m_Count{0};
+    // 访问计数，用作最近使用的时刻
+    size_t m_Clock{0};
+};
+
+#endif /* VertexStore.hpp */
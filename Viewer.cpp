@@ -2,7 +2,7 @@
 【文件名】Viewer.cpp
 【功能模块和目的】定义Viewer类的成员函数
 【开发者及日期】谭雯心 2024/8/10
-【更改记录】
+【更改记录】2026/10/19 谭雯心 改为通过GetModelCount获取模型数量
 *************************************************************************/
 // 包含Viewer.hpp头文件
 #include "Viewer.hpp"
@@ -121,6 +121,7 @@ string Viewer::MainMenu() {
 【返回值】string
 【开发者及日期】谭雯心 2024/8/10
 【更改记录】2024/8/12 谭雯心 修改了键入q或Q时返回主菜单的逻辑
+           2026/10/19 谭雯心 改为通过GetModelCount获取模型数量
 *************************************************************************/
 string Viewer::SelectModelMenu() {
     // 获取Controller类的唯一实例
@@ -130,13 +131,13 @@ string Viewer::SelectModelMenu() {
     while (Selection != "Y" && Selection != "y") {
         cout << "----------SELECT MODEL----------" << endl;
         // 如果Controller类中没有模型，提示用户先创建模型
-        if (pController->Models.size() == 0) {
+        if (pController->GetModelCount() == 0) {
             cout << "No model can be selected, "
                 << "please create a model first!" << endl;
             return "";
         }
         cout << "Please input the selected model index(enter q to quit): (0-"
-            << pController->Models.size() - 1 << "): ";
+            << pController->GetModelCount() - 1 << "): ";
         string Index;
         cin >> Index;
         if (Index == "q" || Index == "Q") {
@@ -324,6 +325,7 @@ string Viewer::SaveModelMenu() {
 【返回值】string
 【开发者及日期】谭雯心 2024/8/10
 【更改记录】2024/8/12 谭雯心 修改了键入q或Q时返回主菜单的逻辑
+           2026/10/19 谭雯心 改为通过GetModelCount获取模型数量
 *************************************************************************/
 string Viewer::RemoveModelMenu() {
     // 获取Controller类的唯一实例
@@ -333,14 +335,14 @@ string Viewer::RemoveModelMenu() {
     while (Selection != "N" && Selection != "n") {
         cout << "----------REMOVE MODEL----------" << endl;
         // 如果Controller类中没有模型，提示用户先创建模型
-        if (pController->Models.size() == 0) {
+        if (pController->GetModelCount() == 0) {
             cout << "No model can be removed, " 
                 << "please create a model first!" << endl;
             return "";
         }
         // 让用户选择删除的模型的索引
         cout << "Please input the removed model index(enter q to quit): (0-"
-            << pController->Models.size() - 1 << "): ";
+            << pController->GetModelCount() - 1 << "): ";
         string Index;
         cin >> Index;
         if (Index == "q" || Index == "Q") {
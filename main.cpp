@@ -2,15 +2,28 @@
 【文件名】main.cpp
 【功能模块和目的】主函数，用于测试类的功能
 【开发者及日期】谭雯心 2024/8/10
-【更改记录】
+【更改记录】2026/10/19 谭雯心 带参数运行时进入命令行批处理模式
 *************************************************************************/
 #include "Viewer.hpp"
+// CommandLine所属头文件
+#include "CommandLine.hpp"
+// vector所属头文件
+#include <vector>
+// string所属头文件
+#include <string>
+// cout、cerr所属头文件
+#include <iostream>
 
 using namespace std;
 
-int main() {
+int main(int argc, char* argv[]) {
+    // 带参数时执行一条批处理命令，以命令的结果作为退出码
+    if (argc > 1) {
+        ios::sync_with_stdio(false);
+        CommandLine Cli(cout, cerr);
+        return Cli.Run(vector<string>(argv + 1, argv + argc));
+    }
     // 创建一个Viewer对象, 进入主菜单
     Viewer viewer;
     return 0;
 }
-